@@ -1,18 +1,81 @@
 #version 450
 
+layout(binding = 0) uniform UniformBufferObject {
+    mat4 view;
+    mat4 proj;
+    vec4 clusterParameters;  // scale and bias of the depth slices, viewport size
+    mat4 shadowViewProjections[4];
+    vec4 shadowSplits;  // the view depth each cascade ends at
+    vec4 lightDirection;  // towards the directional light
+} ubo;
+
 // Updated bindings
 layout(binding = 1) uniform sampler2D baseColorSampler;
 layout(binding = 2) uniform sampler2D normalSampler;
 layout(binding = 3) uniform sampler2D roughnessSampler;
 
+// the point lights binned into clusters by light_cluster.comp, see VulkanClusteredLighting.hxx
+const uint CLUSTER_GRID_X = 16;
+const uint CLUSTER_GRID_Y = 9;
+const uint CLUSTER_GRID_Z = 24;
+const uint CLUSTER_MAX_LIGHTS_PER_CLUSTER = 128;
+
+struct Light {
+    vec4 positionRange;
+    vec4 colorIntensity;
+};
+
+layout(std430, binding = 5) readonly buffer Lights {
+    Light lights[];
+};
+
+layout(std430, binding = 6) readonly buffer ClusterCounts {
+    uint clusterCounts[];
+};
+
+layout(std430, binding = 7) readonly buffer ClusterIndices {
+    uint clusterIndices[];
+};
+
+// the cascades of the directional light, see VulkanShadowCascades.hxx
+const uint SHADOW_CASCADE_COUNT = 4;
+
+layout(binding = 8) uniform sampler2DArrayShadow shadowMap;
+
 // Updated inputs from vertex shader
 layout(location = 0) in vec3 fragColor; // Unused, but passed
 layout(location = 1) in vec3 fragNormal; // World space normal from VS
 layout(location = 2) in vec2 fragTexCoord;
 layout(location = 3) in vec3 fragTangent; // World space tangent from VS
+layout(location = 4) in vec3 fragPosition;
+layout(location = 5) in float fragViewDepth;
 
 layout(location = 0) out vec4 outColor;
 
+// the lit fraction of the fragment, a 3x3 kernel on top of the bilinear comparison of the sampler
+float sampleShadow(vec3 position, float viewDepth) {
+    uint cascade = 0;
+    while (cascade < SHADOW_CASCADE_COUNT - 1 && viewDepth > ubo.shadowSplits[cascade]) {
+        cascade++;
+    }
+
+    vec4 shadowPosition = ubo.shadowViewProjections[cascade] * vec4(position, 1.0);
+    vec3 coords = shadowPosition.xyz / shadowPosition.w;
+    if (coords.z >= 1.0) {
+        return 1.0;
+    }
+
+    vec2 uv = coords.xy * 0.5 + 0.5;
+    vec2 texelSize = 1.0 / vec2(textureSize(shadowMap, 0).xy);
+    float lit = 0.0;
+    for (int y = -1; y <= 1; y++) {
+        for (int x = -1; x <= 1; x++) {
+            lit += texture(shadowMap, vec4(uv + vec2(x, y) * texelSize, float(cascade), coords.z));
+        }
+    }
+    return lit / 9.0;
+}
+
 void main() {
     // Calculate TBN matrix
     vec3 N = normalize(fragNormal); // World space normal
@@ -30,9 +93,27 @@ void main() {
     float roughness = texture(roughnessSampler, fragTexCoord).r; // Assuming roughness in R channel
 
     // Simple diffuse lighting using the world normal from the normal map
-    vec3 lightDir = normalize(vec3(1.0, 1.0, 1.0)); // Example light direction
-    float diff = max(dot(worldNormal, lightDir), 0.0);
+    vec3 lightDir = ubo.lightDirection.xyz;
+    float diff = max(dot(worldNormal, lightDir), 0.0) * sampleShadow(fragPosition, fragViewDepth);
     vec3 diffuse = diff * vec3(1.0, 1.0, 1.0); // Light color = white
+
+    // only the point lights of the cluster of the fragment are visited
+    uvec2 tile = min(uvec2(gl_FragCoord.xy / ubo.clusterParameters.zw * vec2(CLUSTER_GRID_X, CLUSTER_GRID_Y)), uvec2(CLUSTER_GRID_X - 1, CLUSTER_GRID_Y - 1));
+    uint slice = uint(clamp(log(max(fragViewDepth, 1.0e-4)) * ubo.clusterParameters.x + ubo.clusterParameters.y, 0.0, float(CLUSTER_GRID_Z - 1)));
+    uint cluster = tile.x + (tile.y * CLUSTER_GRID_X) + (slice * CLUSTER_GRID_X * CLUSTER_GRID_Y);
+    uint lightCount = min(clusterCounts[cluster], CLUSTER_MAX_LIGHTS_PER_CLUSTER);
+    vec3 pointLights = vec3(0.0);
+    for (uint i = 0; i < lightCount; i++) {
+        Light light = lights[clusterIndices[cluster * CLUSTER_MAX_LIGHTS_PER_CLUSTER + i]];
+        vec3 toLight = light.positionRange.xyz - fragPosition;
+        float distanceSquared = dot(toLight, toLight);
+        // the inverse square falloff is windowed to reach zero at the range of the light
+        float ratio = distanceSquared / (light.positionRange.w * light.positionRange.w);
+        float window = clamp(1.0 - ratio * ratio, 0.0, 1.0);
+        float attenuation = window * window / max(distanceSquared, 1.0e-4);
+        pointLights += max(dot(worldNormal, toLight * inversesqrt(max(distanceSquared, 1.0e-8))), 0.0) * attenuation * light.colorIntensity.rgb * light.colorIntensity.a;
+    }
+    diffuse += pointLights;
     
     // Combine (using original simple lighting for now, ignoring roughness)
     vec3 finalColor = (diffuse * 0.5 + 0.5) * baseColor.rgb;
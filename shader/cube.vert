@@ -1,11 +1,25 @@
 #version 450
 
 layout(binding = 0) uniform UniformBufferObject {
-    mat4 model;
     mat4 view;
     mat4 proj;
 } ubo;
 
+// the draws are indirect, the first instance of a draw is the index of its instance
+struct Instance {
+    mat4 model;
+    vec4 boundsMin;
+    vec4 boundsMax;
+    uint firstIndex;
+    uint indexCount;
+    int vertexOffset;
+    uint padding;
+};
+
+layout(std430, binding = 4) readonly buffer Instances {
+    Instance instances[];
+};
+
 layout(location = 0) in vec3 inPosition;
 layout(location = 1) in vec3 inColor;
 layout(location = 2) in vec3 inNormal;
@@ -16,12 +30,19 @@ layout(location = 0) out vec3 fragColor;
 layout(location = 1) out vec3 fragNormal;
 layout(location = 2) out vec2 fragTexCoord;
 layout(location = 3) out vec3 fragTangent;
+layout(location = 4) out vec3 fragPosition;  // world space, for the lights
+layout(location = 5) out float fragViewDepth;  // selects the depth slice of the light clusters
 
 void main() {
-    gl_Position = ubo.proj * ubo.view * ubo.model * vec4(inPosition, 1.0);
+    mat4 model = instances[gl_InstanceIndex].model;
+    vec4 worldPosition = model * vec4(inPosition, 1.0);
+    vec4 viewPosition = ubo.view * worldPosition;
+    gl_Position = ubo.proj * viewPosition;
+    fragPosition = worldPosition.xyz;
+    fragViewDepth = -viewPosition.z;
     fragColor = inColor;
     
-    mat3 normalMatrix = mat3(ubo.model); 
+    mat3 normalMatrix = mat3(model); 
     fragNormal = normalize(normalMatrix * inNormal);
     fragTangent = normalize(normalMatrix * inTangent);
     
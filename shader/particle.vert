@@ -0,0 +1,36 @@
+#version 450
+
+// expands every particle into a camera facing quad of two triangles, there are no vertex buffers
+struct Particle {
+    vec3 position;
+    float life;  // the remaining seconds
+    vec3 velocity;
+    uint color;
+};
+
+layout(std430, binding = 0) readonly buffer Particles {
+    Particle particles[];
+};
+
+layout(push_constant) uniform DrawPushConstants {
+    mat4 viewProjection;
+    vec4 right;  // the camera axes in world space, scaled by the size of a particle
+    vec4 up;
+} pc;
+
+layout(location = 0) out vec2 fragCorner;
+layout(location = 1) out vec4 fragColor;
+
+const vec2 CORNERS[6] = vec2[](vec2(-1.0, -1.0), vec2(1.0, -1.0), vec2(1.0, 1.0), vec2(-1.0, -1.0), vec2(1.0, 1.0), vec2(-1.0, 1.0));
+
+void main() {
+    Particle particle = particles[gl_VertexIndex / 6];
+    vec2 corner = CORNERS[gl_VertexIndex % 6];
+
+    vec3 position = particle.position + pc.right.xyz * corner.x + pc.up.xyz * corner.y;
+    gl_Position = pc.viewProjection * vec4(position, 1.0);
+
+    // the particles fade out during their last second
+    fragCorner = corner;
+    fragColor = unpackUnorm4x8(particle.color) * clamp(particle.life, 0.0, 1.0);
+}
@@ -0,0 +1,13 @@
+#version 450
+
+// the atlas page of the run
+layout(binding = 0) uniform sampler2D page;
+
+layout(location = 0) in vec2 fragUv;
+layout(location = 1) in vec4 fragColor;
+
+layout(location = 0) out vec4 outColor;
+
+void main() {
+    outColor = texture(page, fragUv) * fragColor;
+}
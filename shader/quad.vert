@@ -0,0 +1,20 @@
+#version 450
+
+// a corner of an overlay quad, see VulkanQuadRenderer
+layout(push_constant) uniform QuadPushConstants {
+    vec2 inverseExtent;  // maps window pixels to [0, 1]
+} pc;
+
+layout(location = 0) in vec2 inPosition;  // in window pixels, the origin is the top left corner
+layout(location = 1) in vec2 inUv;
+layout(location = 2) in vec4 inColor;
+
+layout(location = 0) out vec2 fragUv;
+layout(location = 1) out vec4 fragColor;
+
+void main() {
+    // the y axis of the clip space points down like the one of the window
+    gl_Position = vec4(inPosition * pc.inverseExtent * 2.0 - 1.0, 0.0, 1.0);
+    fragUv = inUv;
+    fragColor = inColor;
+}
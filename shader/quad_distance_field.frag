@@ -0,0 +1,17 @@
+#version 450
+
+// the atlas page of the run, its alpha is the distance to the outline of a glyph (see Font)
+layout(binding = 0) uniform sampler2D page;
+
+layout(location = 0) in vec2 fragUv;
+layout(location = 1) in vec4 fragColor;
+
+layout(location = 0) out vec4 outColor;
+
+void main() {
+    // the outline lies at 0.5, the edge is smoothed over about one pixel of the screen whatever the size of the glyph
+    float distance = texture(page, fragUv).a;
+    float width = max(fwidth(distance), 1e-4);
+    float coverage = smoothstep(0.5 - width, 0.5 + width, distance);
+    outColor = vec4(fragColor.rgb, fragColor.a * coverage);
+}
@@ -0,0 +1,27 @@
+#version 450
+
+// the light matrix of the cascade, see VulkanShadowCascades
+layout(push_constant) uniform PushConstants {
+    mat4 viewProjection;
+} cascade;
+
+// the first instance of a draw is the index of its caster
+struct Instance {
+    mat4 model;
+    vec4 boundsMin;
+    vec4 boundsMax;
+    uint firstIndex;
+    uint indexCount;
+    int vertexOffset;
+    uint padding;
+};
+
+layout(std430, binding = 0) readonly buffer Casters {
+    Instance casters[];
+};
+
+layout(location = 0) in vec3 inPosition;
+
+void main() {
+    gl_Position = cascade.viewProjection * casters[gl_InstanceIndex].model * vec4(inPosition, 1.0);
+}
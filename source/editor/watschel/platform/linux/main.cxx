@@ -1,11 +1,45 @@
 // Copyright (c) 2025 by Tim Janke. All rights reserved.
 
 #include <Adelie.hxx>
+#include <iostream>
+#include <span>
+#include <string_view>
 
+using adelie::core::InputSystem;
 using adelie::core::renderer::Renderer;
 using adelie::core::renderer::WindowFactory;
+using adelie::exception::RuntimeException;
+
+namespace {
+
+    constexpr std::string_view USAGE = "usage: watschel [--record-input <file> | --replay-input <file>]";
+
+} /* namespace */
+
+auto main(int argc, char** argv) -> int {
+    // --record-input <file> records the input of the session, --replay-input <file> plays it back
+    const std::span arguments(argv, static_cast<std::size_t>(argc));
+    for (std::size_t i = 1; i < arguments.size(); i++) {
+        const std::string_view argument = arguments[i];
+        if ((argument != "--record-input" && argument != "--replay-input") || i + 1 == arguments.size()) {
+            std::cerr << USAGE << std::endl;
+            return 1;
+        }
+
+        // the recording or replay file may not be accessible
+        try {
+            if (argument == "--record-input") {
+                InputSystem::getInstance()->startRecording(arguments[++i]);
+            } else {
+                InputSystem::getInstance()->startReplay(arguments[++i]);
+            }
+        } catch (const RuntimeException& exception) {
+            std::cerr << exception.getMessage() << std::endl;
+            std::cerr << USAGE << std::endl;
+            return 1;
+        }
+    }
 
-auto main(int /*unused*/, char** /*unused*/) -> int {
     auto window = WindowFactory::createWindow();
     window->createWindow(1920, 1080, "Watschel");
 
@@ -6,10 +6,16 @@
 // this is the client header file for the Adélie engine. This should
 // *only* be included in clients and not the engine itself!
 
+    #include <adelie/core/InputSystem.hxx>
     #include <adelie/core/renderer/Renderer.hxx>
     #include <adelie/core/renderer/WindowFactory.hxx>
+    #include <adelie/core/scene/Components.hxx>
     #include <adelie/exception/RuntimeException.hxx>
     #include <adelie/exception/VulkanRuntimeException.hxx>
+    #include <adelie/io/AssetPack.hxx>
+    #include <adelie/io/AssetPackMount.hxx>
+    #include <adelie/io/DirectoryMount.hxx>
     #include <adelie/io/Logger.hxx>
+    #include <adelie/io/VirtualFileSystem.hxx>
 
 #endif /* if !defined( __ADELIE_HXX__ ) */
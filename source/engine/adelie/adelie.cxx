@@ -1,4 +1,7 @@
 // Copyright (c) 2025 by Tim Janke. All rights reserved.
 
 #define STB_IMAGE_IMPLEMENTATION
-#include <stb/stb_image.h>
\ No newline at end of file
+#include <stb/stb_image.h>
+
+#define STB_TRUETYPE_IMPLEMENTATION
+#include <stb/stb_truetype.h>
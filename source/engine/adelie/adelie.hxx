@@ -3,7 +3,8 @@
 #if !defined(__ADELIE_INTERNAL_HXX__)
     #define __ADELIE_INTERNAL_HXX__
 
-    #include <stb/stb_image.h>  // loading images from disk / memory
+    #include <stb/stb_image.h>      // loading images from disk / memory
+    #include <stb/stb_truetype.h>  // rasterizing the glyphs of TrueType fonts
 
     #include <glm/glm.hpp>  // all math-related stuff e.g., glm::vec3, glm::mat4x4
     #include <memory>       // std::unique_ptr, std::shared_ptr
@@ -0,0 +1,25 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#include <adelie/core/FrameClock.hxx>
+
+using adelie::core::FrameClock;
+
+FrameClock::FrameClock() {
+    mLastTick = std::chrono::steady_clock::now();
+    mDeltaTime = 0.0F;
+    mTime = 0.0;
+    mFrameNumber = 0;
+}
+
+auto FrameClock::tick() -> void {
+    const auto now = std::chrono::steady_clock::now();
+    const std::chrono::duration<float> deltaTime = now - mLastTick;
+    mLastTick = now;
+    advance(deltaTime.count());
+}
+
+auto FrameClock::advance(const float deltaTime) -> void {
+    mDeltaTime = deltaTime;
+    mTime += static_cast<double>(deltaTime);
+    mFrameNumber++;
+}
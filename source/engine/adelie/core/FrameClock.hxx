@@ -0,0 +1,40 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#if !defined(__ADELIE_CORE_FRAMECLOCK_HXX__)
+    #define __ADELIE_CORE_FRAMECLOCK_HXX__
+
+    #include <adelie/adelie.hxx>
+    #include <chrono>
+    #include <cstdint>
+
+namespace adelie::core {
+
+    // the time of the simulation. It only moves forward by the delta times of the frames, so the same deltas (e.g. the
+    // ones of an input recording) always lead to the same simulation time, independent of how fast the frames run
+    class ADELIE_API FrameClock {
+        public:
+            FrameClock();
+
+            // advance by the wall clock time which passed since the previous tick
+            auto tick() -> void;
+
+            // advance by a given delta time, the wall clock is ignored
+            auto advance(float deltaTime) -> void;
+
+            [[nodiscard]] auto getDeltaTime() const -> float { return mDeltaTime; }
+
+            [[nodiscard]] auto getTime() const -> double { return mTime; }
+
+            [[nodiscard]] auto getFrameNumber() const -> uint64_t { return mFrameNumber; }
+
+        private:
+            std::chrono::time_point<std::chrono::steady_clock> mLastTick;
+            float mDeltaTime;
+            double mTime;
+            uint64_t mFrameNumber;
+
+    }; /* class FrameClock */
+
+} /* namespace adelie::core */
+
+#endif /* if !defined(__ADELIE_CORE_FRAMECLOCK_HXX__) */
@@ -0,0 +1,27 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#include <adelie/core/Input.hxx>
+#include <adelie/core/InputSystem.hxx>
+
+using adelie::core::Input;
+using adelie::core::InputSystem;
+
+auto Input::isKeyPressed(const KeyCode& keycode) -> bool {
+    return InputSystem::getInstance()->isKeyPressed(keycode);
+}
+
+auto Input::isMouseButtonPressed(const MouseButtonCode& button) -> bool {
+    return InputSystem::getInstance()->isMouseButtonPressed(button);
+}
+
+auto Input::getMouseX() -> float {
+    return InputSystem::getInstance()->getMousePosition().first;
+}
+
+auto Input::getMouseY() -> float {
+    return InputSystem::getInstance()->getMousePosition().second;
+}
+
+auto Input::getMousePosition() -> std::pair<float, float> {
+    return InputSystem::getInstance()->getMousePosition();
+}
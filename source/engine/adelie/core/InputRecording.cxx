@@ -0,0 +1,133 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#include <adelie/core/InputRecording.hxx>
+#include <adelie/exception/IOException.hxx>
+#include <cstring>
+#include <iterator>
+
+using adelie::core::InputPlayback;
+using adelie::core::InputRecord;
+using adelie::core::InputRecorder;
+using adelie::exception::IOException;
+
+namespace {
+    // the buffered records are written to the file once they exceed this size
+    constexpr std::size_t INPUT_RECORDING_BUFFER_SIZE = 64ULL * 1024ULL;
+}  // namespace
+
+InputRecorder::InputRecorder(const std::string& filename) {
+    mStream.open(filename, std::ios::binary | std::ios::trunc);
+    if (!mStream.is_open()) {
+        throw IOException("Failed to create input recording: " + filename);
+    }
+
+    mBuffer.reserve(INPUT_RECORDING_BUFFER_SIZE);
+    append(INPUT_RECORDING_MAGIC);
+    append(INPUT_RECORDING_VERSION);
+}
+
+InputRecorder::~InputRecorder() noexcept {
+    try {
+        flush();
+    } catch (...) {
+        // nothing to do here, the end of the recording is lost
+    }
+}
+
+template <typename T>
+auto InputRecorder::append(const T& value) -> void {
+    const auto* bytes = reinterpret_cast<const std::byte*>(&value);  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    mBuffer.insert(mBuffer.end(), bytes, bytes + sizeof(T));
+}
+
+auto InputRecorder::write(const InputRecord& record) -> void {
+    append(record.type);
+    switch (record.type) {
+        case InputRecordType::Frame:
+            append(record.frame.deltaTime);
+            append(record.frame.windowWidth);
+            append(record.frame.windowHeight);
+            break;
+        case InputRecordType::Key:
+        case InputRecordType::MouseButton:
+            append(record.code);
+            append(static_cast<uint8_t>(record.pressed ? 1 : 0));
+            break;
+        case InputRecordType::MousePosition:
+        case InputRecordType::Scroll:
+            append(record.x);
+            append(record.y);
+            break;
+    }
+
+    if (mBuffer.size() >= INPUT_RECORDING_BUFFER_SIZE) {
+        flush();
+    }
+}
+
+auto InputRecorder::flush() -> void {
+    mStream.write(reinterpret_cast<const char*>(mBuffer.data()), static_cast<std::streamsize>(mBuffer.size()));  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    mStream.flush();
+    mBuffer.clear();
+}
+
+InputPlayback::InputPlayback(const std::string& filename) {
+    std::ifstream stream(filename, std::ios::binary);
+    if (!stream.is_open()) {
+        throw IOException("Failed to open input recording: " + filename);
+    }
+
+    const std::vector<char> content((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+    mData.resize(content.size());
+    std::memcpy(mData.data(), content.data(), content.size());
+    mPosition = 0;
+
+    std::array<char, 4> magic{};
+    uint32_t version = 0;
+    if (!take(magic) || !take(version) || magic != INPUT_RECORDING_MAGIC || version != INPUT_RECORDING_VERSION) {
+        throw IOException("Not an input recording or an unsupported version: " + filename);
+    }
+}
+
+template <typename T>
+auto InputPlayback::take(T& value) -> bool {
+    if (mPosition + sizeof(T) > mData.size()) {
+        return false;
+    }
+    std::memcpy(&value, mData.data() + mPosition, sizeof(T));
+    mPosition += sizeof(T);
+    return true;
+}
+
+auto InputPlayback::read() -> std::optional<InputRecord> {
+    InputRecord record{};
+    if (!take(record.type)) {
+        return std::nullopt;
+    }
+
+    // a record which was cut off (e.g. the recording process crashed) ends the recording as well
+    uint8_t pressed = 0;
+    switch (record.type) {
+        case InputRecordType::Frame:
+            if (!take(record.frame.deltaTime) || !take(record.frame.windowWidth) || !take(record.frame.windowHeight)) {
+                return std::nullopt;
+            }
+            break;
+        case InputRecordType::Key:
+        case InputRecordType::MouseButton:
+            if (!take(record.code) || !take(pressed)) {
+                return std::nullopt;
+            }
+            record.pressed = (pressed != 0);
+            break;
+        case InputRecordType::MousePosition:
+        case InputRecordType::Scroll:
+            if (!take(record.x) || !take(record.y)) {
+                return std::nullopt;
+            }
+            break;
+        default:
+            return std::nullopt;
+    }
+    return record;
+}
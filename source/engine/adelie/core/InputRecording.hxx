@@ -0,0 +1,90 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#if !defined(__ADELIE_CORE_INPUTRECORDING_HXX__)
+    #define __ADELIE_CORE_INPUTRECORDING_HXX__
+
+    #include <adelie/adelie.hxx>
+    #include <array>
+    #include <cstddef>
+    #include <cstdint>
+    #include <fstream>
+    #include <optional>
+    #include <string>
+    #include <vector>
+
+// an input recording is a header followed by the records of all frames. The input records of a frame (a key, a
+// button, the pointer moved, the wheel scrolled) come first and the frame record closes it with the delta time and the
+// window size of the frame. Every record is its type (one byte) followed by its values, see InputRecorder::write()
+namespace adelie::core {
+
+    constexpr std::array<char, 4> INPUT_RECORDING_MAGIC = {'A', 'D', 'I', 'R'};
+
+    constexpr uint32_t INPUT_RECORDING_VERSION = 1;
+
+    enum class InputRecordType : uint8_t { Frame, Key, MouseButton, MousePosition, Scroll }; /* enum class InputRecordType */
+
+    struct InputFrame {
+            float deltaTime;
+            uint32_t windowWidth;
+            uint32_t windowHeight;
+    }; /* struct InputFrame */
+
+    struct InputRecord {
+            InputRecordType type;
+            uint8_t code;  // KeyCode or MouseButtonCode
+            bool pressed;
+            float x;  // pointer position or scroll offset
+            float y;
+            InputFrame frame;
+    }; /* struct InputRecord */
+
+    // writes the records into a file, they are buffered and written in larger chunks
+    class ADELIE_API InputRecorder {
+        public:
+            // throws an IOException if the file cannot be created
+            explicit InputRecorder(const std::string& filename);
+
+            ~InputRecorder() noexcept;
+
+            InputRecorder(const InputRecorder&) = delete;
+
+            auto operator=(InputRecorder const&) -> InputRecorder& = delete;
+
+            InputRecorder(InputRecorder&&) = delete;
+
+            auto operator=(InputRecorder&&) -> InputRecorder& = delete;
+
+            auto write(const InputRecord& record) -> void;
+
+        private:
+            template <typename T>
+            auto append(const T& value) -> void;
+
+            auto flush() -> void;
+
+            std::ofstream mStream;
+            std::vector<std::byte> mBuffer;
+
+    }; /* class InputRecorder */
+
+    // reads the records of a recording back, the whole file is loaded when the playback is created
+    class ADELIE_API InputPlayback {
+        public:
+            // throws an IOException if the file cannot be read or is no input recording
+            explicit InputPlayback(const std::string& filename);
+
+            // std::nullopt at the end of the recording
+            [[nodiscard]] auto read() -> std::optional<InputRecord>;
+
+        private:
+            template <typename T>
+            auto take(T& value) -> bool;
+
+            std::vector<std::byte> mData;
+            std::size_t mPosition;
+
+    }; /* class InputPlayback */
+
+} /* namespace adelie::core */
+
+#endif /* if !defined(__ADELIE_CORE_INPUTRECORDING_HXX__) */
@@ -0,0 +1,245 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#include <adelie/core/InputSystem.hxx>
+#include <adelie/core/events/EventBus.hxx>
+#include <adelie/core/events/KeyPressedEvent.hxx>
+#include <adelie/core/events/KeyReleasedEvent.hxx>
+#include <adelie/core/events/MouseButtonPressedEvent.hxx>
+#include <adelie/core/events/MouseButtonReleasedEvent.hxx>
+#include <adelie/core/events/MouseMovedEvent.hxx>
+#include <adelie/core/events/MouseScrolledEvent.hxx>
+#include <bit>
+
+using adelie::core::InputFrame;
+using adelie::core::InputPlayback;
+using adelie::core::InputRecord;
+using adelie::core::InputRecorder;
+using adelie::core::InputRecordType;
+using adelie::core::InputSystem;
+using adelie::core::events::EventBus;
+using adelie::core::events::KeyPressedEvent;
+using adelie::core::events::KeyReleasedEvent;
+using adelie::core::events::MouseButtonPressedEvent;
+using adelie::core::events::MouseButtonReleasedEvent;
+using adelie::core::events::MouseMovedEvent;
+using adelie::core::events::MouseScrolledEvent;
+
+namespace {
+    auto packPosition(const float x, const float y) -> uint64_t {
+        return static_cast<uint64_t>(std::bit_cast<uint32_t>(x)) | (static_cast<uint64_t>(std::bit_cast<uint32_t>(y)) << 32U);
+    }
+}  // namespace
+
+InputSystem::InputSystem() {
+    mState.keys.fill(0);
+    mState.buttons = 0;
+    mState.mouseX = 0.0F;
+    mState.mouseY = 0.0F;
+    mState.repeatCounts.fill(0);
+
+    for (auto& snapshot : mSnapshots) {
+        for (auto& word : snapshot.keys) {
+            word.store(0, std::memory_order_relaxed);
+        }
+        snapshot.buttons.store(0, std::memory_order_relaxed);
+        snapshot.mousePosition.store(packPosition(0.0F, 0.0F), std::memory_order_relaxed);
+    }
+    mFrontIndex = 0;
+}
+
+auto InputSystem::getInstance() -> InputSystem* {
+    static InputSystem staticInstance;
+    return &staticInstance;
+}
+
+auto InputSystem::applyKey(const KeyCode keyCode, const bool pressed) -> void {
+    const auto index = static_cast<std::size_t>(keyCode);
+    if (index >= INPUT_KEY_COUNT) {
+        return;
+    }
+
+    auto& word = mState.keys[index / 64];
+    const auto bit = uint64_t{1} << (index % 64);
+    const bool wasPressed = (word & bit) != 0;
+
+    if (pressed) {
+        // the platforms repeat the press of a key which is held down
+        mState.repeatCounts[index] = wasPressed ? mState.repeatCounts[index] + 1 : 0;
+        word |= bit;
+        EventBus::getInstance()->publish<KeyPressedEvent>(keyCode, mState.repeatCounts[index]);
+    } else if (wasPressed) {
+        word &= ~bit;
+        EventBus::getInstance()->publish<KeyReleasedEvent>(keyCode);
+    }
+}
+
+auto InputSystem::applyMouseButton(const MouseButtonCode button, const bool pressed) -> void {
+    const auto index = static_cast<uint32_t>(button);
+    if (index >= static_cast<uint32_t>(MouseButtonCode::MouseButtonUnknown)) {
+        return;
+    }
+
+    const auto bit = 1U << index;
+    const bool wasPressed = (mState.buttons & bit) != 0;
+    if (pressed && !wasPressed) {
+        mState.buttons |= bit;
+        EventBus::getInstance()->publish<MouseButtonPressedEvent>(button);
+    } else if (!pressed && wasPressed) {
+        mState.buttons &= ~bit;
+        EventBus::getInstance()->publish<MouseButtonReleasedEvent>(button);
+    }
+}
+
+auto InputSystem::applyMousePosition(const float x, const float y) -> void {
+    if (x == mState.mouseX && y == mState.mouseY) {
+        return;
+    }
+    mState.mouseX = x;
+    mState.mouseY = y;
+    EventBus::getInstance()->publish<MouseMovedEvent>(x, y);
+}
+
+auto InputSystem::applyScroll(const float xOffset, const float yOffset) -> void {
+    EventBus::getInstance()->publish<MouseScrolledEvent>(xOffset, yOffset);
+}
+
+auto InputSystem::setKey(const KeyCode keyCode, const bool pressed) -> void {
+    if (isReplaying()) {
+        return;
+    }
+    if (isRecording()) {
+        mRecorder->write({InputRecordType::Key, static_cast<uint8_t>(keyCode), pressed, 0.0F, 0.0F, {}});
+    }
+    applyKey(keyCode, pressed);
+}
+
+auto InputSystem::setMouseButton(const MouseButtonCode button, const bool pressed) -> void {
+    if (isReplaying()) {
+        return;
+    }
+    if (isRecording()) {
+        mRecorder->write({InputRecordType::MouseButton, static_cast<uint8_t>(button), pressed, 0.0F, 0.0F, {}});
+    }
+    applyMouseButton(button, pressed);
+}
+
+auto InputSystem::setMousePosition(const float x, const float y) -> void {
+    if (isReplaying() || (x == mState.mouseX && y == mState.mouseY)) {
+        return;
+    }
+    if (isRecording()) {
+        mRecorder->write({InputRecordType::MousePosition, 0, false, x, y, {}});
+    }
+    applyMousePosition(x, y);
+}
+
+auto InputSystem::addScroll(const float xOffset, const float yOffset) -> void {
+    if (isReplaying()) {
+        return;
+    }
+    if (isRecording()) {
+        mRecorder->write({InputRecordType::Scroll, 0, false, xOffset, yOffset, {}});
+    }
+    applyScroll(xOffset, yOffset);
+}
+
+auto InputSystem::releaseAll() -> void {
+    // the releases go through the setters, so they are recorded one by one
+    for (std::size_t index = 0; index < INPUT_KEY_COUNT; index++) {
+        if ((mState.keys[index / 64] & (uint64_t{1} << (index % 64))) != 0) {
+            setKey(static_cast<KeyCode>(index), false);
+        }
+    }
+    for (uint32_t index = 0; index < static_cast<uint32_t>(MouseButtonCode::MouseButtonUnknown); index++) {
+        if ((mState.buttons & (1U << index)) != 0) {
+            setMouseButton(static_cast<MouseButtonCode>(index), false);
+        }
+    }
+}
+
+auto InputSystem::publishSnapshot() -> void {
+    // the back snapshot is only read by a query which loaded the front index two frames ago and is still running
+    const auto backIndex = 1 - mFrontIndex.load(std::memory_order_relaxed);
+    auto& snapshot = mSnapshots[backIndex];
+    for (std::size_t i = 0; i < INPUT_KEY_WORDS; i++) {
+        snapshot.keys[i].store(mState.keys[i], std::memory_order_relaxed);
+    }
+    snapshot.buttons.store(mState.buttons, std::memory_order_relaxed);
+    snapshot.mousePosition.store(packPosition(mState.mouseX, mState.mouseY), std::memory_order_relaxed);
+
+    mFrontIndex.store(backIndex, std::memory_order_release);
+}
+
+auto InputSystem::isKeyPressed(const KeyCode keyCode) const noexcept -> bool {
+    const auto index = static_cast<std::size_t>(keyCode);
+    if (index >= INPUT_KEY_COUNT) {
+        return false;
+    }
+    return (getFrontSnapshot().keys[index / 64].load(std::memory_order_relaxed) & (uint64_t{1} << (index % 64))) != 0;
+}
+
+auto InputSystem::isMouseButtonPressed(const MouseButtonCode button) const noexcept -> bool {
+    const auto index = static_cast<uint32_t>(button);
+    if (index >= static_cast<uint32_t>(MouseButtonCode::MouseButtonUnknown)) {
+        return false;
+    }
+    return (getFrontSnapshot().buttons.load(std::memory_order_relaxed) & (1U << index)) != 0;
+}
+
+auto InputSystem::getMousePosition() const noexcept -> std::pair<float, float> {
+    const auto position = getFrontSnapshot().mousePosition.load(std::memory_order_relaxed);
+    return {std::bit_cast<float>(static_cast<uint32_t>(position)), std::bit_cast<float>(static_cast<uint32_t>(position >> 32U))};
+}
+
+auto InputSystem::startRecording(const std::string& filename) -> void {
+    mPlayback.reset();
+    mRecorder = std::make_unique<InputRecorder>(filename);
+}
+
+auto InputSystem::stopRecording() -> void {
+    mRecorder.reset();
+}
+
+auto InputSystem::startReplay(const std::string& filename) -> void {
+    mRecorder.reset();
+
+    // the replay starts from the same (empty) state the recording started from. The setters ignore the live input
+    // during a replay, so the held keys and buttons are released before the playback is installed
+    releaseAll();
+    applyMousePosition(0.0F, 0.0F);
+    mPlayback = std::make_unique<InputPlayback>(filename);
+}
+
+auto InputSystem::recordFrame(const InputFrame& frame) -> void {
+    if (isRecording()) {
+        mRecorder->write({InputRecordType::Frame, 0, false, 0.0F, 0.0F, frame});
+    }
+}
+
+auto InputSystem::replayFrame() -> std::optional<InputFrame> {
+    if (!isReplaying()) {
+        return std::nullopt;
+    }
+
+    while (const auto record = mPlayback->read()) {
+        switch (record->type) {
+            case InputRecordType::Frame:
+                return record->frame;
+            case InputRecordType::Key:
+                applyKey(static_cast<KeyCode>(record->code), record->pressed);
+                break;
+            case InputRecordType::MouseButton:
+                applyMouseButton(static_cast<MouseButtonCode>(record->code), record->pressed);
+                break;
+            case InputRecordType::MousePosition:
+                applyMousePosition(record->x, record->y);
+                break;
+            case InputRecordType::Scroll:
+                applyScroll(record->x, record->y);
+                break;
+        }
+    }
+
+    mPlayback.reset();
+    return std::nullopt;
+}
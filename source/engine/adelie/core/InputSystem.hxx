@@ -0,0 +1,122 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#if !defined(__ADELIE_CORE_INPUTSYSTEM_HXX__)
+    #define __ADELIE_CORE_INPUTSYSTEM_HXX__
+
+    #include <adelie/adelie.hxx>
+    #include <adelie/core/Input.hxx>
+    #include <adelie/core/InputRecording.hxx>
+    #include <array>
+    #include <atomic>
+    #include <cstddef>
+    #include <cstdint>
+    #include <memory>
+    #include <optional>
+    #include <string>
+    #include <utility>
+
+namespace adelie::core {
+
+    static inline constexpr std::size_t INPUT_KEY_COUNT = static_cast<std::size_t>(KeyCode::UnknownKey);
+
+    static inline constexpr std::size_t INPUT_KEY_WORDS = (INPUT_KEY_COUNT + 63) / 64;
+
+    // collects the input the platform windows receive and publishes it once per frame as a snapshot. The snapshot is
+    // double-buffered and every part of it is a single atomic word (the keys and buttons as bitsets, the pointer as two
+    // packed floats), so a query from any thread is one or two loads without a lock or a call into the platform
+    //
+    // the setters are called by the window while it polls its events on the main thread. Every change of the state is
+    // also published as an event on the event bus
+    //
+    // the input can be recorded together with the delta time and the window size of every frame. A replay feeds the
+    // recorded input back through the same path (state, snapshot and events) frame by frame and ignores the input of
+    // the window, so a benchmark run can be repeated exactly
+    class ADELIE_API InputSystem {
+        public:
+            static auto getInstance() -> InputSystem*;
+
+            ~InputSystem() noexcept = default;
+
+            InputSystem(const InputSystem&) = delete;
+
+            auto operator=(InputSystem const&) -> InputSystem& = delete;
+
+            InputSystem(InputSystem&&) = delete;
+
+            auto operator=(InputSystem&&) -> InputSystem& = delete;
+
+            auto setKey(KeyCode keyCode, bool pressed) -> void;
+
+            auto setMouseButton(MouseButtonCode button, bool pressed) -> void;
+
+            // in window coordinates, the origin is the top left corner
+            auto setMousePosition(float x, float y) -> void;
+
+            auto addScroll(float xOffset, float yOffset) -> void;
+
+            // the window lost the focus, it will not be told about the keys and buttons released in the meantime
+            auto releaseAll() -> void;
+
+            // makes the state collected so far visible to the queries, once per frame after the events were polled
+            auto publishSnapshot() -> void;
+
+            // throws an IOException if the file cannot be created
+            auto startRecording(const std::string& filename) -> void;
+
+            auto stopRecording() -> void;
+
+            // throws an IOException if the file is no input recording
+            auto startReplay(const std::string& filename) -> void;
+
+            [[nodiscard]] auto isRecording() const -> bool { return nullptr != mRecorder; }
+
+            [[nodiscard]] auto isReplaying() const -> bool { return nullptr != mPlayback; }
+
+            // recording: closes the input of the current frame
+            auto recordFrame(const InputFrame& frame) -> void;
+
+            // replay: applies the input of the next recorded frame and returns its delta time and window size,
+            // std::nullopt once the recording ended
+            auto replayFrame() -> std::optional<InputFrame>;
+
+            [[nodiscard]] auto isKeyPressed(KeyCode keyCode) const noexcept -> bool;
+
+            [[nodiscard]] auto isMouseButtonPressed(MouseButtonCode button) const noexcept -> bool;
+
+            [[nodiscard]] auto getMousePosition() const noexcept -> std::pair<float, float>;
+
+        private:
+            InputSystem();
+
+            auto applyKey(KeyCode keyCode, bool pressed) -> void;
+            auto applyMouseButton(MouseButtonCode button, bool pressed) -> void;
+            auto applyMousePosition(float x, float y) -> void;
+            auto applyScroll(float xOffset, float yOffset) -> void;
+
+            struct State {
+                    std::array<uint64_t, INPUT_KEY_WORDS> keys;
+                    uint32_t buttons;
+                    float mouseX;
+                    float mouseY;
+                    std::array<uint32_t, INPUT_KEY_COUNT> repeatCounts;
+            };
+
+            struct Snapshot {
+                    std::array<std::atomic<uint64_t>, INPUT_KEY_WORDS> keys;
+                    std::atomic<uint32_t> buttons;
+                    std::atomic<uint64_t> mousePosition;
+            };
+
+            [[nodiscard]] auto getFrontSnapshot() const noexcept -> const Snapshot& { return mSnapshots[mFrontIndex.load(std::memory_order_acquire)]; }
+
+            State mState;  // only touched by the main thread
+            std::unique_ptr<InputRecorder> mRecorder;
+            std::unique_ptr<InputPlayback> mPlayback;
+            std::array<Snapshot, 2> mSnapshots;
+            std::atomic<uint32_t> mFrontIndex;
+
+    }; /* class InputSystem */
+
+} /* namespace adelie::core */
+
+#endif /* if !defined(__ADELIE_CORE_INPUTSYSTEM_HXX__) */
@@ -0,0 +1,42 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#include <adelie/core/SimulationLoop.hxx>
+#include <adelie/io/Logger.hxx>
+
+using adelie::core::LayerStack;
+using adelie::core::SimulationLoop;
+using adelie::core::Timestep;
+
+SimulationLoop::SimulationLoop(const float fixedDeltaTime, const uint32_t maxStepsPerFrame) {
+    mFixedDeltaTime = fixedDeltaTime;
+    mMaxStepsPerFrame = maxStepsPerFrame;
+    mAccumulator = 0.0;
+    mStepCount = 0;
+    mDroppedTime = 0.0;
+}
+
+auto SimulationLoop::update(const float frameDeltaTime, LayerStack& layers) -> uint32_t {
+    mAccumulator += static_cast<double>(frameDeltaTime);
+
+    // a long frame would need more steps, which take longer and need even more steps in the next frame. The steps are
+    // capped instead, the simulation slows down for a moment but the cost of a frame stays bounded
+    const double maxAccumulator = static_cast<double>(mMaxStepsPerFrame) * mFixedDeltaTime;
+    if (mAccumulator >= maxAccumulator + mFixedDeltaTime) {
+        const double dropped = mAccumulator - maxAccumulator;
+        mDroppedTime += dropped;
+        mAccumulator = maxAccumulator;
+        AdelieLogDebug("Simulation fell behind, dropped {:.3f}s", dropped);
+    }
+
+    const Timestep deltaTime(mFixedDeltaTime);
+    uint32_t steps = 0;
+    while (mAccumulator >= mFixedDeltaTime) {
+        for (auto* layer : layers) {
+            layer->onUpdate(deltaTime);
+        }
+        mAccumulator -= mFixedDeltaTime;
+        mStepCount++;
+        steps++;
+    }
+    return steps;
+}
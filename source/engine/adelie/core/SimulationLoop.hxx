@@ -0,0 +1,60 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#if !defined(__ADELIE_CORE_SIMULATIONLOOP_HXX__)
+    #define __ADELIE_CORE_SIMULATIONLOOP_HXX__
+
+    #include <adelie/adelie.hxx>
+    #include <adelie/core/LayerStack.hxx>
+    #include <adelie/core/Timestep.hxx>
+    #include <cstdint>
+
+namespace adelie::core {
+
+    static inline constexpr float SIMULATION_DEFAULT_DELTA_TIME = 1.0F / 60.0F;
+
+    // a frame which took longer than this many simulation steps (e.g. a breakpoint or a stall while loading) does not
+    // have to be caught up, the rest of its time is dropped
+    static inline constexpr uint32_t SIMULATION_DEFAULT_MAX_STEPS = 8;
+
+    // runs the layer updates at a fixed rate, independent of the rate the frames are rendered at. The time of every
+    // frame is collected in an accumulator and as many fixed steps are simulated as fit into it. What is left over
+    // (less than one step) becomes the interpolation alpha the renderer uses to blend the previous and the current
+    // simulation state
+    //
+    // the simulation only ever sees the fixed delta time, so the same frame times (e.g. the ones of an input recording)
+    // always lead to the same steps, no matter how fast the display refreshes
+    class ADELIE_API SimulationLoop {
+        public:
+            SimulationLoop(float fixedDeltaTime, uint32_t maxStepsPerFrame);
+
+            // adds the time of the frame and updates the layers once per fixed step, returns the number of steps
+            auto update(float frameDeltaTime, LayerStack& layers) -> uint32_t;
+
+            [[nodiscard]] auto getFixedDeltaTime() const -> float { return mFixedDeltaTime; }
+
+            // how far the rendered frame is between the previous and the current step, in [0, 1)
+            [[nodiscard]] auto getAlpha() const -> float { return static_cast<float>(mAccumulator / mFixedDeltaTime); }
+
+            [[nodiscard]] auto getStepCount() const -> uint64_t { return mStepCount; }
+
+            // the time of the current step
+            [[nodiscard]] auto getSimulationTime() const -> double { return static_cast<double>(mStepCount) * mFixedDeltaTime; }
+
+            // the time between the previous and the current step the rendered frame shows
+            [[nodiscard]] auto getInterpolatedTime() const -> double { return getSimulationTime() - mFixedDeltaTime + mAccumulator; }
+
+            // the frame time which was dropped because the simulation could not keep up
+            [[nodiscard]] auto getDroppedTime() const -> double { return mDroppedTime; }
+
+        private:
+            float mFixedDeltaTime;
+            uint32_t mMaxStepsPerFrame;
+            double mAccumulator;
+            uint64_t mStepCount;
+            double mDroppedTime;
+
+    }; /* class SimulationLoop */
+
+} /* namespace adelie::core */
+
+#endif /* if !defined(__ADELIE_CORE_SIMULATIONLOOP_HXX__) */
@@ -0,0 +1,15 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#include <adelie/core/Timestep.hxx>
+#include <chrono>
+
+using adelie::core::Timestep;
+
+namespace {
+    // the seconds are counted from the start of the process, so a float keeps its precision for a long time
+    const auto PROCESS_START_TIME = std::chrono::steady_clock::now();
+}  // namespace
+
+auto Timestep::getCurrentTime() -> float {
+    return std::chrono::duration<float>(std::chrono::steady_clock::now() - PROCESS_START_TIME).count();
+}
@@ -22,7 +22,8 @@ namespace adelie::core::events {
         MouseMoved,
         MouseScrolled,
         MouseButtonPressed,
-        MouseButtonReleased
+        MouseButtonReleased,
+        Count
     };
 
     enum EventCategory { NoEventCategory = 0, Application = 1 << 0, GenericInput = 1 << 1, KeyboardInput = 1 << 2, MouseInput = 1 << 3 };
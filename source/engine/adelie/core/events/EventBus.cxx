@@ -0,0 +1,145 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#include <adelie/core/events/EventBus.hxx>
+#include <algorithm>
+
+using adelie::core::events::EventBus;
+
+EventBus::EventBus() {
+    for (auto& queue : mQueues) {
+        queue.blockIndex = 0;
+        queue.blockOffset = 0;
+    }
+    mPublishQueue = &mQueues[0];
+    mNextSubscriptionId = 1;
+    mDispatching = false;
+    mHasUnsubscribed = false;
+}
+
+EventBus::~EventBus() noexcept {
+    for (auto& queue : mQueues) {
+        queue.reset();
+    }
+}
+
+auto EventBus::getInstance() -> EventBus* {
+    static EventBus staticInstance;
+    return &staticInstance;
+}
+
+auto EventBus::Queue::allocate(const std::size_t size, const std::size_t alignment) -> void* {
+    auto offset = (blockOffset + alignment - 1) & ~(alignment - 1);
+    if (blockIndex < blocks.size() && offset + size > EVENT_ARENA_BLOCK_SIZE) {
+        blockIndex++;
+        offset = 0;
+    }
+
+    // only a frame with more events than any frame before grows the arena
+    if (blockIndex == blocks.size()) {
+        blocks.push_back(std::make_unique<std::byte[]>(EVENT_ARENA_BLOCK_SIZE));  // NOLINT(cppcoreguidelines-avoid-c-arrays)
+        offset = 0;
+    }
+
+    blockOffset = offset + size;
+    return blocks[blockIndex].get() + offset;
+}
+
+auto EventBus::Queue::reset() noexcept -> void {
+    for (const auto& entry : entries) {
+        entry.event->~Event();
+    }
+    entries.clear();  // keeps the capacity
+    blockIndex = 0;
+    blockOffset = 0;
+}
+
+auto EventBus::subscribe(const EventType type, const EventHandler handler) -> SubscriptionId {
+    const auto id = mNextSubscriptionId++;
+    mTypeSubscriptions[static_cast<std::size_t>(type)].push_back({id, 0, handler});
+    return id;
+}
+
+auto EventBus::subscribe(const uint32_t categoryMask, const EventHandler handler) -> SubscriptionId {
+    const auto id = mNextSubscriptionId++;
+    mCategorySubscriptions.push_back({id, categoryMask, handler});
+    return id;
+}
+
+auto EventBus::unsubscribe(const SubscriptionId id) -> void {
+    const auto clear = [id](std::vector<Subscription>& subscriptions) {
+        for (auto& subscription : subscriptions) {
+            if (subscription.id == id) {
+                subscription.handler.function = nullptr;
+            }
+        }
+    };
+    for (auto& subscriptions : mTypeSubscriptions) {
+        clear(subscriptions);
+    }
+    clear(mCategorySubscriptions);
+
+    // the vectors are only compacted outside of a dispatch, a handler may be iterating over them
+    mHasUnsubscribed = true;
+    if (!mDispatching) {
+        removeUnsubscribed();
+    }
+}
+
+auto EventBus::removeUnsubscribed() -> void {
+    const auto isUnsubscribed = [](const Subscription& subscription) { return nullptr == subscription.handler.function; };
+    for (auto& subscriptions : mTypeSubscriptions) {
+        std::erase_if(subscriptions, isUnsubscribed);
+    }
+    std::erase_if(mCategorySubscriptions, isUnsubscribed);
+    mHasUnsubscribed = false;
+}
+
+auto EventBus::dispatch() -> void {
+    // events published while dispatching go into the other queue and are dispatched with the next frame
+    Queue* queue = nullptr;
+    {
+        const std::lock_guard lock(mPublishMutex);
+        queue = mPublishQueue;
+        mPublishQueue = (mPublishQueue == &mQueues[0]) ? &mQueues[1] : &mQueues[0];
+    }
+
+    // the queue is reset even if a handler throws, its remaining events are dropped with it
+    struct DispatchGuard {
+            EventBus* bus;
+            Queue* queue;
+
+            ~DispatchGuard() noexcept {
+                bus->mDispatching = false;
+                queue->reset();
+                if (bus->mHasUnsubscribed) {
+                    bus->removeUnsubscribed();
+                }
+            }
+    };
+    const DispatchGuard guard{this, queue};
+
+    mDispatching = true;
+    for (const auto& entry : queue->entries) {
+        auto& event = *entry.event;
+
+        // indices instead of iterators, a handler may subscribe and grow the vectors
+        const auto& typeSubscriptions = mTypeSubscriptions[static_cast<std::size_t>(entry.type)];
+        for (std::size_t i = 0; i < typeSubscriptions.size() && !event.isHandled(); i++) {
+            const auto handler = typeSubscriptions[i].handler;
+            if (nullptr != handler.function && handler.function(handler.context, event)) {
+                event.markHandled();
+            }
+        }
+
+        if (event.isHandled() || mCategorySubscriptions.empty()) {
+            continue;
+        }
+        const auto categoryFlags = event.getCategoryFlags();
+        for (std::size_t i = 0; i < mCategorySubscriptions.size() && !event.isHandled(); i++) {
+            const auto subscription = mCategorySubscriptions[i];
+            if (nullptr != subscription.handler.function && (subscription.categoryMask & categoryFlags) != 0 && subscription.handler.function(subscription.handler.context, event)) {
+                event.markHandled();
+            }
+        }
+    }
+}
@@ -0,0 +1,127 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#if !defined(__ADELIE_CORE_EVENTS_EVENTBUS_HXX__)
+    #define __ADELIE_CORE_EVENTS_EVENTBUS_HXX__
+
+    #include <adelie/adelie.hxx>
+    #include <adelie/core/events/Event.hxx>
+    #include <array>
+    #include <cstddef>
+    #include <cstdint>
+    #include <memory>
+    #include <mutex>
+    #include <new>
+    #include <type_traits>
+    #include <utility>
+    #include <vector>
+
+namespace adelie::core::events {
+
+    // size of the blocks the queued events are allocated from, the blocks are kept and reused every frame
+    static inline constexpr std::size_t EVENT_ARENA_BLOCK_SIZE = 64ULL * 1024ULL;
+
+    using SubscriptionId = uint32_t;
+
+    // a handler without any allocation: a plain function and the object it is called for. It returns true if it
+    // handled the event, the remaining handlers are skipped then
+    struct EventHandler {
+            bool (*function)(void* context, Event& event);
+            void* context;
+    }; /* struct EventHandler */
+
+    // collects the events of a frame and dispatches them once per frame. Events of all types are constructed in an
+    // arena which is reset after the dispatch, so once the arena grew to the size of a busy frame publishing events
+    // does not allocate anymore. Handlers are looked up in a table indexed by the event type, or subscribe to a set of
+    // event categories
+    //
+    // publish() can be called from any thread. subscribe(), unsubscribe() and dispatch() belong to the main thread,
+    // handlers may publish new events (they are dispatched in the next frame) and may subscribe and unsubscribe
+    class ADELIE_API EventBus {
+        public:
+            static auto getInstance() -> EventBus*;
+
+            ~EventBus() noexcept;
+
+            EventBus(const EventBus&) = delete;
+
+            auto operator=(EventBus const&) -> EventBus& = delete;
+
+            EventBus(EventBus&&) = delete;
+
+            auto operator=(EventBus&&) -> EventBus& = delete;
+
+            template <typename T, typename... Args>
+            auto publish(Args&&... args) -> void {
+                static_assert(std::is_base_of_v<Event, T>, "only events can be published");
+                static_assert(sizeof(T) <= EVENT_ARENA_BLOCK_SIZE, "the event does not fit into an arena block");
+
+                const std::lock_guard lock(mPublishMutex);
+                auto* event = new (mPublishQueue->allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+                mPublishQueue->entries.push_back({event, T::getStaticType()});
+            }
+
+            // handlers for a single event type
+            auto subscribe(EventType type, EventHandler handler) -> SubscriptionId;
+
+            // handlers for every event which belongs to at least one of the categories (EventCategory flags)
+            auto subscribe(uint32_t categoryMask, EventHandler handler) -> SubscriptionId;
+
+            // e.g. subscribe<KeyPressedEvent, &Player::onKeyPressed>(player)
+            template <typename T, auto Method, typename Object>
+            auto subscribe(Object* object) -> SubscriptionId {
+                return subscribe(T::getStaticType(), EventHandler{[](void* context, Event& event) -> bool { return (static_cast<Object*>(context)->*Method)(static_cast<T&>(event)); }, object});
+            }
+
+            // e.g. subscribe<KeyPressedEvent>([](KeyPressedEvent& event) { ... }), the lambda must not capture anything
+            template <typename T, typename Function>
+                requires std::is_empty_v<Function> && std::is_default_constructible_v<Function>
+            auto subscribe(Function /* function */) -> SubscriptionId {
+                return subscribe(T::getStaticType(), EventHandler{[](void* /* context */, Event& event) -> bool { return Function{}(static_cast<T&>(event)); }, nullptr});
+            }
+
+            auto unsubscribe(SubscriptionId id) -> void;
+
+            // hands every event published since the last dispatch to its handlers, in the order they were published
+            auto dispatch() -> void;
+
+        private:
+            EventBus();
+
+            struct Entry {
+                    Event* event;
+                    EventType type;
+            };
+
+            struct Queue {
+                    std::vector<std::unique_ptr<std::byte[]>> blocks;  // NOLINT(cppcoreguidelines-avoid-c-arrays)
+                    std::size_t blockIndex;
+                    std::size_t blockOffset;
+                    std::vector<Entry> entries;
+
+                    auto allocate(std::size_t size, std::size_t alignment) -> void*;
+                    auto reset() noexcept -> void;
+            };
+
+            struct Subscription {
+                    SubscriptionId id;
+                    uint32_t categoryMask;
+                    EventHandler handler;  // the function is cleared if it was unsubscribed during a dispatch
+            };
+
+            auto removeUnsubscribed() -> void;
+
+            std::mutex mPublishMutex;
+            std::array<Queue, 2> mQueues;
+            Queue* mPublishQueue;  // the other queue is the one being dispatched
+
+            std::array<std::vector<Subscription>, static_cast<std::size_t>(EventType::Count)> mTypeSubscriptions;
+            std::vector<Subscription> mCategorySubscriptions;
+            SubscriptionId mNextSubscriptionId;
+            bool mDispatching;
+            bool mHasUnsubscribed;
+
+    }; /* class EventBus */
+
+} /* namespace adelie::core::events */
+
+#endif /* if !defined(__ADELIE_CORE_EVENTS_EVENTBUS_HXX__) */
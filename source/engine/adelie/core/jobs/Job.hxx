@@ -0,0 +1,49 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#if !defined(__ADELIE_CORE_JOBS_JOB_HXX__)
+    #define __ADELIE_CORE_JOBS_JOB_HXX__
+
+    #include <adelie/adelie.hxx>
+    #include <adelie/core/jobs/JobCounter.hxx>
+    #include <array>
+    #include <atomic>
+    #include <cstddef>
+    #include <new>
+    #include <type_traits>
+    #include <utility>
+
+namespace adelie::core::jobs {
+
+    static inline constexpr std::size_t JOB_PAYLOAD_SIZE = 64;
+
+    // a unit of work. The callable is stored inline in the payload and invoked through a function pointer, so
+    // creating a job never allocates memory on the heap
+    struct ADELIE_API Job {
+            using Function = void (*)(Job& job);
+
+            Function function;
+            JobCounter* counter;     // decremented after the job was executed, may be nullptr
+            Job* nextWaiting;        // the next job parked in the same counter until it reached zero
+            std::atomic<bool> inFlight;  // from the allocation until the job returned, its slot is not reused meanwhile
+            alignas(std::max_align_t) std::array<std::byte, JOB_PAYLOAD_SIZE> payload;
+
+            template <typename F>
+            auto store(F&& callable) -> void {
+                using Callable = std::decay_t<F>;
+                static_assert(sizeof(Callable) <= JOB_PAYLOAD_SIZE, "The callable of a job has to fit into the inline payload, capture by reference instead");
+                static_assert(alignof(Callable) <= alignof(std::max_align_t), "The callable of a job is over-aligned");
+
+                ::new (payload.data()) Callable(std::forward<F>(callable));
+                function = [](Job& job) {
+                    auto* stored = std::launder(reinterpret_cast<Callable*>(job.payload.data()));
+                    (*stored)();
+                    stored->~Callable();
+                };
+            }
+
+            auto execute() -> void { function(*this); }
+    };
+
+} /* namespace adelie::core::jobs */
+
+#endif /* if !defined(__ADELIE_CORE_JOBS_JOB_HXX__) */
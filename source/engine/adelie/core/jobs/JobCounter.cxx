@@ -0,0 +1,46 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#include <adelie/core/jobs/Job.hxx>
+#include <adelie/core/jobs/JobCounter.hxx>
+#include <utility>
+
+using adelie::core::jobs::Job;
+using adelie::core::jobs::JobCounter;
+
+auto JobCounter::decrement() -> Job* {
+    // only the last job of the group has to take the lock, the others just count down
+    auto value = mValue.load(std::memory_order_relaxed);
+    while (value > 1) {
+        if (mValue.compare_exchange_weak(value, value - 1, std::memory_order_release, std::memory_order_relaxed)) {
+            return nullptr;
+        }
+    }
+
+    std::scoped_lock lock(mWaitingMutex);
+    if (1 != mValue.fetch_sub(1, std::memory_order_acq_rel)) {
+        return nullptr;  // the group got another job in the meantime
+    }
+    return std::exchange(mWaitingJobs, nullptr);
+}
+
+auto JobCounter::addWaitingJob(Job* job) -> bool {
+    std::scoped_lock lock(mWaitingMutex);
+    if (0 == mValue.load(std::memory_order_acquire)) {
+        return false;
+    }
+
+    job->nextWaiting = mWaitingJobs;
+    mWaitingJobs = job;
+    return true;
+}
+
+auto JobCounter::isDone() const -> bool {
+    if (0 != mValue.load(std::memory_order_acquire)) {
+        return false;
+    }
+
+    // the last job may still hold the lock while it takes the waiting jobs, the owner must not destroy the counter
+    // before that happened
+    std::scoped_lock lock(mWaitingMutex);
+    return true;
+}
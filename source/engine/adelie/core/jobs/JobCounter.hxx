@@ -0,0 +1,54 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#if !defined(__ADELIE_CORE_JOBS_JOBCOUNTER_HXX__)
+    #define __ADELIE_CORE_JOBS_JOBCOUNTER_HXX__
+
+    #include <adelie/adelie.hxx>
+    #include <atomic>
+    #include <cstdint>
+    #include <mutex>
+
+namespace adelie::core::jobs {
+
+    struct Job;
+
+    // counts the unfinished jobs of a group. Waiting for a group means waiting until its counter reached zero and
+    // a job can depend on a counter to be executed only after the whole group finished. Such a job is parked in the
+    // counter and handed back by the decrement which drops the counter to zero
+    class ADELIE_API JobCounter {
+        public:
+            JobCounter() : mValue(0), mWaitingJobs(nullptr) {}
+
+            ~JobCounter() noexcept = default;
+
+            JobCounter(const JobCounter&) = delete;
+
+            auto operator=(JobCounter const&) -> JobCounter& = delete;
+
+            JobCounter(JobCounter&&) = delete;
+
+            auto operator=(JobCounter&&) -> JobCounter& = delete;
+
+            auto increment(const uint32_t count) -> void { mValue.fetch_add(count, std::memory_order_relaxed); }
+
+            // returns the jobs which waited for the counter if this decrement dropped it to zero, linked through
+            // Job::nextWaiting, otherwise nullptr
+            [[nodiscard]] auto decrement() -> Job*;
+
+            // park a job until the counter reached zero, returns false if it already is zero and the job can run now
+            [[nodiscard]] auto addWaitingJob(Job* job) -> bool;
+
+            [[nodiscard]] auto isDone() const -> bool;
+
+            [[nodiscard]] auto getValue() const -> uint32_t { return mValue.load(std::memory_order_acquire); }
+
+        private:
+            std::atomic<uint32_t> mValue;
+            mutable std::mutex mWaitingMutex;  // guards the waiting jobs and the drop of the counter to zero
+            Job* mWaitingJobs;
+
+    }; /* class JobCounter */
+
+} /* namespace adelie::core::jobs */
+
+#endif /* if !defined(__ADELIE_CORE_JOBS_JOBCOUNTER_HXX__) */
@@ -0,0 +1,233 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#include <adelie/core/Assert.hxx>
+#include <adelie/core/jobs/JobSystem.hxx>
+#include <adelie/io/Logger.hxx>
+#include <chrono>
+
+using adelie::core::jobs::Job;
+using adelie::core::jobs::JobCounter;
+using adelie::core::jobs::JobSystem;
+
+namespace {
+    constexpr auto INVALID_WORKER_INDEX = UINT32_MAX;
+    constexpr auto SPIN_COUNT_BEFORE_SLEEP = 64;
+    constexpr auto MAX_SLEEP_DURATION = std::chrono::milliseconds(1);
+
+    // the index of the worker running on the current thread or INVALID_WORKER_INDEX for foreign threads
+    thread_local uint32_t tWorkerIndex = INVALID_WORKER_INDEX;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+    // every thread allocates its jobs from its own ring, so allocating needs no synchronization at all. A slot is reused
+    // after MAX_JOBS_PER_THREAD allocations once the job in it returned
+    struct JobRing {
+            std::unique_ptr<Job[]> jobs;  // NOLINT(cppcoreguidelines-avoid-c-arrays)
+            uint32_t next = 0;
+    };
+
+    thread_local JobRing tJobRing;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+    // a cheap per-thread random number generator (xorshift) to pick the victim for stealing
+    thread_local uint32_t tStealSeed = 0x9E3779B9U;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+    // every worker starts from its own state (the finalizer of MurmurHash3), so they probe their victims in different orders
+    auto seedSteal(const uint32_t workerIndex) -> void {
+        auto seed = workerIndex + 1;
+        seed ^= seed >> 16U;
+        seed *= 0x85EBCA6BU;
+        seed ^= seed >> 13U;
+        seed *= 0xC2B2AE35U;
+        seed ^= seed >> 16U;
+        tStealSeed = 0 != seed ? seed : 0x9E3779B9U;
+    }
+
+    auto nextStealIndex(const uint32_t count) -> uint32_t {
+        tStealSeed ^= tStealSeed << 13U;
+        tStealSeed ^= tStealSeed >> 17U;
+        tStealSeed ^= tStealSeed << 5U;
+        return tStealSeed % count;
+    }
+}  // namespace
+
+JobSystem::JobSystem() {
+    mPendingJobs = 0;
+    mRunning = false;
+}
+
+JobSystem::~JobSystem() noexcept {
+    shutdown();
+}
+
+auto JobSystem::getInstance() -> JobSystem* {
+    static JobSystem staticInstance;
+    return &staticInstance;
+}
+
+auto JobSystem::initialize(const uint32_t workerCount) -> void {
+    AdelieCoreAssert(mQueues.empty(), "The job system was already initialized");
+
+    const auto count = std::max(workerCount, 1U);
+    mQueues.reserve(count);
+    for (uint32_t i = 0; i < count; i++) {
+        mQueues.push_back(std::make_unique<JobQueue>());
+    }
+
+    mRunning = true;
+    tWorkerIndex = 0;
+    seedSteal(0);
+
+    mWorkers.reserve(count - 1);
+    for (uint32_t i = 1; i < count; i++) {
+        mWorkers.emplace_back([this, i] { workerLoop(i); });
+    }
+
+    AdelieLogDebug("Job system started with {} worker(s)", count);
+}
+
+auto JobSystem::shutdown() -> void {
+    if (!mRunning.exchange(false)) {
+        return;
+    }
+
+    mSleepCondition.notify_all();
+    mWorkers.clear();  // joins the worker threads
+
+    mQueues.clear();
+    {
+        std::scoped_lock lock(mInjectionMutex);
+        mInjectionQueue.clear();
+    }
+    mPendingJobs = 0;
+    tWorkerIndex = INVALID_WORKER_INDEX;
+
+    AdelieLogDebug("Job system stopped");
+}
+
+auto JobSystem::wait(const JobCounter& counter) -> void {
+    AdelieCoreAssert(!mQueues.empty() || counter.isDone(), "Waiting for jobs requires an initialized job system");
+
+    while (!counter.isDone()) {
+        if (auto* job = getNextJob()) {
+            execute(job);
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+auto JobSystem::allocateJob() -> Job* {
+    if (!tJobRing.jobs) {
+        tJobRing.jobs = std::make_unique<Job[]>(MAX_JOBS_PER_THREAD);  // NOLINT(cppcoreguidelines-avoid-c-arrays)
+    }
+
+    // the slots are handed out in turn, one which is still in flight is skipped. It may hold a job further up the
+    // stack of this thread which waits for the jobs it spawned and only returns once this allocation succeeded. A
+    // thread with every slot in flight helps with the pending jobs until one of them returned. The jobs dropped by
+    // shutdown() never return, their slots are free once the system stopped
+    while (true) {
+        for (uint32_t i = 0; i < MAX_JOBS_PER_THREAD; i++) {
+            auto* job = &tJobRing.jobs[tJobRing.next++ & (MAX_JOBS_PER_THREAD - 1)];
+            if (!job->inFlight.load(std::memory_order_acquire) || !mRunning.load(std::memory_order_acquire)) {
+                job->inFlight.store(true, std::memory_order_relaxed);
+                return job;
+            }
+        }
+
+        if (auto* pending = getNextJob()) {
+            execute(pending);
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+auto JobSystem::submit(Job* job) -> void {
+    // workers push onto their own deque, everything else (or an overflowing deque) goes through the injection queue
+    if (tWorkerIndex >= mQueues.size() || !mQueues[tWorkerIndex]->push(job)) {
+        std::scoped_lock lock(mInjectionMutex);
+        mInjectionQueue.push_back(job);
+    }
+
+    mPendingJobs.fetch_add(1, std::memory_order_release);
+    mSleepCondition.notify_one();
+}
+
+auto JobSystem::getNextJob() -> Job* {
+    const auto queueCount = static_cast<uint32_t>(mQueues.size());
+    if (0 == queueCount) {
+        return nullptr;
+    }
+
+    if (tWorkerIndex < queueCount) {
+        if (auto* job = mQueues[tWorkerIndex]->pop()) {
+            return job;
+        }
+    }
+
+    {
+        std::scoped_lock lock(mInjectionMutex);
+        if (!mInjectionQueue.empty()) {
+            auto* job = mInjectionQueue.front();
+            mInjectionQueue.pop_front();
+            return job;
+        }
+    }
+
+    // start at a random victim, so idle workers do not all hammer the same deque
+    const auto start = nextStealIndex(queueCount);
+    for (uint32_t i = 0; i < queueCount; i++) {
+        const auto victim = (start + i) % queueCount;
+        if (victim == tWorkerIndex) {
+            continue;
+        }
+        if (auto* job = mQueues[victim]->steal()) {
+            return job;
+        }
+    }
+    return nullptr;
+}
+
+auto JobSystem::execute(Job* job) -> void {
+    mPendingJobs.fetch_sub(1, std::memory_order_relaxed);
+    job->execute();
+
+    // the owner may reuse the slot as soon as it is released
+    auto* counter = job->counter;
+    job->inFlight.store(false, std::memory_order_release);
+    if (nullptr != counter) {
+        finish(*counter);
+    }
+}
+
+auto JobSystem::finish(JobCounter& counter) -> void {
+    // the jobs which waited for the group go onto the deque of this worker, so they run while its caches are warm
+    auto* job = counter.decrement();
+    while (nullptr != job) {
+        auto* next = job->nextWaiting;
+        submit(job);
+        job = next;
+    }
+}
+
+auto JobSystem::workerLoop(const uint32_t workerIndex) -> void {
+    tWorkerIndex = workerIndex;
+    seedSteal(workerIndex);
+
+    auto idleSpins = 0;
+    while (mRunning.load(std::memory_order_acquire)) {
+        if (auto* job = getNextJob()) {
+            execute(job);
+            idleSpins = 0;
+            continue;
+        }
+
+        if (++idleSpins < SPIN_COUNT_BEFORE_SLEEP) {
+            std::this_thread::yield();
+            continue;
+        }
+
+        // the timeout covers the small window in which a job is submitted between our check and going to sleep
+        std::unique_lock lock(mSleepMutex);
+        mSleepCondition.wait_for(lock, MAX_SLEEP_DURATION, [this] { return !mRunning.load(std::memory_order_acquire) || mPendingJobs.load(std::memory_order_acquire) > 0; });
+        idleSpins = 0;
+    }
+}
@@ -0,0 +1,130 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#if !defined(__ADELIE_CORE_JOBS_JOBSYSTEM_HXX__)
+    #define __ADELIE_CORE_JOBS_JOBSYSTEM_HXX__
+
+    #include <adelie/adelie.hxx>
+    #include <adelie/core/jobs/Job.hxx>
+    #include <adelie/core/jobs/JobCounter.hxx>
+    #include <adelie/core/jobs/WorkStealingQueue.hxx>
+    #include <algorithm>
+    #include <atomic>
+    #include <condition_variable>
+    #include <cstdint>
+    #include <deque>
+    #include <mutex>
+    #include <thread>
+    #include <vector>
+
+namespace adelie::core::jobs {
+
+    // the maximum number of jobs a single thread can have in flight, the job storage of each thread is a ring of this size.
+    // A thread allocating more jobs helps executing the pending ones until one of its jobs returned
+    static inline constexpr uint32_t MAX_JOBS_PER_THREAD = 4096;
+
+    // a work-stealing scheduler with one worker per core. The thread which calls initialize() becomes worker 0 and
+    // executes jobs whenever it waits for a counter, every other core gets a dedicated worker thread. Each worker
+    // pushes and pops jobs on its own deque and steals from the others if it runs dry. Threads which are not workers
+    // (e.g. the render thread) submit their jobs through a shared injection queue
+    class ADELIE_API JobSystem {
+        public:
+            static auto getInstance() -> JobSystem*;
+
+            JobSystem(const JobSystem&) = delete;
+
+            auto operator=(JobSystem const&) -> JobSystem& = delete;
+
+            JobSystem(JobSystem&&) = delete;
+
+            auto operator=(JobSystem&&) -> JobSystem& = delete;
+
+            ~JobSystem() noexcept;
+
+            // start the worker threads, workerCount includes the calling thread and is clamped to at least one
+            auto initialize(uint32_t workerCount) -> void;
+
+            // stop and join all worker threads, the jobs which were not started yet are dropped
+            auto shutdown() -> void;
+
+            [[nodiscard]] auto getWorkerCount() const -> uint32_t { return static_cast<uint32_t>(mQueues.size()); }
+
+            // schedule a callable, the counter is incremented now and decremented once the callable returned
+            template <typename F>
+            auto run(JobCounter& counter, F&& callable) -> void {
+                runAfter(nullptr, counter, std::forward<F>(callable));
+            }
+
+            // schedule a callable which is started only after the dependency counter reached zero. Until then the job
+            // waits in the dependency and is submitted by the worker which finishes the last job of that group
+            template <typename F>
+            auto runAfter(JobCounter* dependency, JobCounter& counter, F&& callable) -> void {
+                if (mQueues.empty()) {
+                    // without workers nobody would ever pick the job up, so it runs right away like in parallelFor().
+                    // Every job ran that way, so the dependency is already done
+                    std::forward<F>(callable)();
+                    return;
+                }
+
+                auto* job = allocateJob();
+                job->store(std::forward<F>(callable));
+                job->counter = &counter;
+                job->nextWaiting = nullptr;
+
+                counter.increment(1);
+                if (nullptr == dependency || !dependency->addWaitingJob(job)) {
+                    submit(job);
+                }
+            }
+
+            // call func(begin, end) for consecutive ranges of at most batchSize elements of [0, count) and wait until
+            // all of them were processed. The calling thread takes part in the processing
+            template <typename F>
+            auto parallelFor(const uint32_t count, const uint32_t batchSize, const F& func) -> void {
+                if (0 == count) {
+                    return;
+                }
+
+                const auto batch = std::max(batchSize, 1U);
+                if (count <= batch || mQueues.empty()) {
+                    func(0U, count);
+                    return;
+                }
+
+                JobCounter counter;
+                for (uint32_t begin = 0; begin < count; begin += batch) {
+                    const auto end = std::min(begin + batch, count);
+                    run(counter, [&func, begin, end] { func(begin, end); });
+                }
+                wait(counter);
+            }
+
+            // block until the counter reached zero, the calling thread executes other jobs in the meantime
+            auto wait(const JobCounter& counter) -> void;
+
+        protected:
+            JobSystem();
+
+        private:
+            using JobQueue = WorkStealingQueue<Job*, MAX_JOBS_PER_THREAD>;
+
+            auto allocateJob() -> Job*;
+            auto submit(Job* job) -> void;
+            auto getNextJob() -> Job*;
+            auto execute(Job* job) -> void;
+            auto finish(JobCounter& counter) -> void;
+            auto workerLoop(uint32_t workerIndex) -> void;
+
+            std::vector<std::unique_ptr<JobQueue>> mQueues;
+            std::vector<std::jthread> mWorkers;
+            std::mutex mInjectionMutex;
+            std::deque<Job*> mInjectionQueue;
+            std::mutex mSleepMutex;
+            std::condition_variable mSleepCondition;
+            std::atomic<uint32_t> mPendingJobs;
+            std::atomic<bool> mRunning;
+
+    }; /* class JobSystem */
+
+} /* namespace adelie::core::jobs */
+
+#endif /* if !defined(__ADELIE_CORE_JOBS_JOBSYSTEM_HXX__) */
@@ -0,0 +1,107 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#if !defined(__ADELIE_CORE_JOBS_WORKSTEALINGQUEUE_HXX__)
+    #define __ADELIE_CORE_JOBS_WORKSTEALINGQUEUE_HXX__
+
+    #include <adelie/adelie.hxx>
+    #include <array>
+    #include <atomic>
+    #include <cstddef>
+    #include <cstdint>
+
+namespace adelie::core::jobs {
+
+    // a bounded Chase-Lev deque (with the memory orderings from Lê et al., "Correct and Efficient Work-Stealing for
+    // Weak Memory Models"). Only the owning worker may call push() and pop() which work on the bottom end, all other
+    // threads may call steal() concurrently which takes from the top end. T has to be a pointer, nullptr means empty
+    template <typename T, std::size_t Capacity>
+    class WorkStealingQueue {
+            static_assert(std::is_pointer_v<T>, "The work-stealing queue only stores pointers");
+            static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "The capacity has to be a power of two");
+
+        public:
+            WorkStealingQueue() : mTop(0), mBottom(0) {
+                for (auto& item : mItems) {
+                    item.store(nullptr, std::memory_order_relaxed);
+                }
+            }
+
+            ~WorkStealingQueue() noexcept = default;
+
+            WorkStealingQueue(const WorkStealingQueue&) = delete;
+
+            auto operator=(WorkStealingQueue const&) -> WorkStealingQueue& = delete;
+
+            WorkStealingQueue(WorkStealingQueue&&) = delete;
+
+            auto operator=(WorkStealingQueue&&) -> WorkStealingQueue& = delete;
+
+            // owner only, returns false if the queue is full
+            auto push(T item) -> bool {
+                const auto bottom = mBottom.load(std::memory_order_relaxed);
+                const auto top = mTop.load(std::memory_order_acquire);
+                if (bottom - top >= static_cast<int64_t>(Capacity)) {
+                    return false;
+                }
+
+                mItems[static_cast<std::size_t>(bottom) & MASK].store(item, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_release);
+                mBottom.store(bottom + 1, std::memory_order_relaxed);
+                return true;
+            }
+
+            // owner only, takes the most recently pushed item (LIFO keeps the working set of a worker hot in its cache)
+            auto pop() -> T {
+                const auto bottom = mBottom.load(std::memory_order_relaxed) - 1;
+                mBottom.store(bottom, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                auto top = mTop.load(std::memory_order_relaxed);
+
+                if (top > bottom) {
+                    mBottom.store(bottom + 1, std::memory_order_relaxed);
+                    return nullptr;
+                }
+
+                T item = mItems[static_cast<std::size_t>(bottom) & MASK].load(std::memory_order_relaxed);
+                if (top == bottom) {
+                    // the last item, we race against the thieves for it
+                    if (!mTop.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                        item = nullptr;
+                    }
+                    mBottom.store(bottom + 1, std::memory_order_relaxed);
+                }
+                return item;
+            }
+
+            // any thread, takes the oldest item
+            auto steal() -> T {
+                auto top = mTop.load(std::memory_order_acquire);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                const auto bottom = mBottom.load(std::memory_order_acquire);
+
+                if (top >= bottom) {
+                    return nullptr;
+                }
+
+                T item = mItems[static_cast<std::size_t>(top) & MASK].load(std::memory_order_relaxed);
+                if (!mTop.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                    return nullptr;  // another thief or the owner was faster
+                }
+                return item;
+            }
+
+            [[nodiscard]] auto isEmpty() const -> bool { return mBottom.load(std::memory_order_relaxed) <= mTop.load(std::memory_order_relaxed); }
+
+        private:
+            static inline constexpr std::size_t MASK = Capacity - 1;
+
+            // top and bottom are written by different threads, keep them on separate cache lines
+            alignas(64) std::atomic<int64_t> mTop;
+            alignas(64) std::atomic<int64_t> mBottom;
+            alignas(64) std::array<std::atomic<T>, Capacity> mItems;
+
+    }; /* class WorkStealingQueue */
+
+} /* namespace adelie::core::jobs */
+
+#endif /* if !defined(__ADELIE_CORE_JOBS_WORKSTEALINGQUEUE_HXX__) */
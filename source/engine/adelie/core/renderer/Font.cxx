@@ -0,0 +1,207 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#include <adelie/core/Assert.hxx>
+#include <adelie/core/jobs/JobSystem.hxx>
+#include <adelie/core/renderer/Font.hxx>
+#include <adelie/exception/IOException.hxx>
+#include <adelie/io/Logger.hxx>
+#include <adelie/io/VirtualFileSystem.hxx>
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+
+using adelie::core::jobs::JobSystem;
+using adelie::core::renderer::FONT_ATLAS_WIDTH;
+using adelie::core::renderer::FONT_BASE_SIZE;
+using adelie::core::renderer::FONT_FIRST_CHARACTER;
+using adelie::core::renderer::FONT_LAST_CHARACTER;
+using adelie::core::renderer::Font;
+using adelie::core::renderer::ShapedText;
+using adelie::exception::IOException;
+using adelie::io::VirtualFileSystem;
+
+namespace {
+    constexpr uint32_t GLYPH_COUNT = FONT_LAST_CHARACTER - FONT_FIRST_CHARACTER + 1;
+    constexpr uint32_t NO_GLYPH = GLYPH_COUNT;
+
+    // the distance falls off from 128 on the outline to 0 at the end of the padding, so the shaders can still tell the
+    // outline from a few pixels away at the smallest drawn size
+    constexpr int SDF_PADDING = 4;
+    constexpr unsigned char SDF_ON_EDGE = 128;
+    constexpr float SDF_DISTANCE_SCALE = static_cast<float>(SDF_ON_EDGE) / static_cast<float>(SDF_PADDING);
+
+    // the texels between two glyphs of the atlas, so the filtering never mixes them
+    constexpr uint32_t GLYPH_SPACING = 1;
+    constexpr std::size_t BYTES_PER_TEXEL = 4;
+
+    // texts which change every frame (e.g. timings) would let the cache grow forever, so it starts over once it is full
+    constexpr std::size_t MAX_CACHED_TEXTS = 1024;
+}  // namespace
+
+Font::Font() : mReady(false) {
+    mLoading = false;
+    mGlyphs = {};
+    mAtlasHeight = 0;
+    mAscent = 0.0f;
+    mLineHeight = 0.0f;
+}
+
+auto Font::load(const std::string& path) -> void {
+    AdelieCoreAssert(!mLoading, "A font is loaded only once");
+    mLoading = true;
+    JobSystem::getInstance()->run(mBuildCounter, [this, path] { build(path); });
+}
+
+auto Font::wait() const -> void {
+    if (mLoading) {
+        JobSystem::getInstance()->wait(mBuildCounter);
+    }
+}
+
+auto Font::build(const std::string& path) -> void {
+    std::shared_ptr<const io::Blob> file;
+    try {
+        file = VirtualFileSystem::getInstance()->read(path);
+    } catch (const IOException& exception) {
+        AdelieLogError("Failed to read font {}: {}, no text is drawn", path, exception.getMessage());
+        return;
+    }
+
+    // stb_truetype parses the file in place, it is only needed until the glyphs are rasterized
+    const auto* data = reinterpret_cast<const unsigned char*>(file->getData().data());
+    stbtt_fontinfo info;
+    if (0 == stbtt_InitFont(&info, data, stbtt_GetFontOffsetForIndex(data, 0))) {
+        AdelieLogError("Failed to parse font {}, no text is drawn", path);
+        return;
+    }
+
+    const auto scale = stbtt_ScaleForPixelHeight(&info, FONT_BASE_SIZE);
+    int ascent = 0, descent = 0, lineGap = 0;
+    stbtt_GetFontVMetrics(&info, &ascent, &descent, &lineGap);
+    mAscent = static_cast<float>(ascent) * scale;
+    mLineHeight = static_cast<float>(ascent - descent + lineGap) * scale;
+
+    // the distance fields are packed into rows from the top left corner of the atlas
+    struct Bitmap {
+            unsigned char* pixels;
+            uint32_t width;
+            uint32_t height;
+            uint32_t x;
+            uint32_t y;
+    };
+    std::array<Bitmap, GLYPH_COUNT> bitmaps{};
+    std::array<int, GLYPH_COUNT> fontGlyphs{};
+    uint32_t x = GLYPH_SPACING, y = GLYPH_SPACING, rowHeight = 0;
+    for (uint32_t index = 0; index < GLYPH_COUNT; index++) {
+        fontGlyphs[index] = stbtt_FindGlyphIndex(&info, static_cast<int>(FONT_FIRST_CHARACTER + index));
+        int advance = 0, leftSideBearing = 0;
+        stbtt_GetGlyphHMetrics(&info, fontGlyphs[index], &advance, &leftSideBearing);
+
+        // glyphs without an outline like the space have no distance field
+        int width = 0, height = 0, xOffset = 0, yOffset = 0;
+        auto& bitmap = bitmaps[index];
+        bitmap.pixels = stbtt_GetGlyphSDF(&info, scale, fontGlyphs[index], SDF_PADDING, SDF_ON_EDGE, SDF_DISTANCE_SCALE, &width, &height, &xOffset, &yOffset);
+        if (nullptr != bitmap.pixels) {
+            bitmap.width = static_cast<uint32_t>(width);
+            bitmap.height = static_cast<uint32_t>(height);
+            if (x + bitmap.width + GLYPH_SPACING > FONT_ATLAS_WIDTH) {
+                x = GLYPH_SPACING;
+                y += rowHeight + GLYPH_SPACING;
+                rowHeight = 0;
+            }
+            bitmap.x = x;
+            bitmap.y = y;
+            x += bitmap.width + GLYPH_SPACING;
+            rowHeight = std::max(rowHeight, bitmap.height);
+        }
+
+        // the texture coordinates are in texels until the height of the atlas is known
+        mGlyphs[index] = {.offset = glm::vec2(static_cast<float>(xOffset), static_cast<float>(yOffset)),
+                          .size = glm::vec2(static_cast<float>(bitmap.width), static_cast<float>(bitmap.height)),
+                          .uvMin = glm::vec2(static_cast<float>(bitmap.x), static_cast<float>(bitmap.y)),
+                          .uvMax = glm::vec2(static_cast<float>(bitmap.x + bitmap.width), static_cast<float>(bitmap.y + bitmap.height)),
+                          .advance = static_cast<float>(advance) * scale};
+    }
+    mAtlasHeight = std::bit_ceil(y + rowHeight + GLYPH_SPACING);
+
+    // the texels are white with the distance as their alpha, so the atlas is tinted like every other page
+    mAtlasPixels.assign(static_cast<std::size_t>(FONT_ATLAS_WIDTH) * mAtlasHeight * BYTES_PER_TEXEL, 0xFF);
+    for (std::size_t texel = 0; texel < static_cast<std::size_t>(FONT_ATLAS_WIDTH) * mAtlasHeight; texel++) {
+        mAtlasPixels[(texel * BYTES_PER_TEXEL) + 3] = 0;
+    }
+    for (const auto& bitmap : bitmaps) {
+        for (uint32_t row = 0; row < bitmap.height; row++) {
+            for (uint32_t column = 0; column < bitmap.width; column++) {
+                const auto texel = (static_cast<std::size_t>(bitmap.y + row) * FONT_ATLAS_WIDTH) + bitmap.x + column;
+                mAtlasPixels[(texel * BYTES_PER_TEXEL) + 3] = bitmap.pixels[(static_cast<std::size_t>(row) * bitmap.width) + column];
+            }
+        }
+        stbtt_FreeSDF(bitmap.pixels, nullptr);
+    }
+
+    const auto atlasSize = glm::vec2(static_cast<float>(FONT_ATLAS_WIDTH), static_cast<float>(mAtlasHeight));
+    for (auto& glyph : mGlyphs) {
+        glyph.uvMin = glyph.uvMin / atlasSize;
+        glyph.uvMax = glyph.uvMax / atlasSize;
+    }
+
+    // the kerning of every pair is looked up now, so shaping never touches the font file
+    for (uint32_t first = 0; first < GLYPH_COUNT; first++) {
+        for (uint32_t second = 0; second < GLYPH_COUNT; second++) {
+            if (const auto kerning = stbtt_GetGlyphKernAdvance(&info, fontGlyphs[first], fontGlyphs[second]); 0 != kerning) {
+                mKerning[(first << 8U) | second] = static_cast<float>(kerning) * scale;
+            }
+        }
+    }
+
+    AdelieLogDebug("Built the glyph atlas of font {} ({}x{}, {} kerning pairs)", path, FONT_ATLAS_WIDTH, mAtlasHeight, mKerning.size());
+    mReady.store(true, std::memory_order_release);
+}
+
+auto Font::getGlyphIndex(const char character) const -> uint32_t {
+    const auto code = static_cast<uint32_t>(static_cast<unsigned char>(character));
+    if (code < FONT_FIRST_CHARACTER || code > FONT_LAST_CHARACTER) {
+        return static_cast<uint32_t>('?') - FONT_FIRST_CHARACTER;
+    }
+    return code - FONT_FIRST_CHARACTER;
+}
+
+auto Font::shape(const std::string_view text) -> const ShapedText& {
+    AdelieCoreAssert(isReady(), "Text can only be shaped once the font is ready");
+    if (const auto cached = mTexts.find(text); cached != mTexts.end()) {
+        return cached->second;
+    }
+    if (mTexts.size() >= MAX_CACHED_TEXTS) {
+        mTexts.clear();
+    }
+
+    // the pen starts on the baseline of the first line
+    ShapedText shaped{.glyphs = {}, .extent = glm::vec2(0.0f)};
+    auto pen = glm::vec2(0.0f, mAscent);
+    auto previous = NO_GLYPH;
+    for (const auto character : text) {
+        if ('\n' == character) {
+            shaped.extent.x = std::max(shaped.extent.x, pen.x);
+            pen = glm::vec2(0.0f, pen.y + mLineHeight);
+            previous = NO_GLYPH;
+            continue;
+        }
+
+        const auto index = getGlyphIndex(character);
+        if (NO_GLYPH != previous) {
+            if (const auto kerning = mKerning.find((previous << 8U) | index); kerning != mKerning.end()) {
+                pen.x += kerning->second;
+            }
+        }
+
+        const auto& glyph = mGlyphs[index];
+        if (glyph.size.x > 0.0f) {
+            shaped.glyphs.push_back({.min = pen + glyph.offset, .max = pen + glyph.offset + glyph.size, .uvMin = glyph.uvMin, .uvMax = glyph.uvMax});
+        }
+        pen.x += glyph.advance;
+        previous = index;
+    }
+    shaped.extent = glm::vec2(std::max(shaped.extent.x, pen.x), pen.y - mAscent + mLineHeight);
+
+    return mTexts.emplace(std::string(text), std::move(shaped)).first->second;
+}
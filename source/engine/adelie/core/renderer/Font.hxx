@@ -0,0 +1,127 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#if !defined(__ADELIE_CORE_RENDERER_FONT_HXX__)
+    #define __ADELIE_CORE_RENDERER_FONT_HXX__
+
+    #include <adelie/adelie.hxx>
+    #include <adelie/core/jobs/JobCounter.hxx>
+    #include <array>
+    #include <atomic>
+    #include <cstdint>
+    #include <functional>
+    #include <string>
+    #include <string_view>
+    #include <unordered_map>
+    #include <vector>
+
+namespace adelie::core::renderer {
+
+    // the glyphs are rasterized once at this height in pixels, every other size scales their quads
+    static inline constexpr float FONT_BASE_SIZE = 32.0f;
+
+    // the printable ASCII characters have glyphs in the atlas, every other character is drawn as a question mark
+    static inline constexpr uint32_t FONT_FIRST_CHARACTER = 32;
+    static inline constexpr uint32_t FONT_LAST_CHARACTER = 126;
+
+    // the atlas is this wide, its height is the next power of two the glyphs fit into
+    static inline constexpr uint32_t FONT_ATLAS_WIDTH = 512;
+
+    // a glyph of shaped text, in pixels of the base size relative to the top left corner of the text
+    struct ADELIE_API ShapedGlyph {
+            glm::vec2 min;
+            glm::vec2 max;
+            glm::vec2 uvMin;
+            glm::vec2 uvMax;
+    }; /* struct ShapedGlyph */
+
+    // the glyphs of a text, see Font::shape
+    struct ADELIE_API ShapedText {
+            std::vector<ShapedGlyph> glyphs;  // without the invisible ones
+            glm::vec2 extent;                 // in pixels of the base size
+    }; /* struct ShapedText */
+
+    // a TrueType font whose glyphs are kept as signed distance fields in a single RGBA8 atlas
+    //
+    // the alpha channel of the atlas holds the distance to the outline of a glyph, which is 0.5 right on the outline and
+    // falls off linearly over the padding around the glyph. Since a distance field stays sharp under magnification and
+    // minification alike, the glyphs are rasterized once at the base size and every font size draws the same atlas
+    //
+    // the atlas is built by a job of the job system, the text drawn before it is ready is dropped. Afterwards the
+    // glyphs never touch the font file again: the shaped texts are cached, so drawing the same text every frame only
+    // copies its quads
+    class ADELIE_API Font {
+        public:
+            Font();
+
+            ~Font() noexcept = default;
+
+            Font(const Font&) = delete;
+
+            auto operator=(Font const&) -> Font& = delete;
+
+            Font(Font&&) = delete;
+
+            auto operator=(Font&&) -> Font& = delete;
+
+            // main thread: starts building the atlas of the font file in the background, a font is loaded only once
+            auto load(const std::string& path) -> void;
+
+            // main thread: blocks until the background build finished (or failed), the file system it reads from must
+            // stay mounted until then
+            auto wait() const -> void;
+
+            // any thread: true once the atlas and the glyph metrics can be used
+            [[nodiscard]] auto isReady() const -> bool { return mReady.load(std::memory_order_acquire); }
+
+            // main thread: the glyph quads of text, which may span several lines separated by '\n'. The reference stays
+            // valid until the next call. Requires isReady()
+            auto shape(std::string_view text) -> const ShapedText&;
+
+            // the RGBA8 pixels of the atlas, requires isReady()
+            [[nodiscard]] auto getAtlasPixels() const -> const std::vector<uint8_t>& { return mAtlasPixels; }
+
+            [[nodiscard]] auto getAtlasWidth() const -> uint32_t { return FONT_ATLAS_WIDTH; }
+
+            [[nodiscard]] auto getAtlasHeight() const -> uint32_t { return mAtlasHeight; }
+
+            // the distance between two baselines in pixels of the base size
+            [[nodiscard]] auto getLineHeight() const -> float { return mLineHeight; }
+
+        private:
+            struct Glyph {
+                    glm::vec2 offset;  // of the top left corner from the pen position on the baseline
+                    glm::vec2 size;
+                    glm::vec2 uvMin;
+                    glm::vec2 uvMax;
+                    float advance;
+            };
+
+            // the cache is looked up with string views, so a cached text does not allocate a key
+            struct TextHash {
+                    using is_transparent = void;
+
+                    auto operator()(const std::string_view text) const -> std::size_t { return std::hash<std::string_view>{}(text); }
+            };
+
+            auto build(const std::string& path) -> void;
+            [[nodiscard]] auto getGlyphIndex(char character) const -> uint32_t;
+
+            jobs::JobCounter mBuildCounter;
+            std::atomic<bool> mReady;
+            bool mLoading;
+
+            // written by the build job before mReady is set, read-only afterwards
+            std::array<Glyph, FONT_LAST_CHARACTER - FONT_FIRST_CHARACTER + 1> mGlyphs;
+            std::unordered_map<uint32_t, float> mKerning;  // by the glyph indices of a pair, the first one in the upper bits
+            std::vector<uint8_t> mAtlasPixels;
+            uint32_t mAtlasHeight;
+            float mAscent;
+            float mLineHeight;
+
+            std::unordered_map<std::string, ShapedText, TextHash, std::equal_to<>> mTexts;
+
+    }; /* class Font */
+
+} /* namespace adelie::core::renderer */
+
+#endif /* if !defined(__ADELIE_CORE_RENDERER_FONT_HXX__) */
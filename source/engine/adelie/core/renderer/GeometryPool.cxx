@@ -0,0 +1,65 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#include <adelie/core/renderer/GeometryPool.hxx>
+#include <adelie/core/renderer/MeshSimplifier.hxx>
+#include <adelie/io/Logger.hxx>
+#include <algorithm>
+#include <limits>
+
+using adelie::core::renderer::GeometryPool;
+using adelie::core::renderer::MeshSimplifier;
+using adelie::core::renderer::PoolMesh;
+
+namespace {
+    // the projected error in pixels up to which a coarser level is drawn
+    constexpr float LOD_PIXEL_ERROR = 1.0F;
+
+    // a coarser level than the current one is only drawn once its error is below this fraction of the threshold
+    constexpr float LOD_HYSTERESIS = 0.75F;
+
+    // a level with more than this fraction of the triangles of the previous one is not worth it
+    constexpr float LOD_MIN_REDUCTION = 0.85F;
+}  // namespace
+
+auto GeometryPool::addMesh(const std::span<const glm::vec3> positions, const std::span<const uint32_t> indices, const int32_t vertexOffset) -> uint32_t {
+    PoolMesh mesh{};
+    mesh.vertexOffset = vertexOffset;
+    mesh.bounds = {.min = glm::vec3(std::numeric_limits<float>::max()), .max = glm::vec3(std::numeric_limits<float>::lowest())};
+    for (const auto& position : positions) {
+        mesh.bounds.min = glm::min(mesh.bounds.min, position);
+        mesh.bounds.max = glm::max(mesh.bounds.max, position);
+    }
+    mesh.lods[0] = {.firstIndex = static_cast<uint32_t>(mIndices.size()), .indexCount = static_cast<uint32_t>(indices.size()), .error = 0.0F};
+    mesh.lodCount = 1;
+    mIndices.insert(mIndices.end(), indices.begin(), indices.end());
+
+    // every level is simplified from the full mesh, so the errors do not add up
+    while (mesh.lodCount < MESH_MAX_LODS) {
+        const auto previousCount = mesh.lods[mesh.lodCount - 1].indexCount;
+        const auto target = (previousCount / 6) * 3;
+        auto simplified = MeshSimplifier::simplify(positions, indices, target, std::numeric_limits<float>::max());
+        if (simplified.indices.empty() || static_cast<float>(simplified.indices.size()) > static_cast<float>(previousCount) * LOD_MIN_REDUCTION) {
+            break;
+        }
+
+        mesh.lods[mesh.lodCount] = {.firstIndex = static_cast<uint32_t>(mIndices.size()), .indexCount = static_cast<uint32_t>(simplified.indices.size()), .error = simplified.error};
+        mesh.lodCount++;
+        mIndices.insert(mIndices.end(), simplified.indices.begin(), simplified.indices.end());
+    }
+
+    AdelieLogDebug("Added mesh {} with {} triangles and {} levels of detail", mMeshes.size(), indices.size() / 3, mesh.lodCount);
+    mMeshes.push_back(mesh);
+    return static_cast<uint32_t>(mMeshes.size() - 1);
+}
+
+auto GeometryPool::selectLod(const uint32_t meshId, const float distance, const float worldScale, const float pixelsPerUnit, const uint32_t currentLod) const -> uint32_t {
+    const auto& mesh = mMeshes[meshId];
+    const float pixelsPerError = worldScale * pixelsPerUnit / std::max(distance, std::numeric_limits<float>::epsilon());
+    for (uint32_t lod = mesh.lodCount - 1; lod > 0; lod--) {
+        const float threshold = lod > currentLod ? LOD_PIXEL_ERROR * LOD_HYSTERESIS : LOD_PIXEL_ERROR;
+        if (mesh.lods[lod].error * pixelsPerError <= threshold) {
+            return lod;
+        }
+    }
+    return 0;
+}
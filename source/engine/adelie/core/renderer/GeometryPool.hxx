@@ -0,0 +1,73 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#if !defined(__ADELIE_CORE_RENDERER_GEOMETRYPOOL_HXX__)
+    #define __ADELIE_CORE_RENDERER_GEOMETRYPOOL_HXX__
+
+    #include <adelie/adelie.hxx>
+    #include <adelie/core/scene/Bounds.hxx>
+    #include <array>
+    #include <cstdint>
+    #include <span>
+    #include <vector>
+
+namespace adelie::core::renderer {
+
+    static inline constexpr uint32_t MESH_MAX_LODS = 4;
+
+    // a level of detail is a range of the index buffer of the pool
+    struct ADELIE_API MeshLod {
+            uint32_t firstIndex;
+            uint32_t indexCount;
+            float error;  // in the units of the mesh, see SimplifiedMesh
+    }; /* struct MeshLod */
+
+    struct ADELIE_API PoolMesh {
+            int32_t vertexOffset;  // added to the indices, the mesh starts at this vertex of the vertex buffer
+            scene::Aabb bounds;    // of the positions, the same for every level of detail
+            uint32_t lodCount;
+            std::array<MeshLod, MESH_MAX_LODS> lods;  // from the full detail to the coarsest
+    }; /* struct PoolMesh */
+
+    // the index data of all meshes the renderer draws, which is uploaded into a single index buffer. The levels of
+    // detail of a mesh are generated when it is added: each one halves the triangles of the previous one, until the
+    // simplification stops paying off
+    //
+    // at runtime the coarsest level whose error projects to less than a pixel is drawn. A level only becomes coarser
+    // once its error is clearly below the threshold, so an object near the threshold does not flicker between two
+    // levels
+    class ADELIE_API GeometryPool {
+        public:
+            GeometryPool() = default;
+
+            ~GeometryPool() noexcept = default;
+
+            GeometryPool(const GeometryPool&) = delete;
+
+            auto operator=(GeometryPool const&) -> GeometryPool& = delete;
+
+            GeometryPool(GeometryPool&&) = delete;
+
+            auto operator=(GeometryPool&&) -> GeometryPool& = delete;
+
+            // positions holds the positions of the vertices of the mesh, which start at vertexOffset in the vertex
+            // buffer. Returns the mesh id
+            auto addMesh(std::span<const glm::vec3> positions, std::span<const uint32_t> indices, int32_t vertexOffset) -> uint32_t;
+
+            [[nodiscard]] auto getMesh(const uint32_t meshId) const -> const PoolMesh& { return mMeshes[meshId]; }
+
+            [[nodiscard]] auto getIndices() const -> const std::vector<uint32_t>& { return mIndices; }
+
+            // pixelsPerUnit is the size in pixels of one unit at distance one, the height of the viewport times
+            // projection[1][1] / 2. worldScale is the largest scale of the model matrix and currentLod the level drawn
+            // the last time
+            [[nodiscard]] auto selectLod(uint32_t meshId, float distance, float worldScale, float pixelsPerUnit, uint32_t currentLod) const -> uint32_t;
+
+        private:
+            std::vector<PoolMesh> mMeshes;
+            std::vector<uint32_t> mIndices;
+
+    }; /* class GeometryPool */
+
+} /* namespace adelie::core::renderer */
+
+#endif /* if !defined(__ADELIE_CORE_RENDERER_GEOMETRYPOOL_HXX__) */
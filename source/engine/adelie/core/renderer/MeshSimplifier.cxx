@@ -0,0 +1,232 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#include <adelie/core/renderer/MeshSimplifier.hxx>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <unordered_map>
+
+using adelie::core::renderer::MeshSimplifier;
+using adelie::core::renderer::SimplifiedMesh;
+
+namespace {
+    // the symmetric matrix of the squared distances to a set of planes: a00 a01 a02 a11 a12 a22 b0 b1 b2 c
+    using Quadric = std::array<double, 10>;
+
+    auto addPlane(Quadric& quadric, const glm::vec3& normal, const float distance) -> void {
+        const double x = normal.x;
+        const double y = normal.y;
+        const double z = normal.z;
+        const double d = distance;
+        quadric[0] += x * x;
+        quadric[1] += x * y;
+        quadric[2] += x * z;
+        quadric[3] += y * y;
+        quadric[4] += y * z;
+        quadric[5] += z * z;
+        quadric[6] += x * d;
+        quadric[7] += y * d;
+        quadric[8] += z * d;
+        quadric[9] += d * d;
+    }
+
+    auto evaluate(const Quadric& quadric, const glm::vec3& position) -> double {
+        const double x = position.x;
+        const double y = position.y;
+        const double z = position.z;
+        const double distance = (quadric[0] * x * x) + (2.0 * quadric[1] * x * y) + (2.0 * quadric[2] * x * z) + (quadric[3] * y * y) + (2.0 * quadric[4] * y * z) + (quadric[5] * z * z) +
+                                (2.0 * ((quadric[6] * x) + (quadric[7] * y) + (quadric[8] * z))) + quadric[9];
+        return std::max(0.0, distance);
+    }
+
+    struct Collapse {
+            uint32_t from;
+            uint32_t to;
+            double cost;
+    };
+
+    auto getEdgeKey(const uint32_t a, const uint32_t b) -> uint64_t {
+        return (static_cast<uint64_t>(std::min(a, b)) << 32U) | std::max(a, b);
+    }
+}  // namespace
+
+auto MeshSimplifier::simplify(const std::span<const glm::vec3> positions, const std::span<const uint32_t> indices, const uint32_t targetIndexCount, const float maxError) -> SimplifiedMesh {
+    const auto vertexCount = static_cast<uint32_t>(positions.size());
+    SimplifiedMesh result{.indices = std::vector<uint32_t>(indices.begin(), indices.end()), .error = 0.0F};
+
+    // the vertices which share a position are welded, the topology and the quadrics work on the welded vertices
+    std::vector<uint32_t> welded(vertexCount);
+    std::vector<uint8_t> locked(vertexCount, 0);
+    {
+        std::unordered_map<uint64_t, uint32_t> firstVertex;
+        std::unordered_map<uint32_t, uint32_t> sharedPositions;
+        firstVertex.reserve(vertexCount);
+        for (uint32_t vertex = 0; vertex < vertexCount; vertex++) {
+            const auto& position = positions[vertex];
+            const auto hash = (static_cast<uint64_t>(std::bit_cast<uint32_t>(position.x)) * 73856093U) ^ (static_cast<uint64_t>(std::bit_cast<uint32_t>(position.y)) * 19349663U) ^
+                              (static_cast<uint64_t>(std::bit_cast<uint32_t>(position.z)) * 83492791U);
+            // a collision of the hash only costs a missed weld, never a wrong one
+            const auto [it, inserted] = firstVertex.try_emplace(hash, vertex);
+            const auto first = it->second;
+            welded[vertex] = (!inserted && positions[first].x == position.x && positions[first].y == position.y && positions[first].z == position.z) ? first : vertex;
+            if (welded[vertex] != vertex) {
+                locked[vertex] = 1;
+                locked[first] = 1;
+            }
+        }
+    }
+
+    // an edge used by a single triangle lies on the border, one used by more than two is not manifold
+    Quadric zero{};
+    std::vector<Quadric> quadrics(vertexCount, zero);
+    {
+        std::unordered_map<uint64_t, uint32_t> edgeUses;
+        edgeUses.reserve(indices.size());
+        for (std::size_t i = 0; i + 2 < indices.size(); i += 3) {
+            const std::array<uint32_t, 3> triangle = {welded[indices[i]], welded[indices[i + 1]], welded[indices[i + 2]]};
+            for (uint32_t edge = 0; edge < 3; edge++) {
+                edgeUses[getEdgeKey(triangle[edge], triangle[(edge + 1) % 3])]++;
+            }
+
+            const auto normal = glm::cross(positions[triangle[1]] - positions[triangle[0]], positions[triangle[2]] - positions[triangle[0]]);
+            const float length = glm::length(normal);
+            if (length > 0.0F) {
+                const auto unit = normal / length;
+                for (const auto vertex : triangle) {
+                    addPlane(quadrics[vertex], unit, -glm::dot(unit, positions[triangle[0]]));
+                }
+            }
+        }
+        for (const auto& [key, uses] : edgeUses) {
+            if (2 != uses) {
+                locked[static_cast<uint32_t>(key >> 32U)] = 1;
+                locked[static_cast<uint32_t>(key)] = 1;
+            }
+        }
+        for (uint32_t vertex = 0; vertex < vertexCount; vertex++) {
+            if (0 != locked[welded[vertex]]) {
+                locked[vertex] = 1;
+            }
+        }
+    }
+
+    const double maxCost = static_cast<double>(maxError) * static_cast<double>(maxError);
+    std::vector<uint32_t> triangleOffsets(vertexCount + 1);
+    std::vector<uint32_t> vertexTriangles;
+    std::vector<Collapse> collapses;
+    std::vector<uint32_t> remap(vertexCount);
+    std::vector<uint8_t> touched(vertexCount);
+
+    // every pass collapses a set of edges which do not share a neighborhood, so the checks of one collapse are not
+    // invalidated by another
+    while (result.indices.size() > targetIndexCount) {
+        const auto triangleCount = static_cast<uint32_t>(result.indices.size() / 3);
+
+        std::fill(triangleOffsets.begin(), triangleOffsets.end(), 0);
+        for (const auto index : result.indices) {
+            triangleOffsets[welded[index] + 1]++;
+        }
+        for (uint32_t vertex = 0; vertex < vertexCount; vertex++) {
+            triangleOffsets[vertex + 1] += triangleOffsets[vertex];
+        }
+        vertexTriangles.resize(result.indices.size());
+        {
+            auto cursor = triangleOffsets;
+            for (uint32_t i = 0; i < result.indices.size(); i++) {
+                vertexTriangles[cursor[welded[result.indices[i]]]++] = i / 3;
+            }
+        }
+
+        collapses.clear();
+        for (uint32_t i = 0; i < result.indices.size(); i++) {
+            const auto from = result.indices[i];
+            const auto to = result.indices[(i % 3 == 2) ? i - 2 : i + 1];
+            if (0 == locked[from]) {
+                collapses.push_back({from, to, evaluate(quadrics[from], positions[to]) + evaluate(quadrics[welded[to]], positions[to])});
+            }
+            if (0 == locked[to]) {
+                collapses.push_back({to, from, evaluate(quadrics[to], positions[from]) + evaluate(quadrics[welded[from]], positions[from])});
+            }
+        }
+        std::sort(collapses.begin(), collapses.end(), [](const Collapse& a, const Collapse& b) { return a.cost < b.cost; });
+
+        // a collapse of an inner edge removes two triangles
+        const uint32_t trianglesToRemove = (static_cast<uint32_t>(result.indices.size()) - targetIndexCount + 2) / 3;
+        uint32_t removedTriangles = 0;
+        uint32_t collapseCount = 0;
+        std::fill(touched.begin(), touched.end(), 0);
+        for (uint32_t vertex = 0; vertex < vertexCount; vertex++) {
+            remap[vertex] = vertex;
+        }
+
+        for (const auto& collapse : collapses) {
+            if (collapse.cost > maxCost || removedTriangles >= trianglesToRemove) {
+                break;
+            }
+            const auto from = collapse.from;
+            const auto to = welded[collapse.to];
+            if (0 != touched[from] || 0 != touched[to]) {
+                continue;
+            }
+
+            // the triangles around the vertex must not flip or degenerate when it moves
+            bool valid = true;
+            uint32_t sharedTriangles = 0;
+            for (uint32_t t = triangleOffsets[from]; t < triangleOffsets[from + 1] && valid; t++) {
+                const auto* triangle = &result.indices[static_cast<std::size_t>(vertexTriangles[t]) * 3];
+                std::array<glm::vec3, 3> corners{};
+                std::array<glm::vec3, 3> moved{};
+                bool containsTarget = false;
+                for (uint32_t corner = 0; corner < 3; corner++) {
+                    const auto vertex = welded[triangle[corner]];
+                    containsTarget = containsTarget || vertex == to;
+                    corners[corner] = positions[vertex];
+                    moved[corner] = vertex == from ? positions[to] : positions[vertex];
+                }
+                if (containsTarget) {
+                    sharedTriangles++;
+                    continue;
+                }
+                const auto before = glm::cross(corners[1] - corners[0], corners[2] - corners[0]);
+                const auto after = glm::cross(moved[1] - moved[0], moved[2] - moved[0]);
+                valid = glm::dot(before, after) > 0.0F;
+            }
+            if (!valid) {
+                continue;
+            }
+
+            remap[from] = collapse.to;
+            for (std::size_t q = 0; q < quadrics[from].size(); q++) {
+                quadrics[to][q] += quadrics[from][q];
+            }
+            for (uint32_t t = triangleOffsets[from]; t < triangleOffsets[from + 1]; t++) {
+                for (uint32_t corner = 0; corner < 3; corner++) {
+                    touched[welded[result.indices[(static_cast<std::size_t>(vertexTriangles[t]) * 3) + corner]]] = 1;
+                }
+            }
+            touched[to] = 1;
+            removedTriangles += sharedTriangles;
+            collapseCount++;
+            result.error = std::max(result.error, static_cast<float>(std::sqrt(collapse.cost)));
+        }
+        if (0 == collapseCount) {
+            break;
+        }
+
+        // the triangles which lost an edge are dropped
+        std::size_t write = 0;
+        for (uint32_t triangle = 0; triangle < triangleCount; triangle++) {
+            const auto a = remap[result.indices[(triangle * 3)]];
+            const auto b = remap[result.indices[(triangle * 3) + 1]];
+            const auto c = remap[result.indices[(triangle * 3) + 2]];
+            if (welded[a] != welded[b] && welded[b] != welded[c] && welded[c] != welded[a]) {
+                result.indices[write++] = a;
+                result.indices[write++] = b;
+                result.indices[write++] = c;
+            }
+        }
+        result.indices.resize(write);
+    }
+    return result;
+}
@@ -0,0 +1,34 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#if !defined(__ADELIE_CORE_RENDERER_MESHSIMPLIFIER_HXX__)
+    #define __ADELIE_CORE_RENDERER_MESHSIMPLIFIER_HXX__
+
+    #include <adelie/adelie.hxx>
+    #include <cstdint>
+    #include <span>
+    #include <vector>
+
+namespace adelie::core::renderer {
+
+    struct ADELIE_API SimplifiedMesh {
+            std::vector<uint32_t> indices;
+            float error;  // an estimate of the largest distance between the simplified and the source surface
+    }; /* struct SimplifiedMesh */
+
+    // reduces the triangles of an indexed mesh by collapsing edges, ordered by the quadric error of Garland and
+    // Heckbert. A vertex is always collapsed onto one of its neighbors, so the simplified mesh indexes the same
+    // vertices as the source and both can share a vertex buffer
+    //
+    // vertices on a seam (the same position is used by several vertices, e.g. with different texture coordinates) and
+    // on a border of the mesh are never moved, so the silhouette and the attributes along the seams are kept
+    class ADELIE_API MeshSimplifier {
+        public:
+            // collapses edges until the mesh has at most targetIndexCount indices or the next collapse would exceed
+            // maxError. positions holds one position per vertex
+            [[nodiscard]] static auto simplify(std::span<const glm::vec3> positions, std::span<const uint32_t> indices, uint32_t targetIndexCount, float maxError) -> SimplifiedMesh;
+
+    }; /* class MeshSimplifier */
+
+} /* namespace adelie::core::renderer */
+
+#endif /* if !defined(__ADELIE_CORE_RENDERER_MESHSIMPLIFIER_HXX__) */
@@ -0,0 +1,64 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#include <adelie/core/Assert.hxx>
+#include <adelie/core/renderer/QuadBatch.hxx>
+#include <algorithm>
+
+using adelie::core::renderer::QuadBatch;
+using adelie::core::renderer::RenderQuad;
+
+namespace {
+    // the sort key keeps 16 bits for the layer and the page each and 32 bits for the submission order, equal keys are
+    // impossible, so the unstable sort keeps the submission order within a run
+    constexpr uint32_t SORT_FIELD_MASK = 0xFFFFU;
+
+    auto packColor(const glm::vec4& color) -> uint32_t {
+        const auto channel = [](const float value, const uint32_t shift) { return static_cast<uint32_t>(std::clamp(value, 0.0f, 1.0f) * 255.0f + 0.5f) << shift; };
+        return channel(color.x, 0) | channel(color.y, 8) | channel(color.z, 16) | channel(color.w, 24);
+    }
+}  // namespace
+
+QuadBatch::QuadBatch() {
+    mQuads = nullptr;
+    mSequence = 0;
+}
+
+auto QuadBatch::begin(std::vector<RenderQuad>& quads) -> void {
+    mQuads = &quads;
+    mSequence = 0;
+}
+
+auto QuadBatch::drawQuad(const glm::vec2& position, const glm::vec2& size, const glm::vec4& color, const uint32_t layer) -> void {
+    drawSprite(position, size, QUAD_WHITE_PAGE, glm::vec2(0.0f), glm::vec2(1.0f), color, layer);
+}
+
+auto QuadBatch::drawSprite(const glm::vec2& position, const glm::vec2& size, const uint32_t page, const glm::vec2& uvMin, const glm::vec2& uvMax, const glm::vec4& color, const uint32_t layer) -> void {
+    AdelieCoreAssert(nullptr != mQuads, "Quads can only be drawn between begin() and end()");
+    const auto sortKey = (static_cast<uint64_t>(std::min(layer, SORT_FIELD_MASK)) << 48U) | (static_cast<uint64_t>(std::min(page, SORT_FIELD_MASK)) << 32U) | mSequence++;
+    mQuads->push_back({.min = position, .max = position + size, .uvMin = uvMin, .uvMax = uvMax, .color = packColor(color), .page = page, .sortKey = sortKey});
+}
+
+auto QuadBatch::drawText(const std::string_view text, const glm::vec2& position, const float size, const glm::vec4& color, const uint32_t layer) -> void {
+    if (!mFont.isReady()) {
+        return;
+    }
+
+    // a line of the base size spans one line height of the font
+    const auto scale = size / mFont.getLineHeight();
+    for (const auto& glyph : mFont.shape(text).glyphs) {
+        drawSprite(position + (glyph.min * scale), (glyph.max - glyph.min) * scale, QUAD_FONT_PAGE, glyph.uvMin, glyph.uvMax, color, layer);
+    }
+}
+
+auto QuadBatch::measureText(const std::string_view text, const float size) -> glm::vec2 {
+    if (!mFont.isReady()) {
+        return glm::vec2(0.0f);
+    }
+    return mFont.shape(text).extent * (size / mFont.getLineHeight());
+}
+
+auto QuadBatch::end() -> void {
+    AdelieCoreAssert(nullptr != mQuads, "end() without begin()");
+    std::ranges::sort(*mQuads, {}, &RenderQuad::sortKey);
+    mQuads = nullptr;
+}
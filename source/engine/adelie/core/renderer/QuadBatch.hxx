@@ -0,0 +1,71 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#if !defined(__ADELIE_CORE_RENDERER_QUADBATCH_HXX__)
+    #define __ADELIE_CORE_RENDERER_QUADBATCH_HXX__
+
+    #include <adelie/adelie.hxx>
+    #include <adelie/core/renderer/Font.hxx>
+    #include <adelie/core/renderer/RenderSnapshot.hxx>
+    #include <cstdint>
+    #include <string_view>
+    #include <vector>
+
+namespace adelie::core::renderer {
+
+    // the atlas page of the renderer which is a single white texel, so its quads are plain colored
+    static inline constexpr uint32_t QUAD_WHITE_PAGE = 0;
+
+    // the atlas page of the renderer which holds the distance fields of the glyphs of the overlay font
+    static inline constexpr uint32_t QUAD_FONT_PAGE = 1;
+
+    // collects the 2D quads of the overlay, which the layers draw in Layer::onUIRendering
+    //
+    // the renderer draws each run of quads sharing an atlas page with a single draw, so the quads are sorted by their
+    // layer first and their page second. Quads of the same layer are only drawn in submission order if they share the
+    // page, overlapping elements which have to be drawn on top of each other go into different layers
+    class ADELIE_API QuadBatch {
+        public:
+            QuadBatch();
+
+            ~QuadBatch() noexcept = default;
+
+            QuadBatch(const QuadBatch&) = delete;
+
+            auto operator=(QuadBatch const&) -> QuadBatch& = delete;
+
+            QuadBatch(QuadBatch&&) = delete;
+
+            auto operator=(QuadBatch&&) -> QuadBatch& = delete;
+
+            // main thread: the following quads are appended to quads until end()
+            auto begin(std::vector<RenderQuad>& quads) -> void;
+
+            // main thread: a plain colored rectangle, position is its top left corner in window pixels
+            auto drawQuad(const glm::vec2& position, const glm::vec2& size, const glm::vec4& color, uint32_t layer) -> void;
+
+            // main thread: a rectangle showing the region between uvMin and uvMax of an atlas page, tinted by color
+            auto drawSprite(const glm::vec2& position, const glm::vec2& size, uint32_t page, const glm::vec2& uvMin, const glm::vec2& uvMax, const glm::vec4& color, uint32_t layer) -> void;
+
+            // main thread: a text in the overlay font, position is its top left corner and size the height of a line in
+            // window pixels. Each glyph becomes a quad of the font page, the text drawn before the font is ready is dropped
+            auto drawText(std::string_view text, const glm::vec2& position, float size, const glm::vec4& color, uint32_t layer) -> void;
+
+            // main thread: the extent of a text drawn by drawText in window pixels, zero before the font is ready
+            [[nodiscard]] auto measureText(std::string_view text, float size) -> glm::vec2;
+
+            // main thread: sorts the quads into the order the renderer draws them
+            auto end() -> void;
+
+            // the font of the texts, the renderer uploads its atlas once it is ready
+            [[nodiscard]] auto getFont() -> Font& { return mFont; }
+
+        private:
+            Font mFont;
+            std::vector<RenderQuad>* mQuads;
+            uint32_t mSequence;
+
+    }; /* class QuadBatch */
+
+} /* namespace adelie::core::renderer */
+
+#endif /* if !defined(__ADELIE_CORE_RENDERER_QUADBATCH_HXX__) */
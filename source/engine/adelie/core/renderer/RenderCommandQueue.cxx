@@ -0,0 +1,78 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#include <adelie/core/renderer/RenderCommandQueue.hxx>
+
+using adelie::core::renderer::RenderCommandQueue;
+using adelie::core::renderer::RenderSnapshot;
+
+RenderCommandQueue::RenderCommandQueue() {
+    mSnapshots = {};
+    mWriteIndex = 0;
+    mReadIndex = 1;
+    mPending = false;
+    mReading = false;
+    mShutdown = false;
+}
+
+auto RenderCommandQueue::beginWrite() -> RenderSnapshot& {
+    // the write slot is never touched by the consumer, so no lock is required here
+    auto& snapshot = mSnapshots[mWriteIndex];
+    snapshot.commands.clear();  // keeps the capacity, so steady-state frames do not allocate
+    snapshot.lights.clear();
+    snapshot.shadowCasters.clear();
+    snapshot.particleEmitters.clear();
+    snapshot.overlayQuads.clear();
+    return snapshot;
+}
+
+auto RenderCommandQueue::submit() -> bool {
+    std::unique_lock lock(mMutex);
+
+    // the other slot becomes our next write slot, so the consumer has to be done with it
+    mCondition.wait(lock, [this] { return mShutdown || (!mPending && !mReading); });
+    if (mShutdown) {
+        return false;
+    }
+
+    mReadIndex = mWriteIndex;
+    mWriteIndex ^= 1U;
+    mPending = true;
+
+    lock.unlock();
+    mCondition.notify_all();
+    return true;
+}
+
+auto RenderCommandQueue::acquire() -> const RenderSnapshot* {
+    std::unique_lock lock(mMutex);
+
+    mCondition.wait(lock, [this] { return mShutdown || mPending; });
+    if (mShutdown) {
+        return nullptr;
+    }
+
+    mPending = false;
+    mReading = true;
+    return &mSnapshots[mReadIndex];
+}
+
+auto RenderCommandQueue::release() -> void {
+    {
+        std::scoped_lock lock(mMutex);
+        mReading = false;
+    }
+    mCondition.notify_all();
+}
+
+auto RenderCommandQueue::shutdown() -> void {
+    {
+        std::scoped_lock lock(mMutex);
+        mShutdown = true;
+    }
+    mCondition.notify_all();
+}
+
+auto RenderCommandQueue::isShutdown() -> bool {
+    std::scoped_lock lock(mMutex);
+    return mShutdown;
+}
@@ -0,0 +1,62 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#if !defined(__ADELIE_CORE_RENDERER_RENDERCOMMANDQUEUE_HXX__)
+    #define __ADELIE_CORE_RENDERER_RENDERCOMMANDQUEUE_HXX__
+
+    #include <adelie/adelie.hxx>
+    #include <adelie/core/renderer/RenderSnapshot.hxx>
+    #include <array>
+    #include <condition_variable>
+    #include <mutex>
+
+namespace adelie::core::renderer {
+
+    // hands render snapshots from the main thread (producer) to the render thread (consumer). Two snapshots are used
+    // alternately, so the main thread can simulate frame N+1 while the render thread is still recording and submitting
+    // frame N. The producer only blocks if it is a whole frame ahead of the consumer
+    class ADELIE_API RenderCommandQueue {
+        public:
+            RenderCommandQueue();
+
+            ~RenderCommandQueue() noexcept = default;
+
+            RenderCommandQueue(const RenderCommandQueue&) = delete;
+
+            auto operator=(RenderCommandQueue const&) -> RenderCommandQueue& = delete;
+
+            RenderCommandQueue(RenderCommandQueue&&) = delete;
+
+            auto operator=(RenderCommandQueue&&) -> RenderCommandQueue& = delete;
+
+            // producer: the snapshot which can be filled for the next frame, the commands of the last use are cleared
+            auto beginWrite() -> RenderSnapshot&;
+
+            // producer: publish the written snapshot, returns false if the queue was shut down in the meantime
+            auto submit() -> bool;
+
+            // consumer: block until a snapshot was published, returns nullptr once the queue was shut down
+            auto acquire() -> const RenderSnapshot*;
+
+            // consumer: the acquired snapshot is not used anymore and can be written by the producer again
+            auto release() -> void;
+
+            // wake up both sides and let all further calls fail, used to stop the render thread
+            auto shutdown() -> void;
+
+            [[nodiscard]] auto isShutdown() -> bool;
+
+        private:
+            std::array<RenderSnapshot, 2> mSnapshots;
+            std::mutex mMutex;
+            std::condition_variable mCondition;
+            uint32_t mWriteIndex;
+            uint32_t mReadIndex;
+            bool mPending;  // a snapshot was submitted but not acquired yet
+            bool mReading;  // the consumer currently holds the snapshot at mReadIndex
+            bool mShutdown;
+
+    }; /* class RenderCommandQueue */
+
+} /* namespace adelie::core::renderer */
+
+#endif /* if !defined(__ADELIE_CORE_RENDERER_RENDERCOMMANDQUEUE_HXX__) */
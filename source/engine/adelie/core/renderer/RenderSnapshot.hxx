@@ -0,0 +1,83 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#if !defined(__ADELIE_CORE_RENDERER_RENDERSNAPSHOT_HXX__)
+    #define __ADELIE_CORE_RENDERER_RENDERSNAPSHOT_HXX__
+
+    #include <adelie/adelie.hxx>
+    #include <adelie/core/renderer/ShadowCascades.hxx>
+    #include <array>
+    #include <cstdint>
+    #include <vector>
+
+namespace adelie::core::renderer {
+
+    // a single draw of a level of detail of a mesh with the supplied model transformation
+    struct ADELIE_API RenderCommand {
+            glm::mat4 model;
+            uint32_t meshId;
+            uint32_t lod;
+    };
+
+    // a point light in world space
+    struct ADELIE_API RenderLight {
+            glm::vec3 position;
+            float range;
+            glm::vec3 color;
+            float intensity;
+    };
+
+    // a particle emitter in world space, see ParticleEmitterComponent
+    struct ADELIE_API RenderParticleEmitter {
+            glm::vec3 position;
+            float rate;
+            glm::vec3 direction;
+            float spread;
+            glm::vec3 color;
+            float speed;
+            float lifetime;
+    };
+
+    // a textured quad of the overlay in window pixels, the origin is the top left corner, see QuadBatch
+    struct ADELIE_API RenderQuad {
+            glm::vec2 min;
+            glm::vec2 max;
+            glm::vec2 uvMin;
+            glm::vec2 uvMax;
+            uint32_t color;    // packed as 0xAABBGGRR, multiplied with the texel
+            uint32_t page;     // the texture (atlas page) the quad samples
+            uint64_t sortKey;  // the layer, the page and the submission order
+    };
+
+    // a shadow cascade of the directional light and the range of its casters in RenderSnapshot::shadowCasters
+    struct ADELIE_API RenderShadowCascade {
+            glm::mat4 viewProjection;
+            float splitDepth;
+            uint32_t firstCaster;
+            uint32_t casterCount;
+    };
+
+    // everything the render thread needs to know about a simulated frame. The main thread fills one snapshot while
+    // the render thread still draws the previous one, so a snapshot must never reference mutable simulation state
+    struct ADELIE_API RenderSnapshot {
+            uint64_t simulationFrame;
+            float simulationTime;
+            float interpolationAlpha;  // between the previous and the current simulation step, see SimulationLoop
+            float deltaTime;           // the real time since the last snapshot
+            uint32_t windowWidth;
+            uint32_t windowHeight;
+            glm::mat4 view;
+            glm::mat4 projection;
+            float nearPlane;  // of the projection
+            float farPlane;
+            std::vector<RenderCommand> commands;
+            std::vector<RenderLight> lights;
+            glm::vec3 lightDirection;  // towards the directional light
+            std::array<RenderShadowCascade, SHADOW_CASCADE_COUNT> shadowCascades;
+            std::vector<RenderCommand> shadowCasters;  // a caster is repeated for every cascade it falls into
+            std::vector<RenderParticleEmitter> particleEmitters;
+            std::vector<RenderQuad> overlayQuads;  // sorted by layer and page
+    };
+
+} /* namespace adelie::core::renderer */
+
+#endif /* if !defined(__ADELIE_CORE_RENDERER_RENDERSNAPSHOT_HXX__) */
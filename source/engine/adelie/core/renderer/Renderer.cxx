@@ -1,17 +1,82 @@
 // Copyright (c) 2025 by Tim Janke. All rights reserved.
 
+#include <adelie/core/jobs/JobSystem.hxx>
 #include <adelie/core/renderer/Renderer.hxx>
 #include <adelie/exception/RuntimeException.hxx>
+#include <adelie/io/AssetPack.hxx>
+#include <adelie/io/AssetPackMount.hxx>
+#include <adelie/io/DirectoryMount.hxx>
 #include <adelie/io/Logger.hxx>
+#include <adelie/io/VirtualFileSystem.hxx>
 #include <adelie/renderer/vulkan/VulkanRenderer.hxx>
+#include <filesystem>
 
+using adelie::core::LayerStack;
+using adelie::core::jobs::JobSystem;
+using adelie::core::renderer::QuadBatch;
 using adelie::core::renderer::Renderer;
+using adelie::core::scene::Scene;
 using adelie::exception::RuntimeException;
+using adelie::io::AssetPack;
+using adelie::io::AssetPackMount;
+using adelie::io::DirectoryMount;
+using adelie::io::VirtualFileSystem;
 using adelie::renderer::vulkan::VulkanRenderer;
 
+namespace {
+    // the asset pack which shadows the loose files if it is found in the working directory
+    constexpr auto ASSET_PACK_FILENAME = "assets.adpk";
+
+    // the font of the overlay texts
+    constexpr auto OVERLAY_FONT_FILENAME = "fonts/DejaVuSansMono.ttf";
+}  // namespace
+
 Renderer::API Renderer::sAPI = API::None;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 
+auto Renderer::getLayerStack() -> LayerStack& {
+    static LayerStack staticLayerStack;
+    return staticLayerStack;
+}
+
+auto Renderer::getScene() -> Scene& {
+    // the layer stack owns (and deletes) its layers
+    static auto* staticScene = [] {
+        auto* scene = new Scene();  // NOLINT(cppcoreguidelines-owning-memory)
+        getLayerStack().pushLayer(scene);
+        return scene;
+    }();
+    return *staticScene;
+}
+
+auto Renderer::getOverlay() -> QuadBatch& {
+    static QuadBatch staticOverlay;
+    return staticOverlay;
+}
+
 auto Renderer::initialize(const std::shared_ptr<WindowInterface>& windowInterface) -> void {
+    // the calling thread becomes worker 0 of the job system and every other core gets its own worker
+    JobSystem::getInstance()->initialize(std::thread::hardware_concurrency());
+
+    // everything started here is stopped in reverse order once the renderer returned, or if it failed to start
+    struct Shutdown {
+            ~Shutdown() noexcept {
+                getOverlay().getFont().wait();
+                VirtualFileSystem::getInstance()->unmount("");
+                JobSystem::getInstance()->shutdown();
+            }
+    };
+    const Shutdown shutdown;
+
+    // development builds read the loose files, shipped builds additionally mount a pack on top of them
+    auto* fileSystem = VirtualFileSystem::getInstance();
+    fileSystem->mount("", std::make_shared<DirectoryMount>(std::filesystem::current_path()));
+    if (std::filesystem::exists(ASSET_PACK_FILENAME)) {
+        fileSystem->mount("", std::make_shared<AssetPackMount>(std::make_shared<const AssetPack>(ASSET_PACK_FILENAME)));
+    }
+
+    // the glyph atlas is built in the background while the renderer starts up
+    getOverlay().getFont().load(OVERLAY_FONT_FILENAME);
+
     AdelieLogDebug("Start initializing the selected rendering API");
     switch (sAPI) {
         case API::Vulkan:
@@ -21,4 +86,4 @@ auto Renderer::initialize(const std::shared_ptr<WindowInterface>& windowInterfac
         default:
             throw RuntimeException("No rendering API selected");
     }
-}
\ No newline at end of file
+}
@@ -4,7 +4,10 @@
     #define __ADELIE_CORE_RENDERER_RENDERER_HXX__
 
     #include <adelie/adelie.hxx>
+    #include <adelie/core/LayerStack.hxx>
+    #include <adelie/core/renderer/QuadBatch.hxx>
     #include <adelie/core/renderer/WindowInterface.hxx>
+    #include <adelie/core/scene/Scene.hxx>
 
 namespace adelie::core::renderer {
 
@@ -18,6 +21,15 @@ namespace adelie::core::renderer {
 
             static auto setAPI(const API& selectedAPI) -> void { sAPI = selectedAPI; }
 
+            // the layers updated by the simulation loop, they are pushed by the client before the renderer is initialized
+            static auto getLayerStack() -> LayerStack&;
+
+            // the scene the renderer draws, it is pushed onto the layer stack the first time it is requested
+            static auto getScene() -> scene::Scene&;
+
+            // the 2D quads of the overlay, the layers draw into it from Layer::onUIRendering
+            static auto getOverlay() -> QuadBatch&;
+
         private:
             static API sAPI;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 
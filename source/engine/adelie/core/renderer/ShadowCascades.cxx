@@ -0,0 +1,72 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#include <adelie/core/renderer/ShadowCascades.hxx>
+#include <algorithm>
+#include <cmath>
+#include <glm/gtc/matrix_transform.hpp>
+
+using adelie::core::renderer::ShadowCascade;
+using adelie::core::renderer::ShadowCascades;
+
+namespace {
+    // 0 splits uniformly, 1 logarithmically
+    constexpr float SPLIT_LAMBDA = 0.75f;
+
+    // the radius of a cascade is rounded up to this step, so the float noise of the corners does not resize it
+    constexpr float RADIUS_STEP = 1.0f / 16.0f;
+}  // namespace
+
+auto ShadowCascades::fit(const glm::mat4& view, const glm::mat4& projection, const float nearPlane, const float farPlane, const glm::vec3& lightDirection, const float casterDistance)
+    -> std::array<ShadowCascade, SHADOW_CASCADE_COUNT> {
+    // the corners of the view frustum on the near (0 to 3) and the far plane (4 to 7) in world space
+    const auto inverseViewProjection = glm::inverse(projection * view);
+    std::array<glm::vec3, 8> corners{};
+    for (uint32_t i = 0; i < corners.size(); i++) {
+        const glm::vec4 ndc((i & 1U) != 0 ? 1.0f : -1.0f, (i & 2U) != 0 ? 1.0f : -1.0f, (i & 4U) != 0 ? 1.0f : 0.0f, 1.0f);
+        const auto corner = inverseViewProjection * ndc;
+        corners[i] = glm::vec3(corner) / corner.w;
+    }
+
+    // the light view only rotates, so the texel grid of a cascade does not move with the camera
+    const auto up = std::abs(lightDirection.z) > 0.99f ? glm::vec3(1.0f, 0.0f, 0.0f) : glm::vec3(0.0f, 0.0f, 1.0f);
+    const auto lightView = glm::lookAt(glm::vec3(0.0f), -lightDirection, up);
+
+    std::array<ShadowCascade, SHADOW_CASCADE_COUNT> cascades{};
+    float sliceNear = nearPlane;
+    for (uint32_t cascade = 0; cascade < SHADOW_CASCADE_COUNT; cascade++) {
+        const float ratio = static_cast<float>(cascade + 1) / static_cast<float>(SHADOW_CASCADE_COUNT);
+        const float logarithmic = nearPlane * std::pow(farPlane / nearPlane, ratio);
+        const float uniform = nearPlane + ((farPlane - nearPlane) * ratio);
+        const float sliceFar = (SPLIT_LAMBDA * logarithmic) + ((1.0f - SPLIT_LAMBDA) * uniform);
+
+        // the view depth grows linearly along the edges of the frustum
+        std::array<glm::vec3, 8> slice{};
+        glm::vec3 center(0.0f);
+        for (uint32_t edge = 0; edge < 4; edge++) {
+            const auto direction = corners[edge + 4] - corners[edge];
+            slice[edge] = corners[edge] + (direction * ((sliceNear - nearPlane) / (farPlane - nearPlane)));
+            slice[edge + 4] = corners[edge] + (direction * ((sliceFar - nearPlane) / (farPlane - nearPlane)));
+            center += slice[edge] + slice[edge + 4];
+        }
+        center /= 8.0f;
+
+        float radius = 0.0f;
+        for (const auto& corner : slice) {
+            radius = std::max(radius, glm::length(corner - center));
+        }
+        radius = std::ceil(radius / RADIUS_STEP) * RADIUS_STEP;
+
+        // the center is snapped to whole texels in light space, the depth as well, so small camera moves keep the
+        // matrix bit for bit
+        const float texelSize = (2.0f * radius) / static_cast<float>(SHADOW_MAP_SIZE);
+        auto lightCenter = glm::vec3(lightView * glm::vec4(center, 1.0f));
+        lightCenter = glm::floor(lightCenter / texelSize) * texelSize;
+
+        // the light looks down its negative z axis, the casters in front of the slice have a larger z
+        const auto lightProjection = glm::ortho(lightCenter.x - radius, lightCenter.x + radius, lightCenter.y - radius, lightCenter.y + radius, -(lightCenter.z + radius + casterDistance),
+                                                -(lightCenter.z - radius));
+        cascades[cascade] = {.viewProjection = lightProjection * lightView, .splitDepth = sliceFar};
+        sliceNear = sliceFar;
+    }
+    return cascades;
+}
@@ -0,0 +1,39 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#if !defined(__ADELIE_CORE_RENDERER_SHADOWCASCADES_HXX__)
+    #define __ADELIE_CORE_RENDERER_SHADOWCASCADES_HXX__
+
+    #include <adelie/adelie.hxx>
+    #include <array>
+    #include <cstdint>
+
+namespace adelie::core::renderer {
+
+    // the view frustum of the directional light is covered by this many shadow maps of SHADOW_MAP_SIZE texels. The
+    // count is repeated by cube.frag
+    static inline constexpr uint32_t SHADOW_CASCADE_COUNT = 4;
+    static inline constexpr uint32_t SHADOW_MAP_SIZE = 2048;
+
+    struct ADELIE_API ShadowCascade {
+            glm::mat4 viewProjection;  // from world space to the clip space of the shadow map
+            float splitDepth;          // the view depth the cascade ends at
+    }; /* struct ShadowCascade */
+
+    // fits an orthographic projection along the light around each slice of the view frustum. The slices are a blend
+    // of a logarithmic and a uniform split
+    //
+    // the fit is stable: a cascade is sized by the bounding sphere of its slice, which does not change when the camera
+    // turns, and it only moves in whole texels of its shadow map. So the shadow edges do not shimmer and the light
+    // matrix of a cascade stays the same while the camera moves less than a texel, which lets the renderer reuse it
+    class ADELIE_API ShadowCascades {
+        public:
+            // lightDirection points towards the light. casterDistance is how far in front of a slice, towards the
+            // light, a caster can still throw a shadow into it
+            [[nodiscard]] static auto fit(const glm::mat4& view, const glm::mat4& projection, float nearPlane, float farPlane, const glm::vec3& lightDirection, float casterDistance)
+                -> std::array<ShadowCascade, SHADOW_CASCADE_COUNT>;
+
+    }; /* class ShadowCascades */
+
+} /* namespace adelie::core::renderer */
+
+#endif /* if !defined(__ADELIE_CORE_RENDERER_SHADOWCASCADES_HXX__) */
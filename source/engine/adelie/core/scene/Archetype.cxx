@@ -0,0 +1,94 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#include <adelie/core/scene/Archetype.hxx>
+#include <adelie/exception/RuntimeException.hxx>
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <new>
+
+using adelie::core::scene::Archetype;
+using adelie::core::scene::ArchetypeLocation;
+using adelie::core::scene::ComponentMask;
+using adelie::core::scene::ComponentRegistry;
+using adelie::core::scene::Entity;
+using adelie::exception::RuntimeException;
+
+namespace {
+    // every array of a chunk starts on its own cache line
+    constexpr std::size_t ARCHETYPE_COLUMN_ALIGNMENT = 64;
+
+    auto alignUp(const std::size_t value, const std::size_t alignment) -> std::size_t {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+}  // namespace
+
+auto Archetype::ChunkDeleter::operator()(std::byte* data) const -> void {
+    ::operator delete[](data, std::align_val_t{ARCHETYPE_COLUMN_ALIGNMENT});
+}
+
+Archetype::Archetype(const ComponentMask mask) {
+    mMask = mask;
+    mColumnOffsets.fill(0);
+    for (auto bits = mask; 0 != bits; bits &= bits - 1) {
+        mComponents.push_back(static_cast<ComponentTypeId>(std::countr_zero(bits)));
+    }
+
+    const auto* registry = ComponentRegistry::getInstance();
+    std::size_t rowSize = sizeof(Entity);
+    for (const auto id : mComponents) {
+        rowSize += registry->getInfo(id).size;
+    }
+
+    // start with the capacity the rows would have without any padding and shrink it until the aligned arrays fit
+    auto capacity = static_cast<uint32_t>(ARCHETYPE_CHUNK_SIZE / rowSize);
+    for (; capacity > 0; capacity--) {
+        std::size_t offset = alignUp(capacity * sizeof(Entity), ARCHETYPE_COLUMN_ALIGNMENT);
+        for (const auto id : mComponents) {
+            const auto& info = registry->getInfo(id);
+            offset = alignUp(offset, std::max(info.alignment, ARCHETYPE_COLUMN_ALIGNMENT));
+            mColumnOffsets[id] = offset;
+            offset += capacity * info.size;
+        }
+        if (offset <= ARCHETYPE_CHUNK_SIZE) {
+            break;
+        }
+    }
+    if (0 == capacity) {
+        throw RuntimeException("The components of an archetype do not fit into a single chunk");
+    }
+    mChunkCapacity = capacity;
+}
+
+auto Archetype::allocate(const Entity entity) -> ArchetypeLocation {
+    if (mChunks.empty() || mChunks.back().count == mChunkCapacity) {
+        auto* data = static_cast<std::byte*>(::operator new[](ARCHETYPE_CHUNK_SIZE, std::align_val_t{ARCHETYPE_COLUMN_ALIGNMENT}));
+        mChunks.push_back({std::unique_ptr<std::byte[], ChunkDeleter>(data), 0});  // NOLINT(cppcoreguidelines-avoid-c-arrays)
+    }
+
+    const auto chunk = static_cast<uint32_t>(mChunks.size() - 1);
+    const auto row = mChunks.back().count++;
+    std::memcpy(mChunks[chunk].data.get() + (row * sizeof(Entity)), &entity, sizeof(Entity));
+    return {chunk, row};
+}
+
+auto Archetype::remove(const ArchetypeLocation& location) -> Entity {
+    const auto lastChunk = static_cast<uint32_t>(mChunks.size() - 1);
+    const auto lastRow = mChunks[lastChunk].count - 1;
+
+    Entity moved = getEntities(lastChunk)[lastRow];
+    if (location.chunk != lastChunk || location.row != lastRow) {
+        const auto* registry = ComponentRegistry::getInstance();
+        std::memcpy(mChunks[location.chunk].data.get() + (location.row * sizeof(Entity)), &moved, sizeof(Entity));
+        for (const auto id : mComponents) {
+            const auto size = registry->getInfo(id).size;
+            std::memcpy(getColumn(location.chunk, id) + (location.row * size), getColumn(lastChunk, id) + (lastRow * size), size);
+        }
+    }
+
+    // an empty chunk is released right away, the next allocation of a new chunk is rare compared to the iterations
+    if (0 == --mChunks[lastChunk].count) {
+        mChunks.pop_back();
+    }
+    return moved;
+}
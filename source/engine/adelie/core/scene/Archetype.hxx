@@ -0,0 +1,96 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#if !defined(__ADELIE_CORE_SCENE_ARCHETYPE_HXX__)
+    #define __ADELIE_CORE_SCENE_ARCHETYPE_HXX__
+
+    #include <adelie/adelie.hxx>
+    #include <adelie/core/scene/ComponentRegistry.hxx>
+    #include <adelie/core/scene/Entity.hxx>
+    #include <array>
+    #include <cstddef>
+    #include <cstdint>
+    #include <memory>
+    #include <vector>
+
+namespace adelie::core::scene {
+
+    // the size of the memory block a chunk stores its entities in, small enough that the arrays of a query stay in the
+    // L1/L2 cache while a chunk is processed
+    static inline constexpr std::size_t ARCHETYPE_CHUNK_SIZE = 16ULL * 1024ULL;
+
+    // the position of an entity in an archetype
+    struct ArchetypeLocation {
+            uint32_t chunk;
+            uint32_t row;
+    }; /* struct ArchetypeLocation */
+
+    // stores all entities with exactly the same set of components. The entities are packed into fixed-size chunks and
+    // every chunk holds one array per component type (structure of arrays), so a system which reads two components of
+    // thousands of entities streams through two dense arrays per chunk
+    //
+    // the chunks are always packed: only the last chunk is partially filled, a removed entity is replaced by the last
+    // one of the archetype
+    class ADELIE_API Archetype {
+        public:
+            explicit Archetype(ComponentMask mask);
+
+            ~Archetype() noexcept = default;
+
+            Archetype(const Archetype&) = delete;
+
+            auto operator=(Archetype const&) -> Archetype& = delete;
+
+            Archetype(Archetype&&) = delete;
+
+            auto operator=(Archetype&&) -> Archetype& = delete;
+
+            [[nodiscard]] auto getMask() const -> ComponentMask { return mMask; }
+
+            [[nodiscard]] auto hasComponent(const ComponentTypeId id) const -> bool { return (mMask & (ComponentMask{1} << id)) != 0; }
+
+            [[nodiscard]] auto getChunkCapacity() const -> uint32_t { return mChunkCapacity; }
+
+            [[nodiscard]] auto getChunkCount() const -> uint32_t { return static_cast<uint32_t>(mChunks.size()); }
+
+            [[nodiscard]] auto getEntityCount(const uint32_t chunk) const -> uint32_t { return mChunks[chunk].count; }
+
+            [[nodiscard]] auto getEntities(const uint32_t chunk) const -> const Entity* {
+                return reinterpret_cast<const Entity*>(mChunks[chunk].data.get());  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            }
+
+            // the array of a component in a chunk, the component has to be part of the archetype
+            [[nodiscard]] auto getColumn(const uint32_t chunk, const ComponentTypeId id) const -> std::byte* { return mChunks[chunk].data.get() + mColumnOffsets[id]; }
+
+            template <typename T>
+            [[nodiscard]] auto getArray(const uint32_t chunk) const -> T* {
+                return reinterpret_cast<T*>(getColumn(chunk, ComponentRegistry::getId<std::remove_const_t<T>>()));  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            }
+
+            // appends an entity, its components are left uninitialized
+            auto allocate(Entity entity) -> ArchetypeLocation;
+
+            // removes the entity at the location by moving the last entity of the archetype into its place. Returns
+            // the entity which was moved (the removed one itself if it was the last)
+            auto remove(const ArchetypeLocation& location) -> Entity;
+
+        private:
+            struct ChunkDeleter {
+                    auto operator()(std::byte* data) const -> void;
+            };
+
+            struct Chunk {
+                    std::unique_ptr<std::byte[], ChunkDeleter> data;  // NOLINT(cppcoreguidelines-avoid-c-arrays)
+                    uint32_t count;
+            };
+
+            ComponentMask mMask;
+            std::vector<ComponentTypeId> mComponents;
+            std::array<std::size_t, MAX_COMPONENT_TYPES> mColumnOffsets;
+            uint32_t mChunkCapacity;
+            std::vector<Chunk> mChunks;
+
+    }; /* class Archetype */
+
+} /* namespace adelie::core::scene */
+
+#endif /* if !defined(__ADELIE_CORE_SCENE_ARCHETYPE_HXX__) */
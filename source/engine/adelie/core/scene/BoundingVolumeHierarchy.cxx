@@ -0,0 +1,407 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#include <adelie/core/scene/BoundingVolumeHierarchy.hxx>
+#include <limits>
+
+using adelie::core::scene::Aabb;
+using adelie::core::scene::BoundingVolumeHierarchy;
+using adelie::core::scene::BvhNode;
+using adelie::core::scene::BvhProxy;
+
+static_assert(sizeof(BvhNode) == 32, "two nodes are expected to share a cache line");
+
+namespace {
+    // the leaves are enlarged by this margin, an object which moves less does not change the tree
+    constexpr float BVH_AABB_MARGIN = 0.1F;
+
+    // the tree is rebuilt once its cost grew by this factor since the last rebuild
+    constexpr float BVH_REBUILD_COST_RATIO = 1.5F;
+
+    // the cost is only measured after this many refits, or a quarter of the proxies, whichever is more
+    constexpr uint32_t BVH_MIN_REFITS_BEFORE_CHECK = 64;
+
+    constexpr uint32_t BVH_BIN_COUNT = 16;
+
+    // below this depth a rebuild splits at the median instead of the SAH, so the depth of the rebuilt tree stays
+    // within this plus the binary logarithm of the proxy count
+    constexpr uint32_t BVH_MAX_SAH_DEPTH = 24;
+
+    auto enlarge(const Aabb& bounds) -> Aabb {
+        const glm::vec3 margin(BVH_AABB_MARGIN);
+        return {bounds.min - margin, bounds.max + margin};
+    }
+
+    auto setBounds(BvhNode& node, const Aabb& bounds) -> void {
+        node.min = bounds.min;
+        node.max = bounds.max;
+    }
+}  // namespace
+
+BoundingVolumeHierarchy::BoundingVolumeHierarchy() {
+    mRoot = BVH_NULL;
+    mFreeNode = BVH_NULL;
+    mProxyCount = 0;
+    mRefitsSinceRebuild = 0;
+    mCostAfterRebuild = 0.0F;
+}
+
+auto BoundingVolumeHierarchy::allocateNode() -> uint32_t {
+    if (BVH_NULL != mFreeNode) {
+        const auto index = mFreeNode;
+        mFreeNode = mNodes[index].child0;
+        return index;
+    }
+    mNodes.push_back({});
+    mParents.push_back(BVH_NULL);
+    mHeights.push_back(0);
+    return static_cast<uint32_t>(mNodes.size() - 1);
+}
+
+auto BoundingVolumeHierarchy::freeNode(const uint32_t index) -> void {
+    mNodes[index].child0 = mFreeNode;
+    mNodes[index].child1 = BVH_NULL;
+    mParents[index] = BVH_NULL;
+    mHeights[index] = 0;
+    mFreeNode = index;
+}
+
+auto BoundingVolumeHierarchy::createProxy(const Aabb& bounds, const uint64_t userData) -> BvhProxy {
+    BvhProxy proxy = 0;
+    if (mFreeProxies.empty()) {
+        proxy = static_cast<BvhProxy>(mProxies.size());
+        mProxies.push_back({});
+    } else {
+        proxy = mFreeProxies.back();
+        mFreeProxies.pop_back();
+    }
+
+    const auto leaf = allocateNode();
+    setBounds(mNodes[leaf], enlarge(bounds));
+    mNodes[leaf].child0 = proxy;
+    mNodes[leaf].child1 = BVH_NULL;
+    mProxies[proxy] = {leaf, userData};
+    mProxyCount++;
+
+    insertLeaf(leaf);
+    return proxy;
+}
+
+auto BoundingVolumeHierarchy::destroyProxy(const BvhProxy proxy) -> void {
+    const auto leaf = mProxies[proxy].node;
+    if (BVH_NULL == leaf) {
+        return;
+    }
+
+    removeLeaf(leaf);
+    freeNode(leaf);
+    mProxies[proxy] = {BVH_NULL, 0};
+    mFreeProxies.push_back(proxy);
+    mProxyCount--;
+}
+
+auto BoundingVolumeHierarchy::moveProxy(const BvhProxy proxy, const Aabb& bounds) -> bool {
+    const auto leaf = mProxies[proxy].node;
+    if (mNodes[leaf].getBounds().contains(bounds)) {
+        return false;
+    }
+
+    // the leaf stays where it is, only its ancestors are refit
+    setBounds(mNodes[leaf], enlarge(bounds));
+    refit(mParents[leaf]);
+    mRefitsSinceRebuild++;
+    return true;
+}
+
+auto BoundingVolumeHierarchy::insertLeaf(const uint32_t leaf) -> void {
+    if (BVH_NULL == mRoot) {
+        mRoot = leaf;
+        mParents[leaf] = BVH_NULL;
+        return;
+    }
+
+    // walk down to the sibling which increases the surface area of the tree the least. Every node on the way grows
+    // to enclose the leaf, which is inherited by the cost of all its children
+    const auto leafBounds = mNodes[leaf].getBounds();
+    auto sibling = mRoot;
+    while (!mNodes[sibling].isLeaf()) {
+        const auto& node = mNodes[sibling];
+        const float area = node.getBounds().getSurfaceArea();
+        const float combinedArea = Aabb::merge(node.getBounds(), leafBounds).getSurfaceArea();
+
+        // a new parent for this node and the leaf
+        const float cost = 2.0F * combinedArea;
+        const float inheritanceCost = 2.0F * (combinedArea - area);
+
+        const auto childCost = [&](const uint32_t child) {
+            const auto childBounds = mNodes[child].getBounds();
+            const float mergedArea = Aabb::merge(childBounds, leafBounds).getSurfaceArea();
+            if (mNodes[child].isLeaf()) {
+                return mergedArea + inheritanceCost;
+            }
+            return mergedArea - childBounds.getSurfaceArea() + inheritanceCost;
+        };
+        const float cost0 = childCost(node.child0);
+        const float cost1 = childCost(node.child1);
+        if (cost < cost0 && cost < cost1) {
+            break;
+        }
+        sibling = cost0 < cost1 ? node.child0 : node.child1;
+    }
+
+    const auto oldParent = mParents[sibling];
+    const auto newParent = allocateNode();
+    setBounds(mNodes[newParent], Aabb::merge(leafBounds, mNodes[sibling].getBounds()));
+    mNodes[newParent].child0 = sibling;
+    mNodes[newParent].child1 = leaf;
+    mParents[newParent] = oldParent;
+    mParents[sibling] = newParent;
+    mParents[leaf] = newParent;
+    mHeights[newParent] = mHeights[sibling] + 1;
+
+    if (BVH_NULL == oldParent) {
+        mRoot = newParent;
+        return;
+    }
+    if (mNodes[oldParent].child0 == sibling) {
+        mNodes[oldParent].child0 = newParent;
+    } else {
+        mNodes[oldParent].child1 = newParent;
+    }
+    refit(oldParent);
+}
+
+auto BoundingVolumeHierarchy::removeLeaf(const uint32_t leaf) -> void {
+    if (leaf == mRoot) {
+        mRoot = BVH_NULL;
+        return;
+    }
+
+    // the sibling takes the place of the parent
+    const auto parent = mParents[leaf];
+    const auto grandParent = mParents[parent];
+    const auto sibling = mNodes[parent].child0 == leaf ? mNodes[parent].child1 : mNodes[parent].child0;
+    freeNode(parent);
+    mParents[sibling] = grandParent;
+
+    if (BVH_NULL == grandParent) {
+        mRoot = sibling;
+        return;
+    }
+    if (mNodes[grandParent].child0 == parent) {
+        mNodes[grandParent].child0 = sibling;
+    } else {
+        mNodes[grandParent].child1 = sibling;
+    }
+    refit(grandParent);
+}
+
+auto BoundingVolumeHierarchy::refit(uint32_t index) -> void {
+    // the ancestors of a node whose bounds and height did not change are not affected either
+    while (BVH_NULL != index) {
+        const auto previousBounds = mNodes[index].getBounds();
+        const auto previousHeight = mHeights[index];
+        index = balance(index);
+
+        auto& node = mNodes[index];
+        const auto bounds = Aabb::merge(mNodes[node.child0].getBounds(), mNodes[node.child1].getBounds());
+        const auto height = std::max(mHeights[node.child0], mHeights[node.child1]) + 1;
+        if (bounds.min == previousBounds.min && bounds.max == previousBounds.max && height == previousHeight) {
+            return;
+        }
+        setBounds(node, bounds);
+        mHeights[index] = height;
+        index = mParents[index];
+    }
+}
+
+auto BoundingVolumeHierarchy::balance(const uint32_t index) -> uint32_t {
+    // the higher child takes the place of the node, which in turn adopts the lower grandchild. The bounds of the
+    // subtree stay the same, only its height shrinks
+    const auto child0 = mNodes[index].child0;
+    const auto child1 = mNodes[index].child1;
+    const auto difference = static_cast<int64_t>(mHeights[child1]) - static_cast<int64_t>(mHeights[child0]);
+    if (difference >= -1 && difference <= 1) {
+        return index;
+    }
+
+    const auto higher = difference > 0 ? child1 : child0;
+    const auto lower = difference > 0 ? child0 : child1;
+    const auto grandChild0 = mNodes[higher].child0;
+    const auto grandChild1 = mNodes[higher].child1;
+    const bool keepChild0 = mHeights[grandChild0] > mHeights[grandChild1];
+    const auto kept = keepChild0 ? grandChild0 : grandChild1;
+    const auto moved = keepChild0 ? grandChild1 : grandChild0;
+
+    const auto parent = mParents[index];
+    mParents[higher] = parent;
+    if (BVH_NULL == parent) {
+        mRoot = higher;
+    } else if (mNodes[parent].child0 == index) {
+        mNodes[parent].child0 = higher;
+    } else {
+        mNodes[parent].child1 = higher;
+    }
+
+    mNodes[index].child0 = lower;
+    mNodes[index].child1 = moved;
+    mParents[moved] = index;
+    setBounds(mNodes[index], Aabb::merge(mNodes[lower].getBounds(), mNodes[moved].getBounds()));
+    mHeights[index] = std::max(mHeights[lower], mHeights[moved]) + 1;
+
+    mNodes[higher].child0 = index;
+    mNodes[higher].child1 = kept;
+    mParents[index] = higher;
+    setBounds(mNodes[higher], Aabb::merge(mNodes[index].getBounds(), mNodes[kept].getBounds()));
+    mHeights[higher] = std::max(mHeights[index], mHeights[kept]) + 1;
+    return higher;
+}
+
+auto BoundingVolumeHierarchy::getCost() const -> float {
+    if (BVH_NULL == mRoot || mNodes[mRoot].isLeaf()) {
+        return 0.0F;
+    }
+
+    float area = 0.0F;
+    TraversalStack<uint32_t> stack;
+    stack.push(mRoot);
+    while (!stack.isEmpty()) {
+        const auto& node = mNodes[stack.pop()];
+        if (!node.isLeaf()) {
+            area += node.getBounds().getSurfaceArea();
+            stack.push(node.child0);
+            stack.push(node.child1);
+        }
+    }
+    return area / mNodes[mRoot].getBounds().getSurfaceArea();
+}
+
+auto BoundingVolumeHierarchy::optimize() -> void {
+    if (mRefitsSinceRebuild < std::max(BVH_MIN_REFITS_BEFORE_CHECK, mProxyCount / 4)) {
+        return;
+    }
+
+    if (getCost() > mCostAfterRebuild * BVH_REBUILD_COST_RATIO) {
+        rebuild();
+    } else {
+        mRefitsSinceRebuild = 0;
+    }
+}
+
+auto BoundingVolumeHierarchy::rebuild() -> void {
+    std::vector<BuildItem> items;
+    items.reserve(mProxyCount);
+    for (BvhProxy proxy = 0; proxy < mProxies.size(); proxy++) {
+        const auto leaf = mProxies[proxy].node;
+        if (BVH_NULL != leaf) {
+            const auto bounds = mNodes[leaf].getBounds();
+            items.push_back({proxy, bounds, bounds.getCenter()});
+        }
+    }
+
+    // the nodes are emitted in depth-first order, a parent is directly followed by its first child
+    mNodes.clear();
+    mParents.clear();
+    mHeights.clear();
+    mFreeNode = BVH_NULL;
+    mRoot = BVH_NULL;
+    if (!items.empty()) {
+        mNodes.reserve((2 * items.size()) - 1);
+        mParents.reserve((2 * items.size()) - 1);
+        mHeights.reserve((2 * items.size()) - 1);
+        mRoot = build(items, BVH_NULL, 0);
+    }
+
+    mRefitsSinceRebuild = 0;
+    mCostAfterRebuild = getCost();
+}
+
+auto BoundingVolumeHierarchy::build(const std::span<BuildItem> items, const uint32_t parent, const uint32_t depth) -> uint32_t {
+    const auto index = allocateNode();
+    mParents[index] = parent;
+
+    if (1 == items.size()) {
+        setBounds(mNodes[index], items[0].bounds);
+        mNodes[index].child0 = items[0].proxy;
+        mNodes[index].child1 = BVH_NULL;
+        mProxies[items[0].proxy].node = index;
+        return index;
+    }
+
+    Aabb centroids{items[0].centroid, items[0].centroid};
+    for (const auto& item : items) {
+        centroids = Aabb::merge(centroids, {item.centroid, item.centroid});
+    }
+
+    // the centroids are sorted into bins along every axis, the split between two bins with the lowest
+    // area * count of both sides wins
+    struct Bin {
+            Aabb bounds;
+            uint32_t count;
+    };
+    int bestAxis = -1;
+    uint32_t bestSplit = 0;
+    float bestCost = std::numeric_limits<float>::max();
+    for (int axis = 0; axis < 3 && depth < BVH_MAX_SAH_DEPTH; axis++) {
+        const float extent = centroids.max[axis] - centroids.min[axis];
+        if (extent <= 0.0F) {
+            continue;
+        }
+        const float scale = static_cast<float>(BVH_BIN_COUNT) / extent;
+
+        std::array<Bin, BVH_BIN_COUNT> bins{};
+        for (const auto& item : items) {
+            const auto bin = std::min(BVH_BIN_COUNT - 1, static_cast<uint32_t>((item.centroid[axis] - centroids.min[axis]) * scale));
+            bins[bin].bounds = 0 == bins[bin].count ? item.bounds : Aabb::merge(bins[bin].bounds, item.bounds);
+            bins[bin].count++;
+        }
+
+        // the costs of the left sides are accumulated forward, the right sides backward
+        std::array<float, BVH_BIN_COUNT - 1> leftCosts{};
+        Aabb bounds{};
+        uint32_t count = 0;
+        for (uint32_t bin = 0; bin + 1 < BVH_BIN_COUNT; bin++) {
+            if (0 != bins[bin].count) {
+                bounds = 0 == count ? bins[bin].bounds : Aabb::merge(bounds, bins[bin].bounds);
+                count += bins[bin].count;
+            }
+            leftCosts[bin] = 0 == count ? 0.0F : bounds.getSurfaceArea() * static_cast<float>(count);
+        }
+        count = 0;
+        for (uint32_t bin = BVH_BIN_COUNT - 1; bin > 0; bin--) {
+            if (0 != bins[bin].count) {
+                bounds = 0 == count ? bins[bin].bounds : Aabb::merge(bounds, bins[bin].bounds);
+                count += bins[bin].count;
+            }
+            const float cost = leftCosts[bin - 1] + (0 == count ? 0.0F : bounds.getSurfaceArea() * static_cast<float>(count));
+            if (cost < bestCost) {
+                bestCost = cost;
+                bestAxis = axis;
+                bestSplit = bin;
+            }
+        }
+    }
+
+    std::size_t middle = 0;
+    if (bestAxis >= 0) {
+        const float scale = static_cast<float>(BVH_BIN_COUNT) / (centroids.max[bestAxis] - centroids.min[bestAxis]);
+        const auto minimum = centroids.min[bestAxis];
+        const auto it = std::partition(items.begin(), items.end(), [=](const BuildItem& item) { return std::min(BVH_BIN_COUNT - 1, static_cast<uint32_t>((item.centroid[bestAxis] - minimum) * scale)) < bestSplit; });
+        middle = static_cast<std::size_t>(it - items.begin());
+    }
+    if (0 == middle || items.size() == middle) {
+        // all centroids coincide (or fell into one bin) or the tree got too deep, the median along the longest axis
+        // keeps it balanced
+        middle = items.size() / 2;
+        const auto extent = centroids.max - centroids.min;
+        const int axis = extent.x >= extent.y && extent.x >= extent.z ? 0 : (extent.y >= extent.z ? 1 : 2);
+        std::nth_element(items.begin(), items.begin() + static_cast<std::ptrdiff_t>(middle), items.end(), [axis](const BuildItem& left, const BuildItem& right) { return left.centroid[axis] < right.centroid[axis]; });
+    }
+
+    const auto child0 = build(items.first(middle), index, depth + 1);
+    const auto child1 = build(items.subspan(middle), index, depth + 1);
+    setBounds(mNodes[index], Aabb::merge(mNodes[child0].getBounds(), mNodes[child1].getBounds()));
+    mNodes[index].child0 = child0;
+    mNodes[index].child1 = child1;
+    mHeights[index] = std::max(mHeights[child0], mHeights[child1]) + 1;
+    return index;
+}
@@ -0,0 +1,321 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#if !defined(__ADELIE_CORE_SCENE_BOUNDINGVOLUMEHIERARCHY_HXX__)
+    #define __ADELIE_CORE_SCENE_BOUNDINGVOLUMEHIERARCHY_HXX__
+
+    #include <adelie/adelie.hxx>
+    #include <adelie/core/Assert.hxx>
+    #include <adelie/core/scene/Bounds.hxx>
+    #include <algorithm>
+    #include <array>
+    #include <bit>
+    #include <cmath>
+    #include <cstdint>
+    #include <span>
+    #include <utility>
+    #include <vector>
+
+namespace adelie::core::scene {
+
+    using BvhProxy = uint32_t;
+
+    static inline constexpr uint32_t BVH_NULL = UINT32_MAX;
+
+    // the maximum number of rays traversed together by a batched ray cast, one bit per ray
+    static inline constexpr uint32_t BVH_RAY_PACKET_SIZE = 64;
+
+    // a node is half a cache line. A leaf is marked by child1 == BVH_NULL and stores its proxy in child0
+    struct BvhNode {
+            glm::vec3 min;
+            uint32_t child0;
+            glm::vec3 max;
+            uint32_t child1;
+
+            [[nodiscard]] auto isLeaf() const -> bool { return BVH_NULL == child1; }
+
+            [[nodiscard]] auto getBounds() const -> Aabb { return {min, max}; }
+    }; /* struct BvhNode */
+
+    struct BvhRayHit {
+            BvhProxy proxy;  // BVH_NULL if nothing was hit
+            float distance;
+    }; /* struct BvhRayHit */
+
+    // a dynamic AABB tree over proxies (one per object). The leaves store the bounds of their proxy enlarged by a
+    // margin, so an object which moves a little does not touch the tree at all. If it leaves its enlarged bounds, the
+    // leaf is refit and the change is carried up to the root. New proxies are inserted next to the sibling which
+    // increases the surface area (SAH cost) the least. On the way back up, a node whose children differ in height by
+    // more than one is rotated, which keeps the depth of the tree logarithmic in the number of proxies
+    //
+    // refitting lets the tree degrade over time, once its cost grew too much it is rebuilt top-down with a binned SAH.
+    // The rebuild stores the nodes in depth-first order, so a traversal mostly walks forward through memory
+    //
+    // the queries are const and can run concurrently, changes of the tree must not overlap with them
+    class ADELIE_API BoundingVolumeHierarchy {
+        public:
+            BoundingVolumeHierarchy();
+
+            ~BoundingVolumeHierarchy() noexcept = default;
+
+            BoundingVolumeHierarchy(const BoundingVolumeHierarchy&) = delete;
+
+            auto operator=(BoundingVolumeHierarchy const&) -> BoundingVolumeHierarchy& = delete;
+
+            BoundingVolumeHierarchy(BoundingVolumeHierarchy&&) = delete;
+
+            auto operator=(BoundingVolumeHierarchy&&) -> BoundingVolumeHierarchy& = delete;
+
+            auto createProxy(const Aabb& bounds, uint64_t userData) -> BvhProxy;
+
+            auto destroyProxy(BvhProxy proxy) -> void;
+
+            // returns true if the tree was changed, false if the bounds are still within the enlarged ones of the leaf
+            auto moveProxy(BvhProxy proxy, const Aabb& bounds) -> bool;
+
+            [[nodiscard]] auto getUserData(const BvhProxy proxy) const -> uint64_t { return mProxies[proxy].userData; }
+
+            // the enlarged bounds of the proxy
+            [[nodiscard]] auto getBounds(const BvhProxy proxy) const -> Aabb { return mNodes[mProxies[proxy].node].getBounds(); }
+
+            [[nodiscard]] auto getProxyCount() const -> uint32_t { return mProxyCount; }
+
+            // the sum of the surface areas of the inner nodes relative to the one of the root
+            [[nodiscard]] auto getCost() const -> float;
+
+            // rebuilds the tree if its cost grew too much since the last rebuild, called once per frame
+            auto optimize() -> void;
+
+            auto rebuild() -> void;
+
+            // func(proxy) for every proxy whose bounds overlap the box, func returns false to stop the query
+            template <typename F>
+            auto queryOverlap(const Aabb& box, F&& func) const -> void {
+                traverse([&box](const BvhNode& node) { return box.overlaps(node.getBounds()); }, [&func](const BvhProxy proxy) { return func(proxy); });
+            }
+
+            // func(proxy, boxDistance) for every proxy whose bounds are hit by the ray. It returns the distance of the
+            // actual hit, which shortens the ray, or a negative value if the object itself was missed
+            template <typename F>
+            auto raycast(const Ray& ray, F&& func) const -> BvhRayHit {
+                BvhRayHit hit{BVH_NULL, ray.maxDistance};
+                auto current = ray;
+                traverse([&current](const BvhNode& node) { return current.intersect(node.getBounds()) >= 0.0F; },
+                         [&](const BvhProxy proxy) {
+                             const float distance = func(proxy, current.intersect(getBounds(proxy)));
+                             if (distance >= 0.0F && distance < current.maxDistance) {
+                                 current.maxDistance = distance;
+                                 hit = {proxy, distance};
+                             }
+                             return true;
+                         });
+                return hit;
+            }
+
+            // casts many rays at once (e.g. all picking rays of a frame). The rays are traversed in packets, a node is
+            // loaded once per packet and only the rays which hit it are carried further down. func(rayIndex, proxy,
+            // boxDistance) works like the one of raycast(), hits receives the closest hit of every ray
+            template <typename F>
+            auto raycast(std::span<const Ray> rays, std::span<BvhRayHit> hits, F&& func) const -> void {
+                for (std::size_t first = 0; first < rays.size(); first += BVH_RAY_PACKET_SIZE) {
+                    const auto count = static_cast<uint32_t>(std::min<std::size_t>(BVH_RAY_PACKET_SIZE, rays.size() - first));
+                    std::array<Ray, BVH_RAY_PACKET_SIZE> packet{};
+                    for (uint32_t i = 0; i < count; i++) {
+                        packet[i] = rays[first + i];
+                        hits[first + i] = {BVH_NULL, rays[first + i].maxDistance};
+                    }
+                    tracePacket(packet, count, [&](const uint32_t ray, const BvhProxy proxy, const float boxDistance) {
+                        const float distance = func(static_cast<uint32_t>(first + ray), proxy, boxDistance);
+                        if (distance >= 0.0F && distance < packet[ray].maxDistance) {
+                            packet[ray].maxDistance = distance;
+                            hits[first + ray] = {proxy, distance};
+                        }
+                    });
+                }
+            }
+
+            // func(proxy) for every proxy whose bounds are (partially) inside the frustum. A node which is completely
+            // inside a plane is not tested against it again further down, a node completely inside the frustum
+            // reports its whole subtree without any test
+            template <typename F>
+            auto queryFrustum(const Frustum& frustum, F&& func) const -> void {
+                if (BVH_NULL == mRoot) {
+                    return;
+                }
+
+                // the node and the planes it still has to be tested against
+                struct Entry {
+                        uint32_t index;
+                        uint32_t planes;
+                };
+                constexpr uint32_t allPlanes = (1U << Frustum::PLANE_COUNT) - 1;
+                TraversalStack<Entry> stack;
+                stack.push({mRoot, allPlanes});
+                while (!stack.isEmpty()) {
+                    const auto [index, planes] = stack.pop();
+                    const auto& node = mNodes[index];
+
+                    uint32_t remaining = planes;
+                    bool outside = false;
+                    const auto center = (node.min + node.max) * 0.5F;
+                    const auto extents = (node.max - node.min) * 0.5F;
+                    for (uint32_t plane = 0; plane < Frustum::PLANE_COUNT && !outside; plane++) {
+                        if (0 == (planes & (1U << plane))) {
+                            continue;
+                        }
+                        const auto& p = frustum.planes[plane];
+                        const float distance = (p.x * center.x) + (p.y * center.y) + (p.z * center.z) + p.w;
+                        const float radius = (std::abs(p.x) * extents.x) + (std::abs(p.y) * extents.y) + (std::abs(p.z) * extents.z);
+                        if (distance < -radius) {
+                            outside = true;
+                        } else if (distance >= radius) {
+                            remaining &= ~(1U << plane);
+                        }
+                    }
+                    if (outside) {
+                        continue;
+                    }
+
+                    if (node.isLeaf()) {
+                        func(node.child0);
+                    } else if (0 == remaining) {
+                        reportSubtree(index, func);
+                    } else {
+                        stack.push({node.child1, remaining});
+                        stack.push({node.child0, remaining});
+                    }
+                }
+            }
+
+        private:
+            // the rotations keep the depth of the tree far below the size of the stack, a depth-first traversal never
+            // needs more
+            static inline constexpr uint32_t BVH_TRAVERSAL_STACK_SIZE = 64;
+
+            // the pending nodes of a traversal, kept on the stack of the caller so a query never allocates
+            template <typename T>
+            struct TraversalStack {
+                    std::array<T, BVH_TRAVERSAL_STACK_SIZE> items;
+                    uint32_t size = 0;
+
+                    auto push(const T& item) -> void {
+                        AdelieCoreAssert(size < BVH_TRAVERSAL_STACK_SIZE, "The traversal stack of the BVH overflowed");
+                        items[size++] = item;
+                    }
+
+                    auto pop() -> T { return items[--size]; }
+
+                    [[nodiscard]] auto isEmpty() const -> bool { return 0 == size; }
+            };
+
+            struct ProxyRecord {
+                    uint32_t node;  // the leaf, BVH_NULL for a free proxy
+                    uint64_t userData;
+            };
+
+            struct BuildItem {
+                    BvhProxy proxy;
+                    Aabb bounds;
+                    glm::vec3 centroid;
+            };
+
+            auto allocateNode() -> uint32_t;
+            auto freeNode(uint32_t index) -> void;
+            auto insertLeaf(uint32_t leaf) -> void;
+            auto removeLeaf(uint32_t leaf) -> void;
+            auto refit(uint32_t index) -> void;
+            auto balance(uint32_t index) -> uint32_t;
+            auto build(std::span<BuildItem> items, uint32_t parent, uint32_t depth) -> uint32_t;
+
+            // visits the nodes for which enter(node) is true and calls leaf(proxy) for the leaves among them
+            template <typename Enter, typename Leaf>
+            auto traverse(const Enter& enter, const Leaf& leaf) const -> void {
+                if (BVH_NULL == mRoot) {
+                    return;
+                }
+
+                TraversalStack<uint32_t> stack;
+                stack.push(mRoot);
+                while (!stack.isEmpty()) {
+                    const auto& node = mNodes[stack.pop()];
+                    if (!enter(node)) {
+                        continue;
+                    }
+                    if (node.isLeaf()) {
+                        if (!leaf(node.child0)) {
+                            return;
+                        }
+                    } else {
+                        stack.push(node.child1);
+                        stack.push(node.child0);
+                    }
+                }
+            }
+
+            template <typename F>
+            auto tracePacket(const std::array<Ray, BVH_RAY_PACKET_SIZE>& packet, const uint32_t count, const F& func) const -> void {
+                if (BVH_NULL == mRoot) {
+                    return;
+                }
+
+                // the node and the rays which hit its parent
+                struct Entry {
+                        uint32_t index;
+                        uint64_t rays;
+                };
+                const uint64_t allRays = count == BVH_RAY_PACKET_SIZE ? ~uint64_t{0} : ((uint64_t{1} << count) - 1);
+                TraversalStack<Entry> stack;
+                stack.push({mRoot, allRays});
+                while (!stack.isEmpty()) {
+                    const auto [index, rays] = stack.pop();
+                    const auto& node = mNodes[index];
+                    const auto bounds = node.getBounds();
+
+                    uint64_t active = 0;
+                    for (auto remaining = rays; 0 != remaining; remaining &= remaining - 1) {
+                        const auto ray = static_cast<uint32_t>(std::countr_zero(remaining));
+                        const float distance = packet[ray].intersect(bounds);
+                        if (distance >= 0.0F) {
+                            active |= uint64_t{1} << ray;
+                            if (node.isLeaf()) {
+                                func(ray, node.child0, distance);
+                            }
+                        }
+                    }
+                    if (0 != active && !node.isLeaf()) {
+                        stack.push({node.child1, active});
+                        stack.push({node.child0, active});
+                    }
+                }
+            }
+
+            template <typename F>
+            auto reportSubtree(const uint32_t index, F& func) const -> void {
+                TraversalStack<uint32_t> stack;
+                stack.push(index);
+                while (!stack.isEmpty()) {
+                    const auto& node = mNodes[stack.pop()];
+                    if (node.isLeaf()) {
+                        func(node.child0);
+                    } else {
+                        stack.push(node.child1);
+                        stack.push(node.child0);
+                    }
+                }
+            }
+
+            std::vector<BvhNode> mNodes;
+            std::vector<uint32_t> mParents;
+            std::vector<uint32_t> mHeights;  // the longest path down to a leaf, 0 for a leaf
+            uint32_t mRoot;
+            uint32_t mFreeNode;  // the free nodes are linked through child0
+            std::vector<ProxyRecord> mProxies;
+            std::vector<BvhProxy> mFreeProxies;
+            uint32_t mProxyCount;
+            uint32_t mRefitsSinceRebuild;
+            float mCostAfterRebuild;
+
+    }; /* class BoundingVolumeHierarchy */
+
+} /* namespace adelie::core::scene */
+
+#endif /* if !defined(__ADELIE_CORE_SCENE_BOUNDINGVOLUMEHIERARCHY_HXX__) */
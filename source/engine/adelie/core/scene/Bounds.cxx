@@ -0,0 +1,57 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#include <adelie/core/scene/Bounds.hxx>
+#include <algorithm>
+#include <cmath>
+
+using adelie::core::scene::Aabb;
+using adelie::core::scene::Frustum;
+using adelie::core::scene::Ray;
+
+auto Aabb::transform(const glm::mat4& matrix) const -> Aabb {
+    // the extents are projected onto the absolute axes of the matrix (Arvo)
+    const auto center = getCenter();
+    const auto extents = getExtents();
+    glm::vec3 newCenter(matrix[3][0], matrix[3][1], matrix[3][2]);
+    glm::vec3 newExtents(0.0F);
+    for (int column = 0; column < 3; column++) {
+        for (int row = 0; row < 3; row++) {
+            newCenter[row] += matrix[column][row] * center[column];
+            newExtents[row] += std::fabs(matrix[column][row]) * extents[column];
+        }
+    }
+    return {newCenter - newExtents, newCenter + newExtents};
+}
+
+auto Ray::create(const glm::vec3& origin, const glm::vec3& direction, const float maxDistance) -> Ray {
+    // a zero component becomes an infinite inverse, the slab test handles it
+    return {origin, direction, glm::vec3(1.0F / direction.x, 1.0F / direction.y, 1.0F / direction.z), maxDistance};
+}
+
+auto Ray::intersect(const Aabb& box) const -> float {
+    float enter = 0.0F;
+    float leave = maxDistance;
+    for (int axis = 0; axis < 3; axis++) {
+        const float t0 = (box.min[axis] - origin[axis]) * inverseDirection[axis];
+        const float t1 = (box.max[axis] - origin[axis]) * inverseDirection[axis];
+        enter = std::max(enter, std::min(t0, t1));
+        leave = std::min(leave, std::max(t0, t1));
+    }
+    return enter <= leave ? enter : -1.0F;
+}
+
+auto Frustum::fromMatrix(const glm::mat4& viewProjection) -> Frustum {
+    // the planes are sums of the rows of the matrix (Gribb and Hartmann), glm stores the columns
+    const auto row = [&viewProjection](const int index) { return glm::vec4(viewProjection[0][index], viewProjection[1][index], viewProjection[2][index], viewProjection[3][index]); };
+    const auto row0 = row(0);
+    const auto row1 = row(1);
+    const auto row2 = row(2);
+    const auto row3 = row(3);
+
+    Frustum frustum{};
+    frustum.planes = {row3 + row0, row3 - row0, row3 + row1, row3 - row1, row2, row3 - row2};
+    for (auto& plane : frustum.planes) {
+        plane /= glm::length(glm::vec3(plane));
+    }
+    return frustum;
+}
@@ -0,0 +1,65 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#if !defined(__ADELIE_CORE_SCENE_BOUNDS_HXX__)
+    #define __ADELIE_CORE_SCENE_BOUNDS_HXX__
+
+    #include <adelie/adelie.hxx>
+    #include <array>
+    #include <cstdint>
+
+namespace adelie::core::scene {
+
+    // an axis-aligned bounding box
+    struct ADELIE_API Aabb {
+            glm::vec3 min;
+            glm::vec3 max;
+
+            [[nodiscard]] auto getCenter() const -> glm::vec3 { return (min + max) * 0.5F; }
+
+            [[nodiscard]] auto getExtents() const -> glm::vec3 { return (max - min) * 0.5F; }
+
+            [[nodiscard]] auto getSurfaceArea() const -> float {
+                const auto size = max - min;
+                return 2.0F * ((size.x * size.y) + (size.y * size.z) + (size.z * size.x));
+            }
+
+            [[nodiscard]] auto contains(const Aabb& other) const -> bool {
+                return min.x <= other.min.x && min.y <= other.min.y && min.z <= other.min.z && other.max.x <= max.x && other.max.y <= max.y && other.max.z <= max.z;
+            }
+
+            [[nodiscard]] auto overlaps(const Aabb& other) const -> bool {
+                return min.x <= other.max.x && min.y <= other.max.y && min.z <= other.max.z && other.min.x <= max.x && other.min.y <= max.y && other.min.z <= max.z;
+            }
+
+            [[nodiscard]] static auto merge(const Aabb& a, const Aabb& b) -> Aabb { return {glm::min(a.min, b.min), glm::max(a.max, b.max)}; }
+
+            // the box which encloses this box after it was transformed
+            [[nodiscard]] auto transform(const glm::mat4& matrix) const -> Aabb;
+    }; /* struct Aabb */
+
+    struct ADELIE_API Ray {
+            glm::vec3 origin;
+            glm::vec3 direction;
+            glm::vec3 inverseDirection;
+            float maxDistance;
+
+            [[nodiscard]] static auto create(const glm::vec3& origin, const glm::vec3& direction, float maxDistance) -> Ray;
+
+            // the distance along the ray at which it enters the box, a negative value if it misses the box
+            [[nodiscard]] auto intersect(const Aabb& box) const -> float;
+    }; /* struct Ray */
+
+    // the six planes of a view frustum, pointing inward. A plane is (normal, distance) with dot(normal, p) + distance
+    // >= 0 for the points p inside
+    struct ADELIE_API Frustum {
+            static inline constexpr uint32_t PLANE_COUNT = 6;
+
+            std::array<glm::vec4, PLANE_COUNT> planes;
+
+            // the frustum of a projection * view matrix with a depth range of [0, 1]
+            [[nodiscard]] static auto fromMatrix(const glm::mat4& viewProjection) -> Frustum;
+    }; /* struct Frustum */
+
+} /* namespace adelie::core::scene */
+
+#endif /* if !defined(__ADELIE_CORE_SCENE_BOUNDS_HXX__) */
@@ -0,0 +1,33 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#include <adelie/core/scene/ComponentRegistry.hxx>
+#include <adelie/exception/RuntimeException.hxx>
+
+using adelie::core::scene::ComponentInfo;
+using adelie::core::scene::ComponentRegistry;
+using adelie::core::scene::ComponentTypeId;
+using adelie::exception::RuntimeException;
+
+ComponentRegistry::ComponentRegistry() {
+    mInfos.reserve(MAX_COMPONENT_TYPES);
+}
+
+auto ComponentRegistry::getInstance() -> ComponentRegistry* {
+    static ComponentRegistry staticInstance;
+    return &staticInstance;
+}
+
+auto ComponentRegistry::registerType(const std::type_index type, const ComponentInfo& info) -> ComponentTypeId {
+    const std::lock_guard lock(mMutex);
+    if (const auto it = mIds.find(type); mIds.end() != it) {
+        return it->second;
+    }
+
+    if (mInfos.size() >= MAX_COMPONENT_TYPES) {
+        throw RuntimeException("Too many component types, at most " + std::to_string(MAX_COMPONENT_TYPES) + " are supported");
+    }
+    const auto id = static_cast<ComponentTypeId>(mInfos.size());
+    mInfos.push_back(info);
+    mIds.emplace(type, id);
+    return id;
+}
@@ -0,0 +1,77 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#if !defined(__ADELIE_CORE_SCENE_COMPONENTREGISTRY_HXX__)
+    #define __ADELIE_CORE_SCENE_COMPONENTREGISTRY_HXX__
+
+    #include <adelie/adelie.hxx>
+    #include <cstddef>
+    #include <cstdint>
+    #include <mutex>
+    #include <type_traits>
+    #include <typeindex>
+    #include <unordered_map>
+    #include <vector>
+
+namespace adelie::core::scene {
+
+    using ComponentTypeId = uint32_t;
+
+    // a set of component types, bit n is the component type with the id n
+    using ComponentMask = uint64_t;
+
+    static inline constexpr uint32_t MAX_COMPONENT_TYPES = 64;
+
+    struct ComponentInfo {
+            std::size_t size;
+            std::size_t alignment;
+    }; /* struct ComponentInfo */
+
+    // components are plain data which are stored in tightly packed arrays and moved around with memcpy when an entity
+    // changes its archetype, so they have to be trivially copyable
+    template <typename T>
+    concept ComponentType = std::is_trivially_copyable_v<T> && std::is_default_constructible_v<T> && !std::is_const_v<T>;
+
+    // hands out a dense id for every component type. The ids are assigned on first use and are keyed by the type
+    // itself, so the engine and a client library agree on them
+    class ADELIE_API ComponentRegistry {
+        public:
+            static auto getInstance() -> ComponentRegistry*;
+
+            ~ComponentRegistry() noexcept = default;
+
+            ComponentRegistry(const ComponentRegistry&) = delete;
+
+            auto operator=(ComponentRegistry const&) -> ComponentRegistry& = delete;
+
+            ComponentRegistry(ComponentRegistry&&) = delete;
+
+            auto operator=(ComponentRegistry&&) -> ComponentRegistry& = delete;
+
+            // throws a RuntimeException if more than MAX_COMPONENT_TYPES types are registered
+            auto registerType(std::type_index type, const ComponentInfo& info) -> ComponentTypeId;
+
+            [[nodiscard]] auto getInfo(ComponentTypeId id) const -> const ComponentInfo& { return mInfos[id]; }
+
+            template <ComponentType T>
+            static auto getId() -> ComponentTypeId {
+                static const ComponentTypeId staticId = getInstance()->registerType(typeid(T), {sizeof(T), alignof(T)});
+                return staticId;
+            }
+
+            template <typename... Ts>
+            static auto getMask() -> ComponentMask {
+                return (ComponentMask{0} | ... | (ComponentMask{1} << getId<std::remove_const_t<Ts>>()));
+            }
+
+        private:
+            ComponentRegistry();
+
+            std::mutex mMutex;
+            std::unordered_map<std::type_index, ComponentTypeId> mIds;
+            std::vector<ComponentInfo> mInfos;  // reserved up front, the infos never move
+
+    }; /* class ComponentRegistry */
+
+} /* namespace adelie::core::scene */
+
+#endif /* if !defined(__ADELIE_CORE_SCENE_COMPONENTREGISTRY_HXX__) */
@@ -0,0 +1,65 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#if !defined(__ADELIE_CORE_SCENE_COMPONENTS_HXX__)
+    #define __ADELIE_CORE_SCENE_COMPONENTS_HXX__
+
+    #include <adelie/adelie.hxx>
+    #include <adelie/core/scene/BoundingVolumeHierarchy.hxx>
+    #include <adelie/core/scene/Bounds.hxx>
+    #include <adelie/core/scene/TransformHierarchy.hxx>
+    #include <cstdint>
+
+// the components the engine itself works with, a client can add any other trivially copyable type
+namespace adelie::core::scene {
+
+    // the node of the entity in the transform hierarchy of the scene. A system which moves the node declares this
+    // component as written
+    struct ADELIE_API TransformNodeComponent {
+            TransformNode node;
+    }; /* struct TransformNodeComponent */
+
+    // the world matrix of the transform node, copied over after the hierarchy was updated. Read by the renderer and
+    // the culling. The renderer draws the entity between the matrices of the previous and the current simulation
+    // step, so both have to be set to the same matrix when the component is created
+    struct ADELIE_API LocalToWorldComponent {
+            glm::mat4 matrix;
+            glm::mat4 previousMatrix;
+    }; /* struct LocalToWorldComponent */
+
+    struct ADELIE_API MeshComponent {
+            uint32_t meshId;
+    }; /* struct MeshComponent */
+
+    // the level of detail of the mesh drawn the last frame, the renderer selects the next one relative to it
+    struct ADELIE_API LodComponent {
+            uint32_t lod;
+    }; /* struct LodComponent */
+
+    // the bounds of the mesh in its local space. The scene keeps a proxy of the world bounds in its spatial index,
+    // created with proxy = BVH_NULL the proxy is added with the next update of the scene
+    struct ADELIE_API BoundsComponent {
+            Aabb localBounds;
+            BvhProxy proxy;
+    }; /* struct BoundsComponent */
+
+    // a point light at the position of the LocalToWorldComponent, its influence ends at range
+    struct ADELIE_API PointLightComponent {
+            glm::vec3 color;
+            float intensity;
+            float range;
+    }; /* struct PointLightComponent */
+
+    // spawns rate particles per second at the position of the LocalToWorldComponent, which fly into a cone of the
+    // half angle spread around direction and fade out at the end of their lifetime
+    struct ADELIE_API ParticleEmitterComponent {
+            glm::vec3 direction;
+            float spread;  // in radians
+            glm::vec3 color;
+            float speed;
+            float rate;
+            float lifetime;  // in seconds
+    }; /* struct ParticleEmitterComponent */
+
+} /* namespace adelie::core::scene */
+
+#endif /* if !defined(__ADELIE_CORE_SCENE_COMPONENTS_HXX__) */
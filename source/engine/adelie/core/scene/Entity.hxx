@@ -0,0 +1,22 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#if !defined(__ADELIE_CORE_SCENE_ENTITY_HXX__)
+    #define __ADELIE_CORE_SCENE_ENTITY_HXX__
+
+    #include <adelie/adelie.hxx>
+    #include <cstdint>
+
+namespace adelie::core::scene {
+
+    // a handle to an entity of a world. The index addresses the record of the entity, the generation is incremented
+    // every time the index is reused, so a handle of a destroyed entity never addresses its successor
+    struct ADELIE_API Entity {
+            uint32_t index;
+            uint32_t generation;
+
+            [[nodiscard]] auto operator==(const Entity& other) const -> bool = default;
+    }; /* struct Entity */
+
+} /* namespace adelie::core::scene */
+
+#endif /* if !defined(__ADELIE_CORE_SCENE_ENTITY_HXX__) */
@@ -0,0 +1,93 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#include <adelie/core/scene/Components.hxx>
+#include <adelie/core/scene/Scene.hxx>
+#include <vector>
+
+using adelie::core::Timestep;
+using adelie::core::scene::BoundsComponent;
+using adelie::core::scene::BvhProxy;
+using adelie::core::scene::Entity;
+using adelie::core::scene::LocalToWorldComponent;
+using adelie::core::scene::Scene;
+using adelie::core::scene::TransformNodeComponent;
+
+namespace {
+    // the number of entities below which the matrices are not worth spreading over the workers
+    constexpr uint32_t PARALLEL_TRANSFORM_THRESHOLD = 1024;
+}  // namespace
+
+Scene::Scene() : Layer("Scene"), mNodesDestroyed(false), mNodesMoved(false) {}
+
+void Scene::onUpdate(const Timestep& deltaTime) {
+    mSystems.run(mWorld, deltaTime);
+
+    // a scene in which nothing moved only looks for new bounds
+    const auto updated = mTransforms.update();
+    if (mNodesDestroyed) {
+        destroyOrphans();
+    }
+
+    // the step after the last move copies once more, so the entities which stopped are no longer blended
+    if (0 != updated || mNodesMoved) {
+        const auto copy = [this](const TransformNodeComponent& transform, LocalToWorldComponent& localToWorld) {
+            localToWorld.previousMatrix = localToWorld.matrix;
+            localToWorld.matrix = mTransforms.getWorldMatrix(transform.node);
+        };
+        if (mWorld.getEntityCount() < PARALLEL_TRANSFORM_THRESHOLD) {
+            mWorld.each<const TransformNodeComponent, LocalToWorldComponent>(copy);
+        } else {
+            mWorld.parallelEach<const TransformNodeComponent, LocalToWorldComponent>(copy);
+        }
+    }
+    mNodesMoved = 0 != updated;
+
+    // bounds added since the last step get their proxy even if nothing moved, an entity which moved less than the
+    // margin of its proxy leaves the spatial index untouched
+    mWorld.eachChunk<const LocalToWorldComponent, BoundsComponent>([this, updated](const uint32_t count, const Entity* entities, const LocalToWorldComponent* localToWorld, BoundsComponent* bounds) {
+        for (uint32_t i = 0; i < count; i++) {
+            if (BVH_NULL == bounds[i].proxy) {
+                const auto worldBounds = bounds[i].localBounds.transform(localToWorld[i].matrix);
+                bounds[i].proxy = mSpatialIndex.createProxy(worldBounds, static_cast<uint64_t>(entities[i].index) | (static_cast<uint64_t>(entities[i].generation) << 32U));
+            } else if (0 != updated) {
+                mSpatialIndex.moveProxy(bounds[i].proxy, bounds[i].localBounds.transform(localToWorld[i].matrix));
+            }
+        }
+    });
+    mSpatialIndex.optimize();
+}
+
+auto Scene::destroyEntity(const Entity entity) -> void {
+    if (!mWorld.isAlive(entity)) {
+        return;
+    }
+    if (const auto* bounds = mWorld.getComponent<BoundsComponent>(entity); nullptr != bounds && BVH_NULL != bounds->proxy) {
+        mSpatialIndex.destroyProxy(bounds->proxy);
+    }
+    if (const auto* transform = mWorld.getComponent<TransformNodeComponent>(entity); nullptr != transform && mTransforms.isAlive(transform->node)) {
+        mTransforms.destroyNode(transform->node);
+        mNodesDestroyed = true;
+    }
+    mWorld.destroyEntity(entity);
+}
+
+auto Scene::destroyOrphans() -> void {
+    // the update destroyed the descendants of the destroyed nodes, their entities must not read the freed slots
+    std::vector<Entity> orphans;
+    mWorld.eachChunk<const TransformNodeComponent>([this, &orphans](const uint32_t count, const Entity* entities, const TransformNodeComponent* transforms) {
+        for (uint32_t i = 0; i < count; i++) {
+            if (!mTransforms.isAlive(transforms[i].node)) {
+                orphans.push_back(entities[i]);
+            }
+        }
+    });
+    for (const auto entity : orphans) {
+        destroyEntity(entity);
+    }
+    mNodesDestroyed = false;
+}
+
+auto Scene::getEntity(const BvhProxy proxy) const -> Entity {
+    const auto userData = mSpatialIndex.getUserData(proxy);
+    return {static_cast<uint32_t>(userData), static_cast<uint32_t>(userData >> 32U)};
+}
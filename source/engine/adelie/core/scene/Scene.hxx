@@ -0,0 +1,65 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#if !defined(__ADELIE_CORE_SCENE_SCENE_HXX__)
+    #define __ADELIE_CORE_SCENE_SCENE_HXX__
+
+    #include <adelie/adelie.hxx>
+    #include <adelie/core/Layer.hxx>
+    #include <adelie/core/scene/BoundingVolumeHierarchy.hxx>
+    #include <adelie/core/scene/SystemScheduler.hxx>
+    #include <adelie/core/scene/TransformHierarchy.hxx>
+    #include <adelie/core/scene/World.hxx>
+
+namespace adelie::core::scene {
+
+    // the layer which simulates a world: every simulation step runs the systems of the world and afterward updates
+    // the transform hierarchy. Only if a node moved, the world matrices are copied into the LocalToWorldComponent of
+    // the entities (keeping the ones of the previous step for the interpolation) and the world bounds of the entities
+    // with a BoundsComponent are moved in the spatial index. New bounds get their proxy with the next step in any case
+    class ADELIE_API Scene : public Layer {
+        public:
+            Scene();
+
+            ~Scene() override = default;
+
+            Scene(const Scene&) = delete;
+
+            auto operator=(Scene const&) -> Scene& = delete;
+
+            Scene(Scene&&) = delete;
+
+            auto operator=(Scene&&) -> Scene& = delete;
+
+            void onUpdate(const Timestep& deltaTime) override;
+
+            // destroys the entity together with its transform node and its proxy in the spatial index. The entities of
+            // the descendant nodes are destroyed with the next update, when the hierarchy destroyed their nodes
+            auto destroyEntity(Entity entity) -> void;
+
+            // the user data of a proxy is the entity, see getEntity()
+            [[nodiscard]] auto getSpatialIndex() const -> const BoundingVolumeHierarchy& { return mSpatialIndex; }
+
+            [[nodiscard]] auto getEntity(BvhProxy proxy) const -> Entity;
+
+            [[nodiscard]] auto getWorld() -> World& { return mWorld; }
+
+            [[nodiscard]] auto getSystems() -> SystemScheduler& { return mSystems; }
+
+            // the nodes of entities have to be destroyed through destroyEntity()
+            [[nodiscard]] auto getTransforms() -> TransformHierarchy& { return mTransforms; }
+
+        private:
+            auto destroyOrphans() -> void;
+
+            World mWorld;
+            SystemScheduler mSystems;
+            TransformHierarchy mTransforms;
+            BoundingVolumeHierarchy mSpatialIndex;
+            bool mNodesDestroyed;  // entities may have lost their node with the last destroyed subtree
+            bool mNodesMoved;      // the previous matrices of the last step still differ from the current ones
+
+    }; /* class Scene */
+
+} /* namespace adelie::core::scene */
+
+#endif /* if !defined(__ADELIE_CORE_SCENE_SCENE_HXX__) */
@@ -0,0 +1,57 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#include <adelie/core/jobs/JobSystem.hxx>
+#include <adelie/core/scene/SystemScheduler.hxx>
+#include <adelie/io/Logger.hxx>
+
+using adelie::core::Timestep;
+using adelie::core::jobs::JobCounter;
+using adelie::core::jobs::JobSystem;
+using adelie::core::scene::ComponentMask;
+using adelie::core::scene::SystemScheduler;
+using adelie::core::scene::World;
+
+auto SystemScheduler::addSystem(const std::string& name, const ComponentMask reads, const ComponentMask writes, SystemFunction function) -> void {
+    mSystems.push_back({name, reads, writes, std::move(function)});
+    mBatches.clear();
+}
+
+auto SystemScheduler::buildBatches() -> void {
+    // a system joins the last batch if it does not conflict with any system in it, otherwise it starts a new one. It
+    // is never moved into an earlier batch, so two conflicting systems keep the order they were added in
+    ComponentMask batchReads = 0;
+    ComponentMask batchWrites = 0;
+    for (uint32_t index = 0; index < mSystems.size(); index++) {
+        const auto& system = mSystems[index];
+        const bool conflicts = ((system.writes & (batchReads | batchWrites)) != 0) || ((system.reads & batchWrites) != 0);
+        if (mBatches.empty() || conflicts) {
+            mBatches.emplace_back();
+            batchReads = 0;
+            batchWrites = 0;
+        }
+        mBatches.back().push_back(index);
+        batchReads |= system.reads;
+        batchWrites |= system.writes;
+    }
+    AdelieLogDebug("Scheduled {} systems in {} batches", mSystems.size(), mBatches.size());
+}
+
+auto SystemScheduler::run(World& world, const Timestep& deltaTime) -> void {
+    if (mBatches.empty()) {
+        buildBatches();
+    }
+
+    auto* jobSystem = JobSystem::getInstance();
+    for (const auto& batch : mBatches) {
+        if (1 == batch.size()) {
+            mSystems[batch.front()].function(world, deltaTime);
+            continue;
+        }
+
+        JobCounter counter;
+        for (const auto index : batch) {
+            jobSystem->run(counter, [this, index, &world, &deltaTime] { mSystems[index].function(world, deltaTime); });
+        }
+        jobSystem->wait(counter);
+    }
+}
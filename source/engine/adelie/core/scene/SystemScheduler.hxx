@@ -0,0 +1,67 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#if !defined(__ADELIE_CORE_SCENE_SYSTEMSCHEDULER_HXX__)
+    #define __ADELIE_CORE_SCENE_SYSTEMSCHEDULER_HXX__
+
+    #include <adelie/adelie.hxx>
+    #include <adelie/core/Timestep.hxx>
+    #include <adelie/core/scene/ComponentRegistry.hxx>
+    #include <adelie/core/scene/World.hxx>
+    #include <functional>
+    #include <string>
+    #include <type_traits>
+    #include <vector>
+
+namespace adelie::core::scene {
+
+    // runs the systems of a world once per simulation step. Every system declares the components it reads and writes,
+    // systems which do not write anything another one reads or writes run in parallel on the job system. Systems which
+    // conflict run in the order they were added
+    //
+    // a system must not change the structure of the world (create or destroy entities, add or remove components)
+    class ADELIE_API SystemScheduler {
+        public:
+            using SystemFunction = std::function<void(World&, const Timestep&)>;
+
+            SystemScheduler() = default;
+
+            ~SystemScheduler() noexcept = default;
+
+            SystemScheduler(const SystemScheduler&) = delete;
+
+            auto operator=(SystemScheduler const&) -> SystemScheduler& = delete;
+
+            SystemScheduler(SystemScheduler&&) = delete;
+
+            auto operator=(SystemScheduler&&) -> SystemScheduler& = delete;
+
+            auto addSystem(const std::string& name, ComponentMask reads, ComponentMask writes, SystemFunction function) -> void;
+
+            // the access is taken from the component types, a const component is read and every other one is written
+            template <typename... Ts>
+            auto addSystem(const std::string& name, SystemFunction function) -> void {
+                addSystem(name, (ComponentMask{0} | ... | (std::is_const_v<Ts> ? ComponentRegistry::getMask<Ts>() : 0)),
+                          (ComponentMask{0} | ... | (std::is_const_v<Ts> ? 0 : ComponentRegistry::getMask<Ts>())), std::move(function));
+            }
+
+            auto run(World& world, const Timestep& deltaTime) -> void;
+
+        private:
+            struct System {
+                    std::string name;
+                    ComponentMask reads;
+                    ComponentMask writes;
+                    SystemFunction function;
+            };
+
+            // the systems of a batch do not conflict with each other, the batches run one after another
+            auto buildBatches() -> void;
+
+            std::vector<System> mSystems;
+            std::vector<std::vector<uint32_t>> mBatches;
+
+    }; /* class SystemScheduler */
+
+} /* namespace adelie::core::scene */
+
+#endif /* if !defined(__ADELIE_CORE_SCENE_SYSTEMSCHEDULER_HXX__) */
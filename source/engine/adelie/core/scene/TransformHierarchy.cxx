@@ -0,0 +1,363 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#include <adelie/core/scene/TransformHierarchy.hxx>
+#include <adelie/exception/RuntimeException.hxx>
+#include <algorithm>
+#include <glm/gtc/type_ptr.hpp>
+#include <string>
+
+#if defined(__SSE2__) || defined(_M_X64)
+    #include <xmmintrin.h>
+    #define ADELIE_TRANSFORM_SSE
+#endif
+
+using adelie::core::scene::Transform;
+using adelie::core::scene::TransformHierarchy;
+using adelie::core::scene::TransformNode;
+using adelie::exception::RuntimeException;
+
+namespace {
+    constexpr uint32_t TRANSFORM_BATCH_SIZE = 4;
+
+#if defined(ADELIE_TRANSFORM_SSE)
+    auto storeColumns(float* matrix, const __m128 column0, const __m128 column1, const __m128 column2, const __m128 column3) -> void {
+        _mm_storeu_ps(matrix, column0);
+        _mm_storeu_ps(matrix + 4, column1);
+        _mm_storeu_ps(matrix + 8, column2);
+        _mm_storeu_ps(matrix + 12, column3);
+    }
+#endif
+
+    // world = parent * local, both column-major
+    auto multiply(const glm::mat4& parent, const glm::mat4& local, glm::mat4& world) -> void {
+        const float* p = glm::value_ptr(parent);
+        const float* l = glm::value_ptr(local);
+        float* w = glm::value_ptr(world);
+#if defined(ADELIE_TRANSFORM_SSE)
+        const __m128 column0 = _mm_loadu_ps(p);
+        const __m128 column1 = _mm_loadu_ps(p + 4);
+        const __m128 column2 = _mm_loadu_ps(p + 8);
+        const __m128 column3 = _mm_loadu_ps(p + 12);
+        for (uint32_t c = 0; c < 4; c++) {
+            const float* lc = l + (c * 4);
+            __m128 result = _mm_mul_ps(column0, _mm_set1_ps(lc[0]));
+            result = _mm_add_ps(result, _mm_mul_ps(column1, _mm_set1_ps(lc[1])));
+            result = _mm_add_ps(result, _mm_mul_ps(column2, _mm_set1_ps(lc[2])));
+            result = _mm_add_ps(result, _mm_mul_ps(column3, _mm_set1_ps(lc[3])));
+            _mm_storeu_ps(w + (c * 4), result);
+        }
+#else
+        for (uint32_t c = 0; c < 4; c++) {
+            for (uint32_t r = 0; r < 4; r++) {
+                w[(c * 4) + r] = (p[r] * l[c * 4]) + (p[4 + r] * l[(c * 4) + 1]) + (p[8 + r] * l[(c * 4) + 2]) + (p[12 + r] * l[(c * 4) + 3]);
+            }
+        }
+#endif
+    }
+}  // namespace
+
+TransformHierarchy::TransformHierarchy() {
+    mSlotCount = 0;
+    mFirstDirtySlot = 0;
+    mNeedsSort = false;
+}
+
+auto TransformHierarchy::createNode(const Transform& local) -> TransformNode {
+    return appendSlot(NO_SLOT, local);
+}
+
+auto TransformHierarchy::createNode(const TransformNode parent, const Transform& local) -> TransformNode {
+    const auto parentSlot = getSlot(parent);
+
+    // the new slot is appended after its parent, the order of the depths is restored with the next update
+    mNeedsSort = true;
+    return appendSlot(parentSlot, local);
+}
+
+auto TransformHierarchy::destroyNode(const TransformNode node) -> void {
+    if (!isAlive(node)) {
+        return;
+    }
+
+    auto& record = mNodes[node.index];
+    mSlotNodes[record.slot] = NO_SLOT;
+    record.slot = NO_SLOT;
+    record.generation++;
+    mFreeNodes.push_back(node.index);
+    mNeedsSort = true;
+}
+
+auto TransformHierarchy::isAlive(const TransformNode node) const -> bool {
+    return node.index < mNodes.size() && NO_SLOT != mNodes[node.index].slot && mNodes[node.index].generation == node.generation;
+}
+
+auto TransformHierarchy::setParent(const TransformNode node, const TransformNode parent) -> void {
+    const auto slot = getSlot(node);
+    const auto parentSlot = getSlot(parent);
+    for (auto ancestor = parentSlot; NO_SLOT != ancestor; ancestor = mParents[ancestor]) {
+        if (ancestor == slot) {
+            throw RuntimeException("A transform node cannot become a child of itself or of one of its descendants");
+        }
+    }
+
+    mParents[slot] = parentSlot;
+    markDirty(slot);
+    mNeedsSort = true;
+}
+
+auto TransformHierarchy::clearParent(const TransformNode node) -> void {
+    const auto slot = getSlot(node);
+    mParents[slot] = NO_SLOT;
+    markDirty(slot);
+    mNeedsSort = true;
+}
+
+auto TransformHierarchy::setLocal(const TransformNode node, const Transform& local) -> void {
+    const auto slot = getSlot(node);
+    mPositionX[slot] = local.position.x;
+    mPositionY[slot] = local.position.y;
+    mPositionZ[slot] = local.position.z;
+    mRotationX[slot] = local.rotation.x;
+    mRotationY[slot] = local.rotation.y;
+    mRotationZ[slot] = local.rotation.z;
+    mRotationW[slot] = local.rotation.w;
+    mScaleX[slot] = local.scale.x;
+    mScaleY[slot] = local.scale.y;
+    mScaleZ[slot] = local.scale.z;
+    markDirty(slot);
+}
+
+auto TransformHierarchy::getLocal(const TransformNode node) const -> Transform {
+    const auto slot = getSlot(node);
+    return {.position = glm::vec3(mPositionX[slot], mPositionY[slot], mPositionZ[slot]),
+            .rotation = glm::quat(mRotationW[slot], mRotationX[slot], mRotationY[slot], mRotationZ[slot]),
+            .scale = glm::vec3(mScaleX[slot], mScaleY[slot], mScaleZ[slot])};
+}
+
+auto TransformHierarchy::getWorldMatrix(const TransformNode node) const -> const glm::mat4& {
+    return mWorld[getSlot(node)];
+}
+
+auto TransformHierarchy::getSlot(const TransformNode node) const -> uint32_t {
+    if (!isAlive(node)) {
+        throw RuntimeException("The transform node " + std::to_string(node.index) + " is not alive");
+    }
+    return mNodes[node.index].slot;
+}
+
+auto TransformHierarchy::appendSlot(const uint32_t parentSlot, const Transform& local) -> TransformNode {
+    uint32_t index = 0;
+    if (mFreeNodes.empty()) {
+        index = static_cast<uint32_t>(mNodes.size());
+        mNodes.push_back({NO_SLOT, 0});
+    } else {
+        index = mFreeNodes.back();
+        mFreeNodes.pop_back();
+    }
+
+    const auto slot = mSlotCount++;
+    const auto paddedCount = (mSlotCount + TRANSFORM_BATCH_SIZE - 1) & ~(TRANSFORM_BATCH_SIZE - 1);
+    if (paddedCount > mDirty.size()) {
+        for (auto* array : {&mPositionX, &mPositionY, &mPositionZ, &mRotationX, &mRotationY, &mRotationZ, &mRotationW, &mScaleX, &mScaleY, &mScaleZ}) {
+            array->resize(paddedCount, 0.0F);
+        }
+        mParents.resize(paddedCount, NO_SLOT);
+        mSlotNodes.resize(paddedCount, NO_SLOT);
+        mDirty.resize(paddedCount, 0);
+        mLocal.resize(paddedCount, glm::mat4(1.0F));
+        mWorld.resize(paddedCount, glm::mat4(1.0F));
+    }
+
+    mNodes[index].slot = slot;
+    mParents[slot] = parentSlot;
+    mSlotNodes[slot] = index;
+
+    const TransformNode node{index, mNodes[index].generation};
+    setLocal(node, local);
+    return node;
+}
+
+auto TransformHierarchy::markDirty(const uint32_t slot) -> void {
+    mDirty[slot] = 1;
+    mFirstDirtySlot = std::min(mFirstDirtySlot, slot);
+}
+
+auto TransformHierarchy::sortByDepth() -> void {
+    // the descendants of destroyed nodes are destroyed as well, a parent may come after its child at this point
+    std::vector<uint32_t> depths(mSlotCount, 0);
+    std::vector<uint32_t> order;
+    order.reserve(mSlotCount);
+    for (uint32_t slot = 0; slot < mSlotCount; slot++) {
+        bool alive = NO_SLOT != mSlotNodes[slot];
+        for (auto ancestor = mParents[slot]; alive && NO_SLOT != ancestor; ancestor = mParents[ancestor]) {
+            alive = NO_SLOT != mSlotNodes[ancestor];
+            depths[slot]++;
+        }
+        if (alive) {
+            order.push_back(slot);
+        } else if (NO_SLOT != mSlotNodes[slot]) {
+            auto& record = mNodes[mSlotNodes[slot]];
+            record.slot = NO_SLOT;
+            record.generation++;
+            mFreeNodes.push_back(mSlotNodes[slot]);
+        }
+    }
+    std::ranges::stable_sort(order, [&depths](const uint32_t a, const uint32_t b) { return depths[a] < depths[b]; });
+
+    std::vector<uint32_t> newSlots(mSlotCount, NO_SLOT);
+    for (uint32_t slot = 0; slot < order.size(); slot++) {
+        newSlots[order[slot]] = slot;
+    }
+
+    const auto permute = [&order](auto& array) {
+        auto sorted = array;
+        for (uint32_t slot = 0; slot < order.size(); slot++) {
+            sorted[slot] = array[order[slot]];
+        }
+        array.swap(sorted);
+    };
+    for (auto* array : {&mPositionX, &mPositionY, &mPositionZ, &mRotationX, &mRotationY, &mRotationZ, &mRotationW, &mScaleX, &mScaleY, &mScaleZ}) {
+        permute(*array);
+    }
+    permute(mParents);
+    permute(mSlotNodes);
+    permute(mDirty);
+    permute(mLocal);
+    permute(mWorld);
+
+    mSlotCount = static_cast<uint32_t>(order.size());
+    for (uint32_t slot = 0; slot < mSlotCount; slot++) {
+        if (NO_SLOT != mParents[slot]) {
+            mParents[slot] = newSlots[mParents[slot]];
+        }
+        mNodes[mSlotNodes[slot]].slot = slot;
+    }
+    for (auto slot = mSlotCount; slot < mDirty.size(); slot++) {
+        mSlotNodes[slot] = NO_SLOT;
+        mDirty[slot] = 0;
+    }
+
+    mFirstDirtySlot = 0;
+    mNeedsSort = false;
+}
+
+auto TransformHierarchy::update() -> uint32_t {
+    if (mNeedsSort) {
+        sortByDepth();
+    }
+    if (mFirstDirtySlot >= mSlotCount) {
+        return 0;
+    }
+
+    // the parents come first, so a single pass hands the dirty flags down to all descendants
+    const auto firstSlot = mFirstDirtySlot;
+    for (auto slot = firstSlot; slot < mSlotCount; slot++) {
+        if (NO_SLOT != mParents[slot]) {
+            mDirty[slot] |= mDirty[mParents[slot]];
+        }
+    }
+
+    updateLocalMatrices(firstSlot & ~(TRANSFORM_BATCH_SIZE - 1));
+    const auto updated = updateWorldMatrices(firstSlot);
+    mFirstDirtySlot = mSlotCount;
+    return updated;
+}
+
+auto TransformHierarchy::updateLocalMatrices(const uint32_t firstSlot) -> void {
+    // local = translate * rotate * scale, calculated for four consecutive slots at once. A batch is skipped if none
+    // of its slots is dirty, the padding slots at the end are calculated but never used
+    for (auto slot = firstSlot; slot < mSlotCount; slot += TRANSFORM_BATCH_SIZE) {
+        if (0 == (mDirty[slot] | mDirty[slot + 1] | mDirty[slot + 2] | mDirty[slot + 3])) {
+            continue;
+        }
+#if defined(ADELIE_TRANSFORM_SSE)
+        const __m128 x = _mm_loadu_ps(&mRotationX[slot]);
+        const __m128 y = _mm_loadu_ps(&mRotationY[slot]);
+        const __m128 z = _mm_loadu_ps(&mRotationZ[slot]);
+        const __m128 w = _mm_loadu_ps(&mRotationW[slot]);
+        const __m128 sx = _mm_loadu_ps(&mScaleX[slot]);
+        const __m128 sy = _mm_loadu_ps(&mScaleY[slot]);
+        const __m128 sz = _mm_loadu_ps(&mScaleZ[slot]);
+        const __m128 one = _mm_set1_ps(1.0F);
+        const __m128 two = _mm_set1_ps(2.0F);
+
+        const __m128 xx = _mm_mul_ps(x, x);
+        const __m128 yy = _mm_mul_ps(y, y);
+        const __m128 zz = _mm_mul_ps(z, z);
+        const __m128 xy = _mm_mul_ps(x, y);
+        const __m128 xz = _mm_mul_ps(x, z);
+        const __m128 yz = _mm_mul_ps(y, z);
+        const __m128 wx = _mm_mul_ps(w, x);
+        const __m128 wy = _mm_mul_ps(w, y);
+        const __m128 wz = _mm_mul_ps(w, z);
+
+        // every register holds one element of the four matrices, they are transposed into the columns afterward
+        __m128 c0x = _mm_mul_ps(sx, _mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(yy, zz))));
+        __m128 c0y = _mm_mul_ps(sx, _mm_mul_ps(two, _mm_add_ps(xy, wz)));
+        __m128 c0z = _mm_mul_ps(sx, _mm_mul_ps(two, _mm_sub_ps(xz, wy)));
+        __m128 c1x = _mm_mul_ps(sy, _mm_mul_ps(two, _mm_sub_ps(xy, wz)));
+        __m128 c1y = _mm_mul_ps(sy, _mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, zz))));
+        __m128 c1z = _mm_mul_ps(sy, _mm_mul_ps(two, _mm_add_ps(yz, wx)));
+        __m128 c2x = _mm_mul_ps(sz, _mm_mul_ps(two, _mm_add_ps(xz, wy)));
+        __m128 c2y = _mm_mul_ps(sz, _mm_mul_ps(two, _mm_sub_ps(yz, wx)));
+        __m128 c2z = _mm_mul_ps(sz, _mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, yy))));
+        __m128 c3x = _mm_loadu_ps(&mPositionX[slot]);
+        __m128 c3y = _mm_loadu_ps(&mPositionY[slot]);
+        __m128 c3z = _mm_loadu_ps(&mPositionZ[slot]);
+        __m128 c0w = _mm_setzero_ps();
+        __m128 c1w = _mm_setzero_ps();
+        __m128 c2w = _mm_setzero_ps();
+        __m128 c3w = one;
+        _MM_TRANSPOSE4_PS(c0x, c0y, c0z, c0w);
+        _MM_TRANSPOSE4_PS(c1x, c1y, c1z, c1w);
+        _MM_TRANSPOSE4_PS(c2x, c2y, c2z, c2w);
+        _MM_TRANSPOSE4_PS(c3x, c3y, c3z, c3w);
+
+        storeColumns(glm::value_ptr(mLocal[slot]), c0x, c1x, c2x, c3x);
+        storeColumns(glm::value_ptr(mLocal[slot + 1]), c0y, c1y, c2y, c3y);
+        storeColumns(glm::value_ptr(mLocal[slot + 2]), c0z, c1z, c2z, c3z);
+        storeColumns(glm::value_ptr(mLocal[slot + 3]), c0w, c1w, c2w, c3w);
+#else
+        for (auto lane = slot; lane < slot + TRANSFORM_BATCH_SIZE; lane++) {
+            const float x = mRotationX[lane];
+            const float y = mRotationY[lane];
+            const float z = mRotationZ[lane];
+            const float w = mRotationW[lane];
+            float* local = glm::value_ptr(mLocal[lane]);
+            local[0] = mScaleX[lane] * (1.0F - (2.0F * ((y * y) + (z * z))));
+            local[1] = mScaleX[lane] * 2.0F * ((x * y) + (w * z));
+            local[2] = mScaleX[lane] * 2.0F * ((x * z) - (w * y));
+            local[3] = 0.0F;
+            local[4] = mScaleY[lane] * 2.0F * ((x * y) - (w * z));
+            local[5] = mScaleY[lane] * (1.0F - (2.0F * ((x * x) + (z * z))));
+            local[6] = mScaleY[lane] * 2.0F * ((y * z) + (w * x));
+            local[7] = 0.0F;
+            local[8] = mScaleZ[lane] * 2.0F * ((x * z) + (w * y));
+            local[9] = mScaleZ[lane] * 2.0F * ((y * z) - (w * x));
+            local[10] = mScaleZ[lane] * (1.0F - (2.0F * ((x * x) + (y * y))));
+            local[11] = 0.0F;
+            local[12] = mPositionX[lane];
+            local[13] = mPositionY[lane];
+            local[14] = mPositionZ[lane];
+            local[15] = 1.0F;
+        }
+#endif
+    }
+}
+
+auto TransformHierarchy::updateWorldMatrices(const uint32_t firstSlot) -> uint32_t {
+    uint32_t updated = 0;
+    for (auto slot = firstSlot; slot < mSlotCount; slot++) {
+        if (0 == mDirty[slot]) {
+            continue;
+        }
+        if (NO_SLOT == mParents[slot]) {
+            mWorld[slot] = mLocal[slot];
+        } else {
+            multiply(mWorld[mParents[slot]], mLocal[slot], mWorld[slot]);
+        }
+        mDirty[slot] = 0;
+        updated++;
+    }
+    return updated;
+}
@@ -0,0 +1,122 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#if !defined(__ADELIE_CORE_SCENE_TRANSFORMHIERARCHY_HXX__)
+    #define __ADELIE_CORE_SCENE_TRANSFORMHIERARCHY_HXX__
+
+    #include <adelie/adelie.hxx>
+    #include <cstdint>
+    #include <glm/gtc/quaternion.hpp>
+    #include <vector>
+
+namespace adelie::core::scene {
+
+    // the position, rotation and scale of a node relative to its parent
+    struct ADELIE_API Transform {
+            glm::vec3 position;
+            glm::quat rotation;
+            glm::vec3 scale;
+    }; /* struct Transform */
+
+    // a handle to a node of a transform hierarchy, the generation guards against handles of destroyed nodes
+    struct ADELIE_API TransformNode {
+            uint32_t index;
+            uint32_t generation;
+
+            [[nodiscard]] auto operator==(const TransformNode& other) const -> bool = default;
+    }; /* struct TransformNode */
+
+    // the local and world transforms of a tree of nodes. The nodes are stored in arrays sorted by their depth, so a
+    // parent always comes before its children and the world matrices are calculated in a single pass over the arrays.
+    // The local transforms are kept as a structure of arrays and turned into matrices four nodes at a time (SSE)
+    //
+    // only nodes whose local transform (or the one of an ancestor) changed are recalculated, an update of a hierarchy
+    // in which nothing moved returns right away. Creating, destroying or reparenting nodes sorts the arrays again with
+    // the next update
+    class ADELIE_API TransformHierarchy {
+        public:
+            TransformHierarchy();
+
+            ~TransformHierarchy() noexcept = default;
+
+            TransformHierarchy(const TransformHierarchy&) = delete;
+
+            auto operator=(TransformHierarchy const&) -> TransformHierarchy& = delete;
+
+            TransformHierarchy(TransformHierarchy&&) = delete;
+
+            auto operator=(TransformHierarchy&&) -> TransformHierarchy& = delete;
+
+            // a root node
+            auto createNode(const Transform& local) -> TransformNode;
+
+            // throws a RuntimeException if the parent is not alive
+            auto createNode(TransformNode parent, const Transform& local) -> TransformNode;
+
+            // the children of the node are destroyed with the next update
+            auto destroyNode(TransformNode node) -> void;
+
+            [[nodiscard]] auto isAlive(TransformNode node) const -> bool;
+
+            // throws a RuntimeException if the parent is not alive or is the node itself or one of its descendants
+            auto setParent(TransformNode node, TransformNode parent) -> void;
+
+            // turns the node into a root node
+            auto clearParent(TransformNode node) -> void;
+
+            auto setLocal(TransformNode node, const Transform& local) -> void;
+
+            [[nodiscard]] auto getLocal(TransformNode node) const -> Transform;
+
+            // the world matrix as of the last update, throws a RuntimeException if the node is not alive
+            [[nodiscard]] auto getWorldMatrix(TransformNode node) const -> const glm::mat4&;
+
+            [[nodiscard]] auto getNodeCount() const -> uint32_t { return mSlotCount; }
+
+            // recalculates the world matrices of the changed nodes and their descendants, returns how many were updated
+            auto update() -> uint32_t;
+
+        private:
+            static inline constexpr uint32_t NO_SLOT = UINT32_MAX;
+
+            struct NodeRecord {
+                    uint32_t slot;
+                    uint32_t generation;
+            };
+
+            auto getSlot(TransformNode node) const -> uint32_t;
+            auto appendSlot(uint32_t parentSlot, const Transform& local) -> TransformNode;
+            auto markDirty(uint32_t slot) -> void;
+            auto sortByDepth() -> void;
+            auto updateLocalMatrices(uint32_t firstSlot) -> void;
+            auto updateWorldMatrices(uint32_t firstSlot) -> uint32_t;
+
+            // the node records are addressed by the handles and point to the slots, which move when the arrays are sorted
+            std::vector<NodeRecord> mNodes;
+            std::vector<uint32_t> mFreeNodes;
+
+            // the per slot arrays, padded to a multiple of four for the SIMD batches
+            uint32_t mSlotCount;
+            std::vector<float> mPositionX;
+            std::vector<float> mPositionY;
+            std::vector<float> mPositionZ;
+            std::vector<float> mRotationX;
+            std::vector<float> mRotationY;
+            std::vector<float> mRotationZ;
+            std::vector<float> mRotationW;
+            std::vector<float> mScaleX;
+            std::vector<float> mScaleY;
+            std::vector<float> mScaleZ;
+            std::vector<uint32_t> mParents;  // the slot of the parent or NO_SLOT
+            std::vector<uint32_t> mSlotNodes;  // the node index of the slot or NO_SLOT once it was destroyed
+            std::vector<uint8_t> mDirty;
+            std::vector<glm::mat4> mLocal;
+            std::vector<glm::mat4> mWorld;
+
+            uint32_t mFirstDirtySlot;
+            bool mNeedsSort;
+
+    }; /* class TransformHierarchy */
+
+} /* namespace adelie::core::scene */
+
+#endif /* if !defined(__ADELIE_CORE_SCENE_TRANSFORMHIERARCHY_HXX__) */
@@ -0,0 +1,100 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#include <adelie/core/scene/World.hxx>
+#include <adelie/exception/RuntimeException.hxx>
+#include <bit>
+#include <cstring>
+
+using adelie::core::scene::Archetype;
+using adelie::core::scene::ComponentMask;
+using adelie::core::scene::ComponentRegistry;
+using adelie::core::scene::ComponentTypeId;
+using adelie::core::scene::Entity;
+using adelie::core::scene::World;
+using adelie::exception::RuntimeException;
+
+World::World() {
+    mEntityCount = 0;
+}
+
+auto World::createEntity() -> Entity {
+    uint32_t index = 0;
+    if (mFreeIndices.empty()) {
+        index = static_cast<uint32_t>(mRecords.size());
+        mRecords.push_back({nullptr, {0, 0}, 0});
+    } else {
+        index = mFreeIndices.back();
+        mFreeIndices.pop_back();
+    }
+
+    auto& record = mRecords[index];
+    const Entity entity{index, record.generation};
+    record.archetype = getArchetype(0);
+    record.location = record.archetype->allocate(entity);
+    mEntityCount++;
+    return entity;
+}
+
+auto World::destroyEntity(const Entity entity) -> void {
+    if (!isAlive(entity)) {
+        return;
+    }
+
+    auto& record = mRecords[entity.index];
+    detach(record);
+    record.archetype = nullptr;
+    record.generation++;
+    mFreeIndices.push_back(entity.index);
+    mEntityCount--;
+}
+
+auto World::isAlive(const Entity entity) const -> bool {
+    return entity.index < mRecords.size() && nullptr != mRecords[entity.index].archetype && mRecords[entity.index].generation == entity.generation;
+}
+
+auto World::getArchetype(const ComponentMask mask) -> Archetype* {
+    auto& archetype = mArchetypes[mask];
+    if (!archetype) {
+        archetype = std::make_unique<Archetype>(mask);
+        mArchetypeList.push_back(archetype.get());
+    }
+    return archetype.get();
+}
+
+auto World::changeArchetype(const Entity entity, const ComponentMask added, const ComponentMask removed) -> const EntityRecord& {
+    if (!isAlive(entity)) {
+        throw RuntimeException("The entity " + std::to_string(entity.index) + " is not alive");
+    }
+
+    auto& record = mRecords[entity.index];
+    auto* source = record.archetype;
+    const auto mask = (source->getMask() | added) & ~removed;
+    if (source->getMask() == mask) {
+        return record;
+    }
+
+    auto* target = getArchetype(mask);
+    const auto sourceLocation = record.location;
+    const auto targetLocation = target->allocate(entity);
+
+    // the components of both archetypes are copied over, the ones only the source has are dropped
+    const auto* registry = ComponentRegistry::getInstance();
+    for (auto shared = source->getMask() & mask; 0 != shared; shared &= shared - 1) {
+        const auto id = static_cast<ComponentTypeId>(std::countr_zero(shared));
+        const auto size = registry->getInfo(id).size;
+        std::memcpy(target->getColumn(targetLocation.chunk, id) + (targetLocation.row * size), source->getColumn(sourceLocation.chunk, id) + (sourceLocation.row * size), size);
+    }
+
+    detach(record);
+    record.archetype = target;
+    record.location = targetLocation;
+    return record;
+}
+
+auto World::detach(const EntityRecord& record) -> void {
+    const auto location = record.location;
+    const auto moved = record.archetype->remove(location);
+    if (&mRecords[moved.index] != &record) {
+        mRecords[moved.index].location = location;
+    }
+}
@@ -0,0 +1,166 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#if !defined(__ADELIE_CORE_SCENE_WORLD_HXX__)
+    #define __ADELIE_CORE_SCENE_WORLD_HXX__
+
+    #include <adelie/adelie.hxx>
+    #include <adelie/core/jobs/JobSystem.hxx>
+    #include <adelie/core/scene/Archetype.hxx>
+    #include <adelie/core/scene/ComponentRegistry.hxx>
+    #include <adelie/core/scene/Entity.hxx>
+    #include <algorithm>
+    #include <cstdint>
+    #include <memory>
+    #include <unordered_map>
+    #include <utility>
+    #include <vector>
+
+namespace adelie::core::scene {
+
+    // the batches of chunks per worker of World::parallelEachChunk, a few of them balance chunks of different costs
+    static inline constexpr uint32_t WORLD_CHUNK_BATCHES_PER_WORKER = 4;
+
+    // owns the entities and their components, grouped into archetypes. Adding or removing a component moves the entity
+    // (and its other components) into the archetype of the new component set, so the archetypes always stay packed
+    //
+    // the queries visit the archetypes which contain the requested components chunk by chunk. A component requested as
+    // const is only read, which is what the system scheduler uses to find the systems which can run in parallel. The
+    // structure of the world (entities, components) must not change while a query runs
+    class ADELIE_API World {
+        public:
+            World();
+
+            ~World() noexcept = default;
+
+            World(const World&) = delete;
+
+            auto operator=(World const&) -> World& = delete;
+
+            World(World&&) = delete;
+
+            auto operator=(World&&) -> World& = delete;
+
+            auto createEntity() -> Entity;
+
+            auto destroyEntity(Entity entity) -> void;
+
+            [[nodiscard]] auto isAlive(Entity entity) const -> bool;
+
+            [[nodiscard]] auto getEntityCount() const -> uint32_t { return mEntityCount; }
+
+            // adds the component or overwrites it if the entity already has one
+            template <ComponentType T>
+            auto addComponent(const Entity entity, const T& component) -> T& {
+                const EntityRecord& record = changeArchetype(entity, ComponentRegistry::getMask<T>(), 0);
+                auto* target = record.archetype->getArray<T>(record.location.chunk) + record.location.row;
+                *target = component;
+                return *target;
+            }
+
+            template <ComponentType T>
+            auto removeComponent(const Entity entity) -> void {
+                changeArchetype(entity, 0, ComponentRegistry::getMask<T>());
+            }
+
+            template <ComponentType T>
+            [[nodiscard]] auto hasComponent(const Entity entity) const -> bool {
+                return isAlive(entity) && mRecords[entity.index].archetype->hasComponent(ComponentRegistry::getId<T>());
+            }
+
+            // nullptr if the entity does not have the component. The pointer is invalidated by any structural change
+            template <ComponentType T>
+            [[nodiscard]] auto getComponent(const Entity entity) -> T* {
+                if (!hasComponent<T>(entity)) {
+                    return nullptr;
+                }
+                const EntityRecord& record = mRecords[entity.index];
+                return record.archetype->getArray<T>(record.location.chunk) + record.location.row;
+            }
+
+            // func(count, entities, arrays...) once per chunk of every archetype which has all the components
+            template <typename... Ts, typename F>
+            auto eachChunk(F&& func) -> void {
+                const auto mask = ComponentRegistry::getMask<Ts...>();
+                for (const auto* archetype : mArchetypeList) {
+                    if ((archetype->getMask() & mask) != mask) {
+                        continue;
+                    }
+                    for (uint32_t chunk = 0; chunk < archetype->getChunkCount(); chunk++) {
+                        func(archetype->getEntityCount(chunk), archetype->getEntities(chunk), archetype->template getArray<Ts>(chunk)...);
+                    }
+                }
+            }
+
+            // func(components...) for every entity which has all the components
+            template <typename... Ts, typename F>
+            auto each(F&& func) -> void {
+                eachChunk<Ts...>([&func](const uint32_t count, const Entity* /*entities*/, Ts*... arrays) {
+                    for (uint32_t row = 0; row < count; row++) {
+                        func(arrays[row]...);
+                    }
+                });
+            }
+
+            // like eachChunk, but the chunks are spread over the workers of the job system. func is called concurrently
+            // and may only write to the components of the chunk it was given
+            template <typename... Ts, typename F>
+            auto parallelEachChunk(const F& func) -> void {
+                const auto mask = ComponentRegistry::getMask<Ts...>();
+                std::vector<std::pair<const Archetype*, uint32_t>> chunks;
+                for (const auto* archetype : mArchetypeList) {
+                    if ((archetype->getMask() & mask) == mask) {
+                        for (uint32_t chunk = 0; chunk < archetype->getChunkCount(); chunk++) {
+                            chunks.emplace_back(archetype, chunk);
+                        }
+                    }
+                }
+
+                // a job per chunk would overrun the job ring of the calling thread for large worlds
+                auto* jobSystem = jobs::JobSystem::getInstance();
+                const auto count = static_cast<uint32_t>(chunks.size());
+                const auto batchSize = std::max(1U, count / (std::max(jobSystem->getWorkerCount(), 1U) * WORLD_CHUNK_BATCHES_PER_WORKER));
+                jobSystem->parallelFor(count, batchSize, [&](const uint32_t begin, const uint32_t end) {
+                    for (auto i = begin; i < end; i++) {
+                        const auto& [archetype, chunk] = chunks[i];
+                        func(archetype->getEntityCount(chunk), archetype->getEntities(chunk), archetype->template getArray<Ts>(chunk)...);
+                    }
+                });
+            }
+
+            template <typename... Ts, typename F>
+            auto parallelEach(const F& func) -> void {
+                parallelEachChunk<Ts...>([&func](const uint32_t count, const Entity* /*entities*/, Ts*... arrays) {
+                    for (uint32_t row = 0; row < count; row++) {
+                        func(arrays[row]...);
+                    }
+                });
+            }
+
+        private:
+            struct EntityRecord {
+                    Archetype* archetype;
+                    ArchetypeLocation location;
+                    uint32_t generation;
+            };
+
+            auto getArchetype(ComponentMask mask) -> Archetype*;
+
+            // moves the entity into the archetype with the components added and removed, the components it has in both
+            // archetypes are copied and the added ones are left uninitialized. Throws a RuntimeException if the entity
+            // is not alive
+            auto changeArchetype(Entity entity, ComponentMask added, ComponentMask removed) -> const EntityRecord&;
+
+            // removes the entity from its archetype and fixes the record of the entity which took its place
+            auto detach(const EntityRecord& record) -> void;
+
+            std::vector<EntityRecord> mRecords;
+            std::vector<uint32_t> mFreeIndices;
+            uint32_t mEntityCount;
+            std::unordered_map<ComponentMask, std::unique_ptr<Archetype>> mArchetypes;
+            std::vector<Archetype*> mArchetypeList;  // in creation order, iterated by the queries
+
+    }; /* class World */
+
+} /* namespace adelie::core::scene */
+
+#endif /* if !defined(__ADELIE_CORE_SCENE_WORLD_HXX__) */
@@ -0,0 +1,207 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#include <adelie/core/Assert.hxx>
+#include <adelie/core/jobs/JobSystem.hxx>
+#include <adelie/exception/IOException.hxx>
+#include <adelie/exception/RuntimeException.hxx>
+#include <adelie/io/AssetPack.hxx>
+#include <adelie/io/Hash.hxx>
+#include <adelie/io/Logger.hxx>
+#include <adelie/io/Lz4.hxx>
+#include <algorithm>
+#include <cstring>
+#include <exception>
+#include <format>
+#include <fstream>
+#include <mutex>
+
+using adelie::core::jobs::JobSystem;
+using adelie::exception::IOException;
+using adelie::exception::RuntimeException;
+using adelie::io::AssetCompression;
+using adelie::io::AssetPack;
+using adelie::io::AssetPackEntry;
+using adelie::io::AssetPackHeader;
+using adelie::io::AssetPackWriter;
+using adelie::io::Lz4;
+
+namespace {
+    // the batches of readMany per worker, a few of them balance the entries of different sizes
+    constexpr uint32_t BATCHES_PER_WORKER = 4;
+}  // namespace
+
+AssetPack::AssetPack(const std::string& filename) : mFile(filename) {
+    const auto data = mFile.getData();
+    if (data.size() < sizeof(AssetPackHeader)) {
+        throw IOException("Asset pack is too small to contain a header: " + filename);
+    }
+
+    AssetPackHeader header;
+    std::memcpy(&header, data.data(), sizeof(header));
+    if (header.magic != ASSET_PACK_MAGIC) {
+        throw IOException("File is not an asset pack: " + filename);
+    }
+    if (header.version != ASSET_PACK_VERSION) {
+        throw IOException(std::format("Unsupported asset pack version {} in {}", header.version, filename));
+    }
+    if (header.indexSize != static_cast<uint64_t>(header.entryCount) * sizeof(AssetPackEntry) || header.indexOffset % alignof(AssetPackEntry) != 0 || header.indexOffset > data.size() ||
+        header.indexSize > data.size() - header.indexOffset) {
+        throw IOException("Asset pack index is out of bounds: " + filename);
+    }
+
+    // the index is aligned inside the mapping, so it can be used in place
+    mEntries = {reinterpret_cast<const AssetPackEntry*>(data.data() + header.indexOffset), header.entryCount};
+    for (const auto& entry : mEntries) {
+        if (entry.offset > data.size() || entry.storedSize > data.size() - entry.offset) {
+            throw IOException("Asset pack entry is out of bounds: " + filename);
+        }
+        if (entry.compression == AssetCompression::None && entry.storedSize != entry.size) {
+            throw IOException("Asset pack entry has an inconsistent size: " + filename);
+        }
+    }
+
+    AdelieLogDebug("Opened asset pack {} with {} entries ({} bytes)", filename, mEntries.size(), data.size());
+}
+
+auto AssetPack::find(const std::string_view path) const -> const AssetPackEntry* {
+    const auto hash = hashPath(path);
+    const auto iterator = std::lower_bound(mEntries.begin(), mEntries.end(), hash, [](const AssetPackEntry& entry, const uint64_t value) { return entry.pathHash < value; });
+    if (iterator == mEntries.end() || iterator->pathHash != hash) {
+        return nullptr;
+    }
+    return &*iterator;
+}
+
+auto AssetPack::view(const AssetPackEntry& entry) const -> std::span<const std::byte> {
+    AdelieCoreAssert(entry.compression == AssetCompression::None, "Only uncompressed asset pack entries can be viewed");
+    return mFile.getData().subspan(entry.offset, entry.storedSize);
+}
+
+auto AssetPack::read(const AssetPackEntry& entry) const -> std::vector<std::byte> {
+    const auto stored = mFile.getData().subspan(entry.offset, entry.storedSize);
+    std::vector<std::byte> data(entry.size);
+
+    switch (entry.compression) {
+        case AssetCompression::None:
+            std::copy(stored.begin(), stored.end(), data.begin());
+            break;
+        case AssetCompression::Lz4:
+            Lz4::decompress(stored, data);
+            break;
+        default:
+            throw IOException(std::format("Unsupported compression {} in asset pack {}", static_cast<uint32_t>(entry.compression), getFilename()));
+    }
+
+#if defined(ADELIE_BUILD_TYPE_DEBUG)
+    if (hashBytes(data) != entry.contentHash) {
+        throw IOException(std::format("Content hash mismatch of entry {:016x} in asset pack {}", entry.pathHash, getFilename()));
+    }
+#endif
+
+    return data;
+}
+
+auto AssetPack::readMany(const std::span<const AssetPackEntry* const> entries) const -> std::vector<std::vector<std::byte>> {
+    std::vector<std::vector<std::byte>> results(entries.size());
+
+    // exceptions must not escape a job, the first failure is rethrown on the calling thread
+    std::mutex errorMutex;
+    std::exception_ptr error = nullptr;
+
+    // a job per entry would overrun the job ring of the calling thread for large batches
+    auto* jobSystem = JobSystem::getInstance();
+    const auto count = static_cast<uint32_t>(entries.size());
+    const auto batchSize = std::max(1U, count / (std::max(jobSystem->getWorkerCount(), 1U) * BATCHES_PER_WORKER));
+    jobSystem->parallelFor(count, batchSize, [&](const uint32_t begin, const uint32_t end) {
+        for (auto i = begin; i < end; i++) {
+            try {
+                results[i] = read(*entries[i]);
+            } catch (...) {
+                std::scoped_lock lock(errorMutex);
+                if (!error) {
+                    error = std::current_exception();
+                }
+            }
+        }
+    });
+
+    if (error) {
+        std::rethrow_exception(error);
+    }
+    return results;
+}
+
+auto AssetPackWriter::add(const std::string_view path, const std::span<const std::byte> data, const AssetCompression compression) -> void {
+    const auto hash = hashPath(path);
+    for (const auto& pending : mEntries) {
+        if (pending.entry.pathHash == hash) {
+            throw RuntimeException(std::format("Asset path {} collides with {} in the asset pack", path, pending.path));
+        }
+    }
+
+    PendingEntry pending{};
+    pending.path = std::string(path);
+    pending.entry.pathHash = hash;
+    pending.entry.size = data.size();
+    pending.entry.contentHash = hashBytes(data);
+    pending.entry.compression = AssetCompression::None;
+
+    if (compression == AssetCompression::Lz4) {
+        auto compressed = Lz4::compress(data);
+        if (compressed.size() < data.size()) {
+            pending.entry.compression = AssetCompression::Lz4;
+            pending.data = std::move(compressed);
+        }
+    }
+    if (pending.entry.compression == AssetCompression::None) {
+        pending.data.assign(data.begin(), data.end());
+    }
+    pending.entry.storedSize = pending.data.size();
+
+    mEntries.push_back(std::move(pending));
+}
+
+auto AssetPackWriter::write(const std::string& filename) -> void {
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        throw IOException("Failed to open asset pack for writing: " + filename);
+    }
+
+    const auto alignUp = [](const uint64_t value) { return (value + ASSET_PACK_ALIGNMENT - 1) & ~(ASSET_PACK_ALIGNMENT - 1); };
+    const std::array<char, ASSET_PACK_ALIGNMENT> padding{};
+
+    uint64_t offset = sizeof(AssetPackHeader);
+    file.seekp(static_cast<std::streamoff>(offset));
+
+    for (auto& pending : mEntries) {
+        const auto alignedOffset = alignUp(offset);
+        file.write(padding.data(), static_cast<std::streamsize>(alignedOffset - offset));
+        pending.entry.offset = alignedOffset;
+        file.write(reinterpret_cast<const char*>(pending.data.data()), static_cast<std::streamsize>(pending.data.size()));
+        offset = alignedOffset + pending.data.size();
+    }
+
+    std::vector<AssetPackEntry> index;
+    index.reserve(mEntries.size());
+    for (const auto& pending : mEntries) {
+        index.push_back(pending.entry);
+    }
+    std::sort(index.begin(), index.end(), [](const AssetPackEntry& left, const AssetPackEntry& right) { return left.pathHash < right.pathHash; });
+
+    AssetPackHeader header{};
+    header.magic = ASSET_PACK_MAGIC;
+    header.version = ASSET_PACK_VERSION;
+    header.entryCount = static_cast<uint32_t>(index.size());
+    header.indexOffset = alignUp(offset);
+    header.indexSize = index.size() * sizeof(AssetPackEntry);
+
+    file.write(padding.data(), static_cast<std::streamsize>(header.indexOffset - offset));
+    file.write(reinterpret_cast<const char*>(index.data()), static_cast<std::streamsize>(header.indexSize));
+
+    file.seekp(0);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    if (!file.good()) {
+        throw IOException("Failed to write asset pack: " + filename);
+    }
+}
@@ -0,0 +1,120 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#if !defined(__ADELIE_IO_ASSETPACK_HXX__)
+    #define __ADELIE_IO_ASSETPACK_HXX__
+
+    #include <adelie/adelie.hxx>
+    #include <adelie/io/MemoryMappedFile.hxx>
+    #include <array>
+    #include <cstddef>
+    #include <cstdint>
+    #include <span>
+    #include <string>
+    #include <string_view>
+    #include <vector>
+
+namespace adelie::io {
+
+    static inline constexpr std::array<char, 4> ASSET_PACK_MAGIC = {'A', 'D', 'P', 'K'};
+    static inline constexpr uint32_t ASSET_PACK_VERSION = 1;
+    static inline constexpr uint64_t ASSET_PACK_ALIGNMENT = 16;  // every entry starts at a multiple of this offset
+
+    enum class AssetCompression : uint32_t { None = 0, Lz4 = 1 }; /* enum class AssetCompression */
+
+    // the layout of an asset pack (all values little-endian):
+    //   AssetPackHeader | entry data (each aligned to ASSET_PACK_ALIGNMENT) | AssetPackEntry[entryCount] sorted by pathHash
+    struct ADELIE_API AssetPackHeader {
+            std::array<char, 4> magic;
+            uint32_t version;
+            uint32_t entryCount;
+            uint32_t reserved;
+            uint64_t indexOffset;
+            uint64_t indexSize;
+    };
+
+    struct ADELIE_API AssetPackEntry {
+            uint64_t pathHash;     // hashPath() of the path relative to the packed directory
+            uint64_t offset;       // offset of the stored data from the beginning of the file
+            uint64_t storedSize;   // the size of the data inside the pack
+            uint64_t size;         // the size of the data after decompression
+            uint64_t contentHash;  // hashBytes() of the uncompressed data
+            AssetCompression compression;
+            uint32_t reserved;
+    };
+
+    static_assert(sizeof(AssetPackHeader) == 32, "The asset pack header must not contain any padding");
+    static_assert(sizeof(AssetPackEntry) == 48, "An asset pack entry must not contain any padding");
+
+    // a read-only archive of many assets in a single memory-mapped file. Looking up an asset is a binary search in
+    // the index, uncompressed assets can be used directly from the mapping without any copy
+    class ADELIE_API AssetPack {
+        public:
+            explicit AssetPack(const std::string& filename);
+
+            ~AssetPack() noexcept = default;
+
+            AssetPack(const AssetPack&) = delete;
+
+            auto operator=(AssetPack const&) -> AssetPack& = delete;
+
+            AssetPack(AssetPack&&) = delete;
+
+            auto operator=(AssetPack&&) -> AssetPack& = delete;
+
+            [[nodiscard]] auto find(std::string_view path) const -> const AssetPackEntry*;
+
+            [[nodiscard]] auto contains(std::string_view path) const -> bool { return nullptr != find(path); }
+
+            // the bytes of an uncompressed entry straight from the mapping, valid as long as the pack is alive
+            [[nodiscard]] auto view(const AssetPackEntry& entry) const -> std::span<const std::byte>;
+
+            // the uncompressed bytes of an entry, compressed entries are decompressed into the returned buffer
+            [[nodiscard]] auto read(const AssetPackEntry& entry) const -> std::vector<std::byte>;
+
+            // read many entries at once, the decompression is distributed over the job system
+            [[nodiscard]] auto readMany(std::span<const AssetPackEntry* const> entries) const -> std::vector<std::vector<std::byte>>;
+
+            [[nodiscard]] auto getEntries() const -> std::span<const AssetPackEntry> { return mEntries; }
+
+            [[nodiscard]] auto getFilename() const -> const std::string& { return mFile.getFilename(); }
+
+        private:
+            MemoryMappedFile mFile;
+            std::span<const AssetPackEntry> mEntries;
+
+    }; /* class AssetPack */
+
+    // builds an asset pack, used by the packing tool
+    class ADELIE_API AssetPackWriter {
+        public:
+            AssetPackWriter() = default;
+
+            ~AssetPackWriter() noexcept = default;
+
+            AssetPackWriter(const AssetPackWriter&) = delete;
+
+            auto operator=(AssetPackWriter const&) -> AssetPackWriter& = delete;
+
+            AssetPackWriter(AssetPackWriter&&) = delete;
+
+            auto operator=(AssetPackWriter&&) -> AssetPackWriter& = delete;
+
+            // entries which do not get smaller by compressing them are stored uncompressed
+            auto add(std::string_view path, std::span<const std::byte> data, AssetCompression compression) -> void;
+
+            auto write(const std::string& filename) -> void;
+
+        private:
+            struct PendingEntry {
+                    AssetPackEntry entry;
+                    std::string path;
+                    std::vector<std::byte> data;
+            };
+
+            std::vector<PendingEntry> mEntries;
+
+    }; /* class AssetPackWriter */
+
+} /* namespace adelie::io */
+
+#endif /* if !defined(__ADELIE_IO_ASSETPACK_HXX__) */
@@ -0,0 +1,29 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#include <adelie/io/AssetPackMount.hxx>
+
+using adelie::io::AssetCompression;
+using adelie::io::AssetPack;
+using adelie::io::AssetPackMount;
+using adelie::io::Blob;
+
+AssetPackMount::AssetPackMount(std::shared_ptr<const AssetPack> assetPack) {
+    mAssetPack = std::move(assetPack);
+}
+
+auto AssetPackMount::exists(const std::string_view path) const -> bool {
+    return mAssetPack->contains(path);
+}
+
+auto AssetPackMount::read(const std::string_view path) const -> std::shared_ptr<const Blob> {
+    const auto* entry = mAssetPack->find(path);
+    if (nullptr == entry) {
+        return nullptr;
+    }
+
+    // the blob keeps the pack and with it the mapping alive for as long as somebody looks at the data
+    if (AssetCompression::None == entry->compression) {
+        return std::make_shared<const Blob>(mAssetPack->view(*entry), mAssetPack);
+    }
+    return std::make_shared<const Blob>(mAssetPack->read(*entry));
+}
@@ -0,0 +1,40 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#if !defined(__ADELIE_IO_ASSETPACKMOUNT_HXX__)
+    #define __ADELIE_IO_ASSETPACKMOUNT_HXX__
+
+    #include <adelie/adelie.hxx>
+    #include <adelie/io/AssetPack.hxx>
+    #include <adelie/io/MountInterface.hxx>
+
+namespace adelie::io {
+
+    // exposes the entries of an asset pack. Uncompressed entries are returned as blobs borrowing from the mapping
+    class ADELIE_API AssetPackMount : public MountInterface {
+        public:
+            explicit AssetPackMount(std::shared_ptr<const AssetPack> assetPack);
+
+            ~AssetPackMount() override = default;
+
+            AssetPackMount(const AssetPackMount&) = delete;
+
+            auto operator=(AssetPackMount const&) -> AssetPackMount& = delete;
+
+            AssetPackMount(AssetPackMount&&) = delete;
+
+            auto operator=(AssetPackMount&&) -> AssetPackMount& = delete;
+
+            [[nodiscard]] auto exists(std::string_view path) const -> bool override;
+
+            [[nodiscard]] auto read(std::string_view path) const -> std::shared_ptr<const Blob> override;
+
+            [[nodiscard]] auto getName() const -> std::string override { return mAssetPack->getFilename(); }
+
+        private:
+            std::shared_ptr<const AssetPack> mAssetPack;
+
+    }; /* class AssetPackMount */
+
+} /* namespace adelie::io */
+
+#endif /* if !defined(__ADELIE_IO_ASSETPACKMOUNT_HXX__) */
@@ -0,0 +1,73 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#if !defined(__ADELIE_IO_BINARYLOGFORMAT_HXX__)
+    #define __ADELIE_IO_BINARYLOGFORMAT_HXX__
+
+    #include <array>
+    #include <cstddef>
+    #include <cstdint>
+
+// the layout of a binary log file, shared by the engine which writes it and adelie_logdecode which turns it back into
+// text. All values are stored in the byte order of the machine which wrote the log
+//
+//   file header
+//   record, record, ...   every record starts with a record header and is padded to BINARY_LOG_RECORD_ALIGNMENT
+//
+// a format record describes a logging statement (level, category, source location, format string) and is written
+// before the first message which refers to it. A message record only holds the id of its format, the timestamp and
+// the raw arguments. The records end at the first record whose size is still zero
+namespace adelie::io {
+
+    constexpr std::array<char, 4> BINARY_LOG_MAGIC = {'A', 'D', 'L', 'G'};
+
+    constexpr uint32_t BINARY_LOG_VERSION = 1;
+
+    constexpr std::size_t BINARY_LOG_RECORD_ALIGNMENT = 8;
+
+    enum class BinaryLogRecordType : uint16_t { Format = 1, Message = 2 }; /* enum class BinaryLogRecordType */
+
+    // every argument is stored as its type followed by 8 bytes for the value, strings are stored as their length
+    // (uint32_t) followed by the characters instead
+    enum class BinaryLogArgumentType : uint8_t {
+        Bool,
+        Char,
+        Signed,    // int64_t
+        Unsigned,  // uint64_t
+        Float,     // stored as double, it is converted back before it is formatted
+        Double,
+        Pointer,   // uint64_t
+        String
+    }; /* enum class BinaryLogArgumentType */
+
+    struct BinaryLogFileHeader {
+            std::array<char, 4> magic;
+            uint32_t version;
+            uint64_t capacity;        // size of the file while it is written, it is truncated when it is closed
+            uint64_t startTime;       // nanoseconds since the epoch (system clock) at which the timestamps start
+            uint64_t droppedRecords;  // messages which did not fit into the file anymore
+    }; /* struct BinaryLogFileHeader */
+
+    struct BinaryLogRecordHeader {
+            uint32_t size;  // of the whole record including this header and the padding, it is stored last
+            BinaryLogRecordType type;
+            uint16_t argumentCount;
+            uint32_t formatId;
+            uint32_t reserved;
+            uint64_t timestamp;  // nanoseconds since the start time of the file
+    }; /* struct BinaryLogRecordHeader */
+
+    // payload of a format record, followed by the file name and the format string (both without a terminator)
+    struct BinaryLogFormatHeader {
+            uint8_t level;
+            uint8_t category;
+            uint16_t fileNameLength;
+            uint32_t line;
+            uint32_t formatLength;
+    }; /* struct BinaryLogFormatHeader */
+
+    static_assert(sizeof(BinaryLogFileHeader) % BINARY_LOG_RECORD_ALIGNMENT == 0);
+    static_assert(sizeof(BinaryLogRecordHeader) % BINARY_LOG_RECORD_ALIGNMENT == 0);
+
+} /* namespace adelie::io */
+
+#endif /* if !defined(__ADELIE_IO_BINARYLOGFORMAT_HXX__) */
@@ -0,0 +1,129 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#include <adelie/exception/IOException.hxx>
+#include <adelie/io/BinaryLogWriter.hxx>
+#include <algorithm>
+#include <filesystem>
+#include <system_error>
+
+using adelie::exception::IOException;
+using adelie::io::BinaryLogWriter;
+
+namespace {
+    auto alignRecordSize(const std::size_t size) -> std::size_t {
+        return (size + adelie::io::BINARY_LOG_RECORD_ALIGNMENT - 1) & ~(adelie::io::BINARY_LOG_RECORD_ALIGNMENT - 1);
+    }
+}  // namespace
+
+BinaryLogWriter::BinaryLogWriter(const std::string& filename, const uint64_t capacity) {
+    if (capacity < sizeof(BinaryLogFileHeader) + 2 * BINARY_LOG_FORMAT_RESERVE) {
+        throw IOException("The capacity of the binary log is too small: " + filename);
+    }
+
+    mFile = std::make_unique<MemoryMappedOutputFile>(filename, capacity);
+    mStartTime = std::chrono::steady_clock::now();
+    mWritePosition = sizeof(BinaryLogFileHeader);
+    mNextFormatId = 0;
+
+    BinaryLogFileHeader header{};
+    header.magic = BINARY_LOG_MAGIC;
+    header.version = BINARY_LOG_VERSION;
+    header.capacity = capacity;
+    header.startTime = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+    header.droppedRecords = 0;
+    std::memcpy(mFile->getData().data(), &header, sizeof(header));
+}
+
+BinaryLogWriter::~BinaryLogWriter() noexcept {
+    // the unused end of the file is cut off, the reader stops at the end of the file as well
+    const auto filename = mFile->getFilename();
+    const auto usedSize = std::min<uint64_t>(mWritePosition.load(), mFile->getSize());
+    mFile.reset();
+
+    std::error_code error;
+    std::filesystem::resize_file(filename, usedSize, error);
+}
+
+auto BinaryLogWriter::registerFormat(const unsigned char level, const unsigned char category, const std::string_view fileName, const uint32_t line, const std::string_view format) noexcept -> uint32_t {
+    const auto formatId = mNextFormatId.fetch_add(1, std::memory_order_relaxed);
+    const auto fileNameLength = std::min<std::size_t>(fileName.size(), UINT16_MAX);
+
+    BinaryLogFormatHeader formatHeader{};
+    formatHeader.level = level;
+    formatHeader.category = category;
+    formatHeader.fileNameLength = static_cast<uint16_t>(fileNameLength);
+    formatHeader.line = line;
+    formatHeader.formatLength = static_cast<uint32_t>(format.size());
+
+    auto* record = beginRecord(BinaryLogRecordType::Format, formatId, 0, sizeof(formatHeader) + fileNameLength + format.size(), true);
+    if (nullptr == record) {
+        return formatId;
+    }
+
+    auto* output = record + sizeof(BinaryLogRecordHeader);
+    std::memcpy(output, &formatHeader, sizeof(formatHeader));
+    output += sizeof(formatHeader);
+    std::memcpy(output, fileName.data(), fileNameLength);
+    output += fileNameLength;
+    std::memcpy(output, format.data(), format.size());
+    endRecord(record, sizeof(formatHeader) + fileNameLength + format.size());
+
+    return formatId;
+}
+
+auto BinaryLogWriter::getDroppedRecords() const noexcept -> uint64_t {
+    auto* header = reinterpret_cast<BinaryLogFileHeader*>(mFile->getData().data());  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    return std::atomic_ref<uint64_t>(header->droppedRecords).load(std::memory_order_relaxed);
+}
+
+auto BinaryLogWriter::beginRecord(const BinaryLogRecordType type, const uint32_t formatId, const uint16_t argumentCount, const std::size_t payloadSize, const bool isFormat) noexcept -> std::byte* {
+    const auto timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - mStartTime);
+    const auto recordSize = alignRecordSize(sizeof(BinaryLogRecordHeader) + payloadSize);
+    const auto limit = mFile->getSize() - (isFormat ? 0 : BINARY_LOG_FORMAT_RESERVE);
+
+    // the position only moves if the record fits, so a full file still accepts the (smaller) format records
+    auto position = mWritePosition.load(std::memory_order_relaxed);
+    do {
+        if (position + recordSize > limit) {
+            auto* header = reinterpret_cast<BinaryLogFileHeader*>(mFile->getData().data());  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            std::atomic_ref<uint64_t>(header->droppedRecords).fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+    } while (!mWritePosition.compare_exchange_weak(position, position + recordSize, std::memory_order_relaxed));
+
+    auto* record = mFile->getData().data() + position;
+
+    // the size stays zero until endRecord(), everything else of the header can be written right away
+    BinaryLogRecordHeader recordHeader{};
+    recordHeader.size = 0;
+    recordHeader.type = type;
+    recordHeader.argumentCount = argumentCount;
+    recordHeader.formatId = formatId;
+    recordHeader.reserved = 0;
+    recordHeader.timestamp = static_cast<uint64_t>(timestamp.count());
+    std::memcpy(record, &recordHeader, sizeof(recordHeader));
+
+    return record;
+}
+
+auto BinaryLogWriter::endRecord(std::byte* record, const std::size_t payloadSize) noexcept -> void {
+    auto* recordHeader = reinterpret_cast<BinaryLogRecordHeader*>(record);  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    std::atomic_ref<uint32_t>(recordHeader->size).store(static_cast<uint32_t>(alignRecordSize(sizeof(BinaryLogRecordHeader) + payloadSize)), std::memory_order_release);
+}
+
+auto BinaryLogWriter::encodeArgument(std::byte* output, const BinaryLogArgument& argument) noexcept -> std::byte* {
+    std::memcpy(output, &argument.type, sizeof(argument.type));
+    output += sizeof(argument.type);
+
+    if (BinaryLogArgumentType::String == argument.type) {
+        const auto text = argument.getText();
+        const auto length = static_cast<uint32_t>(text.size());
+        std::memcpy(output, &length, sizeof(length));
+        output += sizeof(length);
+        std::memcpy(output, text.data(), text.size());
+        return output + text.size();
+    }
+
+    std::memcpy(output, &argument.value, sizeof(argument.value));
+    return output + sizeof(argument.value);
+}
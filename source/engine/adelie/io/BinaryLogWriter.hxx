@@ -0,0 +1,134 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#if !defined(__ADELIE_IO_BINARYLOGWRITER_HXX__)
+    #define __ADELIE_IO_BINARYLOGWRITER_HXX__
+
+    #include <adelie/adelie.hxx>
+    #include <adelie/io/BinaryLogFormat.hxx>
+    #include <adelie/io/MemoryMappedFile.hxx>
+    #include <array>
+    #include <atomic>
+    #include <bit>
+    #include <chrono>
+    #include <cstdint>
+    #include <cstring>
+    #include <format>
+    #include <memory>
+    #include <string>
+    #include <string_view>
+    #include <type_traits>
+
+namespace adelie::io {
+
+    // default size of a binary log file, the file is sparse so only the part which is written uses disk space
+    constexpr uint64_t BINARY_LOG_DEFAULT_CAPACITY = 256ULL * 1024ULL * 1024ULL;
+
+    // the end of the file is kept free for format records, so statements which are logged for the first time after the
+    // messages filled the file can still be decoded
+    constexpr uint64_t BINARY_LOG_FORMAT_RESERVE = 1024ULL * 1024ULL;
+
+    // an argument converted into the form in which it is stored in the file
+    struct BinaryLogArgument {
+            BinaryLogArgumentType type;
+            uint64_t value;         // bit pattern of every type but strings
+            std::string_view text;  // strings which outlive the logging call
+            std::string storage;    // the formatted text of every type the file does not know
+
+            [[nodiscard]] auto getText() const noexcept -> std::string_view { return storage.empty() ? text : std::string_view(storage); }
+
+            [[nodiscard]] auto getEncodedSize() const noexcept -> std::size_t { return 1 + (BinaryLogArgumentType::String == type ? sizeof(uint32_t) + getText().size() : sizeof(uint64_t)); }
+    }; /* struct BinaryLogArgument */
+
+    template <typename T>
+    auto makeBinaryLogArgument(const T& value) -> BinaryLogArgument {
+        using Type = std::remove_cvref_t<T>;
+        if constexpr (std::is_same_v<Type, bool>) {
+            return {BinaryLogArgumentType::Bool, value ? 1U : 0U, {}, {}};
+        } else if constexpr (std::is_same_v<Type, char>) {
+            return {BinaryLogArgumentType::Char, static_cast<uint64_t>(static_cast<unsigned char>(value)), {}, {}};
+        } else if constexpr (std::is_integral_v<Type> && std::is_signed_v<Type>) {
+            return {BinaryLogArgumentType::Signed, static_cast<uint64_t>(static_cast<int64_t>(value)), {}, {}};
+        } else if constexpr (std::is_integral_v<Type>) {
+            return {BinaryLogArgumentType::Unsigned, static_cast<uint64_t>(value), {}, {}};
+        } else if constexpr (std::is_same_v<Type, float>) {
+            return {BinaryLogArgumentType::Float, std::bit_cast<uint64_t>(static_cast<double>(value)), {}, {}};
+        } else if constexpr (std::is_same_v<Type, double>) {
+            return {BinaryLogArgumentType::Double, std::bit_cast<uint64_t>(value), {}, {}};
+        } else if constexpr (std::is_convertible_v<const Type&, std::string_view>) {
+            return {BinaryLogArgumentType::String, 0, std::string_view(value), {}};
+        } else if constexpr (std::is_pointer_v<Type> || std::is_null_pointer_v<Type>) {
+            return {BinaryLogArgumentType::Pointer, static_cast<uint64_t>(reinterpret_cast<std::uintptr_t>(static_cast<const void*>(value))), {}, {}};  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        } else {
+            // enums, vectors, ... are formatted right away by their formatter, only the work of the other types is deferred
+            return {BinaryLogArgumentType::String, 0, {}, std::format("{}", value)};
+        }
+    }
+
+    // writes log records into a memory-mapped file. Any number of threads can write at the same time: a record is
+    // claimed by moving the write position and its size is stored last, so a reader (or the decoder after a crash)
+    // stops at the first record which is incomplete. Once the file is full further messages are dropped and counted
+    class ADELIE_API BinaryLogWriter {
+        public:
+            BinaryLogWriter(const std::string& filename, uint64_t capacity);
+
+            ~BinaryLogWriter() noexcept;
+
+            BinaryLogWriter(const BinaryLogWriter&) = delete;
+
+            auto operator=(BinaryLogWriter const&) -> BinaryLogWriter& = delete;
+
+            BinaryLogWriter(BinaryLogWriter&&) = delete;
+
+            auto operator=(BinaryLogWriter&&) -> BinaryLogWriter& = delete;
+
+            // writes the format record of a logging statement and returns the id its messages refer to
+            auto registerFormat(unsigned char level, unsigned char category, std::string_view fileName, uint32_t line, std::string_view format) noexcept -> uint32_t;
+
+            template <typename... Args>
+            auto write(const uint32_t formatId, const Args&... args) noexcept -> void {
+                try {
+                    const std::array<BinaryLogArgument, sizeof...(Args)> arguments{makeBinaryLogArgument(args)...};
+
+                    std::size_t payloadSize = 0;
+                    for (const auto& argument : arguments) {
+                        payloadSize += argument.getEncodedSize();
+                    }
+
+                    auto* record = beginRecord(BinaryLogRecordType::Message, formatId, static_cast<uint16_t>(sizeof...(Args)), payloadSize, false);
+                    if (nullptr == record) {
+                        return;
+                    }
+
+                    auto* output = record + sizeof(BinaryLogRecordHeader);
+                    for (const auto& argument : arguments) {
+                        output = encodeArgument(output, argument);
+                    }
+                    endRecord(record, payloadSize);
+                } catch (...) {
+                    // nothing to do here, we stay silent; formatting an unknown type failed
+                }
+            }
+
+            [[nodiscard]] auto getDroppedRecords() const noexcept -> uint64_t;
+
+            [[nodiscard]] auto getFilename() const -> const std::string& { return mFile->getFilename(); }
+
+        private:
+            // claims and prepares a record, nullptr if it does not fit into the file anymore
+            auto beginRecord(BinaryLogRecordType type, uint32_t formatId, uint16_t argumentCount, std::size_t payloadSize, bool isFormat) noexcept -> std::byte*;
+
+            // publishes the size of the record, which makes it visible to readers
+            static auto endRecord(std::byte* record, std::size_t payloadSize) noexcept -> void;
+
+            static auto encodeArgument(std::byte* output, const BinaryLogArgument& argument) noexcept -> std::byte*;
+
+            std::unique_ptr<MemoryMappedOutputFile> mFile;
+            std::chrono::time_point<std::chrono::steady_clock> mStartTime;
+            alignas(64) std::atomic<uint64_t> mWritePosition;
+            std::atomic<uint32_t> mNextFormatId;
+
+    }; /* class BinaryLogWriter */
+
+} /* namespace adelie::io */
+
+#endif /* if !defined(__ADELIE_IO_BINARYLOGWRITER_HXX__) */
@@ -0,0 +1,16 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#include <adelie/io/Blob.hxx>
+
+using adelie::io::Blob;
+
+Blob::Blob(std::vector<std::byte> bytes) {
+    mBytes = std::move(bytes);
+    mData = mBytes;
+    mOwner = nullptr;
+}
+
+Blob::Blob(const std::span<const std::byte> view, std::shared_ptr<const void> owner) {
+    mData = view;
+    mOwner = std::move(owner);
+}
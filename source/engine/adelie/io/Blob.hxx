@@ -0,0 +1,48 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#if !defined(__ADELIE_IO_BLOB_HXX__)
+    #define __ADELIE_IO_BLOB_HXX__
+
+    #include <adelie/adelie.hxx>
+    #include <cstddef>
+    #include <memory>
+    #include <span>
+    #include <vector>
+
+namespace adelie::io {
+
+    // an immutable chunk of file data. A blob either owns its bytes or borrows them from an owner which it keeps
+    // alive (e.g. an uncompressed entry inside a memory-mapped asset pack)
+    class ADELIE_API Blob {
+        public:
+            explicit Blob(std::vector<std::byte> bytes);
+
+            Blob(std::span<const std::byte> view, std::shared_ptr<const void> owner);
+
+            ~Blob() noexcept = default;
+
+            Blob(const Blob&) = delete;
+
+            auto operator=(Blob const&) -> Blob& = delete;
+
+            Blob(Blob&&) = delete;
+
+            auto operator=(Blob&&) -> Blob& = delete;
+
+            [[nodiscard]] auto getData() const -> std::span<const std::byte> { return mData; }
+
+            [[nodiscard]] auto getSize() const -> std::size_t { return mData.size(); }
+
+            // only owning blobs occupy memory of their own, borrowed ones are not worth caching
+            [[nodiscard]] auto isOwning() const -> bool { return nullptr == mOwner; }
+
+        private:
+            std::vector<std::byte> mBytes;
+            std::span<const std::byte> mData;
+            std::shared_ptr<const void> mOwner;
+
+    }; /* class Blob */
+
+} /* namespace adelie::io */
+
+#endif /* if !defined(__ADELIE_IO_BLOB_HXX__) */
@@ -0,0 +1,103 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#include <adelie/io/BlobCache.hxx>
+
+using adelie::io::Blob;
+using adelie::io::BlobCache;
+
+BlobCache::BlobCache(const std::size_t budget) {
+    mBudget = budget;
+    mSize = 0;
+    mHitCount = 0;
+    mMissCount = 0;
+}
+
+auto BlobCache::find(const uint64_t pathHash, const std::string_view path) -> std::shared_ptr<const Blob> {
+    std::scoped_lock lock(mMutex);
+
+    const auto iterator = mLookup.find(pathHash);
+    if (iterator == mLookup.end() || iterator->second->path != path) {
+        mMissCount++;
+        return nullptr;
+    }
+
+    mHitCount++;
+    mEntries.splice(mEntries.begin(), mEntries, iterator->second);
+    return iterator->second->blob;
+}
+
+auto BlobCache::insert(const uint64_t pathHash, const std::string_view path, std::shared_ptr<const Blob> blob) -> void {
+    const auto size = blob->getSize();
+
+    std::scoped_lock lock(mMutex);
+    if (size > mBudget) {
+        return;
+    }
+
+    // a second reader may have missed at the same time, the newer blob replaces the older one
+    if (const auto iterator = mLookup.find(pathHash); iterator != mLookup.end()) {
+        mSize -= iterator->second->blob->getSize();
+        mEntries.erase(iterator->second);
+        mLookup.erase(iterator);
+    }
+
+    evict(mBudget - size);
+
+    mEntries.push_front(Entry{.pathHash = pathHash, .path = std::string(path), .blob = std::move(blob)});
+    mLookup[pathHash] = mEntries.begin();
+    mSize += size;
+}
+
+auto BlobCache::erase(const uint64_t pathHash) -> void {
+    std::scoped_lock lock(mMutex);
+
+    if (const auto iterator = mLookup.find(pathHash); iterator != mLookup.end()) {
+        mSize -= iterator->second->blob->getSize();
+        mEntries.erase(iterator->second);
+        mLookup.erase(iterator);
+    }
+}
+
+auto BlobCache::clear() -> void {
+    std::scoped_lock lock(mMutex);
+
+    mEntries.clear();
+    mLookup.clear();
+    mSize = 0;
+}
+
+auto BlobCache::setBudget(const std::size_t budget) -> void {
+    std::scoped_lock lock(mMutex);
+
+    mBudget = budget;
+    evict(budget);
+}
+
+auto BlobCache::getBudget() -> std::size_t {
+    std::scoped_lock lock(mMutex);
+    return mBudget;
+}
+
+auto BlobCache::getSize() -> std::size_t {
+    std::scoped_lock lock(mMutex);
+    return mSize;
+}
+
+auto BlobCache::getHitCount() -> uint64_t {
+    std::scoped_lock lock(mMutex);
+    return mHitCount;
+}
+
+auto BlobCache::getMissCount() -> uint64_t {
+    std::scoped_lock lock(mMutex);
+    return mMissCount;
+}
+
+auto BlobCache::evict(const std::size_t budget) -> void {
+    while (mSize > budget && !mEntries.empty()) {
+        const auto& entry = mEntries.back();
+        mSize -= entry.blob->getSize();
+        mLookup.erase(entry.pathHash);
+        mEntries.pop_back();
+    }
+}
@@ -0,0 +1,77 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#if !defined(__ADELIE_IO_BLOBCACHE_HXX__)
+    #define __ADELIE_IO_BLOBCACHE_HXX__
+
+    #include <adelie/adelie.hxx>
+    #include <adelie/io/Blob.hxx>
+    #include <cstddef>
+    #include <cstdint>
+    #include <list>
+    #include <memory>
+    #include <mutex>
+    #include <string>
+    #include <string_view>
+    #include <unordered_map>
+
+namespace adelie::io {
+
+    // a thread-safe least-recently-used cache of blobs keyed by their path hash. The size of all cached blobs never
+    // exceeds the budget, the least recently used blobs are evicted first. Blobs which are still referenced outside
+    // of the cache stay alive after their eviction
+    class ADELIE_API BlobCache {
+        public:
+            explicit BlobCache(std::size_t budget);
+
+            ~BlobCache() noexcept = default;
+
+            BlobCache(const BlobCache&) = delete;
+
+            auto operator=(BlobCache const&) -> BlobCache& = delete;
+
+            BlobCache(BlobCache&&) = delete;
+
+            auto operator=(BlobCache&&) -> BlobCache& = delete;
+
+            // returns nullptr on a miss, a hit marks the blob as the most recently used one
+            [[nodiscard]] auto find(uint64_t pathHash, std::string_view path) -> std::shared_ptr<const Blob>;
+
+            // blobs larger than the whole budget are not cached at all
+            auto insert(uint64_t pathHash, std::string_view path, std::shared_ptr<const Blob> blob) -> void;
+
+            auto erase(uint64_t pathHash) -> void;
+
+            auto clear() -> void;
+
+            auto setBudget(std::size_t budget) -> void;
+
+            [[nodiscard]] auto getBudget() -> std::size_t;
+
+            [[nodiscard]] auto getSize() -> std::size_t;
+
+            [[nodiscard]] auto getHitCount() -> uint64_t;
+
+            [[nodiscard]] auto getMissCount() -> uint64_t;
+
+        private:
+            struct Entry {
+                    uint64_t pathHash;
+                    std::string path;
+                    std::shared_ptr<const Blob> blob;
+            };
+
+            auto evict(std::size_t budget) -> void;
+
+            std::mutex mMutex;
+            std::list<Entry> mEntries;  // most recently used first
+            std::unordered_map<uint64_t, std::list<Entry>::iterator> mLookup;
+            std::size_t mBudget;
+            std::size_t mSize;
+            uint64_t mHitCount;
+            uint64_t mMissCount;
+
+    }; /* class BlobCache */
+
+} /* namespace adelie::io */
+
+#endif /* if !defined(__ADELIE_IO_BLOBCACHE_HXX__) */
@@ -0,0 +1,47 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#include <adelie/exception/IOException.hxx>
+#include <adelie/io/DirectoryMount.hxx>
+#include <fstream>
+
+using adelie::exception::IOException;
+using adelie::io::Blob;
+using adelie::io::DirectoryMount;
+
+DirectoryMount::DirectoryMount(const std::filesystem::path& root) {
+    mRoot = root;
+}
+
+auto DirectoryMount::exists(const std::string_view path) const -> bool {
+    std::error_code error;
+    return std::filesystem::is_regular_file(mRoot / path, error);
+}
+
+auto DirectoryMount::read(const std::string_view path) const -> std::shared_ptr<const Blob> {
+    const auto fullPath = mRoot / path;
+
+    // a directory or a device is treated like a missing file, as in exists()
+    std::error_code error;
+    if (!std::filesystem::is_regular_file(fullPath, error)) {
+        return nullptr;
+    }
+
+    std::ifstream file(fullPath, std::ios::ate | std::ios::binary);
+    if (!file.is_open()) {
+        return nullptr;
+    }
+
+    const auto end = file.tellg();
+    if (!file.good() || end < 0) {
+        throw IOException("Failed to determine the size of file: " + fullPath.string());
+    }
+    const auto size = static_cast<std::size_t>(end);
+    std::vector<std::byte> bytes(size);
+
+    file.seekg(0);
+    if (!file.read(reinterpret_cast<char*>(bytes.data()), static_cast<std::streamsize>(size))) {
+        throw IOException("Failed to read file: " + fullPath.string());
+    }
+
+    return std::make_shared<const Blob>(std::move(bytes));
+}
@@ -0,0 +1,40 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#if !defined(__ADELIE_IO_DIRECTORYMOUNT_HXX__)
+    #define __ADELIE_IO_DIRECTORYMOUNT_HXX__
+
+    #include <adelie/adelie.hxx>
+    #include <adelie/io/MountInterface.hxx>
+    #include <filesystem>
+
+namespace adelie::io {
+
+    // exposes the loose files below a directory of the host file system
+    class ADELIE_API DirectoryMount : public MountInterface {
+        public:
+            explicit DirectoryMount(const std::filesystem::path& root);
+
+            ~DirectoryMount() override = default;
+
+            DirectoryMount(const DirectoryMount&) = delete;
+
+            auto operator=(DirectoryMount const&) -> DirectoryMount& = delete;
+
+            DirectoryMount(DirectoryMount&&) = delete;
+
+            auto operator=(DirectoryMount&&) -> DirectoryMount& = delete;
+
+            [[nodiscard]] auto exists(std::string_view path) const -> bool override;
+
+            [[nodiscard]] auto read(std::string_view path) const -> std::shared_ptr<const Blob> override;
+
+            [[nodiscard]] auto getName() const -> std::string override { return mRoot.string(); }
+
+        private:
+            std::filesystem::path mRoot;
+
+    }; /* class DirectoryMount */
+
+} /* namespace adelie::io */
+
+#endif /* if !defined(__ADELIE_IO_DIRECTORYMOUNT_HXX__) */
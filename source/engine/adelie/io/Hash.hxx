@@ -0,0 +1,40 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#if !defined(__ADELIE_IO_HASH_HXX__)
+    #define __ADELIE_IO_HASH_HXX__
+
+    #include <adelie/adelie.hxx>
+    #include <cstddef>
+    #include <cstdint>
+    #include <span>
+    #include <string_view>
+
+namespace adelie::io {
+
+    static inline constexpr uint64_t FNV1A_OFFSET_BASIS = 0xCBF29CE484222325ULL;
+    static inline constexpr uint64_t FNV1A_PRIME = 0x00000100000001B3ULL;
+
+    // 64-bit FNV-1a, cheap and good enough to identify asset paths and to detect corrupted asset data
+    constexpr auto hashBytes(const std::span<const std::byte> data) -> uint64_t {
+        uint64_t hash = FNV1A_OFFSET_BASIS;
+        for (const auto byte : data) {
+            hash ^= static_cast<uint64_t>(byte);
+            hash *= FNV1A_PRIME;
+        }
+        return hash;
+    }
+
+    // asset paths are hashed case-sensitive with forward slashes, backslashes are treated as forward slashes so
+    // paths written on Windows resolve to the same entry
+    constexpr auto hashPath(const std::string_view path) -> uint64_t {
+        uint64_t hash = FNV1A_OFFSET_BASIS;
+        for (const auto character : path) {
+            hash ^= static_cast<uint64_t>(static_cast<unsigned char>(character == '\\' ? '/' : character));
+            hash *= FNV1A_PRIME;
+        }
+        return hash;
+    }
+
+} /* namespace adelie::io */
+
+#endif /* if !defined(__ADELIE_IO_HASH_HXX__) */
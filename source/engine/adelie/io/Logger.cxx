@@ -2,6 +2,7 @@
 
 #include <adelie/io/Logger.hxx>
 #include <iostream>
+#include <cstdio>
 #include <sstream>
 
 using adelie::io::Logger;
@@ -10,9 +11,33 @@ Logger::Logger() {
     mStartTime = std::chrono::steady_clock::now();
     mColorEnabled = false;
     mLogfileStream.open("adelie.log");
+    setLevel(LoggingLevel::LevelTrace);
+
+    mRecords = std::make_unique<Record[]>(LOGGING_QUEUE_CAPACITY);  // NOLINT(cppcoreguidelines-avoid-c-arrays)
+    for (uint64_t i = 0; i < LOGGING_QUEUE_CAPACITY; i++) {
+        mRecords[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    mEnqueuePosition = 0;
+    mDequeuePosition = 0;
+    mWrittenPosition = 0;
+    mWriterWaiting = false;
+    mWakeup = 0;
+    mRunning = true;
+    mBinaryOutputEnabled = false;
+
+    mWriterThread = std::thread(&Logger::writerLoop, this);
 }
 
 Logger::~Logger() {
+    mRunning.store(false);
+    mWakeup.fetch_add(1);
+    mWakeup.notify_one();
+    mWriterThread.join();
+
+    // the writer may have been terminated with the process already (e.g. on Windows), write what is left ourselves
+    while (writeBatch() > 0) {
+    }
+
     mLogfileStream.flush();
     mLogfileStream.close();
 }
@@ -22,20 +47,134 @@ auto Logger::getInstance() -> Logger* {
     return &staticInstance;
 }
 
-auto Logger::printWithPrefix(const LoggingLevel& level, const std::string_view& message) noexcept -> void {
-    std::array<char, MAX_LOGGING_TIME_LINE_SIZE> timeMessageBuffer{};
-    auto currentTime = std::chrono::steady_clock::now();
-    std::chrono::duration<float> elapsedSeconds = currentTime - mStartTime;
+auto Logger::getThreadBuffer() noexcept -> std::string& {
+    thread_local std::string tBuffer;
+    return tBuffer;
+}
+
+auto Logger::enqueue(const RecordType type, const LoggingLevel level, const std::string_view text) noexcept -> void {
+    const std::chrono::duration<float> elapsedSeconds = std::chrono::steady_clock::now() - mStartTime;
 
-    snprintf(timeMessageBuffer.data(), MAX_LOGGING_TIME_LINE_SIZE, "%10.4f", elapsedSeconds.count());
+    // claim a slot, if the writer fell a whole ring behind we wait for it instead of dropping the message
+    Record* record = nullptr;
+    auto position = mEnqueuePosition.load(std::memory_order_relaxed);
+    while (true) {
+        record = &mRecords[position & (LOGGING_QUEUE_CAPACITY - 1)];
+        const auto sequence = record->sequence.load(std::memory_order_acquire);
+        const auto difference = static_cast<int64_t>(sequence) - static_cast<int64_t>(position);
+        if (0 == difference) {
+            if (mEnqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (difference < 0) {
+            std::this_thread::yield();
+            position = mEnqueuePosition.load(std::memory_order_relaxed);
+        } else {
+            position = mEnqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
 
-    std::stringstream loggingMessage;
-    loggingMessage << getLoggingString(timeMessageBuffer, level, message);
+    record->type = type;
+    record->level = level;
+    record->timestamp = elapsedSeconds.count();
+    try {
+        record->text.assign(text);  // reuses the capacity of the slot once the ring went around
+    } catch (...) {
+        record->text.clear();
+    }
+    record->sequence.store(position + 1, std::memory_order_seq_cst);
 
-    if (mLogfileStream.is_open()) {
-        mLogfileStream << loggingMessage.str() << std::endl;
+    // only wake the writer if it went to sleep, a busy writer picks the record up on its own
+    if (mWriterWaiting.load(std::memory_order_seq_cst)) {
+        mWakeup.fetch_add(1);
+        mWakeup.notify_one();
     }
-    std::cout << getColorControlSequence(level) << loggingMessage.str() << getColorResetControlSequence() << std::endl;
+}
+
+auto Logger::flush() noexcept -> void {
+    const auto target = mEnqueuePosition.load();
+    auto written = mWrittenPosition.load();
+    while (written < target) {
+        mWakeup.fetch_add(1);
+        mWakeup.notify_one();
+        mWrittenPosition.wait(written);
+        written = mWrittenPosition.load();
+    }
+}
+
+auto Logger::isQueueEmpty() const noexcept -> bool {
+    const auto& record = mRecords[mDequeuePosition & (LOGGING_QUEUE_CAPACITY - 1)];
+    return record.sequence.load(std::memory_order_seq_cst) != mDequeuePosition + 1;
+}
+
+auto Logger::writerLoop() noexcept -> void {
+    while (true) {
+        if (writeBatch() > 0) {
+            continue;
+        }
+        if (!mRunning.load()) {
+            break;
+        }
+
+        const auto ticket = mWakeup.load();
+        mWriterWaiting.store(true, std::memory_order_seq_cst);
+        if (isQueueEmpty() && mRunning.load()) {
+            mWakeup.wait(ticket);
+        }
+        mWriterWaiting.store(false);
+    }
+}
+
+auto Logger::writeBatch() noexcept -> uint64_t {
+    uint64_t count = 0;
+    try {
+        std::string fileOutput;
+        std::string consoleOutput;
+
+        while (count < LOGGING_BATCH_SIZE && !isQueueEmpty()) {
+            auto& record = mRecords[mDequeuePosition & (LOGGING_QUEUE_CAPACITY - 1)];
+
+            if (RecordType::ChangeOutputFile == record.type) {
+                // everything logged before the switch still goes into the old file
+                if (mLogfileStream.is_open()) {
+                    mLogfileStream.write(fileOutput.data(), static_cast<std::streamsize>(fileOutput.size()));
+                    mLogfileStream.flush();
+                    mLogfileStream.close();
+                }
+                fileOutput.clear();
+                mLogfileStream.open(record.text);  // NOLINT(fuchsia-default-arguments-calls)
+            } else {
+                std::array<char, MAX_LOGGING_TIME_LINE_SIZE> timeMessageBuffer{};
+                snprintf(timeMessageBuffer.data(), MAX_LOGGING_TIME_LINE_SIZE, "%10.4f", record.timestamp);
+
+                const auto line = getLoggingString(timeMessageBuffer, record.level, record.text);
+                fileOutput.append(line).push_back('\n');
+                consoleOutput.append(getColorControlSequence(record.level)).append(line).append(getColorResetControlSequence()).push_back('\n');
+            }
+
+            record.sequence.store(mDequeuePosition + LOGGING_QUEUE_CAPACITY, std::memory_order_release);
+            mDequeuePosition++;
+            count++;
+        }
+
+        if (count > 0) {
+            // one write and one flush per batch instead of two flushes per line
+            if (mLogfileStream.is_open() && !fileOutput.empty()) {
+                mLogfileStream.write(fileOutput.data(), static_cast<std::streamsize>(fileOutput.size()));
+                mLogfileStream.flush();
+            }
+            std::cout.write(consoleOutput.data(), static_cast<std::streamsize>(consoleOutput.size()));
+            std::cout.flush();
+        }
+    } catch (...) {
+        // nothing to do here, we stay silent; the records of this batch are lost
+    }
+
+    if (count > 0) {
+        mWrittenPosition.store(mDequeuePosition);
+        mWrittenPosition.notify_all();
+    }
+    return count;
 }
 
 auto Logger::getLoggingString(const std::array<char, MAX_LOGGING_TIME_LINE_SIZE>& timeAsString, const LoggingLevel& level, const std::string_view& message) noexcept -> std::string {
@@ -45,36 +184,33 @@ auto Logger::getLoggingString(const std::array<char, MAX_LOGGING_TIME_LINE_SIZE>
     messageString.append(timeAsString.data());
     messageString.append("]");
     messageString.append("[");
+    messageString.append(getLevelName(level));
+    messageString.append("] ");
+    messageString.append(message);
+
+    return messageString;
+}
 
+auto Logger::getLevelName(const LoggingLevel level) noexcept -> std::string_view {
     switch (level) {
         case LoggingLevel::LevelTrace:
-            messageString.append("TRACE");
-            break;
+            return "TRACE";
         case LoggingLevel::LevelDebug:
-            messageString.append("DEBUG");
-            break;
+            return "DEBUG";
         case LoggingLevel::LevelInformation:
-            messageString.append("INFO ");
-            break;
+            return "INFO ";
         case LoggingLevel::LevelWarning:
-            messageString.append("WARN ");
-            break;
+            return "WARN ";
         case LoggingLevel::LevelError:
-            messageString.append("ERROR");
-            break;
+            return "ERROR";
         case LoggingLevel::LevelFatal:
-            messageString.append("FATAL");
-            break;
+            return "FATAL";
     }
-
-    messageString.append("] ");
-    messageString.append(message.data());
-
-    return messageString;
+    return "?????";
 }
 
 auto Logger::getColorControlSequence(const LoggingLevel& level) const noexcept -> std::string {
-    if (!mColorEnabled) {
+    if (!mColorEnabled.load(std::memory_order_relaxed)) {
         return "";  // NOLINT(fuchsia-default-arguments-calls)
     }
 
@@ -105,7 +241,7 @@ auto Logger::getColorControlSequence(const LoggingLevel& level) const noexcept -
 }
 
 auto Logger::getColorResetControlSequence() const noexcept -> std::string {
-    if (!mColorEnabled) {
+    if (!mColorEnabled.load(std::memory_order_relaxed)) {
         return "";  // NOLINT(fuchsia-default-arguments-calls)
     }
 
@@ -113,18 +249,36 @@ auto Logger::getColorResetControlSequence() const noexcept -> std::string {
 }
 
 [[maybe_unused]] void Logger::enableColor() noexcept {
-    mColorEnabled = true;
+    mColorEnabled.store(true, std::memory_order_relaxed);
 }
 
 [[maybe_unused]] void Logger::disableColor() noexcept {
-    mColorEnabled = false;
+    mColorEnabled.store(false, std::memory_order_relaxed);
+}
+
+auto Logger::setLevel(const LoggingLevel level) noexcept -> void {
+    for (auto& categoryLevel : mCategoryLevels) {
+        categoryLevel.store(level, std::memory_order_relaxed);
+    }
+}
+
+auto Logger::setLevel(const LogCategory category, const LoggingLevel level) noexcept -> void {
+    mCategoryLevels[static_cast<std::size_t>(category)].store(level, std::memory_order_relaxed);
 }
 
-// TODO: raise-condition, it could happen that a thread tries to write while the file is closed
 [[maybe_unused]] void Logger::changeOutputFile(const char* filename) noexcept {
-    if (mLogfileStream.is_open()) {
-        mLogfileStream.flush();
-        mLogfileStream.close();
+    // the file is only touched by the writer thread, the switch is queued in order with the messages
+    enqueue(RecordType::ChangeOutputFile, LoggingLevel::LevelInformation, filename);
+}
+
+auto Logger::enableBinaryOutput(const std::string& filename, const uint64_t capacity) -> void {
+    const std::lock_guard lock(mBinaryOutputMutex);
+    if (mBinaryOutputEnabled.load()) {
+        return;
     }
-    mLogfileStream.open(filename);  // NOLINT(fuchsia-default-arguments-calls)
+
+    // the text written so far is complete before the binary file takes over
+    flush();
+    mBinaryLog = std::make_unique<BinaryLogWriter>(filename, capacity);
+    mBinaryOutputEnabled.store(true, std::memory_order_release);
 }
\ No newline at end of file
@@ -4,26 +4,107 @@
     #define __ADELIE_IO_LOGGER_HXX__
 
     #include <adelie/adelie.hxx>
+    #include <adelie/io/BinaryLogWriter.hxx>
     #include <array>
+    #include <atomic>
     #include <chrono>
+    #include <cstdint>
     #include <format>
     #include <fstream>
+    #include <iterator>
+    #include <memory>
+    #include <mutex>
+    #include <source_location>
+    #include <string>
     #include <string_view>
-
-    #define AdelieLogTrace(...) adelie::io::Logger::getInstance()->trace(__VA_ARGS__)
-    #define AdelieLogDebug(...) adelie::io::Logger::getInstance()->debug(__VA_ARGS__)
-    #define AdelieLogInformation(...) adelie::io::Logger::getInstance()->info(__VA_ARGS__)
-    #define AdelieLogWarning(...) adelie::io::Logger::getInstance()->warn(__VA_ARGS__)
-    #define AdelieLogError(...) adelie::io::Logger::getInstance()->error(__VA_ARGS__)
-    #define AdelieLogFatal(...) adelie::io::Logger::getInstance()->fatal(__VA_ARGS__)
+    #include <thread>
+
+    // numeric logging levels for the preprocessor, they match the values of adelie::io::LoggingLevel
+    #define ADELIE_LOG_LEVEL_TRACE 0
+    #define ADELIE_LOG_LEVEL_DEBUG 1
+    #define ADELIE_LOG_LEVEL_INFORMATION 2
+    #define ADELIE_LOG_LEVEL_WARNING 3
+    #define ADELIE_LOG_LEVEL_ERROR 4
+    #define ADELIE_LOG_LEVEL_FATAL 5
+
+    // every logging call below this level expands to nothing, neither the logger is touched nor are the arguments
+    // evaluated. Can be set by the build (-DADELIE_LOG_MIN_LEVEL=...), fatal messages are always compiled in
+    #if !defined(ADELIE_LOG_MIN_LEVEL)
+        #if defined(ADELIE_BUILD_TYPE_DEBUG)
+            #define ADELIE_LOG_MIN_LEVEL ADELIE_LOG_LEVEL_TRACE
+        #else
+            #define ADELIE_LOG_MIN_LEVEL ADELIE_LOG_LEVEL_INFORMATION
+        #endif
+    #endif
+
+    // the runtime filter is checked before anything is formatted. In binary mode the lambda gives every logging
+    // statement its own instantiation of logBinary(), which registers the format string of the statement once
+    #define ADELIE_LOG_IF_ENABLED(level, method, category, ...)                                                             \
+        do {                                                                                                                \
+            if (auto* adelieLogger = adelie::io::Logger::getInstance(); adelieLogger->isEnabled(level, category)) {         \
+                if (adelieLogger->isBinaryOutputEnabled()) {                                                                \
+                    adelieLogger->logBinary([] {}, level, category, std::source_location::current(), __VA_ARGS__);          \
+                } else {                                                                                                    \
+                    adelieLogger->method(__VA_ARGS__);                                                                      \
+                }                                                                                                           \
+            }                                                                                                               \
+        } while (false)
+
+    #if ADELIE_LOG_MIN_LEVEL <= ADELIE_LOG_LEVEL_TRACE
+        #define AdelieLogCategoryTrace(category, ...) ADELIE_LOG_IF_ENABLED(adelie::io::LoggingLevel::LevelTrace, trace, category, __VA_ARGS__)
+    #else
+        #define AdelieLogCategoryTrace(category, ...) static_cast<void>(0)
+    #endif
+
+    #if ADELIE_LOG_MIN_LEVEL <= ADELIE_LOG_LEVEL_DEBUG
+        #define AdelieLogCategoryDebug(category, ...) ADELIE_LOG_IF_ENABLED(adelie::io::LoggingLevel::LevelDebug, debug, category, __VA_ARGS__)
+    #else
+        #define AdelieLogCategoryDebug(category, ...) static_cast<void>(0)
+    #endif
+
+    #if ADELIE_LOG_MIN_LEVEL <= ADELIE_LOG_LEVEL_INFORMATION
+        #define AdelieLogCategoryInformation(category, ...) ADELIE_LOG_IF_ENABLED(adelie::io::LoggingLevel::LevelInformation, info, category, __VA_ARGS__)
+    #else
+        #define AdelieLogCategoryInformation(category, ...) static_cast<void>(0)
+    #endif
+
+    #if ADELIE_LOG_MIN_LEVEL <= ADELIE_LOG_LEVEL_WARNING
+        #define AdelieLogCategoryWarning(category, ...) ADELIE_LOG_IF_ENABLED(adelie::io::LoggingLevel::LevelWarning, warn, category, __VA_ARGS__)
+    #else
+        #define AdelieLogCategoryWarning(category, ...) static_cast<void>(0)
+    #endif
+
+    #if ADELIE_LOG_MIN_LEVEL <= ADELIE_LOG_LEVEL_ERROR
+        #define AdelieLogCategoryError(category, ...) ADELIE_LOG_IF_ENABLED(adelie::io::LoggingLevel::LevelError, error, category, __VA_ARGS__)
+    #else
+        #define AdelieLogCategoryError(category, ...) static_cast<void>(0)
+    #endif
+
+    #define AdelieLogCategoryFatal(category, ...) ADELIE_LOG_IF_ENABLED(adelie::io::LoggingLevel::LevelFatal, fatal, category, __VA_ARGS__)
+
+    #define AdelieLogTrace(...) AdelieLogCategoryTrace(adelie::io::LogCategory::General, __VA_ARGS__)
+    #define AdelieLogDebug(...) AdelieLogCategoryDebug(adelie::io::LogCategory::General, __VA_ARGS__)
+    #define AdelieLogInformation(...) AdelieLogCategoryInformation(adelie::io::LogCategory::General, __VA_ARGS__)
+    #define AdelieLogWarning(...) AdelieLogCategoryWarning(adelie::io::LogCategory::General, __VA_ARGS__)
+    #define AdelieLogError(...) AdelieLogCategoryError(adelie::io::LogCategory::General, __VA_ARGS__)
+    #define AdelieLogFatal(...) AdelieLogCategoryFatal(adelie::io::LogCategory::General, __VA_ARGS__)
 
 namespace adelie::io {
 
     constexpr auto MAX_LOGGING_LINE_SIZE = 4096;
     constexpr auto MAX_LOGGING_TIME_LINE_SIZE = 32;
 
+    // number of log records which can be queued for the writer thread, has to be a power of two
+    constexpr uint64_t LOGGING_QUEUE_CAPACITY = 4096;
+
+    // the writer thread writes at most this many records before it flushes the file and the console
+    constexpr uint64_t LOGGING_BATCH_SIZE = 256;
+
     enum class LoggingLevel : unsigned char { LevelTrace, LevelDebug, LevelInformation, LevelWarning, LevelError, LevelFatal }; /* enum class LoggingLevel */
 
+    // the subsystem a message belongs to, each category has its own runtime level
+    enum class LogCategory : unsigned char { General, Core, Jobs, IO, Platform, Renderer, Vulkan, Count }; /* enum class LogCategory */
+
     enum class ForegroundColor : unsigned char {
         ForegroundBlack [[maybe_unused]] = 30,
         ForegroundRed = 31,
@@ -79,70 +160,96 @@ namespace adelie::io {
 
             [[maybe_unused]] void disableColor() noexcept;
 
+            // only messages at or above the level are logged, for all categories or for a single one
+            auto setLevel(LoggingLevel level) noexcept -> void;
+
+            auto setLevel(LogCategory category, LoggingLevel level) noexcept -> void;
+
+            [[nodiscard]] auto getLevel(LogCategory category) const noexcept -> LoggingLevel { return mCategoryLevels[static_cast<std::size_t>(category)].load(std::memory_order_relaxed); }
+
+            [[nodiscard]] auto isEnabled(LoggingLevel level, LogCategory category) const noexcept -> bool { return level >= getLevel(category); }
+
+            // from now on the logging statements only write their format id, the timestamp and the raw arguments into
+            // the memory-mapped file instead of formatting the message, adelie_logdecode turns the file into text.
+            // Fatal messages are still written as text as well. The binary output cannot be switched off again, the
+            // file is closed when the logger is destroyed
+            auto enableBinaryOutput(const std::string& filename, uint64_t capacity) -> void;
+
+            [[nodiscard]] auto isBinaryOutputEnabled() const noexcept -> bool { return mBinaryOutputEnabled.load(std::memory_order_acquire); }
+
+            // the first argument is a distinct type for every logging statement, see ADELIE_LOG_IF_ENABLED
+            template <typename CallSite, typename... Args>
+            void logBinary(CallSite /* callSite */, const LoggingLevel level, const LogCategory category, const std::source_location location, std::format_string<Args...> fmt, Args&&... args) noexcept {
+                static const uint32_t formatId = mBinaryLog->registerFormat(static_cast<unsigned char>(level), static_cast<unsigned char>(category), location.file_name(), location.line(), fmt.get());
+                mBinaryLog->write(formatId, args...);
+
+                if (LoggingLevel::LevelFatal == level) {
+                    this->log(level, fmt, std::forward<Args>(args)...);
+                }
+            }
+
+            [[nodiscard]] static auto getLevelName(LoggingLevel level) noexcept -> std::string_view;
+
             template <typename... Args>
             void trace(std::format_string<Args...> fmt, Args&&... args) noexcept {
-                try {
-                    auto formatted = std::format(fmt, std::forward<Args>(args)...);
-                    this->printWithPrefix(LoggingLevel::LevelTrace, formatted);
-                } catch (...) {
-                    // nothing to do here, we stay silent; it is just the logging call that will fail silently
-                }
+                this->log(LoggingLevel::LevelTrace, fmt, std::forward<Args>(args)...);
             }
 
             template <typename... Args>
             void debug(std::format_string<Args...> fmt, Args&&... args) noexcept {
-                try {
-                    auto formatted = std::format(fmt, std::forward<Args>(args)...);
-                    this->printWithPrefix(LoggingLevel::LevelDebug, formatted);
-                } catch (...) {
-                    // nothing to do here, we stay silent; it is just the logging call that will fail silently
-                }
+                this->log(LoggingLevel::LevelDebug, fmt, std::forward<Args>(args)...);
             }
 
             template <typename... Args>
             void info(std::format_string<Args...> fmt, Args&&... args) noexcept {
-                try {
-                    auto formatted = std::format(fmt, std::forward<Args>(args)...);
-                    this->printWithPrefix(LoggingLevel::LevelInformation, formatted);
-                } catch (...) {
-                    // nothing to do here, we stay silent; it is just the logging call that will fail silently
-                }
+                this->log(LoggingLevel::LevelInformation, fmt, std::forward<Args>(args)...);
             }
 
             template <typename... Args>
             void warn(std::format_string<Args...> fmt, Args&&... args) noexcept {
-                try {
-                    auto formatted = std::format(fmt, std::forward<Args>(args)...);
-                    this->printWithPrefix(LoggingLevel::LevelWarning, formatted);
-                } catch (...) {
-                    // nothing to do here, we stay silent; it is just the logging call that will fail silently
-                }
+                this->log(LoggingLevel::LevelWarning, fmt, std::forward<Args>(args)...);
             }
 
             template <typename... Args>
             void error(std::format_string<Args...> fmt, Args&&... args) noexcept {
-                try {
-                    auto formatted = std::format(fmt, std::forward<Args>(args)...);
-                    this->printWithPrefix(LoggingLevel::LevelError, formatted);
-                } catch (...) {
-                    // nothing to do here, we stay silent; it is just the logging call that will fail silently
-                }
+                this->log(LoggingLevel::LevelError, fmt, std::forward<Args>(args)...);
             }
 
             template <typename... Args>
             void fatal(std::format_string<Args...> fmt, Args&&... args) noexcept {
+                this->log(LoggingLevel::LevelFatal, fmt, std::forward<Args>(args)...);
+            }
+
+            // block until every message logged before this call was written and flushed
+            auto flush() noexcept -> void;
+
+        protected:
+            Logger();
+
+            template <typename... Args>
+            void log(const LoggingLevel level, std::format_string<Args...> fmt, Args&&... args) noexcept {
                 try {
-                    auto formatted = std::format(fmt, std::forward<Args>(args)...);
-                    this->printWithPrefix(LoggingLevel::LevelFatal, formatted);
+                    // the message is formatted into a buffer owned by the calling thread, after the first few messages
+                    // its capacity suffices and formatting does not allocate anymore
+                    auto& buffer = getThreadBuffer();
+                    buffer.clear();
+                    std::format_to(std::back_inserter(buffer), fmt, std::forward<Args>(args)...);
+                    this->enqueue(RecordType::Message, level, buffer);
                 } catch (...) {
                     // nothing to do here, we stay silent; it is just the logging call that will fail silently
                 }
+
+                if (LoggingLevel::LevelFatal == level) {
+                    // the process is most likely about to go down, make sure the message survives it
+                    flush();
+                }
             }
 
-        protected:
-            Logger();
+            enum class RecordType : unsigned char { Message, ChangeOutputFile }; /* enum class RecordType */
+
+            static auto getThreadBuffer() noexcept -> std::string&;
 
-            auto printWithPrefix(const LoggingLevel& level, const std::string_view& message) noexcept -> void;
+            auto enqueue(RecordType type, LoggingLevel level, std::string_view text) noexcept -> void;
 
             static auto getLoggingString(const std::array<char, MAX_LOGGING_TIME_LINE_SIZE>& timeAsString, const LoggingLevel& level, const std::string_view& message) noexcept -> std::string;
 
@@ -151,10 +258,38 @@ namespace adelie::io {
             auto getColorResetControlSequence() const noexcept -> std::string;
 
         private:
-            bool mColorEnabled;
-            std::ofstream mLogfileStream;
+            // a slot of the bounded MPSC queue (after Dmitry Vyukov). The sequence tells producers and the writer
+            // whether the slot is free or holds a record for the current lap of the ring
+            struct Record {
+                    std::atomic<uint64_t> sequence;
+                    RecordType type;
+                    LoggingLevel level;
+                    float timestamp;
+                    std::string text;
+            };
+
+            auto writerLoop() noexcept -> void;
+            auto writeBatch() noexcept -> uint64_t;
+            auto isQueueEmpty() const noexcept -> bool;
+
+            std::atomic<bool> mColorEnabled;
+            std::array<std::atomic<LoggingLevel>, static_cast<std::size_t>(LogCategory::Count)> mCategoryLevels;
+            std::ofstream mLogfileStream;  // only touched by the writer thread
             std::chrono::time_point<std::chrono::steady_clock> mStartTime;
 
+            std::unique_ptr<Record[]> mRecords;  // NOLINT(cppcoreguidelines-avoid-c-arrays)
+            alignas(64) std::atomic<uint64_t> mEnqueuePosition;
+            alignas(64) uint64_t mDequeuePosition;  // only touched by the writer thread
+            std::atomic<uint64_t> mWrittenPosition;
+            std::atomic<bool> mWriterWaiting;
+            std::atomic<uint32_t> mWakeup;
+            std::atomic<bool> mRunning;
+            std::thread mWriterThread;
+
+            std::mutex mBinaryOutputMutex;
+            std::unique_ptr<BinaryLogWriter> mBinaryLog;
+            std::atomic<bool> mBinaryOutputEnabled;
+
     }; /* class Logger */
 
 } /* namespace adelie::io */
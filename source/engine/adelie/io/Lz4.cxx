@@ -0,0 +1,181 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#include <adelie/exception/IOException.hxx>
+#include <adelie/io/Lz4.hxx>
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+using adelie::exception::IOException;
+using adelie::io::Lz4;
+
+namespace {
+    constexpr std::size_t MIN_MATCH = 4;
+    constexpr std::size_t LAST_LITERALS = 5;    // the last five bytes of a block are always literals
+    constexpr std::size_t MATCH_FIND_LIMIT = 12;  // a match has to start at least twelve bytes before the end
+    constexpr std::size_t MAX_OFFSET = 65535;
+    constexpr uint32_t RUN_MASK = 15;
+    constexpr uint32_t HASH_BITS = 12;
+    constexpr uint32_t HASH_MULTIPLIER = 2654435761U;
+
+    auto read32(const std::byte* pointer) -> uint32_t {
+        uint32_t value;
+        std::memcpy(&value, pointer, sizeof(value));
+        return value;
+    }
+
+    auto hashSequence(const uint32_t sequence) -> uint32_t {
+        return (sequence * HASH_MULTIPLIER) >> (32U - HASH_BITS);
+    }
+
+    auto writeLength(std::vector<std::byte>& output, std::size_t length) -> void {
+        while (length >= 255) {
+            output.push_back(std::byte{255});
+            length -= 255;
+        }
+        output.push_back(static_cast<std::byte>(length));
+    }
+
+    auto writeSequence(std::vector<std::byte>& output, const std::byte* literals, const std::size_t literalLength, const std::size_t offset, const std::size_t matchLength) -> void {
+        const auto literalToken = static_cast<uint32_t>(std::min<std::size_t>(literalLength, RUN_MASK));
+        const auto matchToken = matchLength > 0 ? static_cast<uint32_t>(std::min<std::size_t>(matchLength - MIN_MATCH, RUN_MASK)) : 0U;
+        output.push_back(static_cast<std::byte>((literalToken << 4U) | matchToken));
+
+        if (literalLength >= RUN_MASK) {
+            writeLength(output, literalLength - RUN_MASK);
+        }
+        output.insert(output.end(), literals, literals + literalLength);
+
+        // the last sequence of a block only consists of literals
+        if (0 == matchLength) {
+            return;
+        }
+
+        output.push_back(static_cast<std::byte>(offset & 0xFFU));
+        output.push_back(static_cast<std::byte>((offset >> 8U) & 0xFFU));
+        if (matchLength - MIN_MATCH >= RUN_MASK) {
+            writeLength(output, matchLength - MIN_MATCH - RUN_MASK);
+        }
+    }
+
+    auto readLength(const std::span<const std::byte> source, std::size_t& position, std::size_t length) -> std::size_t {
+        uint8_t value;
+        do {
+            if (position >= source.size()) {
+                throw IOException("Malformed LZ4 block: truncated length");
+            }
+            value = static_cast<uint8_t>(source[position++]);
+            length += value;
+        } while (255 == value);
+        return length;
+    }
+}  // namespace
+
+auto Lz4::getMaxCompressedSize(const std::size_t size) -> std::size_t {
+    return size + (size / 255) + 16;
+}
+
+auto Lz4::compress(const std::span<const std::byte> source) -> std::vector<std::byte> {
+    std::vector<std::byte> output;
+    output.reserve(getMaxCompressedSize(source.size()));
+
+    const auto* data = source.data();
+    const auto size = source.size();
+    std::size_t anchor = 0;
+
+    if (size > MATCH_FIND_LIMIT) {
+        // positions are stored +1, so zero marks an empty slot
+        std::array<uint32_t, 1U << HASH_BITS> hashTable{};
+        const auto matchStartLimit = size - MATCH_FIND_LIMIT;
+        const auto matchEndLimit = size - LAST_LITERALS;
+
+        std::size_t position = 0;
+        while (position < matchStartLimit) {
+            const auto sequence = read32(data + position);
+            auto& slot = hashTable[hashSequence(sequence)];
+            const auto candidate = static_cast<std::size_t>(slot);
+            slot = static_cast<uint32_t>(position + 1);
+
+            if (0 == candidate || position - (candidate - 1) > MAX_OFFSET || read32(data + candidate - 1) != sequence) {
+                position++;
+                continue;
+            }
+
+            const auto reference = candidate - 1;
+            auto matchLength = MIN_MATCH;
+            while (position + matchLength < matchEndLimit && data[reference + matchLength] == data[position + matchLength]) {
+                matchLength++;
+            }
+
+            writeSequence(output, data + anchor, position - anchor, position - reference, matchLength);
+            position += matchLength;
+            anchor = position;
+        }
+    }
+
+    writeSequence(output, data + anchor, size - anchor, 0, 0);
+    return output;
+}
+
+auto Lz4::decompress(const std::span<const std::byte> source, const std::span<std::byte> destination) -> void {
+    std::size_t input = 0;
+    std::size_t output = 0;
+
+    while (true) {
+        if (input >= source.size()) {
+            throw IOException("Malformed LZ4 block: missing token");
+        }
+        const auto token = static_cast<uint32_t>(source[input++]);
+
+        auto literalLength = static_cast<std::size_t>(token >> 4U);
+        if (RUN_MASK == literalLength) {
+            literalLength = readLength(source, input, literalLength);
+        }
+        if (literalLength > source.size() - input || literalLength > destination.size() - output) {
+            throw IOException("Malformed LZ4 block: literals out of bounds");
+        }
+        if (literalLength > 0) {
+            std::memcpy(destination.data() + output, source.data() + input, literalLength);
+        }
+        input += literalLength;
+        output += literalLength;
+
+        if (input == source.size()) {
+            break;  // the last sequence has no match part
+        }
+
+        if (source.size() - input < 2) {
+            throw IOException("Malformed LZ4 block: truncated offset");
+        }
+        const auto offset = static_cast<std::size_t>(source[input]) | (static_cast<std::size_t>(source[input + 1]) << 8U);
+        input += 2;
+        if (0 == offset || offset > output) {
+            throw IOException("Malformed LZ4 block: offset out of bounds");
+        }
+
+        auto matchLength = static_cast<std::size_t>(token & RUN_MASK);
+        if (RUN_MASK == matchLength) {
+            matchLength = readLength(source, input, matchLength);
+        }
+        matchLength += MIN_MATCH;
+        if (matchLength > destination.size() - output) {
+            throw IOException("Malformed LZ4 block: match out of bounds");
+        }
+
+        // an overlapping match repeats the last `offset` bytes, which has to be copied byte by byte
+        auto* target = destination.data() + output;
+        const auto* match = target - offset;
+        if (offset >= matchLength) {
+            std::memcpy(target, match, matchLength);
+        } else {
+            for (std::size_t i = 0; i < matchLength; i++) {
+                target[i] = match[i];
+            }
+        }
+        output += matchLength;
+    }
+
+    if (output != destination.size()) {
+        throw IOException("Malformed LZ4 block: size mismatch");
+    }
+}
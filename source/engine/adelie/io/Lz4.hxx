@@ -0,0 +1,30 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#if !defined(__ADELIE_IO_LZ4_HXX__)
+    #define __ADELIE_IO_LZ4_HXX__
+
+    #include <adelie/adelie.hxx>
+    #include <cstddef>
+    #include <span>
+    #include <vector>
+
+namespace adelie::io {
+
+    // an implementation of the LZ4 block format (https://github.com/lz4/lz4/blob/dev/doc/lz4_Block_format.md). The
+    // compressor is a simple greedy single-hash matcher, which is all the packer needs since decompression speed is
+    // what matters at runtime. The output is compatible with the reference implementation in both directions
+    class ADELIE_API Lz4 {
+        public:
+            // the worst case size of the compressed data, for incompressible input the output is slightly larger
+            [[nodiscard]] static auto getMaxCompressedSize(std::size_t size) -> std::size_t;
+
+            [[nodiscard]] static auto compress(std::span<const std::byte> source) -> std::vector<std::byte>;
+
+            // decompress into a destination of exactly the original size, throws an IOException for malformed input
+            static auto decompress(std::span<const std::byte> source, std::span<std::byte> destination) -> void;
+
+    }; /* class Lz4 */
+
+} /* namespace adelie::io */
+
+#endif /* if !defined(__ADELIE_IO_LZ4_HXX__) */
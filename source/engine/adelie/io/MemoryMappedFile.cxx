@@ -0,0 +1,179 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#include <adelie/exception/IOException.hxx>
+#include <adelie/io/MemoryMappedFile.hxx>
+
+#if defined(ADELIE_PLATFORM_WINDOWS)
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+using adelie::exception::IOException;
+using adelie::io::MemoryMappedFile;
+using adelie::io::MemoryMappedOutputFile;
+
+#if defined(ADELIE_PLATFORM_WINDOWS)
+MemoryMappedFile::MemoryMappedFile(const std::string& filename) {
+    mFilename = filename;
+    mData = nullptr;
+    mSize = 0;
+    mFileHandle = INVALID_HANDLE_VALUE;
+    mMappingHandle = nullptr;
+
+    mFileHandle = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, nullptr);
+    if (INVALID_HANDLE_VALUE == mFileHandle) {
+        throw IOException("Failed to open file for mapping: " + filename);
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(mFileHandle, &fileSize)) {
+        CloseHandle(mFileHandle);
+        throw IOException("Failed to query the size of file: " + filename);
+    }
+    mSize = static_cast<std::size_t>(fileSize.QuadPart);
+
+    // an empty file cannot be mapped, it is represented by an empty span instead
+    if (0 == mSize) {
+        return;
+    }
+
+    mMappingHandle = CreateFileMappingA(mFileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (nullptr == mMappingHandle) {
+        CloseHandle(mFileHandle);
+        throw IOException("Failed to create file mapping for: " + filename);
+    }
+
+    mData = static_cast<const std::byte*>(MapViewOfFile(mMappingHandle, FILE_MAP_READ, 0, 0, 0));
+    if (nullptr == mData) {
+        CloseHandle(mMappingHandle);
+        CloseHandle(mFileHandle);
+        throw IOException("Failed to map view of file: " + filename);
+    }
+}
+
+MemoryMappedFile::~MemoryMappedFile() noexcept {
+    if (nullptr != mData) {
+        UnmapViewOfFile(mData);
+    }
+    if (nullptr != mMappingHandle) {
+        CloseHandle(mMappingHandle);
+    }
+    if (INVALID_HANDLE_VALUE != mFileHandle) {
+        CloseHandle(mFileHandle);
+    }
+}
+
+MemoryMappedOutputFile::MemoryMappedOutputFile(const std::string& filename, const std::size_t size) {
+    mFilename = filename;
+    mData = nullptr;
+    mSize = size;
+    mFileHandle = INVALID_HANDLE_VALUE;
+    mMappingHandle = nullptr;
+
+    mFileHandle = CreateFileA(filename.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (INVALID_HANDLE_VALUE == mFileHandle) {
+        throw IOException("Failed to create file for mapping: " + filename);
+    }
+
+    // the mapping grows the file to its size
+    LARGE_INTEGER mappingSize;
+    mappingSize.QuadPart = static_cast<LONGLONG>(size);
+    mMappingHandle = CreateFileMappingA(mFileHandle, nullptr, PAGE_READWRITE, static_cast<DWORD>(mappingSize.HighPart), mappingSize.LowPart, nullptr);
+    if (nullptr == mMappingHandle) {
+        CloseHandle(mFileHandle);
+        throw IOException("Failed to create file mapping for: " + filename);
+    }
+
+    mData = static_cast<std::byte*>(MapViewOfFile(mMappingHandle, FILE_MAP_WRITE, 0, 0, size));
+    if (nullptr == mData) {
+        CloseHandle(mMappingHandle);
+        CloseHandle(mFileHandle);
+        throw IOException("Failed to map view of file: " + filename);
+    }
+}
+
+MemoryMappedOutputFile::~MemoryMappedOutputFile() noexcept {
+    if (nullptr != mData) {
+        UnmapViewOfFile(mData);
+    }
+    if (nullptr != mMappingHandle) {
+        CloseHandle(mMappingHandle);
+    }
+    if (INVALID_HANDLE_VALUE != mFileHandle) {
+        CloseHandle(mFileHandle);
+    }
+}
+#else
+MemoryMappedFile::MemoryMappedFile(const std::string& filename) {
+    mFilename = filename;
+    mData = nullptr;
+    mSize = 0;
+
+    const auto fileDescriptor = open(filename.c_str(), O_RDONLY | O_CLOEXEC);  // NOLINT(cppcoreguidelines-pro-type-vararg)
+    if (fileDescriptor < 0) {
+        throw IOException("Failed to open file for mapping: " + filename);
+    }
+
+    struct stat fileStatus{};
+    if (fstat(fileDescriptor, &fileStatus) != 0) {
+        close(fileDescriptor);
+        throw IOException("Failed to query the size of file: " + filename);
+    }
+    mSize = static_cast<std::size_t>(fileStatus.st_size);
+
+    // an empty file cannot be mapped, it is represented by an empty span instead
+    if (0 == mSize) {
+        close(fileDescriptor);
+        return;
+    }
+
+    void* mapping = mmap(nullptr, mSize, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+    close(fileDescriptor);  // the mapping keeps its own reference to the file
+    if (MAP_FAILED == mapping) {
+        throw IOException("Failed to map file: " + filename);
+    }
+
+    mData = static_cast<const std::byte*>(mapping);
+}
+
+MemoryMappedFile::~MemoryMappedFile() noexcept {
+    if (nullptr != mData) {
+        munmap(const_cast<std::byte*>(mData), mSize);
+    }
+}
+
+MemoryMappedOutputFile::MemoryMappedOutputFile(const std::string& filename, const std::size_t size) {
+    mFilename = filename;
+    mData = nullptr;
+    mSize = size;
+
+    const auto fileDescriptor = open(filename.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);  // NOLINT(cppcoreguidelines-pro-type-vararg)
+    if (fileDescriptor < 0) {
+        throw IOException("Failed to create file for mapping: " + filename);
+    }
+
+    // the file is sparse, disk space is only used for the pages which are actually written
+    if (ftruncate(fileDescriptor, static_cast<off_t>(size)) != 0) {
+        close(fileDescriptor);
+        throw IOException("Failed to resize file: " + filename);
+    }
+
+    void* mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fileDescriptor, 0);
+    close(fileDescriptor);  // the mapping keeps its own reference to the file
+    if (MAP_FAILED == mapping) {
+        throw IOException("Failed to map file: " + filename);
+    }
+
+    mData = static_cast<std::byte*>(mapping);
+}
+
+MemoryMappedOutputFile::~MemoryMappedOutputFile() noexcept {
+    if (nullptr != mData) {
+        munmap(mData, mSize);
+    }
+}
+#endif
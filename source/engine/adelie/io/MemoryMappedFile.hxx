@@ -0,0 +1,81 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#if !defined(__ADELIE_IO_MEMORYMAPPEDFILE_HXX__)
+    #define __ADELIE_IO_MEMORYMAPPEDFILE_HXX__
+
+    #include <adelie/adelie.hxx>
+    #include <cstddef>
+    #include <span>
+    #include <string>
+
+namespace adelie::io {
+
+    // a read-only mapping of a whole file into the address space. Pages are loaded by the OS on first access, so
+    // opening a large file is cheap and reading from it does not copy the data into a separate buffer
+    class ADELIE_API MemoryMappedFile {
+        public:
+            explicit MemoryMappedFile(const std::string& filename);
+
+            ~MemoryMappedFile() noexcept;
+
+            MemoryMappedFile(const MemoryMappedFile&) = delete;
+
+            auto operator=(MemoryMappedFile const&) -> MemoryMappedFile& = delete;
+
+            MemoryMappedFile(MemoryMappedFile&&) = delete;
+
+            auto operator=(MemoryMappedFile&&) -> MemoryMappedFile& = delete;
+
+            [[nodiscard]] auto getData() const -> std::span<const std::byte> { return {mData, mSize}; }
+
+            [[nodiscard]] auto getSize() const -> std::size_t { return mSize; }
+
+            [[nodiscard]] auto getFilename() const -> const std::string& { return mFilename; }
+
+        private:
+            std::string mFilename;
+            const std::byte* mData;
+            std::size_t mSize;
+    #if defined(ADELIE_PLATFORM_WINDOWS)
+            void* mFileHandle;
+            void* mMappingHandle;
+    #endif
+
+    }; /* class MemoryMappedFile */
+
+    // a writable, shared mapping of a file which is created (or truncated) with the given size. Everything written to
+    // the mapping ends up in the file, even if the process crashes afterwards
+    class ADELIE_API MemoryMappedOutputFile {
+        public:
+            MemoryMappedOutputFile(const std::string& filename, std::size_t size);
+
+            ~MemoryMappedOutputFile() noexcept;
+
+            MemoryMappedOutputFile(const MemoryMappedOutputFile&) = delete;
+
+            auto operator=(MemoryMappedOutputFile const&) -> MemoryMappedOutputFile& = delete;
+
+            MemoryMappedOutputFile(MemoryMappedOutputFile&&) = delete;
+
+            auto operator=(MemoryMappedOutputFile&&) -> MemoryMappedOutputFile& = delete;
+
+            [[nodiscard]] auto getData() const -> std::span<std::byte> { return {mData, mSize}; }
+
+            [[nodiscard]] auto getSize() const -> std::size_t { return mSize; }
+
+            [[nodiscard]] auto getFilename() const -> const std::string& { return mFilename; }
+
+        private:
+            std::string mFilename;
+            std::byte* mData;
+            std::size_t mSize;
+    #if defined(ADELIE_PLATFORM_WINDOWS)
+            void* mFileHandle;
+            void* mMappingHandle;
+    #endif
+
+    }; /* class MemoryMappedOutputFile */
+
+} /* namespace adelie::io */
+
+#endif /* if !defined(__ADELIE_IO_MEMORYMAPPEDFILE_HXX__) */
@@ -0,0 +1,29 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#if !defined(__ADELIE_IO_MOUNTINTERFACE_HXX__)
+    #define __ADELIE_IO_MOUNTINTERFACE_HXX__
+
+    #include <adelie/io/Blob.hxx>
+    #include <memory>
+    #include <string>
+    #include <string_view>
+
+namespace adelie::io {
+
+    // a source of files which can be mounted into the virtual file system. Paths are relative to the mount point,
+    // normalized and always use forward slashes
+    class MountInterface {
+        public:
+            virtual ~MountInterface() = default;
+
+            [[nodiscard]] virtual auto exists(std::string_view path) const -> bool = 0;
+
+            // returns nullptr if the mount does not contain the file, throws an IOException if reading it failed
+            [[nodiscard]] virtual auto read(std::string_view path) const -> std::shared_ptr<const Blob> = 0;
+
+            [[nodiscard]] virtual auto getName() const -> std::string = 0;
+    };
+
+} /* namespace adelie::io */
+
+#endif /* if !defined(__ADELIE_IO_MOUNTINTERFACE_HXX__) */
@@ -0,0 +1,128 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#include <adelie/exception/IOException.hxx>
+#include <adelie/io/Hash.hxx>
+#include <adelie/io/Logger.hxx>
+#include <adelie/io/VirtualFileSystem.hxx>
+#include <algorithm>
+#include <mutex>
+#include <ranges>
+
+using adelie::exception::IOException;
+using adelie::io::Blob;
+using adelie::io::MountInterface;
+using adelie::io::VirtualFileSystem;
+
+auto VirtualFileSystem::getInstance() -> VirtualFileSystem* {
+    static VirtualFileSystem instance;
+    return &instance;
+}
+
+VirtualFileSystem::VirtualFileSystem() : mCache(VFS_DEFAULT_CACHE_BUDGET) {}
+
+auto VirtualFileSystem::mount(const std::string_view mountPoint, std::shared_ptr<MountInterface> mount) -> void {
+    auto normalized = normalizePath(mountPoint);
+    if (!normalized.empty()) {
+        normalized.push_back('/');
+    }
+
+    AdelieLogDebug("Mounting {} at /{}", mount->getName(), normalized);
+
+    std::unique_lock lock(mMountMutex);
+    mMounts.push_back(Mount{.mountPoint = std::move(normalized), .mount = std::move(mount)});
+
+    // the new mount may shadow files which are already cached
+    mCache.clear();
+}
+
+auto VirtualFileSystem::unmount(const std::string_view mountPoint) -> void {
+    auto normalized = normalizePath(mountPoint);
+    if (!normalized.empty()) {
+        normalized.push_back('/');
+    }
+
+    std::unique_lock lock(mMountMutex);
+    std::erase_if(mMounts, [&normalized](const Mount& mount) { return mount.mountPoint == normalized; });
+    mCache.clear();
+}
+
+auto VirtualFileSystem::exists(const std::string_view path) -> bool {
+    const auto normalized = normalizePath(path);
+
+    std::shared_lock lock(mMountMutex);
+    for (const auto& mount : std::views::reverse(mMounts)) {
+        if (normalized.starts_with(mount.mountPoint) && mount.mount->exists(std::string_view(normalized).substr(mount.mountPoint.size()))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+auto VirtualFileSystem::read(const std::string_view path) -> std::shared_ptr<const Blob> {
+    const auto normalized = normalizePath(path);
+    const auto pathHash = hashPath(normalized);
+
+    if (auto blob = mCache.find(pathHash, normalized)) {
+        return blob;
+    }
+
+    std::shared_lock lock(mMountMutex);
+    for (const auto& mount : std::views::reverse(mMounts)) {
+        if (!normalized.starts_with(mount.mountPoint)) {
+            continue;
+        }
+
+        auto blob = mount.mount->read(std::string_view(normalized).substr(mount.mountPoint.size()));
+        if (nullptr == blob) {
+            continue;
+        }
+
+        // borrowed blobs are already resident in a mapping, caching them would only cost entries
+        if (blob->isOwning()) {
+            mCache.insert(pathHash, normalized, blob);
+        }
+        return blob;
+    }
+
+    throw IOException("File not found in any mount: " + normalized);
+}
+
+auto VirtualFileSystem::invalidate(const std::string_view path) -> void {
+    mCache.erase(hashPath(normalizePath(path)));
+}
+
+auto VirtualFileSystem::clearCache() -> void {
+    mCache.clear();
+}
+
+auto VirtualFileSystem::setCacheBudget(const std::size_t budget) -> void {
+    mCache.setBudget(budget);
+}
+
+auto VirtualFileSystem::normalizePath(const std::string_view path) -> std::string {
+    std::string normalized;
+    normalized.reserve(path.size());
+
+    size_t begin = 0;
+    while (begin <= path.size()) {
+        auto end = path.find_first_of("/\\", begin);
+        if (end == std::string_view::npos) {
+            end = path.size();
+        }
+
+        const auto segment = path.substr(begin, end - begin);
+        if (segment == "..") {
+            throw IOException("Path must not leave the virtual file system root: " + std::string(path));
+        }
+        if (!segment.empty() && segment != ".") {
+            if (!normalized.empty()) {
+                normalized.push_back('/');
+            }
+            normalized.append(segment);
+        }
+
+        begin = end + 1;
+    }
+
+    return normalized;
+}
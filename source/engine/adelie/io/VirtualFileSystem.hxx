@@ -0,0 +1,78 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#if !defined(__ADELIE_IO_VIRTUALFILESYSTEM_HXX__)
+    #define __ADELIE_IO_VIRTUALFILESYSTEM_HXX__
+
+    #include <adelie/adelie.hxx>
+    #include <adelie/io/Blob.hxx>
+    #include <adelie/io/BlobCache.hxx>
+    #include <adelie/io/MountInterface.hxx>
+    #include <cstddef>
+    #include <memory>
+    #include <shared_mutex>
+    #include <string>
+    #include <string_view>
+    #include <vector>
+
+namespace adelie::io {
+
+    static inline constexpr std::size_t VFS_DEFAULT_CACHE_BUDGET = 64ULL * 1024ULL * 1024ULL;
+
+    // resolves engine asset paths (e.g. "shader/cube.vert.spv") against a stack of mounts. Mounts added later shadow
+    // the ones added before, so a pack or a patch directory can override the loose files. Owning blobs which were read
+    // are kept in a memory-bounded LRU cache, repeated loads of the same asset do not touch the disk again
+    class ADELIE_API VirtualFileSystem {
+        public:
+            static auto getInstance() -> VirtualFileSystem*;
+
+            ~VirtualFileSystem() noexcept = default;
+
+            VirtualFileSystem(const VirtualFileSystem&) = delete;
+
+            auto operator=(VirtualFileSystem const&) -> VirtualFileSystem& = delete;
+
+            VirtualFileSystem(VirtualFileSystem&&) = delete;
+
+            auto operator=(VirtualFileSystem&&) -> VirtualFileSystem& = delete;
+
+            // an empty mount point mounts into the root, otherwise only paths below the mount point are resolved
+            auto mount(std::string_view mountPoint, std::shared_ptr<MountInterface> mount) -> void;
+
+            // removes every mount at the mount point and drops the cache, it may contain files of the removed mounts
+            auto unmount(std::string_view mountPoint) -> void;
+
+            [[nodiscard]] auto exists(std::string_view path) -> bool;
+
+            // throws an IOException if no mount contains the file
+            [[nodiscard]] auto read(std::string_view path) -> std::shared_ptr<const Blob>;
+
+            // drop a cached file after it was changed on disk, the next read will load it again
+            auto invalidate(std::string_view path) -> void;
+
+            auto clearCache() -> void;
+
+            auto setCacheBudget(std::size_t budget) -> void;
+
+            [[nodiscard]] auto getCache() -> BlobCache& { return mCache; }
+
+            // forward slashes only, no leading "./" or "/" and no empty segments. Paths escaping the root with ".."
+            // are rejected with an IOException
+            [[nodiscard]] static auto normalizePath(std::string_view path) -> std::string;
+
+        private:
+            VirtualFileSystem();
+
+            struct Mount {
+                    std::string mountPoint;  // normalized, empty or ending with a slash
+                    std::shared_ptr<MountInterface> mount;
+            };
+
+            std::shared_mutex mMountMutex;
+            std::vector<Mount> mMounts;
+            BlobCache mCache;
+
+    }; /* class VirtualFileSystem */
+
+} /* namespace adelie::io */
+
+#endif /* if !defined(__ADELIE_IO_VIRTUALFILESYSTEM_HXX__) */
@@ -0,0 +1,161 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#if !defined(__ADELIE_PLATFORM_LINUX_LINUXINPUT_HXX__)
+    #define __ADELIE_PLATFORM_LINUX_LINUXINPUT_HXX__
+
+    #include <linux/input-event-codes.h>
+
+    #include <adelie/core/Input.hxx>
+    #include <cstdint>
+
+namespace adelie::platform {
+
+    // both X11 (keycode - 8) and Wayland report the evdev scancode of a key, so the physical position on the keyboard
+    // is mapped and not the symbol of the active layout (W, A, S and D stay where they are on every layout)
+    inline auto translateLinuxKeyCode(const uint32_t scancode) -> ::adelie::core::KeyCode {
+        using ::adelie::core::KeyCode;
+        switch (scancode) {
+            case KEY_A:
+                return KeyCode::CharacterA;
+            case KEY_B:
+                return KeyCode::CharacterB;
+            case KEY_C:
+                return KeyCode::CharacterC;
+            case KEY_D:
+                return KeyCode::CharacterD;
+            case KEY_E:
+                return KeyCode::CharacterE;
+            case KEY_F:
+                return KeyCode::CharacterF;
+            case KEY_G:
+                return KeyCode::CharacterG;
+            case KEY_H:
+                return KeyCode::CharacterH;
+            case KEY_I:
+                return KeyCode::CharacterI;
+            case KEY_J:
+                return KeyCode::CharacterJ;
+            case KEY_K:
+                return KeyCode::CharacterK;
+            case KEY_L:
+                return KeyCode::CharacterL;
+            case KEY_M:
+                return KeyCode::CharacterM;
+            case KEY_N:
+                return KeyCode::CharacterN;
+            case KEY_O:
+                return KeyCode::CharacterO;
+            case KEY_P:
+                return KeyCode::CharacterP;
+            case KEY_Q:
+                return KeyCode::CharacterQ;
+            case KEY_R:
+                return KeyCode::CharacterR;
+            case KEY_S:
+                return KeyCode::CharacterS;
+            case KEY_T:
+                return KeyCode::CharacterT;
+            case KEY_U:
+                return KeyCode::CharacterU;
+            case KEY_V:
+                return KeyCode::CharacterV;
+            case KEY_W:
+                return KeyCode::CharacterW;
+            case KEY_X:
+                return KeyCode::CharacterX;
+            case KEY_Y:
+                return KeyCode::CharacterY;
+            case KEY_Z:
+                return KeyCode::CharacterZ;
+            case KEY_0:
+                return KeyCode::Character0;
+            case KEY_1:
+                return KeyCode::Character1;
+            case KEY_2:
+                return KeyCode::Character2;
+            case KEY_3:
+                return KeyCode::Character3;
+            case KEY_4:
+                return KeyCode::Character4;
+            case KEY_5:
+                return KeyCode::Character5;
+            case KEY_6:
+                return KeyCode::Character6;
+            case KEY_7:
+                return KeyCode::Character7;
+            case KEY_8:
+                return KeyCode::Character8;
+            case KEY_9:
+                return KeyCode::Character9;
+            case KEY_TAB:
+                return KeyCode::SpecialKeyTab;
+            case KEY_ESC:
+                return KeyCode::SpecialKeyEscape;
+            case KEY_ENTER:
+                return KeyCode::SpecialKeyReturn;
+            case KEY_SPACE:
+                return KeyCode::SpecialKeySpacebar;
+            case KEY_LEFT:
+                return KeyCode::SpecialKeyLeftArrow;
+            case KEY_UP:
+                return KeyCode::SpecialKeyUpArrow;
+            case KEY_RIGHT:
+                return KeyCode::SpecialKeyRightArrow;
+            case KEY_DOWN:
+                return KeyCode::SpecialKeyDownArrow;
+            case KEY_PAGEUP:
+                return KeyCode::SpecialKeyPageUp;
+            case KEY_PAGEDOWN:
+                return KeyCode::SpecialKeyPageDown;
+            case KEY_HOME:
+                return KeyCode::SpecialKeyHome;
+            case KEY_END:
+                return KeyCode::SpecialKeyEnd;
+            case KEY_INSERT:
+                return KeyCode::SpecialKeyInsert;
+            case KEY_DELETE:
+                return KeyCode::SpecialKeyDelete;
+            case KEY_BACKSPACE:
+                return KeyCode::SpecialKeyBackspace;
+            case KEY_LEFTSHIFT:
+                return KeyCode::SpecialKeyLeftShift;
+            case KEY_RIGHTSHIFT:
+                return KeyCode::SpecialKeyRightShift;
+            case KEY_LEFTCTRL:
+                return KeyCode::SpecialKeyLeftCtrl;
+            case KEY_RIGHTCTRL:
+                return KeyCode::SpecialKeyRightCtrl;
+            case KEY_LEFTMETA:
+                return KeyCode::SpecialKeyLeftSuper;
+            case KEY_RIGHTMETA:
+                return KeyCode::SpecialKeyRightSuper;
+            case KEY_LEFTALT:
+                return KeyCode::SpecialKeyLeftAlt;
+            case KEY_RIGHTALT:
+                return KeyCode::SpecialKeyRightAlt;
+            default:
+                return KeyCode::UnknownKey;
+        }
+    }
+
+    inline auto translateLinuxMouseButton(const uint32_t button) -> ::adelie::core::MouseButtonCode {
+        using ::adelie::core::MouseButtonCode;
+        switch (button) {
+            case BTN_LEFT:
+                return MouseButtonCode::MouseButtonLeft;
+            case BTN_RIGHT:
+                return MouseButtonCode::MouseButtonRight;
+            case BTN_MIDDLE:
+                return MouseButtonCode::MouseButtonMiddle;
+            case BTN_SIDE:
+                return MouseButtonCode::MouseButtonExtended1;
+            case BTN_EXTRA:
+                return MouseButtonCode::MouseButtonExtended2;
+            default:
+                return MouseButtonCode::MouseButtonUnknown;
+        }
+    }
+
+} /* namespace adelie::platform */
+
+#endif /* if !defined(__ADELIE_PLATFORM_LINUX_LINUXINPUT_HXX__) */
@@ -4,23 +4,126 @@
 
 #include <xdg-shell-client-protocol.h>
 
+#include "LinuxInput.hxx"
+
+#include <unistd.h>
+
 #include <adelie/core/Assert.hxx>
+#include <adelie/core/InputSystem.hxx>
 #include <adelie/exception/RuntimeException.hxx>
 #include <adelie/io/Logger.hxx>
+#include <algorithm>
 #include <cstring>
 #include <stdexcept>
 
+using adelie::core::InputSystem;
 using adelie::exception::RuntimeException;
 using adelie::platform::WaylandWindow;
 
 namespace adelie::platform {
-    void registry_handle_global(void* data, wl_registry* registry, const uint32_t id, const char* interface, uint32_t /*version*/) {
+    // the listeners below implement the events up to this version of wl_seat, wl_pointer and wl_keyboard
+    constexpr uint32_t WAYLAND_SEAT_VERSION = 5;
+
+    // a scroll wheel step is reported as 10 units
+    constexpr double WAYLAND_SCROLL_STEP = 10.0;
+
+    void pointer_enter(void* /*data*/, wl_pointer* /*pointer*/, uint32_t /*serial*/, wl_surface* /*surface*/, const wl_fixed_t x, const wl_fixed_t y) {
+        InputSystem::getInstance()->setMousePosition(static_cast<float>(wl_fixed_to_double(x)), static_cast<float>(wl_fixed_to_double(y)));
+    }
+
+    void pointer_leave(void* /*data*/, wl_pointer* /*pointer*/, uint32_t /*serial*/, wl_surface* /*surface*/) {}
+
+    void pointer_motion(void* /*data*/, wl_pointer* /*pointer*/, uint32_t /*time*/, const wl_fixed_t x, const wl_fixed_t y) {
+        InputSystem::getInstance()->setMousePosition(static_cast<float>(wl_fixed_to_double(x)), static_cast<float>(wl_fixed_to_double(y)));
+    }
+
+    void pointer_button(void* /*data*/, wl_pointer* /*pointer*/, uint32_t /*serial*/, uint32_t /*time*/, const uint32_t button, const uint32_t state) {
+        InputSystem::getInstance()->setMouseButton(translateLinuxMouseButton(button), WL_POINTER_BUTTON_STATE_PRESSED == state);
+    }
+
+    void pointer_axis(void* /*data*/, wl_pointer* /*pointer*/, uint32_t /*time*/, const uint32_t axis, const wl_fixed_t value) {
+        // positive values scroll down or right, the scroll events use positive values for up
+        const auto steps = static_cast<float>(wl_fixed_to_double(value) / WAYLAND_SCROLL_STEP);
+        if (WL_POINTER_AXIS_VERTICAL_SCROLL == axis) {
+            InputSystem::getInstance()->addScroll(0.0F, -steps);
+        } else {
+            InputSystem::getInstance()->addScroll(steps, 0.0F);
+        }
+    }
+
+    void pointer_frame(void* /*data*/, wl_pointer* /*pointer*/) {}
+
+    void pointer_axis_source(void* /*data*/, wl_pointer* /*pointer*/, uint32_t /*axisSource*/) {}
+
+    void pointer_axis_stop(void* /*data*/, wl_pointer* /*pointer*/, uint32_t /*time*/, uint32_t /*axis*/) {}
+
+    void pointer_axis_discrete(void* /*data*/, wl_pointer* /*pointer*/, uint32_t /*axis*/, int32_t /*discrete*/) {}
+
+    constexpr wl_pointer_listener pointer_listener = {pointer_enter, pointer_leave, pointer_motion, pointer_button, pointer_axis, pointer_frame, pointer_axis_source, pointer_axis_stop, pointer_axis_discrete};
+
+    void keyboard_keymap(void* /*data*/, wl_keyboard* /*keyboard*/, uint32_t /*format*/, const int32_t fd, uint32_t /*size*/) {
+        // the keys are mapped by their scancode, the keymap is not needed
+        close(fd);
+    }
+
+    void keyboard_enter(void* /*data*/, wl_keyboard* /*keyboard*/, uint32_t /*serial*/, wl_surface* /*surface*/, wl_array* keys) {
+        // the keys which are already held down when the window gains the focus
+        const auto* pressedKeys = static_cast<const uint32_t*>(keys->data);
+        for (std::size_t i = 0; i < keys->size / sizeof(uint32_t); i++) {
+            InputSystem::getInstance()->setKey(translateLinuxKeyCode(pressedKeys[i]), true);
+        }
+    }
+
+    void keyboard_leave(void* /*data*/, wl_keyboard* /*keyboard*/, uint32_t /*serial*/, wl_surface* /*surface*/) {
+        InputSystem::getInstance()->releaseAll();
+    }
+
+    void keyboard_key(void* /*data*/, wl_keyboard* /*keyboard*/, uint32_t /*serial*/, uint32_t /*time*/, const uint32_t key, const uint32_t state) {
+        InputSystem::getInstance()->setKey(translateLinuxKeyCode(key), WL_KEYBOARD_KEY_STATE_PRESSED == state);
+    }
+
+    void keyboard_modifiers(void* /*data*/, wl_keyboard* /*keyboard*/, uint32_t /*serial*/, uint32_t /*depressed*/, uint32_t /*latched*/, uint32_t /*locked*/, uint32_t /*group*/) {}
+
+    void keyboard_repeat_info(void* /*data*/, wl_keyboard* /*keyboard*/, int32_t /*rate*/, int32_t /*delay*/) {}
+
+    constexpr wl_keyboard_listener keyboard_listener = {keyboard_keymap, keyboard_enter, keyboard_leave, keyboard_key, keyboard_modifiers, keyboard_repeat_info};
+
+    void seat_capabilities(void* data, wl_seat* seat, const uint32_t capabilities) {
+        auto* window = static_cast<WaylandWindow*>(data);
+
+        const bool hasPointer = (capabilities & WL_SEAT_CAPABILITY_POINTER) != 0;
+        if (hasPointer && nullptr == window->pointer) {
+            window->pointer = wl_seat_get_pointer(seat);
+            wl_pointer_add_listener(window->pointer, &pointer_listener, window);
+        } else if (!hasPointer && nullptr != window->pointer) {
+            wl_pointer_destroy(window->pointer);
+            window->pointer = nullptr;
+        }
+
+        const bool hasKeyboard = (capabilities & WL_SEAT_CAPABILITY_KEYBOARD) != 0;
+        if (hasKeyboard && nullptr == window->keyboard) {
+            window->keyboard = wl_seat_get_keyboard(seat);
+            wl_keyboard_add_listener(window->keyboard, &keyboard_listener, window);
+        } else if (!hasKeyboard && nullptr != window->keyboard) {
+            wl_keyboard_destroy(window->keyboard);
+            window->keyboard = nullptr;
+        }
+    }
+
+    void seat_name(void* /*data*/, wl_seat* /*seat*/, const char* /*name*/) {}
+
+    constexpr wl_seat_listener seat_listener = {seat_capabilities, seat_name};
+
+    void registry_handle_global(void* data, wl_registry* registry, const uint32_t id, const char* interface, const uint32_t version) {
         auto* window = static_cast<WaylandWindow*>(data);
 
         if (strcmp(interface, wl_compositor_interface.name) == 0) {
             window->compositor = static_cast<wl_compositor*>(wl_registry_bind(registry, id, &wl_compositor_interface, 4));
         } else if (strcmp(interface, xdg_wm_base_interface.name) == 0) {
             window->xdg_wm_base = static_cast<xdg_wm_base*>(wl_registry_bind(registry, id, &xdg_wm_base_interface, 1));
+        } else if (strcmp(interface, wl_seat_interface.name) == 0 && nullptr == window->seat) {
+            window->seat = static_cast<wl_seat*>(wl_registry_bind(registry, id, &wl_seat_interface, std::min(version, WAYLAND_SEAT_VERSION)));
+            wl_seat_add_listener(window->seat, &seat_listener, window);
         }
     }
 
@@ -57,7 +160,7 @@ namespace adelie::platform {
 } /* namespace adelie::platform */
 
 WaylandWindow::WaylandWindow()
-    : compositor(nullptr), xdg_wm_base(nullptr), windowWidth(0), windowHeight(0), shouldCloseFlag(false), display(nullptr), registry(nullptr), surface(nullptr), xdg_surface(nullptr), xdg_toplevel(nullptr) {
+    : compositor(nullptr), xdg_wm_base(nullptr), seat(nullptr), pointer(nullptr), keyboard(nullptr), windowWidth(0), windowHeight(0), shouldCloseFlag(false), display(nullptr), registry(nullptr), surface(nullptr), xdg_surface(nullptr), xdg_toplevel(nullptr) {
     display = wl_display_connect(nullptr);
     if (!display) {
         throw RuntimeException("Failed to connect to Wayland display");
@@ -125,6 +228,18 @@ void WaylandWindow::createWindow(const int& width, const int& height, const char
 }
 
 void WaylandWindow::destroyWindow() {
+    if (keyboard) {
+        wl_keyboard_destroy(keyboard);
+        keyboard = nullptr;
+    }
+    if (pointer) {
+        wl_pointer_destroy(pointer);
+        pointer = nullptr;
+    }
+    if (seat) {
+        wl_seat_destroy(seat);
+        seat = nullptr;
+    }
     if (xdg_toplevel) {
         xdg_toplevel_destroy(xdg_toplevel);
         xdg_toplevel = nullptr;
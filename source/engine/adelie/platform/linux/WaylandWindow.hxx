@@ -30,6 +30,9 @@ namespace adelie::platform {
             // Public members needed by callback functions
             struct wl_compositor* compositor;
             struct xdg_wm_base* xdg_wm_base;
+            struct wl_seat* seat;
+            struct wl_pointer* pointer;
+            struct wl_keyboard* keyboard;
             int windowWidth;
             int windowHeight;
             bool shouldCloseFlag;
@@ -2,13 +2,42 @@
 
 #include "XcbWindow.hxx"
 
+#include "LinuxInput.hxx"
+
+#include <adelie/core/InputSystem.hxx>
 #include <adelie/exception/RuntimeException.hxx>
 #include <cstring>
 #include <stdexcept>
 
+using adelie::core::InputSystem;
+using adelie::core::KeyCode;
+using adelie::core::MouseButtonCode;
 using adelie::exception::RuntimeException;
 using adelie::platform::XcbWindow;
 
+namespace {
+    // X11 keycodes are the evdev scancodes shifted by 8
+    constexpr uint32_t XCB_KEYCODE_OFFSET = 8;
+
+    // the core protocol numbers the buttons itself, 4 to 7 are the scroll wheel
+    auto translateXcbButton(const xcb_button_t button) -> MouseButtonCode {
+        switch (button) {
+            case 1:
+                return MouseButtonCode::MouseButtonLeft;
+            case 2:
+                return MouseButtonCode::MouseButtonMiddle;
+            case 3:
+                return MouseButtonCode::MouseButtonRight;
+            case 8:
+                return MouseButtonCode::MouseButtonExtended1;
+            case 9:
+                return MouseButtonCode::MouseButtonExtended2;
+            default:
+                return MouseButtonCode::MouseButtonUnknown;
+        }
+    }
+}  // namespace
+
 XcbWindow::XcbWindow() : connection(nullptr), window(0), shouldCloseFlag(false) {
     connection = xcb_connect(nullptr, nullptr);
     if (xcb_connection_has_error(connection)) {
@@ -30,7 +59,7 @@ void XcbWindow::createWindow(const int& width, const int& height, const char* ti
     window = xcb_generate_id(connection);
 
     uint32_t value_mask = XCB_CW_BACK_PIXEL | XCB_CW_EVENT_MASK;
-    uint32_t value_list[] = {screen->black_pixel, XCB_EVENT_MASK_EXPOSURE | XCB_EVENT_MASK_KEY_PRESS | XCB_EVENT_MASK_STRUCTURE_NOTIFY};
+    uint32_t value_list[] = {screen->black_pixel, XCB_EVENT_MASK_EXPOSURE | XCB_EVENT_MASK_KEY_PRESS | XCB_EVENT_MASK_KEY_RELEASE | XCB_EVENT_MASK_BUTTON_PRESS | XCB_EVENT_MASK_BUTTON_RELEASE | XCB_EVENT_MASK_POINTER_MOTION | XCB_EVENT_MASK_FOCUS_CHANGE | XCB_EVENT_MASK_STRUCTURE_NOTIFY};
 
     xcb_create_window(connection, XCB_COPY_FROM_PARENT, window, screen->root, 0, 0, width, height, 1, XCB_WINDOW_CLASS_INPUT_OUTPUT, screen->root_visual, value_mask, value_list);
 
@@ -71,11 +100,65 @@ bool XcbWindow::shouldClose() const {
 }
 
 void XcbWindow::pollEvents() {
-    xcb_generic_event_t* event;
-    while ((event = xcb_poll_for_event(connection))) {
+    auto* input = InputSystem::getInstance();
+
+    xcb_generic_event_t* event = nullptr;
+    xcb_generic_event_t* pendingEvent = nullptr;
+    while ((event = (nullptr != pendingEvent) ? pendingEvent : xcb_poll_for_event(connection))) {
+        pendingEvent = nullptr;
         switch (event->response_type & ~0x80) {
-            case XCB_KEY_PRESS:
-                shouldCloseFlag = true;
+            case XCB_KEY_PRESS: {
+                const auto* keyEvent = reinterpret_cast<xcb_key_press_event_t*>(event);
+                const auto keyCode = translateLinuxKeyCode(keyEvent->detail - XCB_KEYCODE_OFFSET);
+                input->setKey(keyCode, true);
+                if (KeyCode::SpecialKeyEscape == keyCode) {
+                    shouldCloseFlag = true;
+                }
+                break;
+            }
+            case XCB_KEY_RELEASE: {
+                // a key which is held down is repeated as a release directly followed by a press with the same time,
+                // such a pair is a repeated press and not a release
+                const auto* keyEvent = reinterpret_cast<xcb_key_release_event_t*>(event);
+                const auto keyCode = translateLinuxKeyCode(keyEvent->detail - XCB_KEYCODE_OFFSET);
+                pendingEvent = xcb_poll_for_queued_event(connection);
+                if (nullptr != pendingEvent && XCB_KEY_PRESS == (pendingEvent->response_type & ~0x80)) {
+                    const auto* nextKeyEvent = reinterpret_cast<xcb_key_press_event_t*>(pendingEvent);
+                    if (nextKeyEvent->detail == keyEvent->detail && nextKeyEvent->time == keyEvent->time) {
+                        input->setKey(keyCode, true);
+                        free(pendingEvent);
+                        pendingEvent = nullptr;
+                        break;
+                    }
+                }
+                input->setKey(keyCode, false);
+                break;
+            }
+            case XCB_BUTTON_PRESS: {
+                const auto* buttonEvent = reinterpret_cast<xcb_button_press_event_t*>(event);
+                input->setMousePosition(static_cast<float>(buttonEvent->event_x), static_cast<float>(buttonEvent->event_y));
+                if (buttonEvent->detail >= 4 && buttonEvent->detail <= 7) {
+                    const float xOffset = (6 == buttonEvent->detail) ? -1.0F : ((7 == buttonEvent->detail) ? 1.0F : 0.0F);
+                    const float yOffset = (4 == buttonEvent->detail) ? 1.0F : ((5 == buttonEvent->detail) ? -1.0F : 0.0F);
+                    input->addScroll(xOffset, yOffset);
+                } else {
+                    input->setMouseButton(translateXcbButton(buttonEvent->detail), true);
+                }
+                break;
+            }
+            case XCB_BUTTON_RELEASE: {
+                const auto* buttonEvent = reinterpret_cast<xcb_button_release_event_t*>(event);
+                input->setMousePosition(static_cast<float>(buttonEvent->event_x), static_cast<float>(buttonEvent->event_y));
+                input->setMouseButton(translateXcbButton(buttonEvent->detail), false);
+                break;
+            }
+            case XCB_MOTION_NOTIFY: {
+                const auto* motionEvent = reinterpret_cast<xcb_motion_notify_event_t*>(event);
+                input->setMousePosition(static_cast<float>(motionEvent->event_x), static_cast<float>(motionEvent->event_y));
+                break;
+            }
+            case XCB_FOCUS_OUT:
+                input->releaseAll();
                 break;
             case XCB_CONFIGURE_NOTIFY:
                 // Handle window resize if needed
@@ -2,12 +2,81 @@
 
 #include "Win32Window.hxx"
 
+#include <windowsx.h>
+
+#include <adelie/core/InputSystem.hxx>
 #include <adelie/exception/RuntimeException.hxx>
 #include <string>
 
+using adelie::core::InputSystem;
+using adelie::core::KeyCode;
+using adelie::core::MouseButtonCode;
 using adelie::exception::RuntimeException;
 using adelie::platform::Win32Window;
 
+namespace {
+    // the generic shift, control and alt keys are resolved into their left and right variant with the scancode and
+    // the extended key flag of the message
+    auto translateVirtualKey(const WPARAM virtualKey, const LPARAM flags) -> KeyCode {
+        const auto isExtended = (HIWORD(flags) & KF_EXTENDED) != 0;
+        if (virtualKey >= 'A' && virtualKey <= 'Z') {
+            return static_cast<KeyCode>(static_cast<uint32_t>(KeyCode::CharacterA) + static_cast<uint32_t>(virtualKey - 'A'));
+        }
+        if (virtualKey >= '0' && virtualKey <= '9') {
+            return static_cast<KeyCode>(static_cast<uint32_t>(KeyCode::Character0) + static_cast<uint32_t>(virtualKey - '0'));
+        }
+
+        switch (virtualKey) {
+            case VK_TAB:
+                return KeyCode::SpecialKeyTab;
+            case VK_ESCAPE:
+                return KeyCode::SpecialKeyEscape;
+            case VK_RETURN:
+                return KeyCode::SpecialKeyReturn;
+            case VK_SPACE:
+                return KeyCode::SpecialKeySpacebar;
+            case VK_LEFT:
+                return KeyCode::SpecialKeyLeftArrow;
+            case VK_UP:
+                return KeyCode::SpecialKeyUpArrow;
+            case VK_RIGHT:
+                return KeyCode::SpecialKeyRightArrow;
+            case VK_DOWN:
+                return KeyCode::SpecialKeyDownArrow;
+            case VK_PRIOR:
+                return KeyCode::SpecialKeyPageUp;
+            case VK_NEXT:
+                return KeyCode::SpecialKeyPageDown;
+            case VK_HOME:
+                return KeyCode::SpecialKeyHome;
+            case VK_END:
+                return KeyCode::SpecialKeyEnd;
+            case VK_INSERT:
+                return KeyCode::SpecialKeyInsert;
+            case VK_DELETE:
+                return KeyCode::SpecialKeyDelete;
+            case VK_BACK:
+                return KeyCode::SpecialKeyBackspace;
+            case VK_SHIFT:
+                return (MapVirtualKey((flags >> 16) & 0xFF, MAPVK_VSC_TO_VK_EX) == VK_RSHIFT) ? KeyCode::SpecialKeyRightShift : KeyCode::SpecialKeyLeftShift;
+            case VK_CONTROL:
+                return isExtended ? KeyCode::SpecialKeyRightCtrl : KeyCode::SpecialKeyLeftCtrl;
+            case VK_MENU:
+                return isExtended ? KeyCode::SpecialKeyRightAlt : KeyCode::SpecialKeyLeftAlt;
+            case VK_LWIN:
+                return KeyCode::SpecialKeyLeftSuper;
+            case VK_RWIN:
+                return KeyCode::SpecialKeyRightSuper;
+            default:
+                return KeyCode::UnknownKey;
+        }
+    }
+
+    auto translateExtendedButton(const WPARAM wParam) -> MouseButtonCode {
+        return (GET_XBUTTON_WPARAM(wParam) == XBUTTON1) ? MouseButtonCode::MouseButtonExtended1 : MouseButtonCode::MouseButtonExtended2;
+    }
+}  // namespace
+
 Win32Window::Win32Window() : hwnd(nullptr), shouldCloseFlag(false) {
     // Register window class
     WNDCLASSEX wc = {};
@@ -91,10 +160,47 @@ LRESULT CALLBACK Win32Window::windowProc(HWND hwnd, UINT uMsg, WPARAM wParam, LP
     }
 
     if (window) {
+        auto* input = InputSystem::getInstance();
         switch (uMsg) {
             case WM_CLOSE:
                 window->shouldCloseFlag = true;
                 return 0;
+            case WM_KEYDOWN:
+            case WM_SYSKEYDOWN:
+                input->setKey(translateVirtualKey(wParam, lParam), true);
+                break;
+            case WM_KEYUP:
+            case WM_SYSKEYUP:
+                input->setKey(translateVirtualKey(wParam, lParam), false);
+                break;
+            case WM_MOUSEMOVE:
+                input->setMousePosition(static_cast<float>(GET_X_LPARAM(lParam)), static_cast<float>(GET_Y_LPARAM(lParam)));
+                return 0;
+            case WM_LBUTTONDOWN:
+            case WM_LBUTTONUP:
+                input->setMouseButton(MouseButtonCode::MouseButtonLeft, WM_LBUTTONDOWN == uMsg);
+                return 0;
+            case WM_RBUTTONDOWN:
+            case WM_RBUTTONUP:
+                input->setMouseButton(MouseButtonCode::MouseButtonRight, WM_RBUTTONDOWN == uMsg);
+                return 0;
+            case WM_MBUTTONDOWN:
+            case WM_MBUTTONUP:
+                input->setMouseButton(MouseButtonCode::MouseButtonMiddle, WM_MBUTTONDOWN == uMsg);
+                return 0;
+            case WM_XBUTTONDOWN:
+            case WM_XBUTTONUP:
+                input->setMouseButton(translateExtendedButton(wParam), WM_XBUTTONDOWN == uMsg);
+                return TRUE;
+            case WM_MOUSEWHEEL:
+                input->addScroll(0.0F, static_cast<float>(GET_WHEEL_DELTA_WPARAM(wParam)) / WHEEL_DELTA);
+                return 0;
+            case WM_MOUSEHWHEEL:
+                input->addScroll(static_cast<float>(GET_WHEEL_DELTA_WPARAM(wParam)) / WHEEL_DELTA, 0.0F);
+                return 0;
+            case WM_KILLFOCUS:
+                input->releaseAll();
+                break;
             case WM_SIZE:
                 // Handle window resize if needed
                 break;
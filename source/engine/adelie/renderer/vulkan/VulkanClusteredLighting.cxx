@@ -0,0 +1,226 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#include <adelie/exception/VulkanRuntimeException.hxx>
+#include <adelie/io/Logger.hxx>
+#include <adelie/io/VirtualFileSystem.hxx>
+#include <adelie/renderer/vulkan/VulkanBufferManager.hxx>
+#include <adelie/renderer/vulkan/VulkanClusteredLighting.hxx>
+#include <adelie/renderer/vulkan/VulkanShaderManager.hxx>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+
+using adelie::exception::VulkanRuntimeException;
+using adelie::io::VirtualFileSystem;
+using adelie::renderer::vulkan::VulkanBufferManager;
+using adelie::renderer::vulkan::VulkanClusteredLighting;
+using adelie::renderer::vulkan::VulkanGpuLight;
+using adelie::renderer::vulkan::VulkanShaderManager;
+
+namespace {
+    constexpr uint32_t CLUSTER_GROUP_SIZE = 64;
+
+    struct ClusterPushConstants {
+            glm::mat4 view;
+            glm::vec4 projection;  // the x and y scale of the projection, near and far plane
+            uint32_t lightCount;
+    };
+}  // namespace
+
+VulkanClusteredLighting::VulkanClusteredLighting(VkDevice device, VkPhysicalDevice physicalDevice, VulkanDeletionQueue& deletionQueue) : mDeletionQueue(deletionQueue) {
+    mDevice = device;
+    mPhysicalDevice = physicalDevice;
+    mSetLayout = VK_NULL_HANDLE;
+    mPipelineLayout = VK_NULL_HANDLE;
+    mPipeline = VK_NULL_HANDLE;
+    mClusterCountBuffer = VK_NULL_HANDLE;
+    mClusterCountMemory = VK_NULL_HANDLE;
+    mClusterIndexBuffer = VK_NULL_HANDLE;
+    mClusterIndexMemory = VK_NULL_HANDLE;
+    mDescriptorPool = VK_NULL_HANDLE;
+
+    createPipeline();
+}
+
+VulkanClusteredLighting::~VulkanClusteredLighting() noexcept {
+    // the caller ensures the device is idle and flushes the deletion queue afterwards
+    retire(0);
+    mDeletionQueue.retirePipeline(mPipeline, 0);
+    mDeletionQueue.retirePipelineLayout(mPipelineLayout, 0);
+    vkDestroyDescriptorSetLayout(mDevice, mSetLayout, nullptr);
+}
+
+auto VulkanClusteredLighting::createPipeline() -> void {
+    // lights, light counts and light indices of the clusters
+    std::array<VkDescriptorSetLayoutBinding, 3> bindings{};
+    for (uint32_t binding = 0; binding < bindings.size(); binding++) {
+        bindings[binding].binding = binding;
+        bindings[binding].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        bindings[binding].descriptorCount = 1;
+        bindings[binding].stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+    }
+
+    VkDescriptorSetLayoutCreateInfo layoutInfo{};
+    layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+    layoutInfo.bindingCount = static_cast<uint32_t>(bindings.size());
+    layoutInfo.pBindings = bindings.data();
+
+    if (const auto result = vkCreateDescriptorSetLayout(mDevice, &layoutInfo, nullptr, &mSetLayout); result != VK_SUCCESS) {
+        throw VulkanRuntimeException("Failed to create light clustering descriptor set layout", result);
+    }
+
+    VkPushConstantRange pushConstantRange{};
+    pushConstantRange.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+    pushConstantRange.offset = 0;
+    pushConstantRange.size = sizeof(ClusterPushConstants);
+
+    VkPipelineLayoutCreateInfo pipelineLayoutInfo{};
+    pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+    pipelineLayoutInfo.setLayoutCount = 1;
+    pipelineLayoutInfo.pSetLayouts = &mSetLayout;
+    pipelineLayoutInfo.pushConstantRangeCount = 1;
+    pipelineLayoutInfo.pPushConstantRanges = &pushConstantRange;
+
+    if (const auto result = vkCreatePipelineLayout(mDevice, &pipelineLayoutInfo, nullptr, &mPipelineLayout); result != VK_SUCCESS) {
+        throw VulkanRuntimeException("Failed to create light clustering pipeline layout", result);
+    }
+
+    const auto code = VirtualFileSystem::getInstance()->read("shader/light_cluster.comp.spv");
+    const auto shaderModule = VulkanShaderManager::createShaderModule(mDevice, code->getData());
+
+    VkComputePipelineCreateInfo pipelineInfo{};
+    pipelineInfo.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+    pipelineInfo.stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    pipelineInfo.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+    pipelineInfo.stage.module = shaderModule;
+    pipelineInfo.stage.pName = "main";
+    pipelineInfo.layout = mPipelineLayout;
+
+    const auto result = vkCreateComputePipelines(mDevice, VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &mPipeline);
+    vkDestroyShaderModule(mDevice, shaderModule, nullptr);
+    if (result != VK_SUCCESS) {
+        throw VulkanRuntimeException("Failed to create light clustering pipeline", result);
+    }
+}
+
+auto VulkanClusteredLighting::resize(const uint32_t frameCount, const uint64_t lastUsedFrame) -> void {
+    retire(lastUsedFrame);
+
+    VulkanBufferManager::createBuffer(mDevice, mPhysicalDevice, sizeof(uint32_t) * CLUSTER_COUNT, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, mClusterCountBuffer,
+                                      mClusterCountMemory);
+    VulkanBufferManager::createBuffer(mDevice, mPhysicalDevice, sizeof(uint32_t) * CLUSTER_COUNT * CLUSTER_MAX_LIGHTS_PER_CLUSTER, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+                                      VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, mClusterIndexBuffer, mClusterIndexMemory);
+
+    mFrames.resize(frameCount);
+    for (auto& frame : mFrames) {
+        VulkanBufferManager::createBuffer(mDevice, mPhysicalDevice, sizeof(VulkanGpuLight) * CLUSTER_MAX_LIGHTS, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+                                          VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, frame.lightBuffer, frame.lightMemory);
+        void* data;
+        vkMapMemory(mDevice, frame.lightMemory, 0, VK_WHOLE_SIZE, 0, &data);
+        frame.lights = static_cast<VulkanGpuLight*>(data);
+        frame.set = VK_NULL_HANDLE;
+        frame.lightCount = 0;
+    }
+
+    VkDescriptorPoolSize poolSize{};
+    poolSize.type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    poolSize.descriptorCount = 3 * frameCount;
+
+    VkDescriptorPoolCreateInfo poolInfo{};
+    poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+    poolInfo.poolSizeCount = 1;
+    poolInfo.pPoolSizes = &poolSize;
+    poolInfo.maxSets = frameCount;
+
+    if (const auto result = vkCreateDescriptorPool(mDevice, &poolInfo, nullptr, &mDescriptorPool); result != VK_SUCCESS) {
+        throw VulkanRuntimeException("Failed to create light clustering descriptor pool", result);
+    }
+
+    for (auto& frame : mFrames) {
+        VkDescriptorSetAllocateInfo allocInfo{};
+        allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+        allocInfo.descriptorPool = mDescriptorPool;
+        allocInfo.descriptorSetCount = 1;
+        allocInfo.pSetLayouts = &mSetLayout;
+
+        if (const auto result = vkAllocateDescriptorSets(mDevice, &allocInfo, &frame.set); result != VK_SUCCESS) {
+            throw VulkanRuntimeException("Failed to allocate light clustering descriptor set", result);
+        }
+
+        const std::array<VkDescriptorBufferInfo, 3> bufferInfos = {VkDescriptorBufferInfo{.buffer = frame.lightBuffer, .offset = 0, .range = VK_WHOLE_SIZE},
+                                                                   VkDescriptorBufferInfo{.buffer = mClusterCountBuffer, .offset = 0, .range = VK_WHOLE_SIZE},
+                                                                   VkDescriptorBufferInfo{.buffer = mClusterIndexBuffer, .offset = 0, .range = VK_WHOLE_SIZE}};
+
+        std::array<VkWriteDescriptorSet, 3> descriptorWrites{};
+        for (uint32_t binding = 0; binding < descriptorWrites.size(); binding++) {
+            descriptorWrites[binding].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            descriptorWrites[binding].dstSet = frame.set;
+            descriptorWrites[binding].dstBinding = binding;
+            descriptorWrites[binding].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+            descriptorWrites[binding].descriptorCount = 1;
+            descriptorWrites[binding].pBufferInfo = &bufferInfos[binding];
+        }
+        vkUpdateDescriptorSets(mDevice, static_cast<uint32_t>(descriptorWrites.size()), descriptorWrites.data(), 0, nullptr);
+    }
+}
+
+auto VulkanClusteredLighting::retire(const uint64_t lastUsedFrame) -> void {
+    // the mapped light memory is unmapped implicitly when it is freed
+    for (const auto& frame : mFrames) {
+        mDeletionQueue.retireBuffer(frame.lightBuffer, frame.lightMemory, lastUsedFrame);
+    }
+    mFrames.clear();
+
+    if (VK_NULL_HANDLE != mClusterCountBuffer) {
+        mDeletionQueue.retireBuffer(mClusterCountBuffer, mClusterCountMemory, lastUsedFrame);
+        mDeletionQueue.retireBuffer(mClusterIndexBuffer, mClusterIndexMemory, lastUsedFrame);
+        mClusterCountBuffer = VK_NULL_HANDLE;
+        mClusterCountMemory = VK_NULL_HANDLE;
+        mClusterIndexBuffer = VK_NULL_HANDLE;
+        mClusterIndexMemory = VK_NULL_HANDLE;
+    }
+
+    if (VK_NULL_HANDLE != mDescriptorPool) {
+        mDeletionQueue.retireDescriptorPool(mDescriptorPool, lastUsedFrame);
+        mDescriptorPool = VK_NULL_HANDLE;
+    }
+}
+
+auto VulkanClusteredLighting::writeLights(const uint32_t frame, const std::span<const VulkanGpuLight> lights) -> uint32_t {
+    const auto count = static_cast<uint32_t>(std::min<std::size_t>(lights.size(), CLUSTER_MAX_LIGHTS));
+    if (count < lights.size()) {
+        AdelieLogWarning("Dropping {} of {} lights, the clustered lighting only handles {}", lights.size() - count, lights.size(), CLUSTER_MAX_LIGHTS);
+    }
+
+    std::memcpy(mFrames[frame].lights, lights.data(), sizeof(VulkanGpuLight) * count);
+    mFrames[frame].lightCount = count;
+    return count;
+}
+
+auto VulkanClusteredLighting::recordCulling(VkCommandBuffer commandBuffer, const uint32_t frame, const glm::mat4& view, const glm::mat4& projection, const float nearPlane, const float farPlane) -> void {
+    // the fragment shaders of the last frame have to be done with the clusters before they are written again
+    VkMemoryBarrier barrier{};
+    barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    barrier.srcAccessMask = 0;
+    barrier.dstAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+    vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 1, &barrier, 0, nullptr, 0, nullptr);
+
+    const auto& slot = mFrames[frame];
+    const ClusterPushConstants pushConstants{.view = view, .projection = glm::vec4(projection[0][0], projection[1][1], nearPlane, farPlane), .lightCount = slot.lightCount};
+
+    vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, mPipeline);
+    vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, mPipelineLayout, 0, 1, &slot.set, 0, nullptr);
+    vkCmdPushConstants(commandBuffer, mPipelineLayout, VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(pushConstants), &pushConstants);
+    vkCmdDispatch(commandBuffer, (CLUSTER_COUNT + CLUSTER_GROUP_SIZE - 1) / CLUSTER_GROUP_SIZE, 1, 1);
+
+    barrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+    vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0, 1, &barrier, 0, nullptr, 0, nullptr);
+}
+
+auto VulkanClusteredLighting::getDepthSliceParameters(const float nearPlane, const float farPlane) -> glm::vec2 {
+    // slice = log(depth / near) / log(far / near) * CLUSTER_GRID_Z
+    const float scale = static_cast<float>(CLUSTER_GRID_Z) / std::log(farPlane / nearPlane);
+    return {scale, -scale * std::log(nearPlane)};
+}
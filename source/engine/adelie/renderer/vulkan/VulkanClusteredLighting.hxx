@@ -0,0 +1,102 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#if !defined(__ADELIE_RENDERER_VULKAN_VULKANCLUSTEREDLIGHTING_HXX__)
+    #define __ADELIE_RENDERER_VULKAN_VULKANCLUSTEREDLIGHTING_HXX__
+
+    #include <vulkan/vulkan.h>
+
+    #include <adelie/adelie.hxx>
+    #include <adelie/renderer/vulkan/VulkanDeletionQueue.hxx>
+    #include <cstdint>
+    #include <span>
+    #include <vector>
+
+namespace adelie::renderer::vulkan {
+
+    // the view frustum is split into this many clusters, the depth slices are exponential. The numbers are repeated by
+    // light_cluster.comp and cube.frag
+    static inline constexpr uint32_t CLUSTER_GRID_X = 16;
+    static inline constexpr uint32_t CLUSTER_GRID_Y = 9;
+    static inline constexpr uint32_t CLUSTER_GRID_Z = 24;
+    static inline constexpr uint32_t CLUSTER_COUNT = CLUSTER_GRID_X * CLUSTER_GRID_Y * CLUSTER_GRID_Z;
+
+    // the lights beyond these limits are dropped, for the whole frame or for a single cluster
+    static inline constexpr uint32_t CLUSTER_MAX_LIGHTS = 1024;
+    static inline constexpr uint32_t CLUSTER_MAX_LIGHTS_PER_CLUSTER = 128;
+
+    // a point light as seen by the shaders (std430)
+    struct ADELIE_API VulkanGpuLight {
+            glm::vec4 positionRange;   // world space position and range
+            glm::vec4 colorIntensity;  // color and intensity
+    }; /* struct VulkanGpuLight */
+
+    // bins the lights of a frame into the clusters of the view frustum on the GPU, so the fragment shader only visits
+    // the lights which can reach its cluster instead of all of them. Every cluster keeps the indices of its lights in a
+    // fixed slot of the index buffer, so the binning needs no atomics and no second pass
+    class ADELIE_API VulkanClusteredLighting {
+        public:
+            VulkanClusteredLighting(VkDevice device, VkPhysicalDevice physicalDevice, VulkanDeletionQueue& deletionQueue);
+
+            ~VulkanClusteredLighting() noexcept;
+
+            VulkanClusteredLighting(const VulkanClusteredLighting&) = delete;
+
+            auto operator=(VulkanClusteredLighting const&) -> VulkanClusteredLighting& = delete;
+
+            VulkanClusteredLighting(VulkanClusteredLighting&&) = delete;
+
+            auto operator=(VulkanClusteredLighting&&) -> VulkanClusteredLighting& = delete;
+
+            // (re)creates the buffers of every frame slot, the replaced ones are retired after lastUsedFrame
+            auto resize(uint32_t frameCount, uint64_t lastUsedFrame) -> void;
+
+            // render thread: the lights of the frame slot, which must not be in use by the GPU anymore. Returns the
+            // number of lights which fit into the buffer
+            auto writeLights(uint32_t frame, std::span<const VulkanGpuLight> lights) -> uint32_t;
+
+            // render thread: bin the lights of the frame slot, recorded outside of a render pass before the fragment
+            // shaders read the clusters
+            auto recordCulling(VkCommandBuffer commandBuffer, uint32_t frame, const glm::mat4& view, const glm::mat4& projection, float nearPlane, float farPlane) -> void;
+
+            // the scale and bias which map the logarithm of the view depth to the depth slice
+            [[nodiscard]] static auto getDepthSliceParameters(float nearPlane, float farPlane) -> glm::vec2;
+
+            [[nodiscard]] auto getLightBuffer(const uint32_t frame) const -> VkBuffer { return mFrames[frame].lightBuffer; }
+
+            [[nodiscard]] auto getClusterCountBuffer() const -> VkBuffer { return mClusterCountBuffer; }
+
+            [[nodiscard]] auto getClusterIndexBuffer() const -> VkBuffer { return mClusterIndexBuffer; }
+
+        private:
+            struct Frame {
+                    VkBuffer lightBuffer;
+                    VkDeviceMemory lightMemory;
+                    VulkanGpuLight* lights;  // persistently mapped
+                    VkDescriptorSet set;
+                    uint32_t lightCount;
+            };
+
+            auto createPipeline() -> void;
+            auto retire(uint64_t lastUsedFrame) -> void;
+
+            VkDevice mDevice;
+            VkPhysicalDevice mPhysicalDevice;
+            VulkanDeletionQueue& mDeletionQueue;
+
+            VkDescriptorSetLayout mSetLayout;
+            VkPipelineLayout mPipelineLayout;
+            VkPipeline mPipeline;
+
+            // written by the binning and read by the fragment shaders of the same frame, so every frame uses them
+            VkBuffer mClusterCountBuffer;  // the number of lights of every cluster
+            VkDeviceMemory mClusterCountMemory;
+            VkBuffer mClusterIndexBuffer;  // CLUSTER_MAX_LIGHTS_PER_CLUSTER light indices for every cluster
+            VkDeviceMemory mClusterIndexMemory;
+            std::vector<Frame> mFrames;
+            VkDescriptorPool mDescriptorPool;
+
+    }; /* class VulkanClusteredLighting */
+
+} /* namespace adelie::renderer::vulkan */
+
+#endif /* if !defined(__ADELIE_RENDERER_VULKAN_VULKANCLUSTEREDLIGHTING_HXX__) */
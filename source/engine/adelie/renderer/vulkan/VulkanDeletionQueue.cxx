@@ -0,0 +1,167 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#include <vulkan/vk_enum_string_helper.h>
+
+#include <adelie/io/Logger.hxx>
+#include <adelie/renderer/vulkan/VulkanDeletionQueue.hxx>
+#include <type_traits>
+
+using adelie::renderer::vulkan::VulkanDeletionQueue;
+
+namespace {
+    // non-dispatchable handles are pointers on 64-bit platforms and plain integers on 32-bit platforms
+    template <typename T>
+    auto toHandle(const uint64_t value) -> T {
+        if constexpr (std::is_pointer_v<T>) {
+            return reinterpret_cast<T>(value);
+        } else {
+            return static_cast<T>(value);
+        }
+    }
+
+    template <typename T>
+    auto fromHandle(const T handle) -> uint64_t {
+        if constexpr (std::is_pointer_v<T>) {
+            return reinterpret_cast<uint64_t>(handle);
+        } else {
+            return static_cast<uint64_t>(handle);
+        }
+    }
+}  // namespace
+
+VulkanDeletionQueue::VulkanDeletionQueue(VkDevice device) {
+    mDevice = device;
+}
+
+VulkanDeletionQueue::~VulkanDeletionQueue() noexcept {
+    flush();
+}
+
+auto VulkanDeletionQueue::retireBuffer(VkBuffer buffer, VkDeviceMemory memory, const uint64_t lastUsedFrame) -> void {
+    retire(VK_OBJECT_TYPE_BUFFER, fromHandle(buffer), fromHandle(memory), lastUsedFrame);
+}
+
+auto VulkanDeletionQueue::retireImage(VkImage image, VkDeviceMemory memory, const uint64_t lastUsedFrame) -> void {
+    retire(VK_OBJECT_TYPE_IMAGE, fromHandle(image), fromHandle(memory), lastUsedFrame);
+}
+
+auto VulkanDeletionQueue::retireImageView(VkImageView imageView, const uint64_t lastUsedFrame) -> void {
+    retire(VK_OBJECT_TYPE_IMAGE_VIEW, fromHandle(imageView), 0, lastUsedFrame);
+}
+
+auto VulkanDeletionQueue::retireSampler(VkSampler sampler, const uint64_t lastUsedFrame) -> void {
+    retire(VK_OBJECT_TYPE_SAMPLER, fromHandle(sampler), 0, lastUsedFrame);
+}
+
+auto VulkanDeletionQueue::retireFramebuffer(VkFramebuffer framebuffer, const uint64_t lastUsedFrame) -> void {
+    retire(VK_OBJECT_TYPE_FRAMEBUFFER, fromHandle(framebuffer), 0, lastUsedFrame);
+}
+
+auto VulkanDeletionQueue::retirePipeline(VkPipeline pipeline, const uint64_t lastUsedFrame) -> void {
+    retire(VK_OBJECT_TYPE_PIPELINE, fromHandle(pipeline), 0, lastUsedFrame);
+}
+
+auto VulkanDeletionQueue::retirePipelineLayout(VkPipelineLayout pipelineLayout, const uint64_t lastUsedFrame) -> void {
+    retire(VK_OBJECT_TYPE_PIPELINE_LAYOUT, fromHandle(pipelineLayout), 0, lastUsedFrame);
+}
+
+auto VulkanDeletionQueue::retireRenderPass(VkRenderPass renderPass, const uint64_t lastUsedFrame) -> void {
+    retire(VK_OBJECT_TYPE_RENDER_PASS, fromHandle(renderPass), 0, lastUsedFrame);
+}
+
+auto VulkanDeletionQueue::retireDescriptorPool(VkDescriptorPool descriptorPool, const uint64_t lastUsedFrame) -> void {
+    retire(VK_OBJECT_TYPE_DESCRIPTOR_POOL, fromHandle(descriptorPool), 0, lastUsedFrame);
+}
+
+auto VulkanDeletionQueue::retireCommandBuffer(VkCommandPool commandPool, VkCommandBuffer commandBuffer, const uint64_t lastUsedFrame) -> void {
+    retire(VK_OBJECT_TYPE_COMMAND_BUFFER, fromHandle(commandBuffer), fromHandle(commandPool), lastUsedFrame);
+}
+
+auto VulkanDeletionQueue::retireSwapchain(VkSwapchainKHR swapchain, const uint64_t lastUsedFrame) -> void {
+    retire(VK_OBJECT_TYPE_SWAPCHAIN_KHR, fromHandle(swapchain), 0, lastUsedFrame);
+}
+
+auto VulkanDeletionQueue::retire(const VkObjectType type, const uint64_t handle, const uint64_t ownerHandle, const uint64_t lastUsedFrame) -> void {
+    if (0 == handle) {
+        return;
+    }
+
+    std::scoped_lock lock(mRetiredObjectsMutex);
+    mRetiredObjects.push_back({.lastUsedFrame = lastUsedFrame, .type = type, .handle = handle, .ownerHandle = ownerHandle});
+}
+
+auto VulkanDeletionQueue::collect(const uint64_t completedFrame) -> void {
+    std::scoped_lock lock(mRetiredObjectsMutex);
+
+    // objects are retired in submission order, so we can stop at the first one which is still in use
+    while (!mRetiredObjects.empty() && mRetiredObjects.front().lastUsedFrame <= completedFrame) {
+        destroy(mRetiredObjects.front());
+        mRetiredObjects.pop_front();
+    }
+}
+
+auto VulkanDeletionQueue::flush() -> void {
+    std::scoped_lock lock(mRetiredObjectsMutex);
+
+    if (!mRetiredObjects.empty()) {
+        AdelieLogTrace("  destroying {} retired Vulkan object(s)", mRetiredObjects.size());
+    }
+
+    for (const auto& object : mRetiredObjects) {
+        destroy(object);
+    }
+    mRetiredObjects.clear();
+}
+
+auto VulkanDeletionQueue::getPendingCount() -> size_t {
+    std::scoped_lock lock(mRetiredObjectsMutex);
+    return mRetiredObjects.size();
+}
+
+auto VulkanDeletionQueue::destroy(const RetiredObject& object) const -> void {
+    switch (object.type) {
+        case VK_OBJECT_TYPE_BUFFER:
+            vkDestroyBuffer(mDevice, toHandle<VkBuffer>(object.handle), nullptr);
+            if (0 != object.ownerHandle) {
+                vkFreeMemory(mDevice, toHandle<VkDeviceMemory>(object.ownerHandle), nullptr);
+            }
+            break;
+        case VK_OBJECT_TYPE_IMAGE:
+            vkDestroyImage(mDevice, toHandle<VkImage>(object.handle), nullptr);
+            if (0 != object.ownerHandle) {
+                vkFreeMemory(mDevice, toHandle<VkDeviceMemory>(object.ownerHandle), nullptr);
+            }
+            break;
+        case VK_OBJECT_TYPE_IMAGE_VIEW:
+            vkDestroyImageView(mDevice, toHandle<VkImageView>(object.handle), nullptr);
+            break;
+        case VK_OBJECT_TYPE_SAMPLER:
+            vkDestroySampler(mDevice, toHandle<VkSampler>(object.handle), nullptr);
+            break;
+        case VK_OBJECT_TYPE_FRAMEBUFFER:
+            vkDestroyFramebuffer(mDevice, toHandle<VkFramebuffer>(object.handle), nullptr);
+            break;
+        case VK_OBJECT_TYPE_PIPELINE:
+            vkDestroyPipeline(mDevice, toHandle<VkPipeline>(object.handle), nullptr);
+            break;
+        case VK_OBJECT_TYPE_PIPELINE_LAYOUT:
+            vkDestroyPipelineLayout(mDevice, toHandle<VkPipelineLayout>(object.handle), nullptr);
+            break;
+        case VK_OBJECT_TYPE_RENDER_PASS:
+            vkDestroyRenderPass(mDevice, toHandle<VkRenderPass>(object.handle), nullptr);
+            break;
+        case VK_OBJECT_TYPE_DESCRIPTOR_POOL:
+            vkDestroyDescriptorPool(mDevice, toHandle<VkDescriptorPool>(object.handle), nullptr);
+            break;
+        case VK_OBJECT_TYPE_COMMAND_BUFFER: {
+            const auto commandBuffer = toHandle<VkCommandBuffer>(object.handle);
+            vkFreeCommandBuffers(mDevice, toHandle<VkCommandPool>(object.ownerHandle), 1, &commandBuffer);
+        } break;
+        case VK_OBJECT_TYPE_SWAPCHAIN_KHR:
+            vkDestroySwapchainKHR(mDevice, toHandle<VkSwapchainKHR>(object.handle), nullptr);
+            break;
+        default:
+            AdelieLogError("Cannot destroy retired object of unsupported type {}", string_VkObjectType(object.type));
+            break;
+    }
+}
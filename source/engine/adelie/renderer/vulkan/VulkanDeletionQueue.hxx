@@ -0,0 +1,82 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#if !defined(__ADELIE_RENDERER_VULKAN_VULKANDELETIONQUEUE_HXX__)
+    #define __ADELIE_RENDERER_VULKAN_VULKANDELETIONQUEUE_HXX__
+
+    #include <vulkan/vulkan.h>
+
+    #include <adelie/adelie.hxx>
+    #include <cstdint>
+    #include <deque>
+    #include <mutex>
+
+namespace adelie::renderer::vulkan {
+
+    // objects which are retired are tagged with the number of the last frame which might still use them and are only
+    // destroyed once the GPU signaled that frame on the frame timeline. This way resources can be replaced while frames
+    // are in flight without waiting for the whole device to become idle
+    class ADELIE_API VulkanDeletionQueue {
+        public:
+            explicit VulkanDeletionQueue(VkDevice device);
+
+            ~VulkanDeletionQueue() noexcept;
+
+            VulkanDeletionQueue(const VulkanDeletionQueue&) = delete;
+
+            auto operator=(VulkanDeletionQueue const&) -> VulkanDeletionQueue& = delete;
+
+            VulkanDeletionQueue(VulkanDeletionQueue&&) = delete;
+
+            auto operator=(VulkanDeletionQueue&&) -> VulkanDeletionQueue& = delete;
+
+            auto retireBuffer(VkBuffer buffer, VkDeviceMemory memory, uint64_t lastUsedFrame) -> void;
+
+            auto retireImage(VkImage image, VkDeviceMemory memory, uint64_t lastUsedFrame) -> void;
+
+            auto retireImageView(VkImageView imageView, uint64_t lastUsedFrame) -> void;
+
+            auto retireSampler(VkSampler sampler, uint64_t lastUsedFrame) -> void;
+
+            auto retireFramebuffer(VkFramebuffer framebuffer, uint64_t lastUsedFrame) -> void;
+
+            auto retirePipeline(VkPipeline pipeline, uint64_t lastUsedFrame) -> void;
+
+            auto retirePipelineLayout(VkPipelineLayout pipelineLayout, uint64_t lastUsedFrame) -> void;
+
+            auto retireRenderPass(VkRenderPass renderPass, uint64_t lastUsedFrame) -> void;
+
+            auto retireDescriptorPool(VkDescriptorPool descriptorPool, uint64_t lastUsedFrame) -> void;
+
+            auto retireCommandBuffer(VkCommandPool commandPool, VkCommandBuffer commandBuffer, uint64_t lastUsedFrame) -> void;
+
+            auto retireSwapchain(VkSwapchainKHR swapchain, uint64_t lastUsedFrame) -> void;
+
+            // destroy all objects whose last frame was already completed by the GPU
+            auto collect(uint64_t completedFrame) -> void;
+
+            // destroy all objects regardless of their frame, the caller has to ensure the device is idle
+            auto flush() -> void;
+
+            [[nodiscard]] auto getPendingCount() -> size_t;
+
+        private:
+            struct RetiredObject {
+                    uint64_t lastUsedFrame;
+                    VkObjectType type;
+                    uint64_t handle;
+                    uint64_t ownerHandle;  // the memory bound to a buffer / image or the pool of a command buffer
+            };
+
+            auto retire(VkObjectType type, uint64_t handle, uint64_t ownerHandle, uint64_t lastUsedFrame) -> void;
+
+            auto destroy(const RetiredObject& object) const -> void;
+
+            VkDevice mDevice;
+            std::mutex mRetiredObjectsMutex;
+            std::deque<RetiredObject> mRetiredObjects;
+
+    }; /* class VulkanDeletionQueue */
+
+} /* namespace adelie::renderer::vulkan */
+
+#endif /* if !defined(__ADELIE_RENDERER_VULKAN_VULKANDELETIONQUEUE_HXX__) */
@@ -8,6 +8,7 @@
 #include <algorithm>
 #include <boost/algorithm/string/join.hpp>
 #include <set>
+#include <string_view>
 
 using adelie::core::renderer::WindowFactory;
 using adelie::core::renderer::WindowType;
@@ -155,4 +156,14 @@ bool VulkanExtensionManager::checkDeviceExtensionSupport(VkPhysicalDevice device
     }
 
     return requiredExtensionSet.empty();
-}
\ No newline at end of file
+}
+
+auto VulkanExtensionManager::isDeviceExtensionSupported(VkPhysicalDevice device, const char* extensionName) -> bool {
+    uint32_t extensionCount;
+    vkEnumerateDeviceExtensionProperties(device, nullptr, &extensionCount, nullptr);
+
+    std::vector<VkExtensionProperties> availableExtensions(extensionCount);
+    vkEnumerateDeviceExtensionProperties(device, nullptr, &extensionCount, availableExtensions.data());
+
+    return std::ranges::any_of(availableExtensions, [extensionName](const auto& extension) { return std::string_view(extension.extensionName) == extensionName; });
+}
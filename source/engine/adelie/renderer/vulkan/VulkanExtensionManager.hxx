@@ -17,6 +17,7 @@ namespace adelie::renderer::vulkan {
             static std::vector<const char*> getRequiredDeviceExtensions();
             static std::vector<const char*> getEnabledExtensions(const std::vector<VkExtensionProperties>& availableExtensions, const std::vector<const char*>& requiredExtensions, const std::string& extensionType);
             static bool checkDeviceExtensionSupport(VkPhysicalDevice device);
+            static auto isDeviceExtensionSupported(VkPhysicalDevice device, const char* extensionName) -> bool;
     }; /* class VulkanExtensionManager */
 
 } /* namespace adelie::renderer::vulkan */
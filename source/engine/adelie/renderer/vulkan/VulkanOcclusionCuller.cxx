@@ -0,0 +1,507 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#include <adelie/exception/VulkanRuntimeException.hxx>
+#include <adelie/io/Logger.hxx>
+#include <adelie/io/VirtualFileSystem.hxx>
+#include <adelie/renderer/vulkan/VulkanBufferManager.hxx>
+#include <adelie/renderer/vulkan/VulkanOcclusionCuller.hxx>
+#include <adelie/renderer/vulkan/VulkanShaderManager.hxx>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <format>
+#include <string>
+
+using adelie::exception::VulkanRuntimeException;
+using adelie::io::VirtualFileSystem;
+using adelie::renderer::vulkan::VulkanBufferManager;
+using adelie::renderer::vulkan::VulkanGpuInstance;
+using adelie::renderer::vulkan::VulkanOcclusionCuller;
+using adelie::renderer::vulkan::VulkanShaderManager;
+
+namespace {
+    constexpr uint32_t PYRAMID_GROUP_SIZE = 8;
+    constexpr uint32_t CULL_GROUP_SIZE = 64;
+
+    struct PyramidPushConstants {
+            uint32_t sourceWidth;
+            uint32_t sourceHeight;
+            uint32_t destinationWidth;
+            uint32_t destinationHeight;
+    };
+
+    struct CullPushConstants {
+            glm::mat4 viewProjection;
+            glm::vec2 pyramidSize;
+            uint32_t instanceCount;
+            uint32_t phase;
+            uint32_t levelCount;
+            uint32_t commandOffset;
+    };
+
+    auto createSetLayout(VkDevice device, const std::span<const VkDescriptorSetLayoutBinding> bindings) -> VkDescriptorSetLayout {
+        VkDescriptorSetLayoutCreateInfo layoutInfo{};
+        layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+        layoutInfo.bindingCount = static_cast<uint32_t>(bindings.size());
+        layoutInfo.pBindings = bindings.data();
+
+        VkDescriptorSetLayout layout = VK_NULL_HANDLE;
+        if (const auto result = vkCreateDescriptorSetLayout(device, &layoutInfo, nullptr, &layout); result != VK_SUCCESS) {
+            throw VulkanRuntimeException("Failed to create occlusion culling descriptor set layout", result);
+        }
+        return layout;
+    }
+
+    auto createPipelineLayout(VkDevice device, VkDescriptorSetLayout setLayout, const uint32_t pushConstantSize) -> VkPipelineLayout {
+        VkPushConstantRange pushConstantRange{};
+        pushConstantRange.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+        pushConstantRange.offset = 0;
+        pushConstantRange.size = pushConstantSize;
+
+        VkPipelineLayoutCreateInfo pipelineLayoutInfo{};
+        pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+        pipelineLayoutInfo.setLayoutCount = 1;
+        pipelineLayoutInfo.pSetLayouts = &setLayout;
+        pipelineLayoutInfo.pushConstantRangeCount = 1;
+        pipelineLayoutInfo.pPushConstantRanges = &pushConstantRange;
+
+        VkPipelineLayout layout = VK_NULL_HANDLE;
+        if (const auto result = vkCreatePipelineLayout(device, &pipelineLayoutInfo, nullptr, &layout); result != VK_SUCCESS) {
+            throw VulkanRuntimeException("Failed to create occlusion culling pipeline layout", result);
+        }
+        return layout;
+    }
+
+    auto createComputePipeline(VkDevice device, VkPipelineLayout layout, const std::string& filename) -> VkPipeline {
+        const auto code = VirtualFileSystem::getInstance()->read(filename);
+        const auto shaderModule = VulkanShaderManager::createShaderModule(device, code->getData());
+
+        VkComputePipelineCreateInfo pipelineInfo{};
+        pipelineInfo.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+        pipelineInfo.stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+        pipelineInfo.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+        pipelineInfo.stage.module = shaderModule;
+        pipelineInfo.stage.pName = "main";
+        pipelineInfo.layout = layout;
+
+        VkPipeline pipeline = VK_NULL_HANDLE;
+        const auto result = vkCreateComputePipelines(device, VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &pipeline);
+        vkDestroyShaderModule(device, shaderModule, nullptr);
+        if (result != VK_SUCCESS) {
+            throw VulkanRuntimeException(std::format("Failed to create compute pipeline from {}", filename), result);
+        }
+        return pipeline;
+    }
+
+    auto recordMemoryBarrier(VkCommandBuffer commandBuffer, const VkPipelineStageFlags srcStage, const VkAccessFlags srcAccess, const VkPipelineStageFlags dstStage, const VkAccessFlags dstAccess) -> void {
+        VkMemoryBarrier barrier{};
+        barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        barrier.srcAccessMask = srcAccess;
+        barrier.dstAccessMask = dstAccess;
+        vkCmdPipelineBarrier(commandBuffer, srcStage, dstStage, 0, 1, &barrier, 0, nullptr, 0, nullptr);
+    }
+}  // namespace
+
+VulkanOcclusionCuller::VulkanOcclusionCuller(VkDevice device, VkPhysicalDevice physicalDevice, VulkanDeletionQueue& deletionQueue) : mDeletionQueue(deletionQueue) {
+    mDevice = device;
+    mPhysicalDevice = physicalDevice;
+    mPyramidSetLayout = VK_NULL_HANDLE;
+    mPyramidPipelineLayout = VK_NULL_HANDLE;
+    mPyramidPipeline = VK_NULL_HANDLE;
+    mCullSetLayout = VK_NULL_HANDLE;
+    mCullPipelineLayout = VK_NULL_HANDLE;
+    mCullPipeline = VK_NULL_HANDLE;
+    mSampler = VK_NULL_HANDLE;
+    mDepthExtent = {.width = 0, .height = 0};
+    mPyramidExtent = {.width = 0, .height = 0};
+    mPyramidLevels = 0;
+    mPyramidImage = VK_NULL_HANDLE;
+    mPyramidMemory = VK_NULL_HANDLE;
+    mPyramidView = VK_NULL_HANDLE;
+    mVisibilityBuffer = VK_NULL_HANDLE;
+    mVisibilityMemory = VK_NULL_HANDLE;
+    mVisibilityCleared = false;
+    mDescriptorPool = VK_NULL_HANDLE;
+
+    createPipelines();
+}
+
+VulkanOcclusionCuller::~VulkanOcclusionCuller() noexcept {
+    // the caller ensures the device is idle and flushes the deletion queue afterwards
+    retire(0);
+    mDeletionQueue.retirePipeline(mCullPipeline, 0);
+    mDeletionQueue.retirePipelineLayout(mCullPipelineLayout, 0);
+    mDeletionQueue.retirePipeline(mPyramidPipeline, 0);
+    mDeletionQueue.retirePipelineLayout(mPyramidPipelineLayout, 0);
+    mDeletionQueue.retireSampler(mSampler, 0);
+    vkDestroyDescriptorSetLayout(mDevice, mCullSetLayout, nullptr);
+    vkDestroyDescriptorSetLayout(mDevice, mPyramidSetLayout, nullptr);
+}
+
+auto VulkanOcclusionCuller::createPipelines() -> void {
+    // the reduction reads the previous level (or the depth buffer) and writes the next one
+    std::array<VkDescriptorSetLayoutBinding, 2> pyramidBindings{};
+    pyramidBindings[0].binding = 0;
+    pyramidBindings[0].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+    pyramidBindings[0].descriptorCount = 1;
+    pyramidBindings[0].stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+    pyramidBindings[1].binding = 1;
+    pyramidBindings[1].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+    pyramidBindings[1].descriptorCount = 1;
+    pyramidBindings[1].stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+    mPyramidSetLayout = createSetLayout(mDevice, pyramidBindings);
+    mPyramidPipelineLayout = createPipelineLayout(mDevice, mPyramidSetLayout, sizeof(PyramidPushConstants));
+    mPyramidPipeline = createComputePipeline(mDevice, mPyramidPipelineLayout, "shader/depth_pyramid.comp.spv");
+
+    // instances, draw commands, visibility and the depth pyramid
+    std::array<VkDescriptorSetLayoutBinding, 4> cullBindings{};
+    for (uint32_t binding = 0; binding < 3; binding++) {
+        cullBindings[binding].binding = binding;
+        cullBindings[binding].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        cullBindings[binding].descriptorCount = 1;
+        cullBindings[binding].stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+    }
+    cullBindings[3].binding = 3;
+    cullBindings[3].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+    cullBindings[3].descriptorCount = 1;
+    cullBindings[3].stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+    mCullSetLayout = createSetLayout(mDevice, cullBindings);
+    mCullPipelineLayout = createPipelineLayout(mDevice, mCullSetLayout, sizeof(CullPushConstants));
+    mCullPipeline = createComputePipeline(mDevice, mCullPipelineLayout, "shader/occlusion_cull.comp.spv");
+
+    // the shaders only fetch single texels, the sampler is required by the descriptor type
+    VkSamplerCreateInfo samplerInfo{};
+    samplerInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+    samplerInfo.magFilter = VK_FILTER_NEAREST;
+    samplerInfo.minFilter = VK_FILTER_NEAREST;
+    samplerInfo.mipmapMode = VK_SAMPLER_MIPMAP_MODE_NEAREST;
+    samplerInfo.addressModeU = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+    samplerInfo.addressModeV = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+    samplerInfo.addressModeW = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+    samplerInfo.minLod = 0.0f;
+    samplerInfo.maxLod = VK_LOD_CLAMP_NONE;
+
+    if (const auto result = vkCreateSampler(mDevice, &samplerInfo, nullptr, &mSampler); result != VK_SUCCESS) {
+        throw VulkanRuntimeException("Failed to create depth pyramid sampler", result);
+    }
+}
+
+auto VulkanOcclusionCuller::resize(VkImageView depthImageView, const VkExtent2D extent, const uint32_t frameCount, const uint64_t lastUsedFrame) -> void {
+    retire(lastUsedFrame);
+    createPyramid(extent);
+    createFrames(frameCount);
+    createDescriptorSets(depthImageView);
+    AdelieLogDebug("Created a depth pyramid of {}x{} with {} levels for {} frames", mPyramidExtent.width, mPyramidExtent.height, mPyramidLevels, frameCount);
+}
+
+auto VulkanOcclusionCuller::createPyramid(const VkExtent2D extent) -> void {
+    // the first level is the largest power of two which fits into the depth buffer, so every following level is
+    // exactly half of the previous one and a texel of the first level covers at most 2x2 depth texels plus a border
+    mDepthExtent = extent;
+    mPyramidExtent = {.width = std::bit_floor(std::max(extent.width, 1U)), .height = std::bit_floor(std::max(extent.height, 1U))};
+    mPyramidLevels = static_cast<uint32_t>(std::bit_width(std::max(mPyramidExtent.width, mPyramidExtent.height)));
+
+    VkImageCreateInfo imageInfo{};
+    imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+    imageInfo.imageType = VK_IMAGE_TYPE_2D;
+    imageInfo.extent.width = mPyramidExtent.width;
+    imageInfo.extent.height = mPyramidExtent.height;
+    imageInfo.extent.depth = 1;
+    imageInfo.mipLevels = mPyramidLevels;
+    imageInfo.arrayLayers = 1;
+    imageInfo.format = VK_FORMAT_R32_SFLOAT;
+    imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+    imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    imageInfo.usage = VK_IMAGE_USAGE_STORAGE_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+    imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+
+    if (const auto result = vkCreateImage(mDevice, &imageInfo, nullptr, &mPyramidImage); result != VK_SUCCESS) {
+        throw VulkanRuntimeException("Failed to create depth pyramid image", result);
+    }
+
+    VkMemoryRequirements memRequirements;
+    vkGetImageMemoryRequirements(mDevice, mPyramidImage, &memRequirements);
+
+    VkMemoryAllocateInfo allocInfo{};
+    allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    allocInfo.allocationSize = memRequirements.size;
+    allocInfo.memoryTypeIndex = VulkanBufferManager::findMemoryType(mPhysicalDevice, memRequirements.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+    if (const auto result = vkAllocateMemory(mDevice, &allocInfo, nullptr, &mPyramidMemory); result != VK_SUCCESS) {
+        throw VulkanRuntimeException("Failed to allocate depth pyramid memory", result);
+    }
+    vkBindImageMemory(mDevice, mPyramidImage, mPyramidMemory, 0);
+
+    VkImageViewCreateInfo viewInfo{};
+    viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+    viewInfo.image = mPyramidImage;
+    viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+    viewInfo.format = VK_FORMAT_R32_SFLOAT;
+    viewInfo.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    viewInfo.subresourceRange.baseMipLevel = 0;
+    viewInfo.subresourceRange.levelCount = mPyramidLevels;
+    viewInfo.subresourceRange.baseArrayLayer = 0;
+    viewInfo.subresourceRange.layerCount = 1;
+
+    if (const auto result = vkCreateImageView(mDevice, &viewInfo, nullptr, &mPyramidView); result != VK_SUCCESS) {
+        throw VulkanRuntimeException("Failed to create depth pyramid image view", result);
+    }
+
+    mPyramidLevelViews.resize(mPyramidLevels);
+    for (uint32_t level = 0; level < mPyramidLevels; level++) {
+        viewInfo.subresourceRange.baseMipLevel = level;
+        viewInfo.subresourceRange.levelCount = 1;
+        if (const auto result = vkCreateImageView(mDevice, &viewInfo, nullptr, &mPyramidLevelViews[level]); result != VK_SUCCESS) {
+            throw VulkanRuntimeException("Failed to create depth pyramid level view", result);
+        }
+    }
+}
+
+auto VulkanOcclusionCuller::createFrames(const uint32_t frameCount) -> void {
+    const VkDeviceSize instanceSize = getInstanceBufferSize();
+    const VkDeviceSize indirectSize = sizeof(VkDrawIndexedIndirectCommand) * OCCLUSION_MAX_INSTANCES * 2;
+
+    mFrames.resize(frameCount);
+    for (auto& frame : mFrames) {
+        VulkanBufferManager::createBuffer(mDevice, mPhysicalDevice, instanceSize, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                                          frame.instanceBuffer, frame.instanceMemory);
+        void* data;
+        vkMapMemory(mDevice, frame.instanceMemory, 0, instanceSize, 0, &data);
+        frame.instances = static_cast<VulkanGpuInstance*>(data);
+
+        VulkanBufferManager::createBuffer(mDevice, mPhysicalDevice, indirectSize, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+                                          frame.indirectBuffer, frame.indirectMemory);
+        frame.cullSet = VK_NULL_HANDLE;
+        frame.instanceCount = 0;
+    }
+
+    VulkanBufferManager::createBuffer(mDevice, mPhysicalDevice, sizeof(uint32_t) * OCCLUSION_MAX_INSTANCES, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                                      VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, mVisibilityBuffer, mVisibilityMemory);
+    mVisibilityCleared = false;
+}
+
+auto VulkanOcclusionCuller::createDescriptorSets(VkImageView depthImageView) -> void {
+    const auto frameCount = static_cast<uint32_t>(mFrames.size());
+
+    std::array<VkDescriptorPoolSize, 3> poolSizes{};
+    poolSizes[0].type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+    poolSizes[0].descriptorCount = mPyramidLevels + frameCount;
+    poolSizes[1].type = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+    poolSizes[1].descriptorCount = mPyramidLevels;
+    poolSizes[2].type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    poolSizes[2].descriptorCount = 3 * frameCount;
+
+    VkDescriptorPoolCreateInfo poolInfo{};
+    poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+    poolInfo.poolSizeCount = static_cast<uint32_t>(poolSizes.size());
+    poolInfo.pPoolSizes = poolSizes.data();
+    poolInfo.maxSets = mPyramidLevels + frameCount;
+
+    if (const auto result = vkCreateDescriptorPool(mDevice, &poolInfo, nullptr, &mDescriptorPool); result != VK_SUCCESS) {
+        throw VulkanRuntimeException("Failed to create occlusion culling descriptor pool", result);
+    }
+
+    std::vector<VkDescriptorSetLayout> layouts(mPyramidLevels, mPyramidSetLayout);
+    layouts.insert(layouts.end(), frameCount, mCullSetLayout);
+    std::vector<VkDescriptorSet> sets(layouts.size());
+
+    VkDescriptorSetAllocateInfo allocInfo{};
+    allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    allocInfo.descriptorPool = mDescriptorPool;
+    allocInfo.descriptorSetCount = static_cast<uint32_t>(layouts.size());
+    allocInfo.pSetLayouts = layouts.data();
+
+    if (const auto result = vkAllocateDescriptorSets(mDevice, &allocInfo, sets.data()); result != VK_SUCCESS) {
+        throw VulkanRuntimeException("Failed to allocate occlusion culling descriptor sets", result);
+    }
+    mPyramidSets.assign(sets.begin(), sets.begin() + mPyramidLevels);
+
+    for (uint32_t level = 0; level < mPyramidLevels; level++) {
+        VkDescriptorImageInfo sourceInfo{};
+        sourceInfo.sampler = mSampler;
+        sourceInfo.imageView = 0 == level ? depthImageView : mPyramidLevelViews[level - 1];
+        sourceInfo.imageLayout = 0 == level ? VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL : VK_IMAGE_LAYOUT_GENERAL;
+
+        VkDescriptorImageInfo destinationInfo{};
+        destinationInfo.imageView = mPyramidLevelViews[level];
+        destinationInfo.imageLayout = VK_IMAGE_LAYOUT_GENERAL;
+
+        std::array<VkWriteDescriptorSet, 2> descriptorWrites{};
+        descriptorWrites[0].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        descriptorWrites[0].dstSet = mPyramidSets[level];
+        descriptorWrites[0].dstBinding = 0;
+        descriptorWrites[0].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        descriptorWrites[0].descriptorCount = 1;
+        descriptorWrites[0].pImageInfo = &sourceInfo;
+        descriptorWrites[1].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        descriptorWrites[1].dstSet = mPyramidSets[level];
+        descriptorWrites[1].dstBinding = 1;
+        descriptorWrites[1].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+        descriptorWrites[1].descriptorCount = 1;
+        descriptorWrites[1].pImageInfo = &destinationInfo;
+        vkUpdateDescriptorSets(mDevice, static_cast<uint32_t>(descriptorWrites.size()), descriptorWrites.data(), 0, nullptr);
+    }
+
+    for (uint32_t i = 0; i < frameCount; i++) {
+        auto& frame = mFrames[i];
+        frame.cullSet = sets[mPyramidLevels + i];
+
+        const std::array<VkDescriptorBufferInfo, 3> bufferInfos = {VkDescriptorBufferInfo{.buffer = frame.instanceBuffer, .offset = 0, .range = VK_WHOLE_SIZE},
+                                                                   VkDescriptorBufferInfo{.buffer = frame.indirectBuffer, .offset = 0, .range = VK_WHOLE_SIZE},
+                                                                   VkDescriptorBufferInfo{.buffer = mVisibilityBuffer, .offset = 0, .range = VK_WHOLE_SIZE}};
+
+        VkDescriptorImageInfo pyramidInfo{};
+        pyramidInfo.sampler = mSampler;
+        pyramidInfo.imageView = mPyramidView;
+        pyramidInfo.imageLayout = VK_IMAGE_LAYOUT_GENERAL;
+
+        std::array<VkWriteDescriptorSet, 4> descriptorWrites{};
+        for (uint32_t binding = 0; binding < 3; binding++) {
+            descriptorWrites[binding].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            descriptorWrites[binding].dstSet = frame.cullSet;
+            descriptorWrites[binding].dstBinding = binding;
+            descriptorWrites[binding].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+            descriptorWrites[binding].descriptorCount = 1;
+            descriptorWrites[binding].pBufferInfo = &bufferInfos[binding];
+        }
+        descriptorWrites[3].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        descriptorWrites[3].dstSet = frame.cullSet;
+        descriptorWrites[3].dstBinding = 3;
+        descriptorWrites[3].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        descriptorWrites[3].descriptorCount = 1;
+        descriptorWrites[3].pImageInfo = &pyramidInfo;
+        vkUpdateDescriptorSets(mDevice, static_cast<uint32_t>(descriptorWrites.size()), descriptorWrites.data(), 0, nullptr);
+    }
+}
+
+auto VulkanOcclusionCuller::retire(const uint64_t lastUsedFrame) -> void {
+    // the mapped instance memory is unmapped implicitly when it is freed
+    for (const auto& frame : mFrames) {
+        mDeletionQueue.retireBuffer(frame.instanceBuffer, frame.instanceMemory, lastUsedFrame);
+        mDeletionQueue.retireBuffer(frame.indirectBuffer, frame.indirectMemory, lastUsedFrame);
+    }
+    mFrames.clear();
+
+    if (VK_NULL_HANDLE != mVisibilityBuffer) {
+        mDeletionQueue.retireBuffer(mVisibilityBuffer, mVisibilityMemory, lastUsedFrame);
+        mVisibilityBuffer = VK_NULL_HANDLE;
+        mVisibilityMemory = VK_NULL_HANDLE;
+    }
+
+    for (const auto view : mPyramidLevelViews) {
+        mDeletionQueue.retireImageView(view, lastUsedFrame);
+    }
+    mPyramidLevelViews.clear();
+
+    if (VK_NULL_HANDLE != mPyramidImage) {
+        mDeletionQueue.retireImageView(mPyramidView, lastUsedFrame);
+        mDeletionQueue.retireImage(mPyramidImage, mPyramidMemory, lastUsedFrame);
+        mPyramidView = VK_NULL_HANDLE;
+        mPyramidImage = VK_NULL_HANDLE;
+        mPyramidMemory = VK_NULL_HANDLE;
+    }
+
+    if (VK_NULL_HANDLE != mDescriptorPool) {
+        mDeletionQueue.retireDescriptorPool(mDescriptorPool, lastUsedFrame);
+        mDescriptorPool = VK_NULL_HANDLE;
+    }
+    mPyramidSets.clear();
+}
+
+auto VulkanOcclusionCuller::writeInstances(const uint32_t frame, const std::span<const VulkanGpuInstance> instances) -> uint32_t {
+    const auto count = static_cast<uint32_t>(std::min<std::size_t>(instances.size(), OCCLUSION_MAX_INSTANCES));
+    if (count < instances.size()) {
+        AdelieLogWarning("Dropping {} of {} instances, the occlusion culling only handles {}", instances.size() - count, instances.size(), OCCLUSION_MAX_INSTANCES);
+    }
+
+    std::memcpy(mFrames[frame].instances, instances.data(), sizeof(VulkanGpuInstance) * count);
+    mFrames[frame].instanceCount = count;
+    return count;
+}
+
+auto VulkanOcclusionCuller::recordFirstPhase(VkCommandBuffer commandBuffer, const uint32_t frame, const glm::mat4& viewProjection) -> void {
+    // after a resize nothing was visible, everything is drawn by the second phase of the first frame
+    if (!mVisibilityCleared) {
+        vkCmdFillBuffer(commandBuffer, mVisibilityBuffer, 0, VK_WHOLE_SIZE, 0);
+        mVisibilityCleared = true;
+    }
+
+    // the visibility was written by the second phase of the last frame (or cleared above)
+    recordMemoryBarrier(commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT | VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_SHADER_WRITE_BIT | VK_ACCESS_TRANSFER_WRITE_BIT,
+                        VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT);
+    recordCull(commandBuffer, frame, viewProjection, 0);
+}
+
+auto VulkanOcclusionCuller::recordSecondPhase(VkCommandBuffer commandBuffer, const uint32_t frame, const glm::mat4& viewProjection) -> void {
+    if (0 == mFrames[frame].instanceCount) {
+        return;
+    }
+
+    // the content of the last frame is not needed, the previous reads of the culling have to be finished though. The
+    // render pass of the first phase makes its depth visible to the compute shaders
+    VkImageMemoryBarrier barrier{};
+    barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    barrier.newLayout = VK_IMAGE_LAYOUT_GENERAL;
+    barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.image = mPyramidImage;
+    barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    barrier.subresourceRange.baseMipLevel = 0;
+    barrier.subresourceRange.levelCount = mPyramidLevels;
+    barrier.subresourceRange.baseArrayLayer = 0;
+    barrier.subresourceRange.layerCount = 1;
+    barrier.srcAccessMask = 0;
+    barrier.dstAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+    vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+
+    vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, mPyramidPipeline);
+    VkExtent2D source = mDepthExtent;
+    for (uint32_t level = 0; level < mPyramidLevels; level++) {
+        const VkExtent2D destination = {.width = std::max(mPyramidExtent.width >> level, 1U), .height = std::max(mPyramidExtent.height >> level, 1U)};
+        const PyramidPushConstants pushConstants{.sourceWidth = source.width, .sourceHeight = source.height, .destinationWidth = destination.width, .destinationHeight = destination.height};
+
+        vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, mPyramidPipelineLayout, 0, 1, &mPyramidSets[level], 0, nullptr);
+        vkCmdPushConstants(commandBuffer, mPyramidPipelineLayout, VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(pushConstants), &pushConstants);
+        vkCmdDispatch(commandBuffer, (destination.width + PYRAMID_GROUP_SIZE - 1) / PYRAMID_GROUP_SIZE, (destination.height + PYRAMID_GROUP_SIZE - 1) / PYRAMID_GROUP_SIZE, 1);
+
+        // the next level reads this one, the last barrier also orders the culling after the whole pyramid
+        recordMemoryBarrier(commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_ACCESS_SHADER_WRITE_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT);
+        source = destination;
+    }
+
+    recordCull(commandBuffer, frame, viewProjection, 1);
+}
+
+auto VulkanOcclusionCuller::recordCull(VkCommandBuffer commandBuffer, const uint32_t frame, const glm::mat4& viewProjection, const uint32_t phase) -> void {
+    const auto& slot = mFrames[frame];
+    if (0 == slot.instanceCount) {
+        return;
+    }
+
+    const CullPushConstants pushConstants{.viewProjection = viewProjection,
+                                          .pyramidSize = glm::vec2(static_cast<float>(mPyramidExtent.width), static_cast<float>(mPyramidExtent.height)),
+                                          .instanceCount = slot.instanceCount,
+                                          .phase = phase,
+                                          .levelCount = mPyramidLevels,
+                                          .commandOffset = phase * OCCLUSION_MAX_INSTANCES};
+
+    vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, mCullPipeline);
+    vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, mCullPipelineLayout, 0, 1, &slot.cullSet, 0, nullptr);
+    vkCmdPushConstants(commandBuffer, mCullPipelineLayout, VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(pushConstants), &pushConstants);
+    vkCmdDispatch(commandBuffer, (slot.instanceCount + CULL_GROUP_SIZE - 1) / CULL_GROUP_SIZE, 1, 1);
+
+    recordMemoryBarrier(commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_ACCESS_SHADER_WRITE_BIT, VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT, VK_ACCESS_INDIRECT_COMMAND_READ_BIT);
+}
+
+auto VulkanOcclusionCuller::recordDraws(VkCommandBuffer commandBuffer, const uint32_t frame, const uint32_t phase) const -> void {
+    const auto& slot = mFrames[frame];
+    if (0 == slot.instanceCount) {
+        return;
+    }
+
+    const VkDeviceSize offset = sizeof(VkDrawIndexedIndirectCommand) * OCCLUSION_MAX_INSTANCES * phase;
+    vkCmdDrawIndexedIndirect(commandBuffer, slot.indirectBuffer, offset, slot.instanceCount, sizeof(VkDrawIndexedIndirectCommand));
+}
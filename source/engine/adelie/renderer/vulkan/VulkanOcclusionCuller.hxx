@@ -0,0 +1,129 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#if !defined(__ADELIE_RENDERER_VULKAN_VULKANOCCLUSIONCULLER_HXX__)
+    #define __ADELIE_RENDERER_VULKAN_VULKANOCCLUSIONCULLER_HXX__
+
+    #include <vulkan/vulkan.h>
+
+    #include <adelie/adelie.hxx>
+    #include <adelie/renderer/vulkan/VulkanDeletionQueue.hxx>
+    #include <cstdint>
+    #include <span>
+    #include <vector>
+
+namespace adelie::renderer::vulkan {
+
+    // the number of instances a frame can cull and draw, the draws beyond it are dropped
+    static inline constexpr uint32_t OCCLUSION_MAX_INSTANCES = 16384;
+
+    // a single draw as seen by the shaders, the layout matches the Instance struct of occlusion_cull.comp and
+    // cube.vert (std430)
+    struct ADELIE_API VulkanGpuInstance {
+            glm::mat4 model;
+            glm::vec4 boundsMin;  // the local bounds of the mesh, w is unused
+            glm::vec4 boundsMax;
+            uint32_t firstIndex;
+            uint32_t indexCount;
+            int32_t vertexOffset;
+            uint32_t padding;
+    }; /* struct VulkanGpuInstance */
+
+    // culls the instances of a frame on the GPU against the frustum and a hierarchical depth buffer and writes the
+    // surviving draws into an indirect buffer. The depth pyramid holds the farthest depth of every texel footprint, so
+    // an instance whose nearest point lies behind it is hidden
+    //
+    // a frame is drawn in two phases. The first one draws the instances which were visible the last frame. Their depth
+    // builds the pyramid, the second phase tests all instances against it and draws the ones which became visible. The
+    // visibility of an instance is remembered by its index, so the order of the instances should be stable between the
+    // frames
+    //
+    // a culled draw stays in the indirect buffer with an instance count of zero, so no indirect draw count is needed.
+    // The first instance of a draw is its index, the vertex shader fetches the model matrix with it
+    class ADELIE_API VulkanOcclusionCuller {
+        public:
+            VulkanOcclusionCuller(VkDevice device, VkPhysicalDevice physicalDevice, VulkanDeletionQueue& deletionQueue);
+
+            ~VulkanOcclusionCuller() noexcept;
+
+            VulkanOcclusionCuller(const VulkanOcclusionCuller&) = delete;
+
+            auto operator=(VulkanOcclusionCuller const&) -> VulkanOcclusionCuller& = delete;
+
+            VulkanOcclusionCuller(VulkanOcclusionCuller&&) = delete;
+
+            auto operator=(VulkanOcclusionCuller&&) -> VulkanOcclusionCuller& = delete;
+
+            // (re)creates the depth pyramid for the supplied depth buffer, which is sampled in the layout
+            // DEPTH_STENCIL_READ_ONLY_OPTIMAL, and the buffers of every frame slot. The replaced objects are retired
+            // after lastUsedFrame and every instance counts as hidden again
+            auto resize(VkImageView depthImageView, VkExtent2D extent, uint32_t frameCount, uint64_t lastUsedFrame) -> void;
+
+            // render thread: the instances of the frame slot, which must not be in use by the GPU anymore. Returns the
+            // number of instances which fit into the buffer
+            auto writeInstances(uint32_t frame, std::span<const VulkanGpuInstance> instances) -> uint32_t;
+
+            // render thread: cull for the first phase, recorded outside of a render pass
+            auto recordFirstPhase(VkCommandBuffer commandBuffer, uint32_t frame, const glm::mat4& viewProjection) -> void;
+
+            // render thread: build the depth pyramid from the depth of the first phase and cull for the second phase,
+            // recorded outside of a render pass
+            auto recordSecondPhase(VkCommandBuffer commandBuffer, uint32_t frame, const glm::mat4& viewProjection) -> void;
+
+            // render thread: draw the surviving instances of a phase (0 or 1) inside of a render pass
+            auto recordDraws(VkCommandBuffer commandBuffer, uint32_t frame, uint32_t phase) const -> void;
+
+            // the instances of the frame slot, bound as storage buffer by the graphics pipeline
+            [[nodiscard]] auto getInstanceBuffer(const uint32_t frame) const -> VkBuffer { return mFrames[frame].instanceBuffer; }
+
+            [[nodiscard]] auto getInstanceBufferSize() const -> VkDeviceSize { return sizeof(VulkanGpuInstance) * OCCLUSION_MAX_INSTANCES; }
+
+        private:
+            struct Frame {
+                    VkBuffer instanceBuffer;
+                    VkDeviceMemory instanceMemory;
+                    VulkanGpuInstance* instances;  // persistently mapped
+                    VkBuffer indirectBuffer;       // the draws of the first phase followed by the ones of the second phase
+                    VkDeviceMemory indirectMemory;
+                    VkDescriptorSet cullSet;
+                    uint32_t instanceCount;
+            };
+
+            auto createPipelines() -> void;
+            auto createPyramid(VkExtent2D extent) -> void;
+            auto createFrames(uint32_t frameCount) -> void;
+            auto createDescriptorSets(VkImageView depthImageView) -> void;
+            auto retire(uint64_t lastUsedFrame) -> void;
+            auto recordCull(VkCommandBuffer commandBuffer, uint32_t frame, const glm::mat4& viewProjection, uint32_t phase) -> void;
+
+            VkDevice mDevice;
+            VkPhysicalDevice mPhysicalDevice;
+            VulkanDeletionQueue& mDeletionQueue;
+
+            VkDescriptorSetLayout mPyramidSetLayout;
+            VkPipelineLayout mPyramidPipelineLayout;
+            VkPipeline mPyramidPipeline;
+            VkDescriptorSetLayout mCullSetLayout;
+            VkPipelineLayout mCullPipelineLayout;
+            VkPipeline mCullPipeline;
+            VkSampler mSampler;
+
+            VkExtent2D mDepthExtent;
+            VkExtent2D mPyramidExtent;
+            uint32_t mPyramidLevels;
+            VkImage mPyramidImage;
+            VkDeviceMemory mPyramidMemory;
+            VkImageView mPyramidView;                     // all levels, sampled by the culling
+            std::vector<VkImageView> mPyramidLevelViews;  // one per level, written by the reduction
+            std::vector<VkDescriptorSet> mPyramidSets;    // level n reads level n - 1, level 0 reads the depth buffer
+
+            VkBuffer mVisibilityBuffer;  // 1 for every instance which passed the second phase of the last frame
+            VkDeviceMemory mVisibilityMemory;
+            bool mVisibilityCleared;
+            std::vector<Frame> mFrames;
+            VkDescriptorPool mDescriptorPool;
+
+    }; /* class VulkanOcclusionCuller */
+
+} /* namespace adelie::renderer::vulkan */
+
+#endif /* if !defined(__ADELIE_RENDERER_VULKAN_VULKANOCCLUSIONCULLER_HXX__) */
@@ -0,0 +1,494 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#include <adelie/exception/VulkanRuntimeException.hxx>
+#include <adelie/io/Logger.hxx>
+#include <adelie/io/VirtualFileSystem.hxx>
+#include <adelie/renderer/vulkan/VulkanBufferManager.hxx>
+#include <adelie/renderer/vulkan/VulkanParticleSystem.hxx>
+#include <adelie/renderer/vulkan/VulkanShaderManager.hxx>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+using adelie::core::renderer::RenderParticleEmitter;
+using adelie::exception::VulkanRuntimeException;
+using adelie::io::VirtualFileSystem;
+using adelie::renderer::vulkan::PARTICLE_MAX_COUNT;
+using adelie::renderer::vulkan::PARTICLE_MAX_EMITTERS;
+using adelie::renderer::vulkan::VulkanBufferManager;
+using adelie::renderer::vulkan::VulkanGpuParticleEmitter;
+using adelie::renderer::vulkan::VulkanParticleSystem;
+using adelie::renderer::vulkan::VulkanShaderManager;
+
+namespace {
+    constexpr uint32_t PARTICLE_GROUP_SIZE = 64;
+
+    // the size of a particle in particle_update.comp, a position and the remaining life, a velocity and a color
+    constexpr VkDeviceSize PARTICLE_SIZE = 32;
+
+    // the world space size of a particle quad
+    constexpr float PARTICLE_SIZE_WORLD = 0.01f;
+
+    // a hitch does not spawn a burst of particles or let them jump
+    constexpr float MAX_TIME_STEP = 0.1f;
+
+    // the counters buffer holds the particle count of both buffers, the dispatch arguments of the next update and the
+    // draw arguments of the particles. The layout matches the Counters block of the simulation shaders (std430), which
+    // declares the arguments as scalars so they are packed without padding
+    struct Counters {
+            std::array<uint32_t, 2> counts;
+            VkDispatchIndirectCommand dispatchArguments;
+            VkDrawIndirectCommand drawArguments;
+    };
+    constexpr VkDeviceSize COUNTER_DISPATCH_OFFSET = offsetof(Counters, dispatchArguments);
+    constexpr VkDeviceSize COUNTER_DRAW_OFFSET = offsetof(Counters, drawArguments);
+    constexpr VkDeviceSize COUNTER_SIZE = sizeof(Counters);
+    static_assert(8 == COUNTER_DISPATCH_OFFSET && 20 == COUNTER_DRAW_OFFSET && 36 == COUNTER_SIZE, "The counters do not match the Counters block of the shaders");
+
+    // the source, destination, counters and emitters of the simulation
+    constexpr uint32_t SIMULATION_BINDING_COUNT = 4;
+
+    struct SimulationPushConstants {
+            float deltaTime;
+            uint32_t source;  // the counter of the source buffer, the destination uses the other one
+    };
+
+    struct DrawPushConstants {
+            glm::mat4 viewProjection;
+            glm::vec4 right;  // the camera axes in world space, scaled by the size of a particle
+            glm::vec4 up;
+    };
+
+    auto clampTimeStep(const float deltaTime) -> float { return std::clamp(deltaTime, 0.0f, MAX_TIME_STEP); }
+}  // namespace
+
+VulkanParticleSystem::VulkanParticleSystem(VkDevice device, VkPhysicalDevice physicalDevice, VulkanDeletionQueue& deletionQueue) : mDeletionQueue(deletionQueue) {
+    mDevice = device;
+    mPhysicalDevice = physicalDevice;
+    mSimulationSetLayout = VK_NULL_HANDLE;
+    mSimulationPipelineLayout = VK_NULL_HANDLE;
+    mUpdatePipeline = VK_NULL_HANDLE;
+    mEmitPipeline = VK_NULL_HANDLE;
+    mFinalizePipeline = VK_NULL_HANDLE;
+    mDrawSetLayout = VK_NULL_HANDLE;
+    mDrawPipelineLayout = VK_NULL_HANDLE;
+    mDrawPipeline = VK_NULL_HANDLE;
+    mCountersCleared = false;
+    mSource = 0;
+    mSeed = 0;
+    mDrawSets.fill(VK_NULL_HANDLE);
+    mDescriptorPool = VK_NULL_HANDLE;
+
+    createSimulation();
+
+    for (uint32_t buffer = 0; buffer < mParticleBuffers.size(); buffer++) {
+        VulkanBufferManager::createBuffer(mDevice, mPhysicalDevice, PARTICLE_SIZE * PARTICLE_MAX_COUNT, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+                                          mParticleBuffers[buffer], mParticleMemory[buffer]);
+    }
+    VulkanBufferManager::createBuffer(mDevice, mPhysicalDevice, COUNTER_SIZE, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                                      VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, mCounterBuffer, mCounterMemory);
+}
+
+VulkanParticleSystem::~VulkanParticleSystem() noexcept {
+    // the caller ensures the device is idle and flushes the deletion queue afterwards
+    retire(0);
+    for (uint32_t buffer = 0; buffer < mParticleBuffers.size(); buffer++) {
+        mDeletionQueue.retireBuffer(mParticleBuffers[buffer], mParticleMemory[buffer], 0);
+    }
+    mDeletionQueue.retireBuffer(mCounterBuffer, mCounterMemory, 0);
+    mDeletionQueue.retirePipeline(mUpdatePipeline, 0);
+    mDeletionQueue.retirePipeline(mEmitPipeline, 0);
+    mDeletionQueue.retirePipeline(mFinalizePipeline, 0);
+    mDeletionQueue.retirePipelineLayout(mSimulationPipelineLayout, 0);
+    mDeletionQueue.retirePipelineLayout(mDrawPipelineLayout, 0);
+    vkDestroyDescriptorSetLayout(mDevice, mSimulationSetLayout, nullptr);
+    vkDestroyDescriptorSetLayout(mDevice, mDrawSetLayout, nullptr);
+}
+
+auto VulkanParticleSystem::createSimulation() -> void {
+    std::array<VkDescriptorSetLayoutBinding, SIMULATION_BINDING_COUNT> bindings{};
+    for (uint32_t binding = 0; binding < bindings.size(); binding++) {
+        bindings[binding].binding = binding;
+        bindings[binding].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        bindings[binding].descriptorCount = 1;
+        bindings[binding].stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+    }
+
+    VkDescriptorSetLayoutCreateInfo layoutInfo{};
+    layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+    layoutInfo.bindingCount = static_cast<uint32_t>(bindings.size());
+    layoutInfo.pBindings = bindings.data();
+
+    if (const auto result = vkCreateDescriptorSetLayout(mDevice, &layoutInfo, nullptr, &mSimulationSetLayout); result != VK_SUCCESS) {
+        throw VulkanRuntimeException("Failed to create particle simulation descriptor set layout", result);
+    }
+
+    // the particles the vertex shader expands into quads
+    VkDescriptorSetLayoutBinding particleBinding{};
+    particleBinding.binding = 0;
+    particleBinding.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    particleBinding.descriptorCount = 1;
+    particleBinding.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+
+    layoutInfo.bindingCount = 1;
+    layoutInfo.pBindings = &particleBinding;
+
+    if (const auto result = vkCreateDescriptorSetLayout(mDevice, &layoutInfo, nullptr, &mDrawSetLayout); result != VK_SUCCESS) {
+        throw VulkanRuntimeException("Failed to create particle descriptor set layout", result);
+    }
+
+    VkPushConstantRange pushConstantRange{};
+    pushConstantRange.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+    pushConstantRange.offset = 0;
+    pushConstantRange.size = sizeof(SimulationPushConstants);
+
+    VkPipelineLayoutCreateInfo pipelineLayoutInfo{};
+    pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+    pipelineLayoutInfo.setLayoutCount = 1;
+    pipelineLayoutInfo.pSetLayouts = &mSimulationSetLayout;
+    pipelineLayoutInfo.pushConstantRangeCount = 1;
+    pipelineLayoutInfo.pPushConstantRanges = &pushConstantRange;
+
+    if (const auto result = vkCreatePipelineLayout(mDevice, &pipelineLayoutInfo, nullptr, &mSimulationPipelineLayout); result != VK_SUCCESS) {
+        throw VulkanRuntimeException("Failed to create particle simulation pipeline layout", result);
+    }
+
+    pushConstantRange.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+    pushConstantRange.size = sizeof(DrawPushConstants);
+    pipelineLayoutInfo.pSetLayouts = &mDrawSetLayout;
+
+    if (const auto result = vkCreatePipelineLayout(mDevice, &pipelineLayoutInfo, nullptr, &mDrawPipelineLayout); result != VK_SUCCESS) {
+        throw VulkanRuntimeException("Failed to create particle pipeline layout", result);
+    }
+
+    // the three passes share the layout, each one only touches the bindings it needs
+    const auto createPipeline = [&](const char* path, VkPipeline& pipeline) {
+        const auto code = VirtualFileSystem::getInstance()->read(path);
+        const auto shaderModule = VulkanShaderManager::createShaderModule(mDevice, code->getData());
+
+        VkComputePipelineCreateInfo pipelineInfo{};
+        pipelineInfo.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+        pipelineInfo.stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+        pipelineInfo.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+        pipelineInfo.stage.module = shaderModule;
+        pipelineInfo.stage.pName = "main";
+        pipelineInfo.layout = mSimulationPipelineLayout;
+
+        const auto result = vkCreateComputePipelines(mDevice, VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &pipeline);
+        vkDestroyShaderModule(mDevice, shaderModule, nullptr);
+        if (result != VK_SUCCESS) {
+            throw VulkanRuntimeException("Failed to create particle simulation pipeline", result);
+        }
+    };
+    createPipeline("shader/particle_update.comp.spv", mUpdatePipeline);
+    createPipeline("shader/particle_emit.comp.spv", mEmitPipeline);
+    createPipeline("shader/particle_finalize.comp.spv", mFinalizePipeline);
+}
+
+auto VulkanParticleSystem::createDrawPipeline(VkRenderPass renderPass, const VkExtent2D extent) -> void {
+    const auto vertCode = VirtualFileSystem::getInstance()->read("shader/particle.vert.spv");
+    const auto vertShaderModule = VulkanShaderManager::createShaderModule(mDevice, vertCode->getData());
+    const auto fragCode = VirtualFileSystem::getInstance()->read("shader/particle.frag.spv");
+    const auto fragShaderModule = VulkanShaderManager::createShaderModule(mDevice, fragCode->getData());
+
+    std::array<VkPipelineShaderStageCreateInfo, 2> shaderStages{};
+    shaderStages[0].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    shaderStages[0].stage = VK_SHADER_STAGE_VERTEX_BIT;
+    shaderStages[0].module = vertShaderModule;
+    shaderStages[0].pName = "main";
+    shaderStages[1].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    shaderStages[1].stage = VK_SHADER_STAGE_FRAGMENT_BIT;
+    shaderStages[1].module = fragShaderModule;
+    shaderStages[1].pName = "main";
+
+    // the quads are expanded from the vertex index, there are no vertex buffers
+    VkPipelineVertexInputStateCreateInfo vertexInputInfo{};
+    vertexInputInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
+
+    VkPipelineInputAssemblyStateCreateInfo inputAssembly{};
+    inputAssembly.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
+    inputAssembly.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    inputAssembly.primitiveRestartEnable = VK_FALSE;
+
+    VkViewport viewport{};
+    viewport.x = 0.0f;
+    viewport.y = 0.0f;
+    viewport.width = static_cast<float>(extent.width);
+    viewport.height = static_cast<float>(extent.height);
+    viewport.minDepth = 0.0f;
+    viewport.maxDepth = 1.0f;
+
+    VkRect2D scissor{.offset = {0, 0}, .extent = extent};
+
+    VkPipelineViewportStateCreateInfo viewportState{};
+    viewportState.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
+    viewportState.viewportCount = 1;
+    viewportState.pViewports = &viewport;
+    viewportState.scissorCount = 1;
+    viewportState.pScissors = &scissor;
+
+    VkPipelineRasterizationStateCreateInfo rasterizer{};
+    rasterizer.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
+    rasterizer.depthClampEnable = VK_FALSE;
+    rasterizer.rasterizerDiscardEnable = VK_FALSE;
+    rasterizer.polygonMode = VK_POLYGON_MODE_FILL;
+    rasterizer.cullMode = VK_CULL_MODE_NONE;
+    rasterizer.frontFace = VK_FRONT_FACE_COUNTER_CLOCKWISE;
+    rasterizer.depthBiasEnable = VK_FALSE;
+    rasterizer.lineWidth = 1.0f;
+
+    VkPipelineMultisampleStateCreateInfo multisampling{};
+    multisampling.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
+    multisampling.sampleShadingEnable = VK_FALSE;
+    multisampling.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
+    multisampling.minSampleShading = 1.0f;
+
+    // the particles are hidden by the opaque geometry but do not hide each other, additive blending makes their
+    // order irrelevant, so they are neither sorted nor write the depth
+    VkPipelineDepthStencilStateCreateInfo depthStencil{};
+    depthStencil.sType = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
+    depthStencil.depthTestEnable = VK_TRUE;
+    depthStencil.depthWriteEnable = VK_FALSE;
+    depthStencil.depthCompareOp = VK_COMPARE_OP_LESS;
+    depthStencil.depthBoundsTestEnable = VK_FALSE;
+    depthStencil.stencilTestEnable = VK_FALSE;
+
+    VkPipelineColorBlendAttachmentState colorBlendAttachment{};
+    colorBlendAttachment.colorWriteMask = VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
+    colorBlendAttachment.blendEnable = VK_TRUE;
+    colorBlendAttachment.srcColorBlendFactor = VK_BLEND_FACTOR_ONE;
+    colorBlendAttachment.dstColorBlendFactor = VK_BLEND_FACTOR_ONE;
+    colorBlendAttachment.colorBlendOp = VK_BLEND_OP_ADD;
+    colorBlendAttachment.srcAlphaBlendFactor = VK_BLEND_FACTOR_ZERO;
+    colorBlendAttachment.dstAlphaBlendFactor = VK_BLEND_FACTOR_ONE;
+    colorBlendAttachment.alphaBlendOp = VK_BLEND_OP_ADD;
+
+    VkPipelineColorBlendStateCreateInfo colorBlending{};
+    colorBlending.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
+    colorBlending.logicOpEnable = VK_FALSE;
+    colorBlending.attachmentCount = 1;
+    colorBlending.pAttachments = &colorBlendAttachment;
+
+    VkGraphicsPipelineCreateInfo pipelineInfo{};
+    pipelineInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+    pipelineInfo.stageCount = static_cast<uint32_t>(shaderStages.size());
+    pipelineInfo.pStages = shaderStages.data();
+    pipelineInfo.pVertexInputState = &vertexInputInfo;
+    pipelineInfo.pInputAssemblyState = &inputAssembly;
+    pipelineInfo.pViewportState = &viewportState;
+    pipelineInfo.pRasterizationState = &rasterizer;
+    pipelineInfo.pMultisampleState = &multisampling;
+    pipelineInfo.pDepthStencilState = &depthStencil;
+    pipelineInfo.pColorBlendState = &colorBlending;
+    pipelineInfo.layout = mDrawPipelineLayout;
+    pipelineInfo.renderPass = renderPass;
+    pipelineInfo.subpass = 0;
+
+    const auto result = vkCreateGraphicsPipelines(mDevice, VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &mDrawPipeline);
+    vkDestroyShaderModule(mDevice, fragShaderModule, nullptr);
+    vkDestroyShaderModule(mDevice, vertShaderModule, nullptr);
+    if (result != VK_SUCCESS) {
+        throw VulkanRuntimeException("Failed to create particle pipeline", result);
+    }
+}
+
+auto VulkanParticleSystem::resize(VkRenderPass renderPass, const VkExtent2D extent, const uint32_t frameCount, const uint64_t lastUsedFrame) -> void {
+    retire(lastUsedFrame);
+    createDrawPipeline(renderPass, extent);
+
+    mFrames.resize(frameCount);
+    for (auto& frame : mFrames) {
+        VulkanBufferManager::createBuffer(mDevice, mPhysicalDevice, sizeof(VulkanGpuParticleEmitter) * PARTICLE_MAX_EMITTERS, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+                                          VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, frame.emitterBuffer, frame.emitterMemory);
+        void* data;
+        vkMapMemory(mDevice, frame.emitterMemory, 0, VK_WHOLE_SIZE, 0, &data);
+        frame.emitters = static_cast<VulkanGpuParticleEmitter*>(data);
+        frame.simulationSets.fill(VK_NULL_HANDLE);
+        frame.emitterCount = 0;
+        frame.maxSpawnCount = 0;
+    }
+
+    createDescriptorSets();
+}
+
+auto VulkanParticleSystem::createDescriptorSets() -> void {
+    const auto simulationSetCount = static_cast<uint32_t>(mFrames.size() * 2);
+
+    VkDescriptorPoolSize poolSize{};
+    poolSize.type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    poolSize.descriptorCount = (simulationSetCount * SIMULATION_BINDING_COUNT) + static_cast<uint32_t>(mDrawSets.size());
+
+    VkDescriptorPoolCreateInfo poolInfo{};
+    poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+    poolInfo.poolSizeCount = 1;
+    poolInfo.pPoolSizes = &poolSize;
+    poolInfo.maxSets = simulationSetCount + static_cast<uint32_t>(mDrawSets.size());
+
+    if (const auto result = vkCreateDescriptorPool(mDevice, &poolInfo, nullptr, &mDescriptorPool); result != VK_SUCCESS) {
+        throw VulkanRuntimeException("Failed to create particle descriptor pool", result);
+    }
+
+    VkDescriptorSetAllocateInfo allocInfo{};
+    allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    allocInfo.descriptorPool = mDescriptorPool;
+    allocInfo.descriptorSetCount = 1;
+
+    for (uint32_t source = 0; source < mParticleBuffers.size(); source++) {
+        allocInfo.pSetLayouts = &mDrawSetLayout;
+        if (const auto result = vkAllocateDescriptorSets(mDevice, &allocInfo, &mDrawSets[source]); result != VK_SUCCESS) {
+            throw VulkanRuntimeException("Failed to allocate particle descriptor set", result);
+        }
+
+        VkDescriptorBufferInfo particleInfo{.buffer = mParticleBuffers[source], .offset = 0, .range = VK_WHOLE_SIZE};
+
+        VkWriteDescriptorSet descriptorWrite{};
+        descriptorWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        descriptorWrite.dstSet = mDrawSets[source];
+        descriptorWrite.dstBinding = 0;
+        descriptorWrite.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        descriptorWrite.descriptorCount = 1;
+        descriptorWrite.pBufferInfo = &particleInfo;
+        vkUpdateDescriptorSets(mDevice, 1, &descriptorWrite, 0, nullptr);
+
+        for (auto& frame : mFrames) {
+            allocInfo.pSetLayouts = &mSimulationSetLayout;
+            if (const auto result = vkAllocateDescriptorSets(mDevice, &allocInfo, &frame.simulationSets[source]); result != VK_SUCCESS) {
+                throw VulkanRuntimeException("Failed to allocate particle simulation descriptor set", result);
+            }
+
+            const std::array<VkDescriptorBufferInfo, SIMULATION_BINDING_COUNT> bufferInfos = {
+                VkDescriptorBufferInfo{.buffer = mParticleBuffers[source], .offset = 0, .range = VK_WHOLE_SIZE},
+                VkDescriptorBufferInfo{.buffer = mParticleBuffers[1 - source], .offset = 0, .range = VK_WHOLE_SIZE},
+                VkDescriptorBufferInfo{.buffer = mCounterBuffer, .offset = 0, .range = VK_WHOLE_SIZE},
+                VkDescriptorBufferInfo{.buffer = frame.emitterBuffer, .offset = 0, .range = VK_WHOLE_SIZE}};
+
+            std::array<VkWriteDescriptorSet, SIMULATION_BINDING_COUNT> descriptorWrites{};
+            for (uint32_t binding = 0; binding < descriptorWrites.size(); binding++) {
+                descriptorWrites[binding].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+                descriptorWrites[binding].dstSet = frame.simulationSets[source];
+                descriptorWrites[binding].dstBinding = binding;
+                descriptorWrites[binding].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+                descriptorWrites[binding].descriptorCount = 1;
+                descriptorWrites[binding].pBufferInfo = &bufferInfos[binding];
+            }
+            vkUpdateDescriptorSets(mDevice, static_cast<uint32_t>(descriptorWrites.size()), descriptorWrites.data(), 0, nullptr);
+        }
+    }
+}
+
+auto VulkanParticleSystem::retire(const uint64_t lastUsedFrame) -> void {
+    // the mapped emitter memory is unmapped implicitly when it is freed
+    for (const auto& frame : mFrames) {
+        mDeletionQueue.retireBuffer(frame.emitterBuffer, frame.emitterMemory, lastUsedFrame);
+    }
+    mFrames.clear();
+
+    if (VK_NULL_HANDLE != mDescriptorPool) {
+        mDeletionQueue.retireDescriptorPool(mDescriptorPool, lastUsedFrame);
+        mDescriptorPool = VK_NULL_HANDLE;
+        mDrawSets.fill(VK_NULL_HANDLE);
+    }
+
+    if (VK_NULL_HANDLE != mDrawPipeline) {
+        mDeletionQueue.retirePipeline(mDrawPipeline, lastUsedFrame);
+        mDrawPipeline = VK_NULL_HANDLE;
+    }
+}
+
+auto VulkanParticleSystem::writeEmitters(const uint32_t frame, const std::span<const RenderParticleEmitter> emitters, const float deltaTime) -> uint32_t {
+    const auto count = static_cast<uint32_t>(std::min<std::size_t>(emitters.size(), PARTICLE_MAX_EMITTERS));
+    if (count < emitters.size()) {
+        AdelieLogWarning("Dropping {} of {} particle emitters, the particle system only handles {}", emitters.size() - count, emitters.size(), PARTICLE_MAX_EMITTERS);
+    }
+
+    // the emitters are matched to their remainders by their order, which only changes with the structure of the scene
+    mSpawnRemainders.resize(count, 0.0f);
+    const float timeStep = clampTimeStep(deltaTime);
+
+    auto& slot = mFrames[frame];
+    slot.emitterCount = count;
+    slot.maxSpawnCount = 0;
+    uint32_t spawned = 0;
+    for (uint32_t index = 0; index < count; index++) {
+        const auto& emitter = emitters[index];
+        const float spawn = (emitter.rate * timeStep) + mSpawnRemainders[index];
+        const float whole = std::floor(spawn);
+        mSpawnRemainders[index] = spawn - whole;
+
+        const auto spawnCount = static_cast<uint32_t>(std::clamp(whole, 0.0f, static_cast<float>(PARTICLE_MAX_COUNT)));
+        slot.emitters[index] = {.positionSpread = glm::vec4(emitter.position, emitter.spread),
+                                .directionSpeed = glm::vec4(emitter.direction, emitter.speed),
+                                .colorLifetime = glm::vec4(emitter.color, emitter.lifetime),
+                                .spawnCount = spawnCount,
+                                .seed = mSeed++,
+                                .padding = {0, 0}};
+        slot.maxSpawnCount = std::max(slot.maxSpawnCount, spawnCount);
+        spawned += spawnCount;
+    }
+    return spawned;
+}
+
+auto VulkanParticleSystem::recordSimulation(VkCommandBuffer commandBuffer, const uint32_t frame, const float deltaTime) -> void {
+    VkMemoryBarrier barrier{};
+    barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+
+    if (!mCountersCleared) {
+        // no particles, no dispatch and no draw until the first simulation wrote the arguments
+        vkCmdFillBuffer(commandBuffer, mCounterBuffer, 0, VK_WHOLE_SIZE, 0);
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT | VK_ACCESS_INDIRECT_COMMAND_READ_BIT;
+        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 1, &barrier, 0, nullptr, 0, nullptr);
+        mCountersCleared = true;
+    }
+
+    // the last frame drew the source and updated from the destination, the update reads the arguments the last
+    // simulation wrote
+    barrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT | VK_ACCESS_INDIRECT_COMMAND_READ_BIT;
+    vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                         VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 1, &barrier, 0, nullptr, 0, nullptr);
+
+    const auto& slot = mFrames[frame];
+    const SimulationPushConstants pushConstants{.deltaTime = clampTimeStep(deltaTime), .source = mSource};
+    vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, mSimulationPipelineLayout, 0, 1, &slot.simulationSets[mSource], 0, nullptr);
+    vkCmdPushConstants(commandBuffer, mSimulationPipelineLayout, VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(pushConstants), &pushConstants);
+
+    // the survivors and the new particles are both appended to the destination through its counter
+    barrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+    vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, mUpdatePipeline);
+    vkCmdDispatchIndirect(commandBuffer, mCounterBuffer, COUNTER_DISPATCH_OFFSET);
+
+    // the update also consumed the dispatch arguments before the finalize pass overwrites them
+    vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 1, &barrier, 0, nullptr, 0, nullptr);
+
+    if (0 != slot.maxSpawnCount) {
+        vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, mEmitPipeline);
+        vkCmdDispatch(commandBuffer, (slot.maxSpawnCount + PARTICLE_GROUP_SIZE - 1) / PARTICLE_GROUP_SIZE, slot.emitterCount, 1);
+        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 1, &barrier, 0, nullptr, 0, nullptr);
+    }
+
+    // a single invocation clamps the count and turns it into the arguments of the next update and of the draw
+    vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, mFinalizePipeline);
+    vkCmdDispatch(commandBuffer, 1, 1, 1);
+
+    barrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_INDIRECT_COMMAND_READ_BIT;
+    vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 1,
+                         &barrier, 0, nullptr, 0, nullptr);
+
+    mSource = 1 - mSource;
+}
+
+auto VulkanParticleSystem::recordDraws(VkCommandBuffer commandBuffer, const glm::mat4& view, const glm::mat4& projection) const -> void {
+    // the rows of the view rotation are the camera axes in world space
+    const DrawPushConstants pushConstants{.viewProjection = projection * view,
+                                          .right = glm::vec4(view[0][0], view[1][0], view[2][0], 0.0f) * PARTICLE_SIZE_WORLD,
+                                          .up = glm::vec4(view[0][1], view[1][1], view[2][1], 0.0f) * PARTICLE_SIZE_WORLD};
+
+    // the last simulation wrote the source of the next one
+    vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, mDrawPipeline);
+    vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, mDrawPipelineLayout, 0, 1, &mDrawSets[mSource], 0, nullptr);
+    vkCmdPushConstants(commandBuffer, mDrawPipelineLayout, VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(pushConstants), &pushConstants);
+    vkCmdDrawIndirect(commandBuffer, mCounterBuffer, COUNTER_DRAW_OFFSET, 1, sizeof(VkDrawIndirectCommand));
+}
@@ -0,0 +1,114 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#if !defined(__ADELIE_RENDERER_VULKAN_VULKANPARTICLESYSTEM_HXX__)
+    #define __ADELIE_RENDERER_VULKAN_VULKANPARTICLESYSTEM_HXX__
+
+    #include <vulkan/vulkan.h>
+
+    #include <adelie/adelie.hxx>
+    #include <adelie/core/renderer/RenderSnapshot.hxx>
+    #include <adelie/renderer/vulkan/VulkanDeletionQueue.hxx>
+    #include <array>
+    #include <cstdint>
+    #include <span>
+    #include <vector>
+
+namespace adelie::renderer::vulkan {
+
+    // the number of particles alive at the same time and the number of emitters of a frame, the particles and emitters
+    // beyond them are dropped
+    static inline constexpr uint32_t PARTICLE_MAX_COUNT = 1U << 20U;
+    static inline constexpr uint32_t PARTICLE_MAX_EMITTERS = 64;
+
+    // an emitter of a frame as seen by the shaders, the layout matches the Emitter struct of particle_emit.comp
+    // (std430)
+    struct ADELIE_API VulkanGpuParticleEmitter {
+            glm::vec4 positionSpread;   // world space position and the half angle of the cone
+            glm::vec4 directionSpeed;   // the axis of the cone and the speed
+            glm::vec4 colorLifetime;    // color and lifetime
+            uint32_t spawnCount;        // the particles spawned this frame
+            uint32_t seed;
+            std::array<uint32_t, 2> padding;
+    }; /* struct VulkanGpuParticleEmitter */
+
+    // simulates the particles entirely on the GPU, the CPU only hands over the emitters of a frame
+    //
+    // the living particles are kept compact in one of two storage buffers. Every frame the update reads them from one
+    // buffer and appends the survivors to the other one, where the emitters append their new particles as well. A
+    // final single invocation turns the number of appended particles into the indirect arguments of the next update
+    // and of the draw, so no count ever travels back to the CPU
+    class ADELIE_API VulkanParticleSystem {
+        public:
+            VulkanParticleSystem(VkDevice device, VkPhysicalDevice physicalDevice, VulkanDeletionQueue& deletionQueue);
+
+            ~VulkanParticleSystem() noexcept;
+
+            VulkanParticleSystem(const VulkanParticleSystem&) = delete;
+
+            auto operator=(VulkanParticleSystem const&) -> VulkanParticleSystem& = delete;
+
+            VulkanParticleSystem(VulkanParticleSystem&&) = delete;
+
+            auto operator=(VulkanParticleSystem&&) -> VulkanParticleSystem& = delete;
+
+            // (re)creates the draw pipeline for a render pass compatible to renderPass and the emitter buffers of every
+            // frame slot. The replaced objects are retired after lastUsedFrame, the particles stay alive
+            auto resize(VkRenderPass renderPass, VkExtent2D extent, uint32_t frameCount, uint64_t lastUsedFrame) -> void;
+
+            // render thread: the emitters of the frame slot, which must not be in use by the GPU anymore. Returns the
+            // number of particles they spawn this frame
+            auto writeEmitters(uint32_t frame, std::span<const core::renderer::RenderParticleEmitter> emitters, float deltaTime) -> uint32_t;
+
+            // render thread: update, emit and compact the particles, recorded outside of a render pass
+            auto recordSimulation(VkCommandBuffer commandBuffer, uint32_t frame, float deltaTime) -> void;
+
+            // render thread: draw the particles as camera facing quads inside of a render pass, after the opaque draws
+            auto recordDraws(VkCommandBuffer commandBuffer, const glm::mat4& view, const glm::mat4& projection) const -> void;
+
+        private:
+            struct Frame {
+                    VkBuffer emitterBuffer;
+                    VkDeviceMemory emitterMemory;
+                    VulkanGpuParticleEmitter* emitters;  // persistently mapped
+                    std::array<VkDescriptorSet, 2> simulationSets;  // one per source buffer
+                    uint32_t emitterCount;
+                    uint32_t maxSpawnCount;
+            };
+
+            auto createSimulation() -> void;
+            auto createDrawPipeline(VkRenderPass renderPass, VkExtent2D extent) -> void;
+            auto createDescriptorSets() -> void;
+            auto retire(uint64_t lastUsedFrame) -> void;
+
+            VkDevice mDevice;
+            VkPhysicalDevice mPhysicalDevice;
+            VulkanDeletionQueue& mDeletionQueue;
+
+            VkDescriptorSetLayout mSimulationSetLayout;
+            VkPipelineLayout mSimulationPipelineLayout;
+            VkPipeline mUpdatePipeline;
+            VkPipeline mEmitPipeline;
+            VkPipeline mFinalizePipeline;
+            VkDescriptorSetLayout mDrawSetLayout;
+            VkPipelineLayout mDrawPipelineLayout;
+            VkPipeline mDrawPipeline;
+
+            // only the GPU touches them, so every frame uses the same ones
+            std::array<VkBuffer, 2> mParticleBuffers;
+            std::array<VkDeviceMemory, 2> mParticleMemory;
+            VkBuffer mCounterBuffer;  // the particle counts and the indirect arguments
+            VkDeviceMemory mCounterMemory;
+            bool mCountersCleared;
+            uint32_t mSource;  // the buffer the next update reads, the last simulation wrote it
+
+            std::vector<float> mSpawnRemainders;  // the fractions of a particle each emitter did not spawn yet
+            uint32_t mSeed;
+            std::vector<Frame> mFrames;
+            std::array<VkDescriptorSet, 2> mDrawSets;  // one per buffer
+            VkDescriptorPool mDescriptorPool;
+
+    }; /* class VulkanParticleSystem */
+
+} /* namespace adelie::renderer::vulkan */
+
+#endif /* if !defined(__ADELIE_RENDERER_VULKAN_VULKANPARTICLESYSTEM_HXX__) */
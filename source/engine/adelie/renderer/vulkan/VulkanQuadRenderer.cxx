@@ -0,0 +1,415 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#include <adelie/core/renderer/QuadBatch.hxx>
+#include <adelie/exception/VulkanRuntimeException.hxx>
+#include <adelie/io/Logger.hxx>
+#include <adelie/io/VirtualFileSystem.hxx>
+#include <adelie/renderer/vulkan/VulkanBufferManager.hxx>
+#include <adelie/renderer/vulkan/VulkanQuadRenderer.hxx>
+#include <adelie/renderer/vulkan/VulkanShaderManager.hxx>
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+
+using adelie::core::renderer::QUAD_WHITE_PAGE;
+using adelie::core::renderer::RenderQuad;
+using adelie::exception::VulkanRuntimeException;
+using adelie::io::VirtualFileSystem;
+using adelie::renderer::vulkan::QUAD_MAX_COUNT;
+using adelie::renderer::vulkan::QUAD_MAX_PAGES;
+using adelie::renderer::vulkan::TextureHandle;
+using adelie::renderer::vulkan::VulkanBufferManager;
+using adelie::renderer::vulkan::VulkanQuadPageContent;
+using adelie::renderer::vulkan::VulkanQuadRenderer;
+using adelie::renderer::vulkan::VulkanQuadVertex;
+using adelie::renderer::vulkan::VulkanShaderManager;
+
+namespace {
+    constexpr uint32_t VERTICES_PER_QUAD = 4;
+    constexpr uint32_t INDICES_PER_QUAD = 6;
+
+    // the set of a page was never written
+    constexpr uint32_t NO_VERSION = std::numeric_limits<uint32_t>::max();
+
+    struct QuadPushConstants {
+            glm::vec2 inverseExtent;  // maps window pixels to [0, 1]
+    };
+}  // namespace
+
+VulkanQuadRenderer::VulkanQuadRenderer(VkDevice device, VkPhysicalDevice physicalDevice, VulkanDeletionQueue& deletionQueue, VulkanTextureLoader& textureLoader, VulkanResidencyManager& residencyManager)
+    : mDeletionQueue(deletionQueue), mTextureLoader(textureLoader), mResidencyManager(residencyManager) {
+    mDevice = device;
+    mPhysicalDevice = physicalDevice;
+    mSampler = VK_NULL_HANDLE;
+    mSetLayout = VK_NULL_HANDLE;
+    mPipelineLayout = VK_NULL_HANDLE;
+    mPipeline = VK_NULL_HANDLE;
+    mDistanceFieldPipeline = VK_NULL_HANDLE;
+    mIndexBuffer = VK_NULL_HANDLE;
+    mIndexMemory = VK_NULL_HANDLE;
+    mExtent = {.width = 1, .height = 1};
+    mDescriptorPool = VK_NULL_HANDLE;
+
+    createPipelineLayout();
+    createIndexBuffer();
+
+    // the pages nobody set up fall back to plain colored quads
+    mPages.fill(mTextureLoader.create("overlay white", 1, 1, VK_FORMAT_R8G8B8A8_UNORM, std::vector<uint8_t>(4, 0xFF)));
+    mPageContents.fill(VulkanQuadPageContent::Color);
+}
+
+VulkanQuadRenderer::~VulkanQuadRenderer() noexcept {
+    // the caller ensures the device is idle and flushes the deletion queue afterwards
+    retire(0);
+    mDeletionQueue.retireBuffer(mIndexBuffer, mIndexMemory, 0);
+    mDeletionQueue.retirePipelineLayout(mPipelineLayout, 0);
+    mDeletionQueue.retireSampler(mSampler, 0);
+    vkDestroyDescriptorSetLayout(mDevice, mSetLayout, nullptr);
+}
+
+auto VulkanQuadRenderer::createPipelineLayout() -> void {
+    // the atlas pages are not repeated and have no mip levels, glyphs and sprites are drawn close to their size
+    VkSamplerCreateInfo samplerInfo{};
+    samplerInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+    samplerInfo.magFilter = VK_FILTER_LINEAR;
+    samplerInfo.minFilter = VK_FILTER_LINEAR;
+    samplerInfo.mipmapMode = VK_SAMPLER_MIPMAP_MODE_NEAREST;
+    samplerInfo.addressModeU = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+    samplerInfo.addressModeV = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+    samplerInfo.addressModeW = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+    samplerInfo.minLod = 0.0f;
+    samplerInfo.maxLod = 0.0f;
+
+    if (const auto result = vkCreateSampler(mDevice, &samplerInfo, nullptr, &mSampler); result != VK_SUCCESS) {
+        throw VulkanRuntimeException("Failed to create overlay sampler", result);
+    }
+
+    // the atlas page of a run
+    VkDescriptorSetLayoutBinding pageBinding{};
+    pageBinding.binding = 0;
+    pageBinding.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+    pageBinding.descriptorCount = 1;
+    pageBinding.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
+
+    VkDescriptorSetLayoutCreateInfo layoutInfo{};
+    layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+    layoutInfo.bindingCount = 1;
+    layoutInfo.pBindings = &pageBinding;
+
+    if (const auto result = vkCreateDescriptorSetLayout(mDevice, &layoutInfo, nullptr, &mSetLayout); result != VK_SUCCESS) {
+        throw VulkanRuntimeException("Failed to create overlay descriptor set layout", result);
+    }
+
+    VkPushConstantRange pushConstantRange{};
+    pushConstantRange.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+    pushConstantRange.offset = 0;
+    pushConstantRange.size = sizeof(QuadPushConstants);
+
+    VkPipelineLayoutCreateInfo pipelineLayoutInfo{};
+    pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+    pipelineLayoutInfo.setLayoutCount = 1;
+    pipelineLayoutInfo.pSetLayouts = &mSetLayout;
+    pipelineLayoutInfo.pushConstantRangeCount = 1;
+    pipelineLayoutInfo.pPushConstantRanges = &pushConstantRange;
+
+    if (const auto result = vkCreatePipelineLayout(mDevice, &pipelineLayoutInfo, nullptr, &mPipelineLayout); result != VK_SUCCESS) {
+        throw VulkanRuntimeException("Failed to create overlay pipeline layout", result);
+    }
+}
+
+auto VulkanQuadRenderer::createPipeline(VkRenderPass renderPass, const std::string& fragmentShader) const -> VkPipeline {
+    const auto vertCode = VirtualFileSystem::getInstance()->read("shader/quad.vert.spv");
+    const auto vertShaderModule = VulkanShaderManager::createShaderModule(mDevice, vertCode->getData());
+    const auto fragCode = VirtualFileSystem::getInstance()->read(fragmentShader);
+    const auto fragShaderModule = VulkanShaderManager::createShaderModule(mDevice, fragCode->getData());
+
+    std::array<VkPipelineShaderStageCreateInfo, 2> shaderStages{};
+    shaderStages[0].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    shaderStages[0].stage = VK_SHADER_STAGE_VERTEX_BIT;
+    shaderStages[0].module = vertShaderModule;
+    shaderStages[0].pName = "main";
+    shaderStages[1].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    shaderStages[1].stage = VK_SHADER_STAGE_FRAGMENT_BIT;
+    shaderStages[1].module = fragShaderModule;
+    shaderStages[1].pName = "main";
+
+    VkVertexInputBindingDescription bindingDescription{};
+    bindingDescription.binding = 0;
+    bindingDescription.stride = sizeof(VulkanQuadVertex);
+    bindingDescription.inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
+
+    std::array<VkVertexInputAttributeDescription, 3> attributeDescriptions{};
+    attributeDescriptions[0] = {.location = 0, .binding = 0, .format = VK_FORMAT_R32G32_SFLOAT, .offset = offsetof(VulkanQuadVertex, position)};
+    attributeDescriptions[1] = {.location = 1, .binding = 0, .format = VK_FORMAT_R32G32_SFLOAT, .offset = offsetof(VulkanQuadVertex, uv)};
+    attributeDescriptions[2] = {.location = 2, .binding = 0, .format = VK_FORMAT_R8G8B8A8_UNORM, .offset = offsetof(VulkanQuadVertex, color)};
+
+    VkPipelineVertexInputStateCreateInfo vertexInputInfo{};
+    vertexInputInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
+    vertexInputInfo.vertexBindingDescriptionCount = 1;
+    vertexInputInfo.pVertexBindingDescriptions = &bindingDescription;
+    vertexInputInfo.vertexAttributeDescriptionCount = static_cast<uint32_t>(attributeDescriptions.size());
+    vertexInputInfo.pVertexAttributeDescriptions = attributeDescriptions.data();
+
+    VkPipelineInputAssemblyStateCreateInfo inputAssembly{};
+    inputAssembly.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
+    inputAssembly.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    inputAssembly.primitiveRestartEnable = VK_FALSE;
+
+    VkViewport viewport{};
+    viewport.x = 0.0f;
+    viewport.y = 0.0f;
+    viewport.width = static_cast<float>(mExtent.width);
+    viewport.height = static_cast<float>(mExtent.height);
+    viewport.minDepth = 0.0f;
+    viewport.maxDepth = 1.0f;
+
+    VkRect2D scissor{.offset = {0, 0}, .extent = mExtent};
+
+    VkPipelineViewportStateCreateInfo viewportState{};
+    viewportState.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
+    viewportState.viewportCount = 1;
+    viewportState.pViewports = &viewport;
+    viewportState.scissorCount = 1;
+    viewportState.pScissors = &scissor;
+
+    VkPipelineRasterizationStateCreateInfo rasterizer{};
+    rasterizer.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
+    rasterizer.depthClampEnable = VK_FALSE;
+    rasterizer.rasterizerDiscardEnable = VK_FALSE;
+    rasterizer.polygonMode = VK_POLYGON_MODE_FILL;
+    rasterizer.cullMode = VK_CULL_MODE_NONE;
+    rasterizer.frontFace = VK_FRONT_FACE_COUNTER_CLOCKWISE;
+    rasterizer.depthBiasEnable = VK_FALSE;
+    rasterizer.lineWidth = 1.0f;
+
+    VkPipelineMultisampleStateCreateInfo multisampling{};
+    multisampling.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
+    multisampling.sampleShadingEnable = VK_FALSE;
+    multisampling.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
+    multisampling.minSampleShading = 1.0f;
+
+    // the overlay lies on top of the scene
+    VkPipelineDepthStencilStateCreateInfo depthStencil{};
+    depthStencil.sType = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
+    depthStencil.depthTestEnable = VK_FALSE;
+    depthStencil.depthWriteEnable = VK_FALSE;
+    depthStencil.depthCompareOp = VK_COMPARE_OP_ALWAYS;
+    depthStencil.depthBoundsTestEnable = VK_FALSE;
+    depthStencil.stencilTestEnable = VK_FALSE;
+
+    VkPipelineColorBlendAttachmentState colorBlendAttachment{};
+    colorBlendAttachment.colorWriteMask = VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
+    colorBlendAttachment.blendEnable = VK_TRUE;
+    colorBlendAttachment.srcColorBlendFactor = VK_BLEND_FACTOR_SRC_ALPHA;
+    colorBlendAttachment.dstColorBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
+    colorBlendAttachment.colorBlendOp = VK_BLEND_OP_ADD;
+    colorBlendAttachment.srcAlphaBlendFactor = VK_BLEND_FACTOR_ONE;
+    colorBlendAttachment.dstAlphaBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
+    colorBlendAttachment.alphaBlendOp = VK_BLEND_OP_ADD;
+
+    VkPipelineColorBlendStateCreateInfo colorBlending{};
+    colorBlending.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
+    colorBlending.logicOpEnable = VK_FALSE;
+    colorBlending.attachmentCount = 1;
+    colorBlending.pAttachments = &colorBlendAttachment;
+
+    VkGraphicsPipelineCreateInfo pipelineInfo{};
+    pipelineInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+    pipelineInfo.stageCount = static_cast<uint32_t>(shaderStages.size());
+    pipelineInfo.pStages = shaderStages.data();
+    pipelineInfo.pVertexInputState = &vertexInputInfo;
+    pipelineInfo.pInputAssemblyState = &inputAssembly;
+    pipelineInfo.pViewportState = &viewportState;
+    pipelineInfo.pRasterizationState = &rasterizer;
+    pipelineInfo.pMultisampleState = &multisampling;
+    pipelineInfo.pDepthStencilState = &depthStencil;
+    pipelineInfo.pColorBlendState = &colorBlending;
+    pipelineInfo.layout = mPipelineLayout;
+    pipelineInfo.renderPass = renderPass;
+    pipelineInfo.subpass = 0;
+
+    VkPipeline pipeline = VK_NULL_HANDLE;
+    const auto result = vkCreateGraphicsPipelines(mDevice, VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &pipeline);
+    vkDestroyShaderModule(mDevice, fragShaderModule, nullptr);
+    vkDestroyShaderModule(mDevice, vertShaderModule, nullptr);
+    if (result != VK_SUCCESS) {
+        throw VulkanRuntimeException("Failed to create overlay pipeline", result);
+    }
+    return pipeline;
+}
+
+auto VulkanQuadRenderer::createIndexBuffer() -> void {
+    // written once, the GPU only ever reads it
+    const VkDeviceSize size = sizeof(uint32_t) * INDICES_PER_QUAD * QUAD_MAX_COUNT;
+    VulkanBufferManager::createBuffer(mDevice, mPhysicalDevice, size, VK_BUFFER_USAGE_INDEX_BUFFER_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, mIndexBuffer,
+                                      mIndexMemory);
+
+    void* data;
+    vkMapMemory(mDevice, mIndexMemory, 0, size, 0, &data);
+    auto* indices = static_cast<uint32_t*>(data);
+    for (uint32_t quad = 0; quad < QUAD_MAX_COUNT; quad++) {
+        const uint32_t first = quad * VERTICES_PER_QUAD;
+        const std::array<uint32_t, INDICES_PER_QUAD> corners = {first, first + 1, first + 2, first + 2, first + 3, first};
+        std::ranges::copy(corners, indices + (static_cast<std::size_t>(quad) * INDICES_PER_QUAD));
+    }
+    vkUnmapMemory(mDevice, mIndexMemory);
+}
+
+auto VulkanQuadRenderer::resize(VkRenderPass renderPass, const VkExtent2D extent, const uint32_t frameCount, const uint64_t lastUsedFrame) -> void {
+    retire(lastUsedFrame);
+    mExtent = extent;
+    mPipeline = createPipeline(renderPass, "shader/quad.frag.spv");
+    mDistanceFieldPipeline = createPipeline(renderPass, "shader/quad_distance_field.frag.spv");
+
+    mFrames.resize(frameCount);
+    for (auto& frame : mFrames) {
+        VulkanBufferManager::createBuffer(mDevice, mPhysicalDevice, sizeof(VulkanQuadVertex) * VERTICES_PER_QUAD * QUAD_MAX_COUNT, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
+                                          VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, frame.vertexBuffer, frame.vertexMemory);
+        void* data;
+        vkMapMemory(mDevice, frame.vertexMemory, 0, VK_WHOLE_SIZE, 0, &data);
+        frame.vertices = static_cast<VulkanQuadVertex*>(data);
+        frame.sets.fill(VK_NULL_HANDLE);
+        frame.writtenVersions.fill(NO_VERSION);
+        frame.runs.clear();
+    }
+
+    VkDescriptorPoolSize poolSize{};
+    poolSize.type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+    poolSize.descriptorCount = frameCount * QUAD_MAX_PAGES;
+
+    VkDescriptorPoolCreateInfo poolInfo{};
+    poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+    poolInfo.poolSizeCount = 1;
+    poolInfo.pPoolSizes = &poolSize;
+    poolInfo.maxSets = frameCount * QUAD_MAX_PAGES;
+
+    if (const auto result = vkCreateDescriptorPool(mDevice, &poolInfo, nullptr, &mDescriptorPool); result != VK_SUCCESS) {
+        throw VulkanRuntimeException("Failed to create overlay descriptor pool", result);
+    }
+
+    // the sets are written once a run samples their page
+    const std::vector<VkDescriptorSetLayout> layouts(QUAD_MAX_PAGES, mSetLayout);
+    for (auto& frame : mFrames) {
+        VkDescriptorSetAllocateInfo allocInfo{};
+        allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+        allocInfo.descriptorPool = mDescriptorPool;
+        allocInfo.descriptorSetCount = QUAD_MAX_PAGES;
+        allocInfo.pSetLayouts = layouts.data();
+
+        if (const auto result = vkAllocateDescriptorSets(mDevice, &allocInfo, frame.sets.data()); result != VK_SUCCESS) {
+            throw VulkanRuntimeException("Failed to allocate overlay descriptor sets", result);
+        }
+    }
+}
+
+auto VulkanQuadRenderer::retire(const uint64_t lastUsedFrame) -> void {
+    // the mapped vertex memory is unmapped implicitly when it is freed
+    for (const auto& frame : mFrames) {
+        mDeletionQueue.retireBuffer(frame.vertexBuffer, frame.vertexMemory, lastUsedFrame);
+    }
+    mFrames.clear();
+
+    if (VK_NULL_HANDLE != mDescriptorPool) {
+        mDeletionQueue.retireDescriptorPool(mDescriptorPool, lastUsedFrame);
+        mDescriptorPool = VK_NULL_HANDLE;
+    }
+
+    if (VK_NULL_HANDLE != mPipeline) {
+        mDeletionQueue.retirePipeline(mPipeline, lastUsedFrame);
+        mPipeline = VK_NULL_HANDLE;
+    }
+
+    if (VK_NULL_HANDLE != mDistanceFieldPipeline) {
+        mDeletionQueue.retirePipeline(mDistanceFieldPipeline, lastUsedFrame);
+        mDistanceFieldPipeline = VK_NULL_HANDLE;
+    }
+}
+
+auto VulkanQuadRenderer::setPage(const uint32_t page, const TextureHandle texture, const VulkanQuadPageContent content) -> void {
+    if (page >= QUAD_MAX_PAGES) {
+        AdelieLogWarning("Ignoring overlay page {}, the overlay only handles {} pages", page, QUAD_MAX_PAGES);
+        return;
+    }
+
+    mPages[page] = texture;
+    mPageContents[page] = content;
+    for (auto& frame : mFrames) {
+        frame.writtenVersions[page] = NO_VERSION;
+    }
+}
+
+auto VulkanQuadRenderer::writeQuads(const uint32_t frame, const uint64_t frameNumber, const std::span<const RenderQuad> quads) -> uint32_t {
+    const auto count = static_cast<uint32_t>(std::min<std::size_t>(quads.size(), QUAD_MAX_COUNT));
+    if (count < quads.size()) {
+        AdelieLogWarning("Dropping {} of {} overlay quads, the overlay only handles {}", quads.size() - count, quads.size(), QUAD_MAX_COUNT);
+    }
+
+    auto& slot = mFrames[frame];
+    slot.runs.clear();
+    for (uint32_t index = 0; index < count; index++) {
+        const auto& quad = quads[index];
+        auto* corners = slot.vertices + (static_cast<std::size_t>(index) * VERTICES_PER_QUAD);
+        corners[0] = {.position = quad.min, .uv = quad.uvMin, .color = quad.color};
+        corners[1] = {.position = glm::vec2(quad.max.x, quad.min.y), .uv = glm::vec2(quad.uvMax.x, quad.uvMin.y), .color = quad.color};
+        corners[2] = {.position = quad.max, .uv = quad.uvMax, .color = quad.color};
+        corners[3] = {.position = glm::vec2(quad.min.x, quad.max.y), .uv = glm::vec2(quad.uvMin.x, quad.uvMax.y), .color = quad.color};
+
+        const auto page = quad.page < QUAD_MAX_PAGES ? quad.page : QUAD_WHITE_PAGE;
+        if (slot.runs.empty() || slot.runs.back().page != page) {
+            slot.runs.push_back({.page = page, .firstQuad = index, .quadCount = 0});
+        }
+        slot.runs.back().quadCount++;
+    }
+
+    // the set of a page is only rewritten when the image behind its texture changed
+    for (const auto& run : slot.runs) {
+        const auto texture = mPages[run.page];
+        mResidencyManager.markUsed(texture, frameNumber);
+        const auto version = mTextureLoader.getVersion(texture);
+        if (version == slot.writtenVersions[run.page]) {
+            continue;
+        }
+        slot.writtenVersions[run.page] = version;
+
+        VkDescriptorImageInfo imageInfo{};
+        imageInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        imageInfo.imageView = mTextureLoader.getImageView(texture);
+        imageInfo.sampler = mSampler;
+
+        VkWriteDescriptorSet descriptorWrite{};
+        descriptorWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        descriptorWrite.dstSet = slot.sets[run.page];
+        descriptorWrite.dstBinding = 0;
+        descriptorWrite.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        descriptorWrite.descriptorCount = 1;
+        descriptorWrite.pImageInfo = &imageInfo;
+        vkUpdateDescriptorSets(mDevice, 1, &descriptorWrite, 0, nullptr);
+    }
+    return static_cast<uint32_t>(slot.runs.size());
+}
+
+auto VulkanQuadRenderer::recordDraws(VkCommandBuffer commandBuffer, const uint32_t frame) const -> void {
+    const auto& slot = mFrames[frame];
+    if (slot.runs.empty()) {
+        return;
+    }
+
+    const VkDeviceSize offset = 0;
+    const QuadPushConstants pushConstants{.inverseExtent = glm::vec2(1.0f / static_cast<float>(mExtent.width), 1.0f / static_cast<float>(mExtent.height))};
+    vkCmdBindVertexBuffers(commandBuffer, 0, 1, &slot.vertexBuffer, &offset);
+    vkCmdBindIndexBuffer(commandBuffer, mIndexBuffer, 0, VK_INDEX_TYPE_UINT32);
+
+    // both pipelines share the layout, so the push constants survive switching between them
+    VkPipeline boundPipeline = VK_NULL_HANDLE;
+    for (const auto& run : slot.runs) {
+        if (const auto pipeline = VulkanQuadPageContent::DistanceField == mPageContents[run.page] ? mDistanceFieldPipeline : mPipeline; pipeline != boundPipeline) {
+            vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
+            if (VK_NULL_HANDLE == boundPipeline) {
+                vkCmdPushConstants(commandBuffer, mPipelineLayout, VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(pushConstants), &pushConstants);
+            }
+            boundPipeline = pipeline;
+        }
+        vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, mPipelineLayout, 0, 1, &slot.sets[run.page], 0, nullptr);
+        vkCmdDrawIndexed(commandBuffer, run.quadCount * INDICES_PER_QUAD, 1, run.firstQuad * INDICES_PER_QUAD, 0, 0);
+    }
+}
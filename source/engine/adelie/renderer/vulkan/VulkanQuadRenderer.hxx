@@ -0,0 +1,117 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#if !defined(__ADELIE_RENDERER_VULKAN_VULKANQUADRENDERER_HXX__)
+    #define __ADELIE_RENDERER_VULKAN_VULKANQUADRENDERER_HXX__
+
+    #include <vulkan/vulkan.h>
+
+    #include <adelie/adelie.hxx>
+    #include <adelie/core/renderer/RenderSnapshot.hxx>
+    #include <adelie/renderer/vulkan/VulkanDeletionQueue.hxx>
+    #include <adelie/renderer/vulkan/VulkanResidencyManager.hxx>
+    #include <adelie/renderer/vulkan/VulkanTextureLoader.hxx>
+    #include <array>
+    #include <cstdint>
+    #include <span>
+    #include <string>
+    #include <vector>
+
+namespace adelie::renderer::vulkan {
+
+    // the number of overlay quads a frame can draw and the number of atlas pages they can sample, the quads beyond
+    // them are dropped
+    static inline constexpr uint32_t QUAD_MAX_COUNT = 16384;
+    static inline constexpr uint32_t QUAD_MAX_PAGES = 16;
+
+    // how the quads of an atlas page turn its texels into colors, the glyphs of a font are kept as distance fields in
+    // the alpha channel (see core::renderer::Font)
+    enum class VulkanQuadPageContent : unsigned char { Color, DistanceField };
+
+    // a corner of an overlay quad, see quad.vert
+    struct ADELIE_API VulkanQuadVertex {
+            glm::vec2 position;  // in window pixels
+            glm::vec2 uv;
+            uint32_t color;  // R8G8B8A8
+    }; /* struct VulkanQuadVertex */
+
+    // draws the 2D quads of the overlay on top of the frame
+    //
+    // the quads arrive sorted by their layer and atlas page (see core::renderer::QuadBatch). Their corners are written
+    // into a persistently mapped vertex buffer of the frame slot and each run of quads sharing a page becomes a single
+    // indexed draw, so a whole overlay costs as many draws as it changes pages. The pages holding distance fields are
+    // drawn by a second pipeline, which turns the distance into a coverage that stays sharp at any size
+    class ADELIE_API VulkanQuadRenderer {
+        public:
+            VulkanQuadRenderer(VkDevice device, VkPhysicalDevice physicalDevice, VulkanDeletionQueue& deletionQueue, VulkanTextureLoader& textureLoader, VulkanResidencyManager& residencyManager);
+
+            ~VulkanQuadRenderer() noexcept;
+
+            VulkanQuadRenderer(const VulkanQuadRenderer&) = delete;
+
+            auto operator=(VulkanQuadRenderer const&) -> VulkanQuadRenderer& = delete;
+
+            VulkanQuadRenderer(VulkanQuadRenderer&&) = delete;
+
+            auto operator=(VulkanQuadRenderer&&) -> VulkanQuadRenderer& = delete;
+
+            // (re)creates the pipeline for a render pass compatible to renderPass and the vertex buffers of every frame
+            // slot, the replaced ones are retired after lastUsedFrame
+            auto resize(VkRenderPass renderPass, VkExtent2D extent, uint32_t frameCount, uint64_t lastUsedFrame) -> void;
+
+            // the texture the quads of an atlas page sample, page core::renderer::QUAD_WHITE_PAGE is set up already
+            auto setPage(uint32_t page, TextureHandle texture, VulkanQuadPageContent content) -> void;
+
+            // render thread: the vertices and the draws of the frame slot, which must not be in use by the GPU anymore.
+            // Returns the number of draws
+            auto writeQuads(uint32_t frame, uint64_t frameNumber, std::span<const core::renderer::RenderQuad> quads) -> uint32_t;
+
+            // render thread: draw the quads of the frame slot inside of a render pass, after everything else
+            auto recordDraws(VkCommandBuffer commandBuffer, uint32_t frame) const -> void;
+
+        private:
+            // consecutive quads sampling the same page
+            struct Run {
+                    uint32_t page;
+                    uint32_t firstQuad;
+                    uint32_t quadCount;
+            };
+
+            struct Frame {
+                    VkBuffer vertexBuffer;
+                    VkDeviceMemory vertexMemory;
+                    VulkanQuadVertex* vertices;  // persistently mapped
+                    std::array<VkDescriptorSet, QUAD_MAX_PAGES> sets;
+                    std::array<uint32_t, QUAD_MAX_PAGES> writtenVersions;  // of the page textures in the sets
+                    std::vector<Run> runs;
+            };
+
+            auto createPipelineLayout() -> void;
+            [[nodiscard]] auto createPipeline(VkRenderPass renderPass, const std::string& fragmentShader) const -> VkPipeline;
+            auto createIndexBuffer() -> void;
+            auto retire(uint64_t lastUsedFrame) -> void;
+
+            VkDevice mDevice;
+            VkPhysicalDevice mPhysicalDevice;
+            VulkanDeletionQueue& mDeletionQueue;
+            VulkanTextureLoader& mTextureLoader;
+            VulkanResidencyManager& mResidencyManager;
+
+            VkSampler mSampler;
+            VkDescriptorSetLayout mSetLayout;
+            VkPipelineLayout mPipelineLayout;
+            VkPipeline mPipeline;
+            VkPipeline mDistanceFieldPipeline;
+            VkBuffer mIndexBuffer;  // the same two triangles for every quad
+            VkDeviceMemory mIndexMemory;
+
+            std::array<TextureHandle, QUAD_MAX_PAGES> mPages;
+            std::array<VulkanQuadPageContent, QUAD_MAX_PAGES> mPageContents;
+            VkExtent2D mExtent;
+            std::vector<Frame> mFrames;
+            VkDescriptorPool mDescriptorPool;
+
+    }; /* class VulkanQuadRenderer */
+
+} /* namespace adelie::renderer::vulkan */
+
+#endif /* if !defined(__ADELIE_RENDERER_VULKAN_VULKANQUADRENDERER_HXX__) */
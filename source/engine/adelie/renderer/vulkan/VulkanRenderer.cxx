@@ -1,30 +1,87 @@
 // Copyright (c) 2025 by Tim Janke. All rights reserved.
 
+#include <adelie/renderer/vulkan/VulkanRenderer.hxx>
 #include <vulkan/vk_enum_string_helper.h>
 
 #include <adelie/adelie.hxx>
 #include <adelie/core/Assert.hxx>
+#include <adelie/core/FrameClock.hxx>
+#include <adelie/core/InputSystem.hxx>
+#include <adelie/core/SimulationLoop.hxx>
+#include <adelie/core/events/EventBus.hxx>
+#include <adelie/core/renderer/Renderer.hxx>
+#include <adelie/core/renderer/ShadowCascades.hxx>
 #include <adelie/core/renderer/WindowFactory.hxx>
+#include <adelie/core/scene/Components.hxx>
 #include <adelie/exception/RuntimeException.hxx>
 #include <adelie/exception/VulkanRuntimeException.hxx>
 #include <adelie/io/Logger.hxx>
+#include <adelie/io/VirtualFileSystem.hxx>
 #include <adelie/renderer/vulkan/VulkanBufferManager.hxx>
+#include <adelie/renderer/vulkan/VulkanClusteredLighting.hxx>
+#include <adelie/renderer/vulkan/VulkanDeletionQueue.hxx>
 #include <adelie/renderer/vulkan/VulkanExtensionManager.hxx>
-#include <adelie/renderer/vulkan/VulkanRenderer.hxx>
+#include <adelie/renderer/vulkan/VulkanOcclusionCuller.hxx>
+#include <adelie/renderer/vulkan/VulkanParticleSystem.hxx>
+#include <adelie/renderer/vulkan/VulkanQuadRenderer.hxx>
+#include <adelie/renderer/vulkan/VulkanResidencyManager.hxx>
 #include <adelie/renderer/vulkan/VulkanShaderManager.hxx>
+#include <adelie/renderer/vulkan/VulkanShadowCascades.hxx>
+#include <adelie/renderer/vulkan/VulkanTimelineSemaphore.hxx>
 #include <adelie/renderer/vulkan/VulkanVertex.hxx>
+#include <algorithm>
 #include <boost/algorithm/string/join.hpp>
+#include <cmath>
+#include <exception>
+#include <format>
 #include <glm/gtc/matrix_transform.hpp>
-
+#include <iterator>
+#include <string>
+#include <thread>
+
+using adelie::core::FrameClock;
+using adelie::core::InputFrame;
+using adelie::core::InputSystem;
+using adelie::core::SimulationLoop;
+using adelie::core::events::EventBus;
+using adelie::core::renderer::QUAD_FONT_PAGE;
+using adelie::core::renderer::RenderCommand;
+using adelie::core::renderer::Renderer;
+using adelie::core::renderer::RenderSnapshot;
+using adelie::core::renderer::SHADOW_CASCADE_COUNT;
+using adelie::core::renderer::ShadowCascades;
 using adelie::core::renderer::WindowFactory;
 using adelie::core::renderer::WindowInterface;
 using adelie::core::renderer::WindowType;
+using adelie::core::scene::BoundsComponent;
+using adelie::core::scene::BvhProxy;
+using adelie::core::scene::Entity;
+using adelie::core::scene::Frustum;
+using adelie::core::scene::LocalToWorldComponent;
+using adelie::core::scene::LodComponent;
+using adelie::core::scene::MeshComponent;
+using adelie::core::scene::ParticleEmitterComponent;
+using adelie::core::scene::PointLightComponent;
+using adelie::core::scene::TransformNodeComponent;
 using adelie::exception::RuntimeException;
 using adelie::exception::VulkanRuntimeException;
+using adelie::io::LogCategory;
+using adelie::io::VirtualFileSystem;
 using adelie::renderer::vulkan::VulkanBufferManager;
+using adelie::renderer::vulkan::VulkanClusteredLighting;
+using adelie::renderer::vulkan::VulkanDeletionQueue;
 using adelie::renderer::vulkan::VulkanExtensionManager;
+using adelie::renderer::vulkan::VulkanGpuLight;
+using adelie::renderer::vulkan::VulkanGpuInstance;
+using adelie::renderer::vulkan::VulkanOcclusionCuller;
+using adelie::renderer::vulkan::VulkanParticleSystem;
+using adelie::renderer::vulkan::VulkanQuadPageContent;
+using adelie::renderer::vulkan::VulkanQuadRenderer;
 using adelie::renderer::vulkan::VulkanRenderer;
+using adelie::renderer::vulkan::VulkanResidencyManager;
 using adelie::renderer::vulkan::VulkanShaderManager;
+using adelie::renderer::vulkan::VulkanShadowCascades;
+using adelie::renderer::vulkan::VulkanTimelineSemaphore;
 using adelie::renderer::vulkan::VulkanVertex;
 
 const std::vector<VulkanVertex> vertices = {
@@ -74,11 +131,26 @@ const std::vector<uint16_t> indices = {
     20, 21, 22, 22, 23, 20};
 
 struct UniformBufferObject {
-        glm::mat4 model;
         glm::mat4 view;
         glm::mat4 proj;
+        glm::vec4 clusterParameters;  // scale and bias of the depth slices of the light clusters, viewport size
+        std::array<glm::mat4, SHADOW_CASCADE_COUNT> shadowViewProjections;
+        glm::vec4 shadowSplits;    // the view depth each cascade ends at
+        glm::vec4 lightDirection;  // towards the directional light
 };
 
+// how far in front of a cascade, towards the light, a caster still throws a shadow into it
+constexpr float SHADOW_CASTER_DISTANCE = 20.0f;
+
+// the depth buffer is sampled by the occlusion culling, see supportsRequiredFeatures
+constexpr VkFormat DEPTH_FORMAT = VK_FORMAT_D32_SFLOAT;
+
+// the frame statistics in the top left corner are averaged over this many seconds, so their text stays readable and
+// is shaped only a few times per second
+constexpr float FRAME_STATS_INTERVAL = 0.25f;
+constexpr float FRAME_STATS_SIZE = 16.0f;
+constexpr uint32_t FRAME_STATS_LAYER = 0xFFFF;  // on top of the layers
+
 VulkanRenderer::VulkanRenderer(const std::shared_ptr<WindowInterface>& windowInterface) {
     mInstance = VK_NULL_HANDLE;
     mDebugMessenger = VK_NULL_HANDLE;
@@ -92,9 +164,13 @@ VulkanRenderer::VulkanRenderer(const std::shared_ptr<WindowInterface>& windowInt
     mSwapChainExtent = {.width = 0, .height = 0};
     mSwapChainImageViews.clear();
     mRenderPass = VK_NULL_HANDLE;
+    mContinueRenderPass = VK_NULL_HANDLE;
     mDescriptorSetLayout = VK_NULL_HANDLE;
     mPipelineLayout = VK_NULL_HANDLE;
     mGraphicsPipeline = VK_NULL_HANDLE;
+    mDepthImage = VK_NULL_HANDLE;
+    mDepthImageMemory = VK_NULL_HANDLE;
+    mDepthImageView = VK_NULL_HANDLE;
     mSwapChainFramebuffers.clear();
     mCommandPool = VK_NULL_HANDLE;
 
@@ -105,25 +181,34 @@ VulkanRenderer::VulkanRenderer(const std::shared_ptr<WindowInterface>& windowInt
     mUniformBuffers.clear();
     mUniformBuffersMemory.clear();
 
-    mTextureImage = VK_NULL_HANDLE;
-    mTextureImageMemory = VK_NULL_HANDLE;
-    mTextureImageView = VK_NULL_HANDLE;
     mTextureSampler = VK_NULL_HANDLE;
-    mNormalMapImage = VK_NULL_HANDLE;
-    mNormalMapImageMemory = VK_NULL_HANDLE;
-    mNormalMapImageView = VK_NULL_HANDLE;
-    mRoughnessMapImage = VK_NULL_HANDLE;
-    mRoughnessMapImageMemory = VK_NULL_HANDLE;
-    mRoughnessMapImageView = VK_NULL_HANDLE;
+    mTextureLoader = nullptr;
+    mOcclusionCuller = nullptr;
+    mInstances.clear();
+    mClusteredLighting = nullptr;
+    mLights.clear();
+    mShadowCascades = nullptr;
+    mShadowCasters.clear();
+    mParticleSystem = nullptr;
+    mQuadRenderer = nullptr;
+    mFontPageSet = false;
+    mMaterialTextures = {};
+    mDescriptorSetTextureVersions.clear();
     mImageAvailableSemaphores.clear();
     mRenderFinishedSemaphores.clear();
-    mInFlightFences.clear();
+    mFrameTimeline = nullptr;
+    mDeletionQueue = nullptr;
+    mFrameNumber = 0;
     mCommandBuffers.clear();
     mCurrentFrame = 0;
     mDescriptorSets.clear();
     mDescriptorPool = VK_NULL_HANDLE;
     mWindowInterface = windowInterface;
 
+    int windowWidth = 0, windowHeight = 0;
+    mWindowInterface->getWindowSize(windowWidth, windowHeight);
+    mWindowExtent = {.width = static_cast<uint32_t>(windowWidth), .height = static_cast<uint32_t>(windowHeight)};
+
     AdelieLogDebug("Start initializing VulkanRenderer");
 
     VkApplicationInfo appInfo{};
@@ -132,7 +217,7 @@ VulkanRenderer::VulkanRenderer(const std::shared_ptr<WindowInterface>& windowInt
     appInfo.applicationVersion = VK_MAKE_VERSION(1, 0, 0);  // TODO: use the application version
     appInfo.pEngineName = "Adelie Engine";
     appInfo.engineVersion = VK_MAKE_VERSION(1, 0, 0);  // TODO: use the correct version
-    appInfo.apiVersion = VK_API_VERSION_1_0;
+    appInfo.apiVersion = VK_API_VERSION_1_2;  // required for timeline semaphores
 
     VkInstanceCreateInfo createInfo{};
     createInfo.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
@@ -178,7 +263,11 @@ VulkanRenderer::VulkanRenderer(const std::shared_ptr<WindowInterface>& windowInt
 
     VkDebugUtilsMessengerCreateInfoEXT debugUtilsCreateInfo{};
     debugUtilsCreateInfo.sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT;
-    debugUtilsCreateInfo.messageSeverity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_VERBOSE_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT;
+    debugUtilsCreateInfo.messageSeverity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT;
+#if ADELIE_LOG_MIN_LEVEL <= ADELIE_LOG_LEVEL_TRACE
+    // verbose messages are only logged as traces, without them the layers do not need to call us at all
+    debugUtilsCreateInfo.messageSeverity |= VK_DEBUG_UTILS_MESSAGE_SEVERITY_VERBOSE_BIT_EXT;
+#endif
     debugUtilsCreateInfo.messageType = VK_DEBUG_UTILS_MESSAGE_TYPE_GENERAL_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_TYPE_PERFORMANCE_BIT_EXT;
     debugUtilsCreateInfo.pfnUserCallback = debugCallback;
     debugUtilsCreateInfo.pUserData = nullptr;
@@ -194,20 +283,44 @@ VulkanRenderer::VulkanRenderer(const std::shared_ptr<WindowInterface>& windowInt
     createImageViews();
     createRenderPass();
     createDescriptorSetLayout();
+
     createGraphicsPipeline();
+    createDepthResources();
     createFramebuffers();
     createCommandPool();
 
     /* specific for the test only: START */
     calculateTangents(const_cast<std::vector<VulkanVertex>&>(vertices), indices);
 
+    std::vector<glm::vec3> positions;
+    positions.reserve(vertices.size());
+    for (const auto& vertex : vertices) {
+        positions.push_back(vertex.pos);
+    }
+    const std::vector<uint32_t> meshIndices(indices.begin(), indices.end());
+    mGeometryPool.addMesh(positions, meshIndices, 0);
+
     createVertexBuffer();
     createIndexBuffer();
     createUniformBuffers();
 
-    createTexture("albedo.png", VK_FORMAT_R8G8B8A8_SRGB, mTextureImage, mTextureImageMemory, mTextureImageView);
-    createTexture("normal.png", VK_FORMAT_R8G8B8A8_UNORM, mNormalMapImage, mNormalMapImageMemory, mNormalMapImageView);              // Assuming UNORM for normal map
-    createTexture("roughness.png", VK_FORMAT_R8G8B8A8_UNORM, mRoughnessMapImage, mRoughnessMapImageMemory, mRoughnessMapImageView);  // Assuming UNORM
+    mOcclusionCuller = std::make_unique<VulkanOcclusionCuller>(*mLogicalDevice, *mPhysicalDevice, *mDeletionQueue);
+    mOcclusionCuller->resize(mDepthImageView, mSwapChainExtent, MAX_FRAMES_IN_FLIGHT, 0);
+    mClusteredLighting = std::make_unique<VulkanClusteredLighting>(*mLogicalDevice, *mPhysicalDevice, *mDeletionQueue);
+    mClusteredLighting->resize(MAX_FRAMES_IN_FLIGHT, 0);
+    mShadowCascades = std::make_unique<VulkanShadowCascades>(*mLogicalDevice, *mPhysicalDevice, *mDeletionQueue);
+    mShadowCascades->resize(MAX_FRAMES_IN_FLIGHT, 0);
+    mParticleSystem = std::make_unique<VulkanParticleSystem>(*mLogicalDevice, *mPhysicalDevice, *mDeletionQueue);
+    mParticleSystem->resize(mContinueRenderPass, mSwapChainExtent, MAX_FRAMES_IN_FLIGHT, 0);
+
+    // the textures are decoded in the background, until then a neutral placeholder texel is sampled
+    mTextureLoader = std::make_unique<VulkanTextureLoader>(*mLogicalDevice, *mPhysicalDevice, *mDeletionQueue);
+    mMaterialTextures[0] = mTextureLoader->load("albedo.png", VK_FORMAT_R8G8B8A8_SRGB, 0xFFFFFFFFU);
+    mMaterialTextures[1] = mTextureLoader->load("normal.png", VK_FORMAT_R8G8B8A8_UNORM, 0xFFFF8080U);     // flat tangent-space normal
+    mMaterialTextures[2] = mTextureLoader->load("roughness.png", VK_FORMAT_R8G8B8A8_UNORM, 0xFFFFFFFFU);  // fully rough
+
+    mQuadRenderer = std::make_unique<VulkanQuadRenderer>(*mLogicalDevice, *mPhysicalDevice, *mDeletionQueue, *mTextureLoader, *mResidencyManager);
+    mQuadRenderer->resize(mContinueRenderPass, mSwapChainExtent, MAX_FRAMES_IN_FLIGHT, 0);
 
     createTextureSampler();
     createDescriptorPool();
@@ -215,6 +328,43 @@ VulkanRenderer::VulkanRenderer(const std::shared_ptr<WindowInterface>& windowInt
     createCommandBuffers();
     createSyncObjects();
 
+    // the scene is a single cube unless the client filled it
+    auto& scene = Renderer::getScene();
+    auto& world = scene.getWorld();
+    if (0 == world.getEntityCount()) {
+        const auto cube = world.createEntity();
+        const auto node = scene.getTransforms().createNode({.position = glm::vec3(0.0f), .rotation = glm::quat(1.0f, 0.0f, 0.0f, 0.0f), .scale = glm::vec3(1.0f)});
+        world.addComponent(cube, TransformNodeComponent{.node = node});
+        world.addComponent(cube, LocalToWorldComponent{.matrix = glm::mat4(1.0f), .previousMatrix = glm::mat4(1.0f)});
+        world.addComponent(cube, MeshComponent{.meshId = 0});
+        world.addComponent(cube, LodComponent{.lod = 0});
+        world.addComponent(cube, BoundsComponent{.localBounds = {.min = glm::vec3(-0.5f), .max = glm::vec3(0.5f)}, .proxy = adelie::core::scene::BVH_NULL});
+
+        // a ring of colored point lights around it
+        for (uint32_t i = 0; i < 8; i++) {
+            const float angle = glm::radians(45.0f * static_cast<float>(i));
+            const auto position = glm::vec3(std::cos(angle), std::sin(angle), 0.0f) * 1.2f;
+            const auto light = world.createEntity();
+            const auto lightNode = scene.getTransforms().createNode({.position = position, .rotation = glm::quat(1.0f, 0.0f, 0.0f, 0.0f), .scale = glm::vec3(1.0f)});
+            world.addComponent(light, TransformNodeComponent{.node = lightNode});
+            world.addComponent(light, LocalToWorldComponent{.matrix = glm::translate(glm::mat4(1.0f), position), .previousMatrix = glm::translate(glm::mat4(1.0f), position)});
+            world.addComponent(light, PointLightComponent{.color = glm::vec3(i & 1U, (i >> 1U) & 1U, (i >> 2U) & 1U) * 0.5f + 0.5f, .intensity = 0.5f, .range = 1.5f});
+        }
+
+        // and a fountain of sparks on top of it
+        const auto fountain = world.createEntity();
+        const auto fountainPosition = glm::vec3(0.0f, 0.0f, 0.6f);
+        const auto fountainNode = scene.getTransforms().createNode({.position = fountainPosition, .rotation = glm::quat(1.0f, 0.0f, 0.0f, 0.0f), .scale = glm::vec3(1.0f)});
+        world.addComponent(fountain, TransformNodeComponent{.node = fountainNode});
+        world.addComponent(fountain, LocalToWorldComponent{.matrix = glm::translate(glm::mat4(1.0f), fountainPosition), .previousMatrix = glm::translate(glm::mat4(1.0f), fountainPosition)});
+        world.addComponent(fountain, ParticleEmitterComponent{.direction = glm::vec3(0.0f, 0.0f, 1.0f),
+                                                              .spread = glm::radians(25.0f),
+                                                              .color = glm::vec3(1.0f, 0.6f, 0.2f),
+                                                              .speed = 2.5f,
+                                                              .rate = 200000.0f,
+                                                              .lifetime = 4.0f});
+    }
+
     mainLoop();
     /* specific for the test only: END */
 }
@@ -223,10 +373,52 @@ VulkanRenderer::~VulkanRenderer() noexcept {
     AdelieLogDebug("Cleaning up VulkanRenderer");
     vkDeviceWaitIdle(*mLogicalDevice);
 
-    for (size_t i = 0; i < mSwapChainImages.size(); i++) {
+    for (size_t i = 0; i < mImageAvailableSemaphores.size(); i++) {
         vkDestroySemaphore(*mLogicalDevice, mRenderFinishedSemaphores[i], nullptr);
         vkDestroySemaphore(*mLogicalDevice, mImageAvailableSemaphores[i], nullptr);
-        vkDestroyFence(*mLogicalDevice, mInFlightFences[i], nullptr);
+    }
+    mFrameTimeline.reset();
+
+    // the overlay samples the textures of the loader
+    if (mQuadRenderer) {
+        mQuadRenderer.reset();
+        AdelieLogTrace("  quad renderer destroyed");
+    }
+
+    if (mTextureLoader) {
+        mTextureLoader.reset();
+        AdelieLogTrace("  textures destroyed");
+    }
+
+    if (VK_NULL_HANDLE != mTextureSampler) {
+        vkDestroySampler(*mLogicalDevice, mTextureSampler, nullptr);
+        mTextureSampler = VK_NULL_HANDLE;
+        AdelieLogTrace("  texture sampler destroyed");
+    }
+
+    if (mOcclusionCuller) {
+        mOcclusionCuller.reset();
+        AdelieLogTrace("  occlusion culler destroyed");
+    }
+
+    if (mClusteredLighting) {
+        mClusteredLighting.reset();
+        AdelieLogTrace("  clustered lighting destroyed");
+    }
+
+    if (mShadowCascades) {
+        mShadowCascades.reset();
+        AdelieLogTrace("  shadow cascades destroyed");
+    }
+
+    if (mParticleSystem) {
+        mParticleSystem.reset();
+        AdelieLogTrace("  particle system destroyed");
+    }
+
+    if (mDeletionQueue) {
+        mDeletionQueue.reset();
+        AdelieLogTrace("  deletion queue flushed");
     }
 
     if (VK_NULL_HANDLE != mCommandPool) {
@@ -243,6 +435,16 @@ VulkanRenderer::~VulkanRenderer() noexcept {
         AdelieLogTrace("  frame buffers destroyed");
     }
 
+    if (VK_NULL_HANDLE != mDepthImage) {
+        vkDestroyImageView(*mLogicalDevice, mDepthImageView, nullptr);
+        vkDestroyImage(*mLogicalDevice, mDepthImage, nullptr);
+        vkFreeMemory(*mLogicalDevice, mDepthImageMemory, nullptr);
+        mDepthImageView = VK_NULL_HANDLE;
+        mDepthImage = VK_NULL_HANDLE;
+        mDepthImageMemory = VK_NULL_HANDLE;
+        AdelieLogTrace("  depth buffer destroyed");
+    }
+
     if (VK_NULL_HANDLE != mPipelineLayout) {
         vkDestroyPipelineLayout(*mLogicalDevice, *mPipelineLayout, nullptr);
         mPipelineLayout = VK_NULL_HANDLE;
@@ -269,13 +471,8 @@ VulkanRenderer::~VulkanRenderer() noexcept {
         AdelieLogTrace("  swap chain image views destroyed");
     }
 
-    if (!mSwapChainImages.empty()) {
-        for (const auto image : mSwapChainImages) {
-            vkDestroyImage(*mLogicalDevice, image, nullptr);
-        }
-        mSwapChainImages.clear();
-        AdelieLogTrace("  swap chain images destroyed");
-    }
+    // the swap chain images are owned by the swap chain and are released together with it
+    mSwapChainImages.clear();
 
     if (VK_NULL_HANDLE != mRenderPass) {
         vkDestroyRenderPass(*mLogicalDevice, *mRenderPass, nullptr);
@@ -283,6 +480,12 @@ VulkanRenderer::~VulkanRenderer() noexcept {
         AdelieLogTrace("  render pass destroyed");
     }
 
+    if (VK_NULL_HANDLE != mContinueRenderPass) {
+        vkDestroyRenderPass(*mLogicalDevice, mContinueRenderPass, nullptr);
+        mContinueRenderPass = VK_NULL_HANDLE;
+        AdelieLogTrace("  continue render pass destroyed");
+    }
+
     if (VK_NULL_HANDLE != mSwapChain) {
         vkDestroySwapchainKHR(*mLogicalDevice, mSwapChain, nullptr);
         mSwapChain = VK_NULL_HANDLE;
@@ -326,7 +529,8 @@ VulkanRenderer::~VulkanRenderer() noexcept {
 }
 
 auto VulkanRenderer::createIndexBuffer() -> void {
-    VkDeviceSize bufferSize = sizeof(indices[0]) * indices.size();
+    const auto& poolIndices = mGeometryPool.getIndices();
+    VkDeviceSize bufferSize = sizeof(poolIndices[0]) * poolIndices.size();
 
     VkBuffer stagingBuffer;
     VkDeviceMemory stagingBufferMemory;
@@ -338,7 +542,7 @@ auto VulkanRenderer::createIndexBuffer() -> void {
 
     void* data;
     vkMapMemory(*mLogicalDevice, stagingBufferMemory, 0, bufferSize, 0, &data);
-    memcpy(data, indices.data(), (size_t)bufferSize);
+    memcpy(data, poolIndices.data(), (size_t)bufferSize);
     vkUnmapMemory(*mLogicalDevice, stagingBufferMemory);
 
     VulkanBufferManager::createBuffer(*mLogicalDevice, *mPhysicalDevice, bufferSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, mIndexBuffer,
@@ -356,10 +560,10 @@ auto VulkanRenderer::createIndexBuffer() -> void {
 auto VulkanRenderer::createUniformBuffers() -> void {
     VkDeviceSize bufferSize = sizeof(UniformBufferObject);
 
-    mUniformBuffers.resize(mSwapChainImages.size());
-    mUniformBuffersMemory.resize(mSwapChainImages.size());
+    mUniformBuffers.resize(MAX_FRAMES_IN_FLIGHT);
+    mUniformBuffersMemory.resize(MAX_FRAMES_IN_FLIGHT);
 
-    for (size_t i = 0; i < mSwapChainImages.size(); i++) {
+    for (size_t i = 0; i < MAX_FRAMES_IN_FLIGHT; i++) {
         VulkanBufferManager::createBuffer(*mLogicalDevice, *mPhysicalDevice, bufferSize, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
                                           mUniformBuffers[i], mUniformBuffersMemory[i]);
 
@@ -539,10 +743,10 @@ auto VulkanRenderer::findQueueFamilies(VkPhysicalDevice device) const -> uint32_
     uint32_t queueFamilyIndex = UINT32_MAX;
     const std::vector<VkQueueFamilyProperties> queueFamilies = getQueueFamilies(device);
 
-    AdelieLogDebug("    Found {} queue families for device", queueFamilies.size());
+    AdelieLogCategoryDebug(LogCategory::Vulkan, "    Found {} queue families for device", queueFamilies.size());
     for (uint32_t i = 0; i < queueFamilies.size(); i++) {
         const auto& queueFamily = queueFamilies[i];
-        AdelieLogDebug("      Queue Family {}: Count: {}, Flags: {}", i, queueFamily.queueCount, queueFamilyFlagsToString(queueFamily.queueFlags));
+        AdelieLogCategoryDebug(LogCategory::Vulkan, "      Queue Family {}: Count: {}, Flags: {}", i, queueFamily.queueCount, queueFamilyFlagsToString(queueFamily.queueFlags));
         if (queueFamily.queueFlags & VK_QUEUE_GRAPHICS_BIT) {
             if (isDeviceSurfaceSupported(device, i)) {
                 queueFamilyIndex = i;
@@ -552,13 +756,55 @@ auto VulkanRenderer::findQueueFamilies(VkPhysicalDevice device) const -> uint32_
     }
 
     if (UINT32_MAX == queueFamilyIndex) {
-        AdelieLogError("    No graphics queue family of the device was able to present the used surface format");
+        AdelieLogCategoryError(LogCategory::Vulkan, "    No graphics queue family of the device was able to present the used surface format");
     }
 
     return queueFamilyIndex;
 }
 
+auto VulkanRenderer::supportsRequiredFeatures(VkPhysicalDevice device) -> bool {
+    VkPhysicalDeviceProperties deviceProperties;
+    vkGetPhysicalDeviceProperties(device, &deviceProperties);
+    if (deviceProperties.apiVersion < VK_API_VERSION_1_2) {
+        AdelieLogCategoryDebug(LogCategory::Vulkan, "    Device only supports Vulkan {}.{}, but at least 1.2 is required", VK_API_VERSION_MAJOR(deviceProperties.apiVersion), VK_API_VERSION_MINOR(deviceProperties.apiVersion));
+        return false;
+    }
+
+    VkPhysicalDeviceVulkan12Features vulkan12Features{};
+    vulkan12Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+
+    VkPhysicalDeviceFeatures2 features{};
+    features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+    features.pNext = &vulkan12Features;
+    vkGetPhysicalDeviceFeatures2(device, &features);
+
+    if (VK_TRUE != vulkan12Features.timelineSemaphore) {
+        AdelieLogCategoryDebug(LogCategory::Vulkan, "    Device does not support timeline semaphores");
+        return false;
+    }
+
+    // the occlusion culling draws all instances with a single indirect draw and identifies them by the first instance
+    if (VK_TRUE != features.features.multiDrawIndirect || VK_TRUE != features.features.drawIndirectFirstInstance) {
+        AdelieLogCategoryDebug(LogCategory::Vulkan, "    Device does not support multi draw indirect with a first instance");
+        return false;
+    }
+
+    VkFormatProperties depthFormatProperties;
+    vkGetPhysicalDeviceFormatProperties(device, DEPTH_FORMAT, &depthFormatProperties);
+    if (constexpr VkFormatFeatureFlags depthFeatures = VK_FORMAT_FEATURE_DEPTH_STENCIL_ATTACHMENT_BIT | VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT;
+        depthFeatures != (depthFormatProperties.optimalTilingFeatures & depthFeatures)) {
+        AdelieLogCategoryDebug(LogCategory::Vulkan, "    Device can not sample the depth format {}", string_VkFormat(DEPTH_FORMAT));
+        return false;
+    }
+
+    return true;
+}
+
 auto VulkanRenderer::isDeviceSuitable(VkPhysicalDevice device) const -> bool {
+    if (!supportsRequiredFeatures(device)) {
+        return false;
+    }
+
     const uint32_t queueFamilyIndex = findQueueFamilies(device);
     const bool extensionsSupported = VulkanExtensionManager::checkDeviceExtensionSupport(device);
 
@@ -567,19 +813,15 @@ auto VulkanRenderer::isDeviceSuitable(VkPhysicalDevice device) const -> bool {
         VkSurfaceCapabilitiesKHR capabilities;
         vkGetPhysicalDeviceSurfaceCapabilitiesKHR(device, *mSurface, &capabilities);
         const std::vector<VkSurfaceFormatKHR> formats = getSurfaceFormats(device);
-#if defined(ADELIE_BUILD_TYPE_DEBUG)
-        AdelieLogDebug("    Supported surface formats");
+        AdelieLogCategoryDebug(LogCategory::Vulkan, "    Supported surface formats");
         for (const auto& [format, _] : formats) {
-            AdelieLogDebug("      {}", string_VkFormat(format));
+            AdelieLogCategoryDebug(LogCategory::Vulkan, "      {}", string_VkFormat(format));
         }
-#endif
         const std::vector<VkPresentModeKHR> presentModes = getSurfacePresentModes(device);
-#if defined(ADELIE_BUILD_TYPE_DEBUG)
-        AdelieLogDebug("    Supported present modes");
+        AdelieLogCategoryDebug(LogCategory::Vulkan, "    Supported present modes");
         for (const auto& presentMode : presentModes) {
-            AdelieLogDebug("      {}", string_VkPresentModeKHR(presentMode));
+            AdelieLogCategoryDebug(LogCategory::Vulkan, "      {}", string_VkPresentModeKHR(presentMode));
         }
-#endif
         swapChainAdequate = !formats.empty() && !presentModes.empty();
     }
 
@@ -589,7 +831,7 @@ auto VulkanRenderer::isDeviceSuitable(VkPhysicalDevice device) const -> bool {
 auto VulkanRenderer::pickPhysicalDevice() -> void {
     uint32_t deviceCount = 0;
     vkEnumeratePhysicalDevices(mInstance, &deviceCount, nullptr);
-    AdelieLogDebug("Found {} GPU(s) with Vulkan support", deviceCount);
+    AdelieLogCategoryDebug(LogCategory::Vulkan, "Found {} GPU(s) with Vulkan support", deviceCount);
     if (deviceCount == 0) {
         throw VulkanRuntimeException("Failed to find GPUs with Vulkan support!");
     }
@@ -600,7 +842,7 @@ auto VulkanRenderer::pickPhysicalDevice() -> void {
     for (const auto& device : devices) {
         VkPhysicalDeviceProperties deviceProperties;
         vkGetPhysicalDeviceProperties(device, &deviceProperties);
-        AdelieLogDebug("  Checking device: {}", deviceProperties.deviceName);
+        AdelieLogCategoryDebug(LogCategory::Vulkan, "  Checking device: {}", deviceProperties.deviceName);
         if (isDeviceSuitable(device)) {
             mPhysicalDevice = std::make_shared<VkPhysicalDevice>(device);
             break;
@@ -624,11 +866,24 @@ auto VulkanRenderer::createLogicalDevice() -> void {
     queueCreateInfo.pQueuePriorities = &queuePriority;
 
     VkPhysicalDeviceFeatures deviceFeatures{};
+    deviceFeatures.multiDrawIndirect = VK_TRUE;
+    deviceFeatures.drawIndirectFirstInstance = VK_TRUE;
 
-    const auto deviceExtensions = VulkanExtensionManager::getRequiredDeviceExtensions();
+    VkPhysicalDeviceVulkan12Features vulkan12Features{};
+    vulkan12Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+    vulkan12Features.timelineSemaphore = VK_TRUE;
+
+    auto deviceExtensions = VulkanExtensionManager::getRequiredDeviceExtensions();
+
+    // the memory budget is optional, without it the texture budget is derived from the heap sizes
+    const auto memoryBudgetSupported = VulkanExtensionManager::isDeviceExtensionSupported(*mPhysicalDevice, VK_EXT_MEMORY_BUDGET_EXTENSION_NAME);
+    if (memoryBudgetSupported) {
+        deviceExtensions.push_back(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME);
+    }
 
     VkDeviceCreateInfo createInfo{};
     createInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+    createInfo.pNext = &vulkan12Features;
     createInfo.queueCreateInfoCount = 1;
     createInfo.pQueueCreateInfos = &queueCreateInfo;
     createInfo.pEnabledFeatures = &deviceFeatures;
@@ -640,6 +895,8 @@ auto VulkanRenderer::createLogicalDevice() -> void {
         throw VulkanRuntimeException("Failed to create logical device!", createDeviceResult);
     }
     mLogicalDevice = std::make_shared<VkDevice>(logicalDevice);
+    mDeletionQueue = std::make_unique<VulkanDeletionQueue>(*mLogicalDevice);
+    mResidencyManager = std::make_unique<VulkanResidencyManager>(*mPhysicalDevice, memoryBudgetSupported);
 
     vkGetDeviceQueue(*mLogicalDevice, queueFamilyIndex, 0, &mSelectedGraphicsQueue);
 }
@@ -708,6 +965,7 @@ auto VulkanRenderer::createSwapChain() -> void {
     createInfo.compositeAlpha = VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR;
     createInfo.presentMode = presentMode;
     createInfo.clipped = VK_TRUE;
+    createInfo.oldSwapchain = mSwapChain;  // allows the presentation engine to hand over in-flight images
 
     if (const auto createSwapChainResult = vkCreateSwapchainKHR(*mLogicalDevice, &createInfo, nullptr, &mSwapChain); createSwapChainResult != VK_SUCCESS) {
         throw VulkanRuntimeException("Failed to create swap chain", createSwapChainResult);
@@ -747,10 +1005,7 @@ auto VulkanRenderer::chooseSwapExtent(const VkSurfaceCapabilitiesKHR& capabiliti
         return capabilities.currentExtent;
     }
 
-    int width, height;
-    mWindowInterface->getWindowSize(width, height);
-
-    VkExtent2D actualExtent = {static_cast<uint32_t>(width), static_cast<uint32_t>(height)};
+    VkExtent2D actualExtent = mWindowExtent;
 
     actualExtent.width = std::max(capabilities.minImageExtent.width, std::min(capabilities.maxImageExtent.width, actualExtent.width));
     actualExtent.height = std::max(capabilities.minImageExtent.height, std::min(capabilities.maxImageExtent.height, actualExtent.height));
@@ -776,37 +1031,37 @@ auto VKAPI_CALL VulkanRenderer::debugCallback(VkDebugUtilsMessageSeverityFlagBit
                                               const VkDebugUtilsMessengerCallbackDataEXT* pCallbackData,
                                               void* /*pUserData*/) -> VKAPI_ATTR VkBool32 {
     if (messageSeverity & VK_DEBUG_UTILS_MESSAGE_SEVERITY_VERBOSE_BIT_EXT) {
-        AdelieLogTrace("Validation layer: {}", pCallbackData->pMessage);
+        AdelieLogCategoryTrace(LogCategory::Vulkan, "Validation layer: {}", pCallbackData->pMessage);
         return VK_FALSE;  // we can continue, it's not severe enough to terminate
     }
 
     if (messageSeverity & VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT) {
-        AdelieLogInformation("Validation layer: {}", pCallbackData->pMessage);
+        AdelieLogCategoryInformation(LogCategory::Vulkan, "Validation layer: {}", pCallbackData->pMessage);
         return VK_FALSE;  // we can continue, it's not severe enough to terminate
     }
 
     if (messageSeverity & VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT) {
-        AdelieLogWarning("Validation layer: {}", pCallbackData->pMessage);
+        AdelieLogCategoryWarning(LogCategory::Vulkan, "Validation layer: {}", pCallbackData->pMessage);
         return VK_FALSE;  // we can continue, it's not severe enough to terminate
     }
 
     if (messageSeverity & VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT) {
         if (messageType & VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT) {
-            AdelieLogFatal("Vulkan API usage validation failed: {}", pCallbackData->pMessageIdName);
+            AdelieLogCategoryFatal(LogCategory::Vulkan, "Vulkan API usage validation failed: {}", pCallbackData->pMessageIdName);
             if (pCallbackData->objectCount > 0) {
-                AdelieLogFatal("  Causing objects: {}", pCallbackData->objectCount);
+                AdelieLogCategoryFatal(LogCategory::Vulkan, "  Causing objects: {}", pCallbackData->objectCount);
                 for (auto i = 0u; i < pCallbackData->objectCount; i++) {
-                    AdelieLogFatal("    Type: {}", string_VkObjectType(pCallbackData->pObjects[i].objectType));
-                    AdelieLogFatal("    Handle: 0x{:x}", pCallbackData->pObjects[i].objectHandle);
+                    AdelieLogCategoryFatal(LogCategory::Vulkan, "    Type: {}", string_VkObjectType(pCallbackData->pObjects[i].objectType));
+                    AdelieLogCategoryFatal(LogCategory::Vulkan, "    Handle: 0x{:x}", pCallbackData->pObjects[i].objectHandle);
                     if (nullptr != pCallbackData->pObjects[i].pObjectName) {
-                        AdelieLogFatal("    Name: {}", std::string(pCallbackData->pObjects[i].pObjectName));
+                        AdelieLogCategoryFatal(LogCategory::Vulkan, "    Name: {}", std::string(pCallbackData->pObjects[i].pObjectName));
                     }
                 }
             }
             if (pCallbackData->cmdBufLabelCount > 0) {
-                AdelieLogFatal("  Causing command buffer labels: {}", pCallbackData->cmdBufLabelCount);
+                AdelieLogCategoryFatal(LogCategory::Vulkan, "  Causing command buffer labels: {}", pCallbackData->cmdBufLabelCount);
                 for (auto i = 0u; i < pCallbackData->cmdBufLabelCount; i++) {
-                    AdelieLogFatal("    Name: {}", std::string(pCallbackData->pCmdBufLabels[i].pLabelName));
+                    AdelieLogCategoryFatal(LogCategory::Vulkan, "    Name: {}", std::string(pCallbackData->pCmdBufLabels[i].pLabelName));
                 }
             }
         }
@@ -837,6 +1092,8 @@ auto VulkanRenderer::setDebugUtilsObjectNameEXT(const VkDebugUtilsObjectNameInfo
 }
 
 auto VulkanRenderer::createRenderPass() -> void {
+    // the frame is drawn in two passes around the depth pyramid of the occlusion culling: the first one clears the
+    // attachments and keeps them, the second one continues on them and presents the image
     VkAttachmentDescription colorAttachment{};
     colorAttachment.format = mSwapChainImageFormat;
     colorAttachment.samples = VK_SAMPLE_COUNT_1_BIT;
@@ -845,39 +1102,91 @@ auto VulkanRenderer::createRenderPass() -> void {
     colorAttachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
     colorAttachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
     colorAttachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-    colorAttachment.finalLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+    colorAttachment.finalLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+
+    VkAttachmentDescription depthAttachment{};
+    depthAttachment.format = DEPTH_FORMAT;
+    depthAttachment.samples = VK_SAMPLE_COUNT_1_BIT;
+    depthAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+    depthAttachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+    depthAttachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+    depthAttachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+    depthAttachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    depthAttachment.finalLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL;
 
     VkAttachmentReference colorAttachmentRef{};
     colorAttachmentRef.attachment = 0;
     colorAttachmentRef.layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
 
+    VkAttachmentReference depthAttachmentRef{};
+    depthAttachmentRef.attachment = 1;
+    depthAttachmentRef.layout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+
     VkSubpassDescription subpass{};
     subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
     subpass.colorAttachmentCount = 1;
     subpass.pColorAttachments = &colorAttachmentRef;
-
-    VkSubpassDependency dependency{};
-    dependency.srcSubpass = VK_SUBPASS_EXTERNAL;
-    dependency.dstSubpass = 0;
-    dependency.srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
-    dependency.srcAccessMask = 0;
-    dependency.dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
-    dependency.dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
-
+    subpass.pDepthStencilAttachment = &depthAttachmentRef;
+
+    // the previous frame might still build its depth pyramid from the depth buffer or draw into it
+    std::array<VkSubpassDependency, 2> dependencies{};
+    dependencies[0].srcSubpass = VK_SUBPASS_EXTERNAL;
+    dependencies[0].dstSubpass = 0;
+    dependencies[0].srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+    dependencies[0].srcAccessMask = VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+    dependencies[0].dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT;
+    dependencies[0].dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+
+    // the depth pyramid is built from the depth, the second pass continues on both attachments
+    dependencies[1].srcSubpass = 0;
+    dependencies[1].dstSubpass = VK_SUBPASS_EXTERNAL;
+    dependencies[1].srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+    dependencies[1].srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+    dependencies[1].dstStageMask = VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT | VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT;
+    dependencies[1].dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT |
+                                    VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+
+    const std::array attachments = {colorAttachment, depthAttachment};
     VkRenderPassCreateInfo renderPassInfo{};
     renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
-    renderPassInfo.attachmentCount = 1;
-    renderPassInfo.pAttachments = &colorAttachment;
+    renderPassInfo.attachmentCount = static_cast<uint32_t>(attachments.size());
+    renderPassInfo.pAttachments = attachments.data();
     renderPassInfo.subpassCount = 1;
     renderPassInfo.pSubpasses = &subpass;
-    renderPassInfo.dependencyCount = 1;
-    renderPassInfo.pDependencies = &dependency;
+    renderPassInfo.dependencyCount = static_cast<uint32_t>(dependencies.size());
+    renderPassInfo.pDependencies = dependencies.data();
 
     VkRenderPass renderPass = VK_NULL_HANDLE;
     if (const auto result = vkCreateRenderPass(*mLogicalDevice, &renderPassInfo, nullptr, &renderPass); result != VK_SUCCESS) {
         throw VulkanRuntimeException("failed to create render pass", result);
     }
     mRenderPass = std::make_shared<VkRenderPass>(renderPass);
+
+    // the second pass is compatible with the first one, so both use the same pipeline and frame buffers
+    std::array continueAttachments = {colorAttachment, depthAttachment};
+    continueAttachments[0].loadOp = VK_ATTACHMENT_LOAD_OP_LOAD;
+    continueAttachments[0].initialLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+    continueAttachments[0].finalLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+    continueAttachments[1].loadOp = VK_ATTACHMENT_LOAD_OP_LOAD;
+    continueAttachments[1].storeOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+    continueAttachments[1].initialLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL;
+
+    // the culling of the second phase has to finish sampling the depth before it is written again
+    VkSubpassDependency continueDependency{};
+    continueDependency.srcSubpass = VK_SUBPASS_EXTERNAL;
+    continueDependency.dstSubpass = 0;
+    continueDependency.srcStageMask = VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+    continueDependency.srcAccessMask = 0;
+    continueDependency.dstStageMask = VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+    continueDependency.dstAccessMask = VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+
+    renderPassInfo.pAttachments = continueAttachments.data();
+    renderPassInfo.dependencyCount = 1;
+    renderPassInfo.pDependencies = &continueDependency;
+
+    if (const auto result = vkCreateRenderPass(*mLogicalDevice, &renderPassInfo, nullptr, &mContinueRenderPass); result != VK_SUCCESS) {
+        throw VulkanRuntimeException("failed to create continue render pass", result);
+    }
 }
 
 auto VulkanRenderer::createDescriptorSetLayout() -> void {
@@ -885,7 +1194,7 @@ auto VulkanRenderer::createDescriptorSetLayout() -> void {
     uboLayoutBinding.binding = 0;
     uboLayoutBinding.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
     uboLayoutBinding.descriptorCount = 1;
-    uboLayoutBinding.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+    uboLayoutBinding.stageFlags = VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT;
 
     VkDescriptorSetLayoutBinding baseColorSamplerLayoutBinding{};
     baseColorSamplerLayoutBinding.binding = 1;
@@ -908,7 +1217,34 @@ auto VulkanRenderer::createDescriptorSetLayout() -> void {
     roughnessSamplerLayoutBinding.pImmutableSamplers = nullptr;
     roughnessSamplerLayoutBinding.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
 
-    const std::array bindings = {uboLayoutBinding, baseColorSamplerLayoutBinding, normalSamplerLayoutBinding, roughnessSamplerLayoutBinding};
+    // the instances of the occlusion culling, indexed by the first instance of the indirect draws
+    VkDescriptorSetLayoutBinding instanceLayoutBinding{};
+    instanceLayoutBinding.binding = 4;
+    instanceLayoutBinding.descriptorCount = 1;
+    instanceLayoutBinding.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    instanceLayoutBinding.pImmutableSamplers = nullptr;
+    instanceLayoutBinding.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+
+    // the lights, the light counts and the light indices of the clusters
+    std::array<VkDescriptorSetLayoutBinding, 3> lightLayoutBindings{};
+    for (uint32_t i = 0; i < lightLayoutBindings.size(); i++) {
+        lightLayoutBindings[i].binding = 5 + i;
+        lightLayoutBindings[i].descriptorCount = 1;
+        lightLayoutBindings[i].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        lightLayoutBindings[i].pImmutableSamplers = nullptr;
+        lightLayoutBindings[i].stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
+    }
+
+    // the cascades of the directional light
+    VkDescriptorSetLayoutBinding shadowSamplerLayoutBinding{};
+    shadowSamplerLayoutBinding.binding = 8;
+    shadowSamplerLayoutBinding.descriptorCount = 1;
+    shadowSamplerLayoutBinding.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+    shadowSamplerLayoutBinding.pImmutableSamplers = nullptr;
+    shadowSamplerLayoutBinding.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
+
+    const std::array bindings = {uboLayoutBinding,       baseColorSamplerLayoutBinding, normalSamplerLayoutBinding, roughnessSamplerLayoutBinding, instanceLayoutBinding,
+                                 lightLayoutBindings[0], lightLayoutBindings[1],        lightLayoutBindings[2],     shadowSamplerLayoutBinding};
     VkDescriptorSetLayoutCreateInfo layoutInfo{};
     layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
     layoutInfo.bindingCount = static_cast<uint32_t>(bindings.size());
@@ -920,11 +1256,8 @@ auto VulkanRenderer::createDescriptorSetLayout() -> void {
 }
 
 auto VulkanRenderer::createGraphicsPipeline() -> void {
-    auto vertShaderCode = VulkanShaderManager::readFile("shader/cube.vert.spv");
-    auto fragShaderCode = VulkanShaderManager::readFile("shader/cube.frag.spv");
-
-    auto vertShaderModule = VulkanShaderManager::createShaderModule(*mLogicalDevice, vertShaderCode);
-    auto fragShaderModule = VulkanShaderManager::createShaderModule(*mLogicalDevice, fragShaderCode);
+    auto vertShaderModule = createShaderModule("shader/cube.vert.spv");
+    auto fragShaderModule = createShaderModule("shader/cube.frag.spv");
 
     VkPipelineShaderStageCreateInfo vertShaderStageInfo{};
     vertShaderStageInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
@@ -994,6 +1327,14 @@ auto VulkanRenderer::createGraphicsPipeline() -> void {
     multisampling.alphaToCoverageEnable = VK_FALSE;
     multisampling.alphaToOneEnable = VK_FALSE;
 
+    VkPipelineDepthStencilStateCreateInfo depthStencil{};
+    depthStencil.sType = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
+    depthStencil.depthTestEnable = VK_TRUE;
+    depthStencil.depthWriteEnable = VK_TRUE;
+    depthStencil.depthCompareOp = VK_COMPARE_OP_LESS;
+    depthStencil.depthBoundsTestEnable = VK_FALSE;
+    depthStencil.stencilTestEnable = VK_FALSE;
+
     VkPipelineColorBlendAttachmentState colorBlendAttachment{};
     colorBlendAttachment.colorWriteMask = VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
     colorBlendAttachment.blendEnable = VK_FALSE;
@@ -1035,6 +1376,7 @@ auto VulkanRenderer::createGraphicsPipeline() -> void {
     pipelineInfo.pViewportState = &viewportState;
     pipelineInfo.pRasterizationState = &rasterizer;
     pipelineInfo.pMultisampleState = &multisampling;
+    pipelineInfo.pDepthStencilState = &depthStencil;
     pipelineInfo.pColorBlendState = &colorBlending;
     pipelineInfo.layout = *mPipelineLayout;
     pipelineInfo.renderPass = *mRenderPass;
@@ -1050,16 +1392,71 @@ auto VulkanRenderer::createGraphicsPipeline() -> void {
     vkDestroyShaderModule(*mLogicalDevice, vertShaderModule, nullptr);
 }
 
+auto VulkanRenderer::createShaderModule(const std::string& filename) const -> VkShaderModule {
+    const auto code = VirtualFileSystem::getInstance()->read(filename);
+    return VulkanShaderManager::createShaderModule(*mLogicalDevice, code->getData());
+}
+
+auto VulkanRenderer::createDepthResources() -> void {
+    VkImageCreateInfo imageInfo{};
+    imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+    imageInfo.imageType = VK_IMAGE_TYPE_2D;
+    imageInfo.extent.width = mSwapChainExtent.width;
+    imageInfo.extent.height = mSwapChainExtent.height;
+    imageInfo.extent.depth = 1;
+    imageInfo.mipLevels = 1;
+    imageInfo.arrayLayers = 1;
+    imageInfo.format = DEPTH_FORMAT;
+    imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+    imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    imageInfo.usage = VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+    imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+
+    if (const auto result = vkCreateImage(*mLogicalDevice, &imageInfo, nullptr, &mDepthImage); result != VK_SUCCESS) {
+        throw VulkanRuntimeException("Failed to create depth image", result);
+    }
+
+    VkMemoryRequirements memRequirements;
+    vkGetImageMemoryRequirements(*mLogicalDevice, mDepthImage, &memRequirements);
+
+    VkMemoryAllocateInfo allocInfo{};
+    allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    allocInfo.allocationSize = memRequirements.size;
+    allocInfo.memoryTypeIndex = VulkanBufferManager::findMemoryType(*mPhysicalDevice, memRequirements.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+    if (const auto result = vkAllocateMemory(*mLogicalDevice, &allocInfo, nullptr, &mDepthImageMemory); result != VK_SUCCESS) {
+        throw VulkanRuntimeException("Failed to allocate depth image memory", result);
+    }
+    vkBindImageMemory(*mLogicalDevice, mDepthImage, mDepthImageMemory, 0);
+
+    VkImageViewCreateInfo viewInfo{};
+    viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+    viewInfo.image = mDepthImage;
+    viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+    viewInfo.format = DEPTH_FORMAT;
+    viewInfo.subresourceRange.aspectMask = VK_IMAGE_ASPECT_DEPTH_BIT;
+    viewInfo.subresourceRange.baseMipLevel = 0;
+    viewInfo.subresourceRange.levelCount = 1;
+    viewInfo.subresourceRange.baseArrayLayer = 0;
+    viewInfo.subresourceRange.layerCount = 1;
+
+    if (const auto result = vkCreateImageView(*mLogicalDevice, &viewInfo, nullptr, &mDepthImageView); result != VK_SUCCESS) {
+        throw VulkanRuntimeException("Failed to create depth image view", result);
+    }
+    debugUtilsObjectName(reinterpret_cast<uint64_t>(mDepthImage), "mDepthImage", VK_OBJECT_TYPE_IMAGE);
+}
+
 auto VulkanRenderer::createFramebuffers() -> void {
     mSwapChainFramebuffers.resize(mSwapChainImageViews.size());
 
     for (size_t i = 0; i < mSwapChainImageViews.size(); i++) {
-        VkImageView attachments[] = {mSwapChainImageViews[i]};
+        VkImageView attachments[] = {mSwapChainImageViews[i], mDepthImageView};
 
         VkFramebufferCreateInfo framebufferInfo{};
         framebufferInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
         framebufferInfo.renderPass = *mRenderPass;
-        framebufferInfo.attachmentCount = 1;
+        framebufferInfo.attachmentCount = 2;
         framebufferInfo.pAttachments = attachments;
         framebufferInfo.width = mSwapChainExtent.width;
         framebufferInfo.height = mSwapChainExtent.height;
@@ -1084,62 +1481,194 @@ auto VulkanRenderer::createCommandPool() -> void {
     }
 }
 
-auto VulkanRenderer::cleanupSwapChain() -> void {
+auto VulkanRenderer::cleanupSwapChain(const uint64_t lastUsedFrame) -> void {
+    // nothing is destroyed right away, the objects are released as soon as the last frame using them has finished
     for (auto framebuffer : mSwapChainFramebuffers) {
-        vkDestroyFramebuffer(*mLogicalDevice, framebuffer, nullptr);
+        mDeletionQueue->retireFramebuffer(framebuffer, lastUsedFrame);
     }
+    mSwapChainFramebuffers.clear();
 
     for (auto imageView : mSwapChainImageViews) {
-        vkDestroyImageView(*mLogicalDevice, imageView, nullptr);
+        mDeletionQueue->retireImageView(imageView, lastUsedFrame);
     }
+    mSwapChainImageViews.clear();
 
-    vkDestroySwapchainKHR(*mLogicalDevice, mSwapChain, nullptr);
+    mDeletionQueue->retireImageView(mDepthImageView, lastUsedFrame);
+    mDeletionQueue->retireImage(mDepthImage, mDepthImageMemory, lastUsedFrame);
+    mDepthImageView = VK_NULL_HANDLE;
+    mDepthImage = VK_NULL_HANDLE;
+    mDepthImageMemory = VK_NULL_HANDLE;
 
-    for (size_t i = 0; i < mSwapChainImages.size(); i++) {
-        vkDestroyBuffer(*mLogicalDevice, mUniformBuffers[i], nullptr);
-        vkFreeMemory(*mLogicalDevice, mUniformBuffersMemory[i], nullptr);
+    for (size_t i = 0; i < mUniformBuffers.size(); i++) {
+        mDeletionQueue->retireBuffer(mUniformBuffers[i], mUniformBuffersMemory[i], lastUsedFrame);
+    }
+    mUniformBuffers.clear();
+    mUniformBuffersMemory.clear();
+
+    for (auto commandBuffer : mCommandBuffers) {
+        mDeletionQueue->retireCommandBuffer(mCommandPool, commandBuffer, lastUsedFrame);
     }
+    mCommandBuffers.clear();
 
-    vkDestroyPipeline(*mLogicalDevice, *mGraphicsPipeline, nullptr);
-    vkDestroyPipelineLayout(*mLogicalDevice, *mPipelineLayout, nullptr);
-    vkDestroyRenderPass(*mLogicalDevice, *mRenderPass, nullptr);
+    mDeletionQueue->retireDescriptorPool(mDescriptorPool, lastUsedFrame);
+    mDescriptorPool = VK_NULL_HANDLE;
+    mDescriptorSets.clear();
+
+    mDeletionQueue->retirePipeline(*mGraphicsPipeline, lastUsedFrame);
+    mDeletionQueue->retirePipelineLayout(*mPipelineLayout, lastUsedFrame);
+    mDeletionQueue->retireRenderPass(*mRenderPass, lastUsedFrame);
+    mDeletionQueue->retireRenderPass(mContinueRenderPass, lastUsedFrame);
+    mContinueRenderPass = VK_NULL_HANDLE;
 }
 
 auto VulkanRenderer::recreateSwapChain() -> void {
     AdelieLogTrace("Recreating swap chain");
-    int width = 0, height = 0;
-    mWindowInterface->getWindowSize(width, height);
-
-    if (width == 0 || height == 0) {
+    if (mWindowExtent.width == 0 || mWindowExtent.height == 0) {
         return;
     }
 
-    vkDeviceWaitIdle(*mLogicalDevice);
-
-    cleanupSwapChain();
+    // every frame up to the last submitted one might still reference the old objects, so they are tagged with it
+    // instead of waiting for the whole device to become idle
+    const auto lastUsedFrame = getFrameNumber();
+    cleanupSwapChain(lastUsedFrame);
 
+    // the old swap chain has to stay alive until the new one was created from it
+    const auto oldSwapChain = mSwapChain;
     createSwapChain();
+    mDeletionQueue->retireSwapchain(oldSwapChain, lastUsedFrame);
+
     createImageViews();
     createRenderPass();
     createGraphicsPipeline();
+    createDepthResources();
     createFramebuffers();
     createUniformBuffers();
+    mOcclusionCuller->resize(mDepthImageView, mSwapChainExtent, MAX_FRAMES_IN_FLIGHT, lastUsedFrame);
+    mClusteredLighting->resize(MAX_FRAMES_IN_FLIGHT, lastUsedFrame);
+    mShadowCascades->resize(MAX_FRAMES_IN_FLIGHT, lastUsedFrame);
+    mParticleSystem->resize(mContinueRenderPass, mSwapChainExtent, MAX_FRAMES_IN_FLIGHT, lastUsedFrame);
+    mQuadRenderer->resize(mContinueRenderPass, mSwapChainExtent, MAX_FRAMES_IN_FLIGHT, lastUsedFrame);
     createDescriptorPool();
     createDescriptorSets();
     createCommandBuffers();
 }
 
-auto VulkanRenderer::updateUniformBuffer() -> void {
-    static auto startTime = std::chrono::high_resolution_clock::now();
+auto VulkanRenderer::updateScene(RenderSnapshot& snapshot, const float time) const -> void {
+    const glm::vec3 eye(2.0f, 2.0f, 2.0f);
+    snapshot.view = glm::lookAt(eye, glm::vec3(0.0f, 0.0f, 0.0f), glm::vec3(0.0f, 0.0f, 1.0f));
+    snapshot.nearPlane = 0.1f;
+    snapshot.farPlane = 10.0f;
+    snapshot.projection = glm::perspective(glm::radians(45.0f), static_cast<float>(snapshot.windowWidth) / static_cast<float>(std::max(1U, snapshot.windowHeight)), snapshot.nearPlane, snapshot.farPlane);
+    snapshot.projection[1][1] *= -1;
+    const auto spin = glm::rotate(glm::mat4(1.0f), time * glm::radians(90.0f), glm::vec3(0.0f, 0.0f, 1.0f));
+    const float pixelsPerUnit = static_cast<float>(snapshot.windowHeight) * std::abs(snapshot.projection[1][1]) * 0.5f;
+
+    auto& scene = Renderer::getScene();
+    auto& world = scene.getWorld();
+
+    // the entities are drawn between their last two simulation steps. The steps are short, so blending the matrices
+    // element-wise is close enough to blending position, rotation and scale on their own
+    const auto interpolate = [alpha = snapshot.interpolationAlpha](const LocalToWorldComponent& localToWorld) { return localToWorld.previousMatrix + ((localToWorld.matrix - localToWorld.previousMatrix) * alpha); };
+
+    // an entity with a LodComponent is drawn at the coarsest level of detail whose error is not visible
+    const auto submit = [&](const Entity entity, const glm::mat4& localToWorld, const uint32_t meshId) {
+        const auto model = spin * localToWorld;
+        uint32_t lod = 0;
+        if (auto* lodComponent = world.getComponent<LodComponent>(entity); nullptr != lodComponent) {
+            const float scale = std::max({glm::length(glm::vec3(model[0])), glm::length(glm::vec3(model[1])), glm::length(glm::vec3(model[2]))});
+            lod = mGeometryPool.selectLod(meshId, glm::length(glm::vec3(model[3]) - eye), scale, pixelsPerUnit, lodComponent->lod);
+            lodComponent->lod = lod;
+        }
+        snapshot.commands.push_back({.model = model, .meshId = meshId, .lod = lod});
+    };
+
+    // the entities with bounds are culled by the spatial index, the spin is folded into the frustum instead of
+    // transforming every box
+    const auto frustum = Frustum::fromMatrix(snapshot.projection * snapshot.view * spin);
+    scene.getSpatialIndex().queryFrustum(frustum, [&](const BvhProxy proxy) {
+        const auto entity = scene.getEntity(proxy);
+        const auto* localToWorld = world.getComponent<LocalToWorldComponent>(entity);
+        const auto* mesh = world.getComponent<MeshComponent>(entity);
+        if (nullptr != localToWorld && nullptr != mesh) {
+            submit(entity, interpolate(*localToWorld), mesh->meshId);
+        }
+    });
+
+    world.eachChunk<const LocalToWorldComponent, const PointLightComponent>([&](const uint32_t count, const Entity* /*entities*/, const LocalToWorldComponent* localToWorld, const PointLightComponent* lights) {
+        for (uint32_t i = 0; i < count; i++) {
+            const auto position = glm::vec3(spin * interpolate(localToWorld[i])[3]);
+            snapshot.lights.push_back({.position = position, .range = lights[i].range, .color = lights[i].color, .intensity = lights[i].intensity});
+        }
+    });
+
+    world.eachChunk<const LocalToWorldComponent, const ParticleEmitterComponent>(
+        [&](const uint32_t count, const Entity* /*entities*/, const LocalToWorldComponent* localToWorld, const ParticleEmitterComponent* emitters) {
+            for (uint32_t i = 0; i < count; i++) {
+                const auto matrix = spin * interpolate(localToWorld[i]);
+                snapshot.particleEmitters.push_back({.position = glm::vec3(matrix[3]),
+                                                     .rate = emitters[i].rate,
+                                                     .direction = glm::normalize(glm::vec3(matrix * glm::vec4(emitters[i].direction, 0.0f))),
+                                                     .spread = emitters[i].spread,
+                                                     .color = emitters[i].color,
+                                                     .speed = emitters[i].speed,
+                                                     .lifetime = emitters[i].lifetime});
+            }
+        });
 
-    auto currentTime = std::chrono::high_resolution_clock::now();
-    float time = std::chrono::duration<float, std::chrono::seconds::period>(currentTime - startTime).count();
+    // the chunks of an archetype either all have bounds or none
+    world.eachChunk<const LocalToWorldComponent, const MeshComponent>([&](const uint32_t count, const Entity* entities, const LocalToWorldComponent* localToWorld, const MeshComponent* meshes) {
+        if (0 == count || world.hasComponent<BoundsComponent>(entities[0])) {
+            return;
+        }
+        for (uint32_t i = 0; i < count; i++) {
+            submit(entities[i], interpolate(localToWorld[i]), meshes[i].meshId);
+        }
+    });
+
+    // every cascade gets its own casters, the ones in front of a cascade included. The renderer only redraws a
+    // cascade when its casters changed, so they are not merged into a single list
+    snapshot.lightDirection = glm::normalize(glm::vec3(1.0f, 1.0f, 1.0f));
+    const auto cascades = ShadowCascades::fit(snapshot.view, snapshot.projection, snapshot.nearPlane, snapshot.farPlane, snapshot.lightDirection, SHADOW_CASTER_DISTANCE);
+    const auto addCaster = [&](const Entity entity, const glm::mat4& localToWorld, const uint32_t meshId) {
+        const auto* lodComponent = world.getComponent<LodComponent>(entity);
+        snapshot.shadowCasters.push_back({.model = spin * localToWorld, .meshId = meshId, .lod = nullptr != lodComponent ? lodComponent->lod : 0});
+    };
+    for (uint32_t cascade = 0; cascade < SHADOW_CASCADE_COUNT; cascade++) {
+        const auto firstCaster = static_cast<uint32_t>(snapshot.shadowCasters.size());
+        scene.getSpatialIndex().queryFrustum(Frustum::fromMatrix(cascades[cascade].viewProjection * spin), [&](const BvhProxy proxy) {
+            const auto entity = scene.getEntity(proxy);
+            const auto* localToWorld = world.getComponent<LocalToWorldComponent>(entity);
+            const auto* mesh = world.getComponent<MeshComponent>(entity);
+            if (nullptr != localToWorld && nullptr != mesh) {
+                addCaster(entity, interpolate(*localToWorld), mesh->meshId);
+            }
+        });
+        world.eachChunk<const LocalToWorldComponent, const MeshComponent>([&](const uint32_t count, const Entity* entities, const LocalToWorldComponent* localToWorld, const MeshComponent* meshes) {
+            if (0 == count || world.hasComponent<BoundsComponent>(entities[0])) {
+                return;
+            }
+            for (uint32_t i = 0; i < count; i++) {
+                addCaster(entities[i], interpolate(localToWorld[i]), meshes[i].meshId);
+            }
+        });
+        snapshot.shadowCascades[cascade] = {.viewProjection = cascades[cascade].viewProjection,
+                                            .splitDepth = cascades[cascade].splitDepth,
+                                            .firstCaster = firstCaster,
+                                            .casterCount = static_cast<uint32_t>(snapshot.shadowCasters.size()) - firstCaster};
+    }
+}
 
+auto VulkanRenderer::updateUniformBuffer(const RenderSnapshot& snapshot) -> void {
     UniformBufferObject ubo{};
-    ubo.model = glm::rotate(glm::mat4(1.0f), time * glm::radians(90.0f), glm::vec3(0.0f, 0.0f, 1.0f));
-    ubo.view = glm::lookAt(glm::vec3(2.0f, 2.0f, 2.0f), glm::vec3(0.0f, 0.0f, 0.0f), glm::vec3(0.0f, 0.0f, 1.0f));
-    ubo.proj = glm::perspective(glm::radians(45.0f), mSwapChainExtent.width / (float)mSwapChainExtent.height, 0.1f, 10.0f);
-    ubo.proj[1][1] *= -1;
+    ubo.view = snapshot.view;
+    ubo.proj = snapshot.projection;
+    const auto depthSlices = VulkanClusteredLighting::getDepthSliceParameters(snapshot.nearPlane, snapshot.farPlane);
+    ubo.clusterParameters = glm::vec4(depthSlices.x, depthSlices.y, static_cast<float>(mSwapChainExtent.width), static_cast<float>(mSwapChainExtent.height));
+    for (uint32_t cascade = 0; cascade < SHADOW_CASCADE_COUNT; cascade++) {
+        ubo.shadowViewProjections[cascade] = snapshot.shadowCascades[cascade].viewProjection;
+        ubo.shadowSplits[static_cast<int>(cascade)] = snapshot.shadowCascades[cascade].splitDepth;
+    }
+    ubo.lightDirection = glm::vec4(snapshot.lightDirection, 0.0f);
 
     void* data;
     vkMapMemory(*mLogicalDevice, mUniformBuffersMemory[mCurrentFrame], 0, sizeof(ubo), 0, &data);
@@ -1148,10 +1677,101 @@ auto VulkanRenderer::updateUniformBuffer() -> void {
 }
 
 auto VulkanRenderer::mainLoop() -> void {
-    while (!mWindowInterface->shouldClose()) {
-        mWindowInterface->pollEvents();
-        drawFrame();
+    std::exception_ptr renderException = nullptr;
+    {
+        std::jthread renderThread([this, &renderException] {
+            try {
+                renderLoop();
+            } catch (...) {
+                renderException = std::current_exception();
+                mRenderQueue.shutdown();  // do not let the main thread wait for a consumer which is gone
+            }
+        });
+
+        auto* input = InputSystem::getInstance();
+        FrameClock clock;
+        std::string frameStats;
+        float frameStatsTime = 0.0f;
+        uint32_t frameStatsCount = 0;
+        SimulationLoop simulation(adelie::core::SIMULATION_DEFAULT_DELTA_TIME, adelie::core::SIMULATION_DEFAULT_MAX_STEPS);
+        while (!mWindowInterface->shouldClose()) {
+            mWindowInterface->pollEvents();
+
+            // a replay takes the delta time and the window size of the recorded frame instead of the real ones, so the
+            // simulation runs exactly as it was recorded
+            InputFrame frame{};
+            if (input->isReplaying()) {
+                const auto recordedFrame = input->replayFrame();
+                if (!recordedFrame) {
+                    AdelieLogInformation("Input replay finished after {} frames", clock.getFrameNumber());
+                    break;
+                }
+                frame = *recordedFrame;
+                clock.advance(frame.deltaTime);
+            } else {
+                int width = 0, height = 0;
+                mWindowInterface->getWindowSize(width, height);
+                clock.tick();
+                frame = {clock.getDeltaTime(), static_cast<uint32_t>(width), static_cast<uint32_t>(height)};
+                input->recordFrame(frame);
+            }
+            input->publishSnapshot();
+            EventBus::getInstance()->dispatch();
+            simulation.update(clock.getDeltaTime(), Renderer::getLayerStack());
+
+            // everything written into the snapshot is simulated while the render thread still draws the previous one.
+            // The scene is shown between the last two simulation steps, so it moves smoothly at any refresh rate
+            auto& snapshot = mRenderQueue.beginWrite();
+            snapshot.simulationFrame = simulation.getStepCount();
+            snapshot.simulationTime = static_cast<float>(simulation.getSimulationTime());
+            snapshot.interpolationAlpha = simulation.getAlpha();
+            snapshot.deltaTime = frame.deltaTime;
+            snapshot.windowWidth = frame.windowWidth;
+            snapshot.windowHeight = frame.windowHeight;
+            updateScene(snapshot, static_cast<float>(simulation.getInterpolatedTime()));
+
+            auto& overlay = Renderer::getOverlay();
+            overlay.begin(snapshot.overlayQuads);
+            for (auto* layer : Renderer::getLayerStack()) {
+                layer->onUIRendering();
+            }
+
+            frameStatsTime += frame.deltaTime;
+            frameStatsCount++;
+            if (frameStatsTime >= FRAME_STATS_INTERVAL) {
+                const auto frameTime = frameStatsTime / static_cast<float>(frameStatsCount);
+                frameStats = std::format("{:.1f} fps  {:.2f} ms", 1.0f / frameTime, frameTime * 1000.0f);
+                frameStatsTime = 0.0f;
+                frameStatsCount = 0;
+            }
+            // the backdrop shares the layer, the white page is drawn before the font page
+            if (const auto extent = overlay.measureText(frameStats, FRAME_STATS_SIZE); extent.x > 0.0f) {
+                const auto position = glm::vec2(8.0f);
+                overlay.drawQuad(position - glm::vec2(4.0f), extent + glm::vec2(8.0f), glm::vec4(0.0f, 0.0f, 0.0f, 0.5f), FRAME_STATS_LAYER);
+                overlay.drawText(frameStats, position, FRAME_STATS_SIZE, glm::vec4(1.0f), FRAME_STATS_LAYER);
+            }
+            overlay.end();
+
+            if (!mRenderQueue.submit()) {
+                break;
+            }
+        }
+
+        mRenderQueue.shutdown();
+    }  // joins the render thread
+
+    if (renderException) {
+        std::rethrow_exception(renderException);
+    }
+}
+
+auto VulkanRenderer::renderLoop() -> void {
+    AdelieLogDebug("Render thread started");
+    while (const auto* snapshot = mRenderQueue.acquire()) {
+        drawFrame(*snapshot);
+        mRenderQueue.release();
     }
+    AdelieLogDebug("Render thread stopped");
 }
 
 auto VulkanRenderer::getRenderWindow() const -> std::shared_ptr<WindowInterface> {
@@ -1182,9 +1802,34 @@ auto VulkanRenderer::getRenderPass() const -> std::shared_ptr<VkRenderPass> {
     return mRenderPass;
 }
 
-void VulkanRenderer::drawFrame() {
-    vkWaitForFences(*mLogicalDevice, 1, &mInFlightFences[mCurrentFrame], VK_TRUE, UINT64_MAX);
-    vkResetFences(*mLogicalDevice, 1, &mInFlightFences[mCurrentFrame]);
+auto VulkanRenderer::getFrameNumber() const -> uint64_t {
+    return mFrameNumber.load(std::memory_order_acquire);
+}
+
+auto VulkanRenderer::getCompletedFrameNumber() const -> uint64_t {
+    return mFrameTimeline->getCompletedValue();
+}
+
+auto VulkanRenderer::waitForFrame(const uint64_t frameNumber) const -> void {
+    AdelieAssert(frameNumber <= getFrameNumber(), "Waiting for a frame which was not submitted yet would block forever");
+    mFrameTimeline->wait(frameNumber, UINT64_MAX);
+}
+
+auto VulkanRenderer::getFrameTimeline() const -> const VulkanTimelineSemaphore& {
+    return *mFrameTimeline;
+}
+
+void VulkanRenderer::drawFrame(const RenderSnapshot& snapshot) {
+    mWindowExtent = {.width = snapshot.windowWidth, .height = snapshot.windowHeight};
+
+    // the resources of the current slot were last used by the frame submitted `framesInFlight` frames ago, so we only
+    // have to wait until the GPU reached exactly that value on the frame timeline before we can reuse them
+    const auto framesInFlight = static_cast<uint64_t>(MAX_FRAMES_IN_FLIGHT);
+    const auto frameNumber = mFrameNumber.load(std::memory_order_relaxed) + 1;
+    if (frameNumber > framesInFlight) {
+        mFrameTimeline->wait(frameNumber - framesInFlight, UINT64_MAX);
+    }
+    mDeletionQueue->collect(mFrameTimeline->getCompletedValue());
 
     uint32_t imageIndex;
     if (const auto result = vkAcquireNextImageKHR(*mLogicalDevice, mSwapChain, UINT64_MAX, mImageAvailableSemaphores[mCurrentFrame], VK_NULL_HANDLE, &imageIndex); result == VK_ERROR_OUT_OF_DATE_KHR) {
@@ -1194,11 +1839,13 @@ void VulkanRenderer::drawFrame() {
         throw VulkanRuntimeException("Failed to acquire swap chain image", result);
     }
 
-    if (imageIndex >= mCommandBuffers.size()) {
+    if (imageIndex >= mSwapChainFramebuffers.size()) {
         throw std::runtime_error("Acquired image index out of bounds!");
     }
 
-    updateUniformBuffer();
+    // the command buffer of this slot was last used by the frame we waited for above, so it can be recorded again
+    updateUniformBuffer(snapshot);
+    recordCommandBuffer(mCommandBuffers[mCurrentFrame], imageIndex, frameNumber, snapshot);
 
     VkSubmitInfo submitInfo{};
     submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
@@ -1209,14 +1856,28 @@ void VulkanRenderer::drawFrame() {
     submitInfo.pWaitDstStageMask = waitStages;
 
     submitInfo.commandBufferCount = 1;
-    submitInfo.pCommandBuffers = &mCommandBuffers[imageIndex];
+    submitInfo.pCommandBuffers = &mCommandBuffers[mCurrentFrame];
 
-    submitInfo.signalSemaphoreCount = 1;
-    submitInfo.pSignalSemaphores = &mRenderFinishedSemaphores[mCurrentFrame];
+    // the binary semaphore is required for the presentation engine, the timeline value marks the frame as finished
+    const std::array signalSemaphores = {mRenderFinishedSemaphores[mCurrentFrame], mFrameTimeline->getHandle()};
+    const std::array<uint64_t, 2> signalValues = {0, frameNumber};
+    const uint64_t waitValue = 0;
 
-    if (const auto result = vkQueueSubmit(mSelectedGraphicsQueue, 1, &submitInfo, mInFlightFences[mCurrentFrame]); result != VK_SUCCESS) {
+    VkTimelineSemaphoreSubmitInfo timelineInfo{};
+    timelineInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+    timelineInfo.waitSemaphoreValueCount = 1;
+    timelineInfo.pWaitSemaphoreValues = &waitValue;
+    timelineInfo.signalSemaphoreValueCount = static_cast<uint32_t>(signalValues.size());
+    timelineInfo.pSignalSemaphoreValues = signalValues.data();
+
+    submitInfo.pNext = &timelineInfo;
+    submitInfo.signalSemaphoreCount = static_cast<uint32_t>(signalSemaphores.size());
+    submitInfo.pSignalSemaphores = signalSemaphores.data();
+
+    if (const auto result = vkQueueSubmit(mSelectedGraphicsQueue, 1, &submitInfo, VK_NULL_HANDLE); result != VK_SUCCESS) {
         throw VulkanRuntimeException("Failed to submit draw command buffer", result);
     }
+    mFrameNumber.store(frameNumber, std::memory_order_release);
 
     VkSwapchainKHR swapChains[] = {mSwapChain};
     VkPresentInfoKHR presentInfo{};
@@ -1233,168 +1894,29 @@ void VulkanRenderer::drawFrame() {
         throw VulkanRuntimeException("Failed to present swap chain image", result);
     }
 
-    mCurrentFrame = (mCurrentFrame + 1) % mSwapChainImages.size();
-}
-
-auto VulkanRenderer::transitionImageLayout(VkImage image, VkFormat format, VkImageLayout oldLayout, VkImageLayout newLayout) -> void {
-    VkCommandBuffer commandBuffer = VulkanBufferManager::beginSingleTimeCommands(*mLogicalDevice, mCommandPool);
-
-    VkImageMemoryBarrier barrier{};
-    barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
-    barrier.oldLayout = oldLayout;
-    barrier.newLayout = newLayout;
-    barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-    barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-    barrier.image = image;
-    barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;  // TODO: Handle depth/stencil aspects if needed
-    barrier.subresourceRange.baseMipLevel = 0;
-    barrier.subresourceRange.levelCount = 1;
-    barrier.subresourceRange.baseArrayLayer = 0;
-    barrier.subresourceRange.layerCount = 1;
-
-    VkPipelineStageFlags sourceStage;
-    VkPipelineStageFlags destinationStage;
-
-    if (oldLayout == VK_IMAGE_LAYOUT_UNDEFINED && newLayout == VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL) {
-        barrier.srcAccessMask = 0;
-        barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-
-        sourceStage = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
-        destinationStage = VK_PIPELINE_STAGE_TRANSFER_BIT;
-    } else if (oldLayout == VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL && newLayout == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL) {
-        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-        barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
-
-        sourceStage = VK_PIPELINE_STAGE_TRANSFER_BIT;
-        destinationStage = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
-    } else {
-        throw VulkanRuntimeException("Unsupported layout transition");  // TODO: maybe just an assert
-    }
-
-    vkCmdPipelineBarrier(commandBuffer, sourceStage, destinationStage, 0, 0, nullptr, 0, nullptr, 1, &barrier);
-
-    VulkanBufferManager::endSingleTimeCommands(*mLogicalDevice, mCommandPool, mSelectedGraphicsQueue, commandBuffer);
-}
-
-auto VulkanRenderer::copyBufferToImage(VkBuffer buffer, VkImage image, uint32_t width, uint32_t height) -> void {
-    VkCommandBuffer commandBuffer = VulkanBufferManager::beginSingleTimeCommands(*mLogicalDevice, mCommandPool);
-
-    VkBufferImageCopy region{};
-    region.bufferOffset = 0;
-    region.bufferRowLength = 0;
-    region.bufferImageHeight = 0;
-    region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-    region.imageSubresource.mipLevel = 0;
-    region.imageSubresource.baseArrayLayer = 0;
-    region.imageSubresource.layerCount = 1;
-    region.imageOffset = {0, 0, 0};
-    region.imageExtent = {width, height, 1};
-
-    vkCmdCopyBufferToImage(commandBuffer, buffer, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
-
-    VulkanBufferManager::endSingleTimeCommands(*mLogicalDevice, mCommandPool, mSelectedGraphicsQueue, commandBuffer);
-}
-
-auto VulkanRenderer::createTexture(const std::string& filename, VkFormat format, VkImage& image, VkDeviceMemory& imageMemory, VkImageView& imageView) -> void {
-    int texWidth, texHeight, texChannels;
-    std::string fullPath = "textures/" + filename;
-    stbi_set_flip_vertically_on_load(true);
-    stbi_uc* pixels = stbi_load(fullPath.c_str(), &texWidth, &texHeight, &texChannels, STBI_rgb_alpha);
-    if (!pixels) {
-        throw RuntimeException("Failed to load texture image: " + fullPath);
-    }
-
-    VkDeviceSize imageSize = texWidth * texHeight * 4;
-
-    VkBuffer stagingBuffer;
-    VkDeviceMemory stagingBufferMemory;
-    VulkanBufferManager::createBuffer(*mLogicalDevice, *mPhysicalDevice, imageSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, stagingBuffer,
-                                      stagingBufferMemory);
-
-    debugUtilsObjectName(reinterpret_cast<uint64_t>(stagingBuffer), std::format("createTexture({})", filename).c_str(), VK_OBJECT_TYPE_BUFFER);
-    debugUtilsObjectName(reinterpret_cast<uint64_t>(stagingBufferMemory), std::format("createTexture({})", filename).c_str(), VK_OBJECT_TYPE_DEVICE_MEMORY);
-
-    void* data;
-    vkMapMemory(*mLogicalDevice, stagingBufferMemory, 0, imageSize, 0, &data);
-    memcpy(data, pixels, imageSize);
-    vkUnmapMemory(*mLogicalDevice, stagingBufferMemory);
-
-    stbi_image_free(pixels);
-
-    VkImageCreateInfo imageInfo{};
-    imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
-    imageInfo.imageType = VK_IMAGE_TYPE_2D;
-    imageInfo.extent.width = static_cast<uint32_t>(texWidth);
-    imageInfo.extent.height = static_cast<uint32_t>(texHeight);
-    imageInfo.extent.depth = 1;
-    imageInfo.mipLevels = 1;
-    imageInfo.arrayLayers = 1;
-    imageInfo.format = format;
-    imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
-    imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-    imageInfo.usage = VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
-    imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
-    imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
-    imageInfo.flags = 0;
-
-    if (const auto result = vkCreateImage(*mLogicalDevice, &imageInfo, nullptr, &image); result != VK_SUCCESS) {
-        throw VulkanRuntimeException("Failed to create texture image", result);
-    }
-    debugUtilsObjectName(reinterpret_cast<uint64_t>(image), std::format("createTexture({})", filename).c_str(), VK_OBJECT_TYPE_IMAGE);
-
-    VkMemoryRequirements memRequirements;
-    vkGetImageMemoryRequirements(*mLogicalDevice, image, &memRequirements);
-    VkMemoryAllocateInfo allocInfo{};
-    allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-    allocInfo.allocationSize = memRequirements.size;
-    allocInfo.memoryTypeIndex = VulkanBufferManager::findMemoryType(*mPhysicalDevice, memRequirements.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
-
-    if (const auto result = vkAllocateMemory(*mLogicalDevice, &allocInfo, nullptr, &imageMemory); result != VK_SUCCESS) {
-        throw VulkanRuntimeException("Failed to allocate texture image memory", result);
-    }
-    vkBindImageMemory(*mLogicalDevice, image, imageMemory, 0);
-
-    transitionImageLayout(image, format, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
-    copyBufferToImage(stagingBuffer, image, static_cast<uint32_t>(texWidth), static_cast<uint32_t>(texHeight));
-    transitionImageLayout(image, format, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
-
-    vkDestroyBuffer(*mLogicalDevice, stagingBuffer, nullptr);
-    vkFreeMemory(*mLogicalDevice, stagingBufferMemory, nullptr);
-
-    debugUtilsObjectName(reinterpret_cast<uint64_t>(imageMemory), std::format("createTexture({})", filename).c_str(), VK_OBJECT_TYPE_DEVICE_MEMORY);
-
-    VkImageViewCreateInfo viewInfo{};
-    viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
-    viewInfo.image = image;
-    viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
-    viewInfo.format = format;
-    viewInfo.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-    viewInfo.subresourceRange.baseMipLevel = 0;
-    viewInfo.subresourceRange.levelCount = 1;
-    viewInfo.subresourceRange.baseArrayLayer = 0;
-    viewInfo.subresourceRange.layerCount = 1;
-
-    if (const auto result = vkCreateImageView(*mLogicalDevice, &viewInfo, nullptr, &imageView); result != VK_SUCCESS) {
-        throw VulkanRuntimeException("Failed to create texture image view", result);
-    }
+    mCurrentFrame = (mCurrentFrame + 1) % framesInFlight;
 }
 
 auto VulkanRenderer::createDescriptorPool() -> void {
-    std::array<VkDescriptorPoolSize, 4> poolSizes{};
+    std::array<VkDescriptorPoolSize, 6> poolSizes{};
     poolSizes[0].type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-    poolSizes[0].descriptorCount = static_cast<uint32_t>(mSwapChainImages.size());
+    poolSizes[0].descriptorCount = MAX_FRAMES_IN_FLIGHT;
     poolSizes[1].type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
-    poolSizes[1].descriptorCount = static_cast<uint32_t>(mSwapChainImages.size());
+    poolSizes[1].descriptorCount = MAX_FRAMES_IN_FLIGHT;
     poolSizes[2].type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
-    poolSizes[2].descriptorCount = static_cast<uint32_t>(mSwapChainImages.size());
+    poolSizes[2].descriptorCount = MAX_FRAMES_IN_FLIGHT;
     poolSizes[3].type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
-    poolSizes[3].descriptorCount = static_cast<uint32_t>(mSwapChainImages.size());
+    poolSizes[3].descriptorCount = MAX_FRAMES_IN_FLIGHT;
+    poolSizes[4].type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    poolSizes[4].descriptorCount = MAX_FRAMES_IN_FLIGHT * 4;  // instances and the light clusters
+    poolSizes[5].type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+    poolSizes[5].descriptorCount = MAX_FRAMES_IN_FLIGHT;  // shadow cascades
 
     VkDescriptorPoolCreateInfo poolInfo{};
     poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
     poolInfo.poolSizeCount = static_cast<uint32_t>(poolSizes.size());
     poolInfo.pPoolSizes = poolSizes.data();
-    poolInfo.maxSets = static_cast<uint32_t>(mSwapChainImages.size());
+    poolInfo.maxSets = MAX_FRAMES_IN_FLIGHT;
 
     if (const auto result = vkCreateDescriptorPool(*mLogicalDevice, &poolInfo, nullptr, &mDescriptorPool); result != VK_SUCCESS) {
         throw VulkanRuntimeException("Failed to create descriptor pool", result);
@@ -1402,41 +1924,46 @@ auto VulkanRenderer::createDescriptorPool() -> void {
 }
 
 auto VulkanRenderer::createDescriptorSets() -> void {
-    std::vector layouts(mSwapChainImages.size(), mDescriptorSetLayout);
+    std::vector layouts(MAX_FRAMES_IN_FLIGHT, mDescriptorSetLayout);
     VkDescriptorSetAllocateInfo allocInfo{};
     allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
     allocInfo.descriptorPool = mDescriptorPool;
-    allocInfo.descriptorSetCount = static_cast<uint32_t>(mSwapChainImages.size());
+    allocInfo.descriptorSetCount = MAX_FRAMES_IN_FLIGHT;
     allocInfo.pSetLayouts = layouts.data();
 
-    mDescriptorSets.resize(mSwapChainImages.size());
+    mDescriptorSets.resize(MAX_FRAMES_IN_FLIGHT);
     if (const auto result = vkAllocateDescriptorSets(*mLogicalDevice, &allocInfo, mDescriptorSets.data()); result != VK_SUCCESS) {
         throw VulkanRuntimeException("Failed to allocate descriptor sets", result);
     }
 
-    for (size_t i = 0; i < mSwapChainImages.size(); i++) {
+    // no version is 0xFFFFFFFF, so every texture binding gets written on the first use of the set
+    mDescriptorSetTextureVersions.assign(MAX_FRAMES_IN_FLIGHT, {});
+    for (auto& versions : mDescriptorSetTextureVersions) {
+        versions.fill(UINT32_MAX);
+    }
+
+    for (size_t i = 0; i < MAX_FRAMES_IN_FLIGHT; i++) {
         VkDescriptorBufferInfo bufferInfo{};
         bufferInfo.buffer = mUniformBuffers[i];
         bufferInfo.offset = 0;
         bufferInfo.range = sizeof(UniformBufferObject);
 
-        VkDescriptorImageInfo baseColorImageInfo{};
-        baseColorImageInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-        baseColorImageInfo.imageView = mTextureImageView;
-        baseColorImageInfo.sampler = mTextureSampler;
-
-        VkDescriptorImageInfo normalMapImageInfo{};
-        normalMapImageInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-        normalMapImageInfo.imageView = mNormalMapImageView;
-        normalMapImageInfo.sampler = mTextureSampler;
+        VkDescriptorBufferInfo instanceBufferInfo{};
+        instanceBufferInfo.buffer = mOcclusionCuller->getInstanceBuffer(static_cast<uint32_t>(i));
+        instanceBufferInfo.offset = 0;
+        instanceBufferInfo.range = mOcclusionCuller->getInstanceBufferSize();
 
-        VkDescriptorImageInfo roughnessMapImageInfo{};
-        roughnessMapImageInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-        roughnessMapImageInfo.imageView = mRoughnessMapImageView;
-        roughnessMapImageInfo.sampler = mTextureSampler;
+        const std::array<VkDescriptorBufferInfo, 3> lightBufferInfos = {
+            VkDescriptorBufferInfo{.buffer = mClusteredLighting->getLightBuffer(static_cast<uint32_t>(i)), .offset = 0, .range = VK_WHOLE_SIZE},
+            VkDescriptorBufferInfo{.buffer = mClusteredLighting->getClusterCountBuffer(), .offset = 0, .range = VK_WHOLE_SIZE},
+            VkDescriptorBufferInfo{.buffer = mClusteredLighting->getClusterIndexBuffer(), .offset = 0, .range = VK_WHOLE_SIZE}};
 
-        std::array<VkWriteDescriptorSet, 4> descriptorWrites{};
+        VkDescriptorImageInfo shadowImageInfo{};
+        shadowImageInfo.imageLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL;
+        shadowImageInfo.imageView = mShadowCascades->getImageView();
+        shadowImageInfo.sampler = mShadowCascades->getSampler();
 
+        std::array<VkWriteDescriptorSet, 6> descriptorWrites{};
         descriptorWrites[0].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
         descriptorWrites[0].dstSet = mDescriptorSets[i];
         descriptorWrites[0].dstBinding = 0;
@@ -1444,37 +1971,73 @@ auto VulkanRenderer::createDescriptorSets() -> void {
         descriptorWrites[0].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
         descriptorWrites[0].descriptorCount = 1;
         descriptorWrites[0].pBufferInfo = &bufferInfo;
-
         descriptorWrites[1].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
         descriptorWrites[1].dstSet = mDescriptorSets[i];
-        descriptorWrites[1].dstBinding = 1;
+        descriptorWrites[1].dstBinding = 4;
         descriptorWrites[1].dstArrayElement = 0;
-        descriptorWrites[1].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        descriptorWrites[1].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
         descriptorWrites[1].descriptorCount = 1;
-        descriptorWrites[1].pImageInfo = &baseColorImageInfo;
-
-        descriptorWrites[2].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-        descriptorWrites[2].dstSet = mDescriptorSets[i];
-        descriptorWrites[2].dstBinding = 2;
-        descriptorWrites[2].dstArrayElement = 0;
-        descriptorWrites[2].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
-        descriptorWrites[2].descriptorCount = 1;
-        descriptorWrites[2].pImageInfo = &normalMapImageInfo;
-
-        descriptorWrites[3].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-        descriptorWrites[3].dstSet = mDescriptorSets[i];
-        descriptorWrites[3].dstBinding = 3;
-        descriptorWrites[3].dstArrayElement = 0;
-        descriptorWrites[3].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
-        descriptorWrites[3].descriptorCount = 1;
-        descriptorWrites[3].pImageInfo = &roughnessMapImageInfo;
+        descriptorWrites[1].pBufferInfo = &instanceBufferInfo;
+        for (uint32_t binding = 0; binding < lightBufferInfos.size(); binding++) {
+            auto& descriptorWrite = descriptorWrites[2 + binding];
+            descriptorWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            descriptorWrite.dstSet = mDescriptorSets[i];
+            descriptorWrite.dstBinding = 5 + binding;
+            descriptorWrite.dstArrayElement = 0;
+            descriptorWrite.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+            descriptorWrite.descriptorCount = 1;
+            descriptorWrite.pBufferInfo = &lightBufferInfos[binding];
+        }
+        descriptorWrites[5].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        descriptorWrites[5].dstSet = mDescriptorSets[i];
+        descriptorWrites[5].dstBinding = 8;
+        descriptorWrites[5].dstArrayElement = 0;
+        descriptorWrites[5].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        descriptorWrites[5].descriptorCount = 1;
+        descriptorWrites[5].pImageInfo = &shadowImageInfo;
 
         vkUpdateDescriptorSets(*mLogicalDevice, static_cast<uint32_t>(descriptorWrites.size()), descriptorWrites.data(), 0, nullptr);
+        updateTextureDescriptors(i);
+    }
+}
+
+auto VulkanRenderer::updateTextureDescriptors(const size_t descriptorSetIndex) -> void {
+    std::array<VkDescriptorImageInfo, MATERIAL_TEXTURE_COUNT> imageInfos{};
+    std::array<VkWriteDescriptorSet, MATERIAL_TEXTURE_COUNT> descriptorWrites{};
+    uint32_t writeCount = 0;
+
+    // only the bindings whose texture changed since the set was written last are touched
+    auto& writtenVersions = mDescriptorSetTextureVersions[descriptorSetIndex];
+    for (size_t i = 0; i < MATERIAL_TEXTURE_COUNT; i++) {
+        const auto version = mTextureLoader->getVersion(mMaterialTextures[i]);
+        if (version == writtenVersions[i]) {
+            continue;
+        }
+        writtenVersions[i] = version;
+
+        auto& imageInfo = imageInfos[writeCount];
+        imageInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        imageInfo.imageView = mTextureLoader->getImageView(mMaterialTextures[i]);
+        imageInfo.sampler = mTextureSampler;
+
+        auto& descriptorWrite = descriptorWrites[writeCount];
+        descriptorWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        descriptorWrite.dstSet = mDescriptorSets[descriptorSetIndex];
+        descriptorWrite.dstBinding = static_cast<uint32_t>(i + 1);
+        descriptorWrite.dstArrayElement = 0;
+        descriptorWrite.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        descriptorWrite.descriptorCount = 1;
+        descriptorWrite.pImageInfo = &imageInfo;
+        writeCount++;
+    }
+
+    if (writeCount > 0) {
+        vkUpdateDescriptorSets(*mLogicalDevice, writeCount, descriptorWrites.data(), 0, nullptr);
     }
 }
 
 auto VulkanRenderer::createCommandBuffers() -> void {
-    mCommandBuffers.resize(mSwapChainImages.size());
+    mCommandBuffers.resize(MAX_FRAMES_IN_FLIGHT);
 
     VkCommandBufferAllocateInfo allocInfo{};
     allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
@@ -1487,57 +2050,138 @@ auto VulkanRenderer::createCommandBuffers() -> void {
     }
 
     for (size_t i = 0; i < mCommandBuffers.size(); i++) {
-        VkCommandBufferBeginInfo beginInfo{};
-        beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
-        beginInfo.flags = VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT;
+        debugUtilsObjectName(reinterpret_cast<uint64_t>(mCommandBuffers[i]), std::format("mCommandBuffers[{}]", i).c_str(), VK_OBJECT_TYPE_COMMAND_BUFFER);
+    }
+}
 
-        if (const auto result = vkBeginCommandBuffer(mCommandBuffers[i], &beginInfo); result != VK_SUCCESS) {
-            throw VulkanRuntimeException("Failed to begin recording command buffer", result);
-        }
+auto VulkanRenderer::recordCommandBuffer(VkCommandBuffer commandBuffer, const uint32_t imageIndex, const uint64_t frameNumber, const RenderSnapshot& snapshot) -> void {
+    if (const auto result = vkResetCommandBuffer(commandBuffer, 0); result != VK_SUCCESS) {
+        throw VulkanRuntimeException("Failed to reset command buffer", result);
+    }
+
+    VkCommandBufferBeginInfo beginInfo{};
+    beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+
+    if (const auto result = vkBeginCommandBuffer(commandBuffer, &beginInfo); result != VK_SUCCESS) {
+        throw VulkanRuntimeException("Failed to begin recording command buffer", result);
+    }
+
+    // uploads and residency changes have to be recorded outside of the render pass and the descriptor set has to be
+    // written before it is bound. The set of this slot is not used by the GPU anymore, since we waited for its previous
+    // frame
+    for (const auto handle : mMaterialTextures) {
+        mResidencyManager->markUsed(handle, frameNumber);
+    }
 
-        VkClearValue clearValue{};
-        clearValue.color = {{0.0f, 0.0f, 0.0f, 1.0f}};
+    // the glyph atlas is built once by a job, the main thread draws no text before it is ready. It is only read after
+    // that, so it is copied into a texture without a lock
+    if (const auto& font = Renderer::getOverlay().getFont(); !mFontPageSet && font.isReady()) {
+        const auto texture = mTextureLoader->create("overlay font", font.getAtlasWidth(), font.getAtlasHeight(), VK_FORMAT_R8G8B8A8_UNORM, font.getAtlasPixels());
+        mQuadRenderer->setPage(QUAD_FONT_PAGE, texture, VulkanQuadPageContent::DistanceField);
+        mFontPageSet = true;
+    }
+    mTextureLoader->recordUploads(commandBuffer, frameNumber);
 
-        VkRenderPassBeginInfo renderPassInfo{};
-        renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
-        renderPassInfo.renderPass = *mRenderPass;
-        renderPassInfo.framebuffer = mSwapChainFramebuffers[i];
-        renderPassInfo.renderArea.offset = {0, 0};
-        renderPassInfo.renderArea.extent = mSwapChainExtent;
-        renderPassInfo.clearValueCount = 1;
-        renderPassInfo.pClearValues = &clearValue;
+    mResidencyManager->update(mTextureLoader->getMemoryUsage());
+    mResidencyManager->recordResidencyChanges(commandBuffer, frameNumber, *mTextureLoader);
+    updateTextureDescriptors(mCurrentFrame);
+    mQuadRenderer->writeQuads(mCurrentFrame, frameNumber, snapshot.overlayQuads);
 
-        vkCmdBeginRenderPass(mCommandBuffers[i], &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
-        vkCmdBindPipeline(mCommandBuffers[i], VK_PIPELINE_BIND_POINT_GRAPHICS, *mGraphicsPipeline);
+    // every draw becomes an instance of the occlusion culling, its index in the snapshot identifies it between the
+    // frames
+    const auto toInstance = [&](const RenderCommand& command) -> VulkanGpuInstance {
+        const auto& mesh = mGeometryPool.getMesh(command.meshId);
+        const auto& lod = mesh.lods[command.lod];
+        return {.model = command.model,
+                .boundsMin = glm::vec4(mesh.bounds.min, 0.0f),
+                .boundsMax = glm::vec4(mesh.bounds.max, 0.0f),
+                .firstIndex = lod.firstIndex,
+                .indexCount = lod.indexCount,
+                .vertexOffset = mesh.vertexOffset,
+                .padding = 0};
+    };
+    mInstances.clear();
+    std::ranges::transform(snapshot.commands, std::back_inserter(mInstances), toInstance);
+    mOcclusionCuller->writeInstances(mCurrentFrame, mInstances);
+
+    // only the cascades whose light matrix or casters changed are drawn again
+    mShadowCasters.clear();
+    std::ranges::transform(snapshot.shadowCasters, std::back_inserter(mShadowCasters), toInstance);
+    mShadowCascades->recordCascades(commandBuffer, mCurrentFrame, snapshot.shadowCascades, mShadowCasters, mVertexBuffer, mIndexBuffer);
+
+    const auto viewProjection = snapshot.projection * snapshot.view;
+    mOcclusionCuller->recordFirstPhase(commandBuffer, mCurrentFrame, viewProjection);
+
+    mLights.clear();
+    for (const auto& light : snapshot.lights) {
+        mLights.push_back({.positionRange = glm::vec4(light.position, light.range), .colorIntensity = glm::vec4(light.color, light.intensity)});
+    }
+    mClusteredLighting->writeLights(mCurrentFrame, mLights);
+    mClusteredLighting->recordCulling(commandBuffer, mCurrentFrame, snapshot.view, snapshot.projection, snapshot.nearPlane, snapshot.farPlane);
+
+    // the particles are simulated and counted on the GPU, the CPU only hands over the emitters
+    mParticleSystem->writeEmitters(mCurrentFrame, snapshot.particleEmitters, snapshot.deltaTime);
+    mParticleSystem->recordSimulation(commandBuffer, mCurrentFrame, snapshot.deltaTime);
+
+    std::array<VkClearValue, 2> clearValues{};
+    clearValues[0].color = {{0.0f, 0.0f, 0.0f, 1.0f}};
+    clearValues[1].depthStencil = {.depth = 1.0f, .stencil = 0};
+
+    VkRenderPassBeginInfo renderPassInfo{};
+    renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+    renderPassInfo.renderPass = *mRenderPass;
+    renderPassInfo.framebuffer = mSwapChainFramebuffers[imageIndex];
+    renderPassInfo.renderArea.offset = {0, 0};
+    renderPassInfo.renderArea.extent = mSwapChainExtent;
+    renderPassInfo.clearValueCount = static_cast<uint32_t>(clearValues.size());
+    renderPassInfo.pClearValues = clearValues.data();
+
+    const auto drawPhase = [&](const uint32_t phase) {
+        vkCmdBeginRenderPass(commandBuffer, &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
+        vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, *mGraphicsPipeline);
 
         VkBuffer vertexBuffers[] = {mVertexBuffer};
         VkDeviceSize offsets[] = {0};
-        vkCmdBindVertexBuffers(mCommandBuffers[i], 0, 1, vertexBuffers, offsets);
-        vkCmdBindIndexBuffer(mCommandBuffers[i], mIndexBuffer, 0, VK_INDEX_TYPE_UINT16);
-        vkCmdBindDescriptorSets(mCommandBuffers[i], VK_PIPELINE_BIND_POINT_GRAPHICS, *mPipelineLayout, 0, 1, &mDescriptorSets[mCurrentFrame], 0, nullptr);
+        vkCmdBindVertexBuffers(commandBuffer, 0, 1, vertexBuffers, offsets);
+        vkCmdBindIndexBuffer(commandBuffer, mIndexBuffer, 0, VK_INDEX_TYPE_UINT32);
+        vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, *mPipelineLayout, 0, 1, &mDescriptorSets[mCurrentFrame], 0, nullptr);
 
-        vkCmdDrawIndexed(mCommandBuffers[i], static_cast<uint32_t>(indices.size()), 1, 0, 0, 0);
+        mOcclusionCuller->recordDraws(commandBuffer, mCurrentFrame, phase);
 
-        vkCmdEndRenderPass(mCommandBuffers[i]);
-        if (const auto result = vkEndCommandBuffer(mCommandBuffers[i]); result != VK_SUCCESS) {
-            throw VulkanRuntimeException("Failed to stop recording command buffer", result);
+        // the particles are blended over the opaque geometry of both phases, the overlay lies on top of everything
+        if (1 == phase) {
+            mParticleSystem->recordDraws(commandBuffer, snapshot.view, snapshot.projection);
+            mQuadRenderer->recordDraws(commandBuffer, mCurrentFrame);
         }
+        vkCmdEndRenderPass(commandBuffer);
+    };
+
+    // the instances visible in the last frame are drawn first, their depth is the occluder for all the others
+    drawPhase(0);
+    mOcclusionCuller->recordSecondPhase(commandBuffer, mCurrentFrame, viewProjection);
+
+    renderPassInfo.renderPass = mContinueRenderPass;
+    renderPassInfo.clearValueCount = 0;
+    renderPassInfo.pClearValues = nullptr;
+    drawPhase(1);
+
+    if (const auto result = vkEndCommandBuffer(commandBuffer); result != VK_SUCCESS) {
+        throw VulkanRuntimeException("Failed to stop recording command buffer", result);
     }
 }
 
 auto VulkanRenderer::createSyncObjects() -> void {
-    mImageAvailableSemaphores.resize(mSwapChainImages.size());
-    mRenderFinishedSemaphores.resize(mSwapChainImages.size());
-    mInFlightFences.resize(mSwapChainImages.size());
+    mImageAvailableSemaphores.resize(MAX_FRAMES_IN_FLIGHT);
+    mRenderFinishedSemaphores.resize(MAX_FRAMES_IN_FLIGHT);
 
     VkSemaphoreCreateInfo semaphoreInfo{};
     semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
 
-    VkFenceCreateInfo fenceInfo{};
-    fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
-    fenceInfo.flags = VK_FENCE_CREATE_SIGNALED_BIT;
+    mFrameTimeline = std::make_unique<VulkanTimelineSemaphore>(*mLogicalDevice, 0);
+    debugUtilsObjectName(reinterpret_cast<uint64_t>(mFrameTimeline->getHandle()), "mFrameTimeline", VK_OBJECT_TYPE_SEMAPHORE);
 
-    for (size_t i = 0; i < mSwapChainImages.size(); i++) {
+    for (size_t i = 0; i < MAX_FRAMES_IN_FLIGHT; i++) {
         if (const auto result = vkCreateSemaphore(*mLogicalDevice, &semaphoreInfo, nullptr, &mImageAvailableSemaphores[i]); result != VK_SUCCESS) {
             throw VulkanRuntimeException("Failed to create synchronization object (semaphore) for available images", result);
         }
@@ -1547,11 +2191,6 @@ auto VulkanRenderer::createSyncObjects() -> void {
             throw VulkanRuntimeException("Failed to create synchronization object (semaphore) for finished renderings", result);
         }
         debugUtilsObjectName(reinterpret_cast<uint64_t>(mRenderFinishedSemaphores[i]), std::format("mRenderFinishedSemaphores[{}]", i).c_str(), VK_OBJECT_TYPE_SEMAPHORE);
-
-        if (const auto result = vkCreateFence(*mLogicalDevice, &fenceInfo, nullptr, &mInFlightFences[i]); result != VK_SUCCESS) {
-            throw VulkanRuntimeException("Failed to create synchronization object (fence) for frames in flight", result);
-        }
-        debugUtilsObjectName(reinterpret_cast<uint64_t>(mInFlightFences[i]), std::format("mInFlightFences[{}]", i).c_str(), VK_OBJECT_TYPE_FENCE);
     }
 }
 
@@ -1572,7 +2211,7 @@ auto VulkanRenderer::createTextureSampler() -> void {
     samplerInfo.mipmapMode = VK_SAMPLER_MIPMAP_MODE_LINEAR;
     samplerInfo.mipLodBias = 0.0f;
     samplerInfo.minLod = 0.0f;
-    samplerInfo.maxLod = 0.0f;
+    samplerInfo.maxLod = VK_LOD_CLAMP_NONE;
 
     if (const auto result = vkCreateSampler(*mLogicalDevice, &samplerInfo, nullptr, &mTextureSampler); result != VK_SUCCESS) {
         throw VulkanRuntimeException("Failed to create texture sampler", result);
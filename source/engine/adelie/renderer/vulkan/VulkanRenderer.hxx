@@ -6,11 +6,32 @@
     #include <vulkan/vulkan.h>
 
     #include <adelie/adelie.hxx>
+    #include <adelie/core/renderer/GeometryPool.hxx>
+    #include <adelie/core/renderer/RenderCommandQueue.hxx>
+    #include <adelie/core/renderer/RenderSnapshot.hxx>
     #include <adelie/core/renderer/WindowInterface.hxx>
+    #include <adelie/renderer/vulkan/VulkanClusteredLighting.hxx>
+    #include <adelie/renderer/vulkan/VulkanDeletionQueue.hxx>
+    #include <adelie/renderer/vulkan/VulkanOcclusionCuller.hxx>
+    #include <adelie/renderer/vulkan/VulkanParticleSystem.hxx>
+    #include <adelie/renderer/vulkan/VulkanQuadRenderer.hxx>
+    #include <adelie/renderer/vulkan/VulkanResidencyManager.hxx>
+    #include <adelie/renderer/vulkan/VulkanShadowCascades.hxx>
+    #include <adelie/renderer/vulkan/VulkanTextureLoader.hxx>
+    #include <adelie/renderer/vulkan/VulkanTimelineSemaphore.hxx>
     #include <adelie/renderer/vulkan/VulkanVertex.hxx>
+    #include <array>
+    #include <atomic>
 
 namespace adelie::renderer::vulkan {
 
+    // albedo, normal map and roughness map of the material bound at the descriptor bindings 1 to 3
+    static inline constexpr std::size_t MATERIAL_TEXTURE_COUNT = 3;
+
+    // the frames the CPU records ahead of the GPU, every per-frame resource exists this often whatever the number of
+    // swap chain images, only the framebuffers exist once per image
+    static inline constexpr uint32_t MAX_FRAMES_IN_FLIGHT = 2;
+
     class ADELIE_API VulkanRenderer {
         public:
             explicit VulkanRenderer(const std::shared_ptr<core::renderer::WindowInterface>& windowInterface);
@@ -25,6 +46,7 @@ namespace adelie::renderer::vulkan {
 
             auto operator=(VulkanRenderer&&) -> VulkanRenderer& = delete;
 
+            // runs the simulation on the calling thread and the rendering on a dedicated render thread until the window is closed
             auto mainLoop() -> void;
 
             inline auto getRenderWindow() const -> std::shared_ptr<core::renderer::WindowInterface>;
@@ -41,8 +63,21 @@ namespace adelie::renderer::vulkan {
 
             inline auto getRenderPass() const -> std::shared_ptr<VkRenderPass>;
 
+            // the number of the last frame which was submitted to the GPU (the first frame has the number 1)
+            [[nodiscard]] auto getFrameNumber() const -> uint64_t;
+
+            // the number of the last frame the GPU has completely finished executing
+            [[nodiscard]] auto getCompletedFrameNumber() const -> uint64_t;
+
+            // block the calling thread until the GPU finished the frame with the supplied number
+            auto waitForFrame(uint64_t frameNumber) const -> void;
+
+            // the timeline the frame numbers are signaled on, other queues can wait on it to chain their work
+            [[nodiscard]] auto getFrameTimeline() const -> const VulkanTimelineSemaphore&;
+
         private:
             static auto getQueueFamilies(VkPhysicalDevice device) -> std::vector<VkQueueFamilyProperties>;
+            static auto supportsRequiredFeatures(VkPhysicalDevice device) -> bool;
 
             auto createSurface() -> void;
             auto getSurfaceFormats(VkPhysicalDevice device) const -> std::vector<VkSurfaceFormatKHR>;
@@ -56,6 +91,8 @@ namespace adelie::renderer::vulkan {
             auto createSwapChain() -> void;
             auto createRenderPass() -> void;
             auto createGraphicsPipeline() -> void;
+            auto createShaderModule(const std::string& filename) const -> VkShaderModule;
+            auto createDepthResources() -> void;
             auto createFramebuffers() -> void;
             auto chooseSwapExtent(const VkSurfaceCapabilitiesKHR& capabilities) -> VkExtent2D;
 
@@ -78,11 +115,9 @@ namespace adelie::renderer::vulkan {
 
             //
             static auto calculateTangents(std::vector<VulkanVertex>& vertices, const std::vector<uint16_t>& indices) -> void;
-            auto createTexture(const std::string& filename, VkFormat format, VkImage& image, VkDeviceMemory& imageMemory, VkImageView& imageView) -> void;
-            auto transitionImageLayout(VkImage image, VkFormat format, VkImageLayout oldLayout, VkImageLayout newLayout) -> void;
-            auto copyBufferToImage(VkBuffer buffer, VkImage image, uint32_t width, uint32_t height) -> void;
             auto createDescriptorPool() -> void;
             auto createDescriptorSets() -> void;
+            auto updateTextureDescriptors(size_t descriptorSetIndex) -> void;
             auto createCommandBuffers() -> void;
             auto createSyncObjects() -> void;
             auto createTextureSampler() -> void;
@@ -90,10 +125,13 @@ namespace adelie::renderer::vulkan {
             auto createVertexBuffer() -> void;
             auto createUniformBuffers() -> void;
             auto createIndexBuffer() -> void;
-            auto drawFrame() -> void;
+            auto updateScene(core::renderer::RenderSnapshot& snapshot, float time) const -> void;
+            auto renderLoop() -> void;
+            auto drawFrame(const core::renderer::RenderSnapshot& snapshot) -> void;
+            auto recordCommandBuffer(VkCommandBuffer commandBuffer, uint32_t imageIndex, uint64_t frameNumber, const core::renderer::RenderSnapshot& snapshot) -> void;
             auto recreateSwapChain() -> void;
-            auto cleanupSwapChain() -> void;
-            auto updateUniformBuffer() -> void;
+            auto cleanupSwapChain(uint64_t lastUsedFrame) -> void;
+            auto updateUniformBuffer(const core::renderer::RenderSnapshot& snapshot) -> void;
 
             VkInstance mInstance;
             std::shared_ptr<VkSurfaceKHR> mSurface;
@@ -101,7 +139,8 @@ namespace adelie::renderer::vulkan {
             std::shared_ptr<VkDevice> mLogicalDevice;
             std::shared_ptr<VkPipelineLayout> mPipelineLayout;
             std::shared_ptr<VkPipeline> mGraphicsPipeline;
-            std::shared_ptr<VkRenderPass> mRenderPass;
+            std::shared_ptr<VkRenderPass> mRenderPass;  // clears the attachments, draws the first phase of the occlusion culling
+            VkRenderPass mContinueRenderPass;           // keeps the attachments, draws the second phase
 
             VkQueue mSelectedGraphicsQueue;
             VkSwapchainKHR mSwapChain;
@@ -113,6 +152,10 @@ namespace adelie::renderer::vulkan {
 
             VkDescriptorSetLayout mDescriptorSetLayout;
 
+            VkImage mDepthImage;
+            VkDeviceMemory mDepthImageMemory;
+            VkImageView mDepthImageView;
+
             std::vector<VkFramebuffer> mSwapChainFramebuffers;
             VkCommandPool mCommandPool;
 
@@ -120,27 +163,36 @@ namespace adelie::renderer::vulkan {
             VkDeviceMemory mVertexBufferMemory;
             VkBuffer mIndexBuffer;
             VkDeviceMemory mIndexBufferMemory;
+            core::renderer::GeometryPool mGeometryPool;  // the indices of all meshes and their levels of detail
             std::vector<VkBuffer> mUniformBuffers;
             std::vector<VkDeviceMemory> mUniformBuffersMemory;
 
-            VkImage mTextureImage;
-            VkDeviceMemory mTextureImageMemory;
-            VkImageView mTextureImageView;
             VkSampler mTextureSampler;
-            VkImage mNormalMapImage;
-            VkDeviceMemory mNormalMapImageMemory;
-            VkImageView mNormalMapImageView;
-            VkImage mRoughnessMapImage;
-            VkDeviceMemory mRoughnessMapImageMemory;
-            VkImageView mRoughnessMapImageView;
+            std::unique_ptr<VulkanTextureLoader> mTextureLoader;
+            std::unique_ptr<VulkanResidencyManager> mResidencyManager;
+            std::unique_ptr<VulkanOcclusionCuller> mOcclusionCuller;
+            std::vector<VulkanGpuInstance> mInstances;  // the instances of the recorded frame, kept to reuse the allocation
+            std::unique_ptr<VulkanClusteredLighting> mClusteredLighting;
+            std::vector<VulkanGpuLight> mLights;  // the lights of the recorded frame
+            std::unique_ptr<VulkanShadowCascades> mShadowCascades;
+            std::vector<VulkanGpuInstance> mShadowCasters;  // the shadow casters of the recorded frame
+            std::unique_ptr<VulkanParticleSystem> mParticleSystem;
+            std::unique_ptr<VulkanQuadRenderer> mQuadRenderer;
+            bool mFontPageSet;  // the glyph atlas of the overlay font is a page of the quad renderer
+            std::array<TextureHandle, MATERIAL_TEXTURE_COUNT> mMaterialTextures;
+            std::vector<std::array<uint32_t, MATERIAL_TEXTURE_COUNT>> mDescriptorSetTextureVersions;  // the texture versions written into each descriptor set
             std::vector<VkSemaphore> mImageAvailableSemaphores;
             std::vector<VkSemaphore> mRenderFinishedSemaphores;
-            std::vector<VkFence> mInFlightFences;
+            std::unique_ptr<VulkanTimelineSemaphore> mFrameTimeline;
+            std::unique_ptr<VulkanDeletionQueue> mDeletionQueue;
+            std::atomic<uint64_t> mFrameNumber;
             std::vector<VkCommandBuffer> mCommandBuffers;
             VkDescriptorPool mDescriptorPool;
             std::vector<VkDescriptorSet> mDescriptorSets;
             uint32_t mCurrentFrame;
             std::shared_ptr<core::renderer::WindowInterface> mWindowInterface;
+            VkExtent2D mWindowExtent;  // the window size the render thread works with, taken from the latest snapshot
+            core::renderer::RenderCommandQueue mRenderQueue;
 
     }; /* class VulkanRenderer */
 
@@ -0,0 +1,135 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#include <adelie/io/Logger.hxx>
+#include <adelie/renderer/vulkan/VulkanResidencyManager.hxx>
+#include <algorithm>
+
+using adelie::renderer::vulkan::TextureHandle;
+using adelie::renderer::vulkan::VulkanResidencyManager;
+using adelie::renderer::vulkan::VulkanTextureInfo;
+using adelie::renderer::vulkan::VulkanTextureLoader;
+
+VulkanResidencyManager::VulkanResidencyManager(VkPhysicalDevice physicalDevice, const bool memoryBudgetSupported) {
+    mPhysicalDevice = physicalDevice;
+    mMemoryBudgetSupported = memoryBudgetSupported;
+    mTextureBudgetLimit = 0;
+    mTextureBudget = 0;
+    mHeapBudget = 0;
+    mHeapUsage = 0;
+
+    update(0);
+    AdelieLogDebug("Texture residency budget is {} MiB (VK_EXT_memory_budget {})", mTextureBudget >> 20U, mMemoryBudgetSupported ? "available" : "not available");
+}
+
+auto VulkanResidencyManager::update(const VkDeviceSize textureUsage) -> void {
+    VkPhysicalDeviceMemoryBudgetPropertiesEXT budgetProperties{};
+    budgetProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT;
+
+    VkPhysicalDeviceMemoryProperties2 memoryProperties{};
+    memoryProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2;
+    memoryProperties.pNext = mMemoryBudgetSupported ? &budgetProperties : nullptr;
+    vkGetPhysicalDeviceMemoryProperties2(mPhysicalDevice, &memoryProperties);
+
+    // the textures may live in any device-local heap, so all of them are summed up
+    VkDeviceSize heapSize = 0;
+    mHeapBudget = 0;
+    mHeapUsage = 0;
+    for (uint32_t i = 0; i < memoryProperties.memoryProperties.memoryHeapCount; i++) {
+        if ((memoryProperties.memoryProperties.memoryHeaps[i].flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) == 0) {
+            continue;
+        }
+
+        heapSize += memoryProperties.memoryProperties.memoryHeaps[i].size;
+        if (mMemoryBudgetSupported) {
+            mHeapBudget += budgetProperties.heapBudget[i];
+            mHeapUsage += budgetProperties.heapUsage[i];
+        }
+    }
+
+    VkDeviceSize textureBudget;
+    if (mMemoryBudgetSupported) {
+        // the textures may keep what they have and grow into the headroom which is left in the heaps
+        const auto allowedUsage = static_cast<VkDeviceSize>(static_cast<double>(mHeapBudget) * RESIDENCY_HEAP_BUDGET_SHARE);
+        const auto otherUsage = mHeapUsage > textureUsage ? mHeapUsage - textureUsage : 0;
+        textureBudget = allowedUsage > otherUsage ? allowedUsage - otherUsage : 0;
+    } else {
+        mHeapBudget = heapSize;
+        mHeapUsage = textureUsage;
+        textureBudget = static_cast<VkDeviceSize>(static_cast<double>(heapSize) * RESIDENCY_FALLBACK_TEXTURE_SHARE);
+    }
+
+    mTextureBudget = mTextureBudgetLimit > 0 ? std::min(textureBudget, mTextureBudgetLimit) : textureBudget;
+}
+
+auto VulkanResidencyManager::markUsed(const TextureHandle handle, const uint64_t frameNumber) -> void {
+    if (handle >= mTextures.size()) {
+        mTextures.resize(handle + 1, {.lastUsedFrame = 0, .droppedLevels = 0, .version = 0});
+    }
+    mTextures[handle].lastUsedFrame = frameNumber;
+}
+
+auto VulkanResidencyManager::recordResidencyChanges(VkCommandBuffer commandBuffer, const uint64_t frameNumber, VulkanTextureLoader& textureLoader) -> void {
+    const auto textureCount = textureLoader.getTextureCount();
+    if (textureCount > mTextures.size()) {
+        mTextures.resize(textureCount, {.lastUsedFrame = 0, .droppedLevels = 0, .version = 0});
+    }
+
+    // any change of an image which was not a downgrade is an upload of the whole file
+    std::vector<VulkanTextureInfo> infos(textureCount);
+    for (TextureHandle handle = 0; handle < textureCount; handle++) {
+        infos[handle] = textureLoader.getInfo(handle);
+        if (infos[handle].version != mTextures[handle].version) {
+            mTextures[handle].version = infos[handle].version;
+            mTextures[handle].droppedLevels = 0;
+        }
+    }
+
+    // the image size of a texture with all mip levels, estimated from what is resident right now
+    const auto getFullSize = [&](const TextureHandle handle) { return infos[handle].memorySize << (2U * mTextures[handle].droppedLevels); };
+
+    if (textureLoader.getMemoryUsage() > mTextureBudget) {
+        // drop the top mip level of the least recently used textures (the largest ones first among equals), at most
+        // one level per texture and frame so the work stays bounded
+        std::vector<TextureHandle> candidates;
+        for (TextureHandle handle = 0; handle < textureCount; handle++) {
+            const auto& info = infos[handle];
+            if (!info.loading && info.mipLevels > 1 && std::max(info.width, info.height) > RESIDENCY_MIN_DIMENSION) {
+                candidates.push_back(handle);
+            }
+        }
+        std::ranges::sort(candidates, [&](const TextureHandle a, const TextureHandle b) { return mTextures[a].lastUsedFrame != mTextures[b].lastUsedFrame ? mTextures[a].lastUsedFrame < mTextures[b].lastUsedFrame : infos[a].memorySize > infos[b].memorySize; });
+
+        for (const auto handle : candidates) {
+            if (textureLoader.getMemoryUsage() <= mTextureBudget) {
+                break;
+            }
+            textureLoader.recordDowngrade(commandBuffer, frameNumber, handle);
+            mTextures[handle].version = textureLoader.getInfo(handle).version;
+            mTextures[handle].droppedLevels++;
+        }
+        return;
+    }
+
+    // textures which are reloading already will grow to their full size soon
+    VkDeviceSize projectedUsage = textureLoader.getMemoryUsage();
+    std::vector<TextureHandle> candidates;
+    for (TextureHandle handle = 0; handle < textureCount; handle++) {
+        if (infos[handle].loading) {
+            projectedUsage += getFullSize(handle) - infos[handle].memorySize;
+        } else if (mTextures[handle].droppedLevels > 0 && mTextures[handle].lastUsedFrame + RESIDENCY_RESTORE_WINDOW >= frameNumber) {
+            candidates.push_back(handle);
+        }
+    }
+    std::ranges::sort(candidates, [this](const TextureHandle a, const TextureHandle b) { return mTextures[a].lastUsedFrame > mTextures[b].lastUsedFrame; });
+
+    const auto restoreLimit = static_cast<VkDeviceSize>(static_cast<double>(mTextureBudget) * RESIDENCY_RESTORE_THRESHOLD);
+    for (const auto handle : candidates) {
+        const auto growth = getFullSize(handle) - infos[handle].memorySize;
+        if (projectedUsage + growth > restoreLimit) {
+            continue;
+        }
+
+        projectedUsage += growth;
+        textureLoader.reload(handle);
+    }
+}
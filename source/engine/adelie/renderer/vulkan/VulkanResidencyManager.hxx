@@ -0,0 +1,94 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#if !defined(__ADELIE_RENDERER_VULKAN_VULKANRESIDENCYMANAGER_HXX__)
+    #define __ADELIE_RENDERER_VULKAN_VULKANRESIDENCYMANAGER_HXX__
+
+    #include <vulkan/vulkan.h>
+
+    #include <adelie/adelie.hxx>
+    #include <adelie/renderer/vulkan/VulkanTextureLoader.hxx>
+    #include <cstdint>
+    #include <vector>
+
+namespace adelie::renderer::vulkan {
+
+    // share of the device-local heap budget the engine allows itself to use, the rest is left to the driver, the
+    // compositor and other applications
+    static inline constexpr double RESIDENCY_HEAP_BUDGET_SHARE = 0.9;
+
+    // without VK_EXT_memory_budget nothing is known about the other users of the heap, so textures only get this
+    // share of the device-local heaps
+    static inline constexpr double RESIDENCY_FALLBACK_TEXTURE_SHARE = 0.5;
+
+    // textures are never downgraded below this size, so every handle always stays sampleable
+    static inline constexpr uint32_t RESIDENCY_MIN_DIMENSION = 64;
+
+    // a downgraded texture is loaded again in full if it was used within this many frames and fits into the budget
+    static inline constexpr uint64_t RESIDENCY_RESTORE_WINDOW = 60;
+
+    // share of the budget a restore may fill, the gap keeps restores from immediately causing new downgrades
+    static inline constexpr double RESIDENCY_RESTORE_THRESHOLD = 0.9;
+
+    // decides how much device-local memory the textures may occupy. With VK_EXT_memory_budget the budget follows the
+    // actual heap usage reported by the driver every frame, so memory allocated elsewhere shrinks the texture budget
+    // before the driver starts paging or allocations fail
+    //
+    // it also decides which textures stay resident at which size: if they use more memory than the budget, the top mip
+    // levels of the least recently used textures are dropped and restored from the file once there is room again
+    class ADELIE_API VulkanResidencyManager {
+        public:
+            VulkanResidencyManager(VkPhysicalDevice physicalDevice, bool memoryBudgetSupported);
+
+            ~VulkanResidencyManager() noexcept = default;
+
+            VulkanResidencyManager(const VulkanResidencyManager&) = delete;
+
+            auto operator=(VulkanResidencyManager const&) -> VulkanResidencyManager& = delete;
+
+            VulkanResidencyManager(VulkanResidencyManager&&) = delete;
+
+            auto operator=(VulkanResidencyManager&&) -> VulkanResidencyManager& = delete;
+
+            // render thread: refresh the heap budget and usage, textureUsage is the memory currently held by textures
+            auto update(VkDeviceSize textureUsage) -> void;
+
+            // render thread: the texture is referenced by the given frame
+            auto markUsed(TextureHandle handle, uint64_t frameNumber) -> void;
+
+            // render thread: downgrade the least recently used textures of the loader while they use more memory than
+            // the budget, or reload recently used downgraded textures if the budget allows it
+            auto recordResidencyChanges(VkCommandBuffer commandBuffer, uint64_t frameNumber, VulkanTextureLoader& textureLoader) -> void;
+
+            // an upper limit for the texture memory, 0 removes the limit and only the heap budget applies
+            auto setTextureBudgetLimit(VkDeviceSize limit) -> void { mTextureBudgetLimit = limit; }
+
+            [[nodiscard]] auto getTextureBudgetLimit() const -> VkDeviceSize { return mTextureBudgetLimit; }
+
+            [[nodiscard]] auto getTextureBudget() const -> VkDeviceSize { return mTextureBudget; }
+
+            [[nodiscard]] auto getHeapBudget() const -> VkDeviceSize { return mHeapBudget; }
+
+            [[nodiscard]] auto getHeapUsage() const -> VkDeviceSize { return mHeapUsage; }
+
+            [[nodiscard]] auto isMemoryBudgetSupported() const -> bool { return mMemoryBudgetSupported; }
+
+        private:
+            struct TextureResidency {
+                    uint64_t lastUsedFrame;
+                    uint32_t droppedLevels;  // mip levels dropped from the top of the full chain
+                    uint32_t version;        // of the image the dropped levels refer to
+            };
+
+            VkPhysicalDevice mPhysicalDevice;
+            bool mMemoryBudgetSupported;
+            VkDeviceSize mTextureBudgetLimit;
+            VkDeviceSize mTextureBudget;
+            VkDeviceSize mHeapBudget;
+            VkDeviceSize mHeapUsage;
+            std::vector<TextureResidency> mTextures;  // indexed by the texture handle
+
+    }; /* class VulkanResidencyManager */
+
+} /* namespace adelie::renderer::vulkan */
+
+#endif /* if !defined(__ADELIE_RENDERER_VULKAN_VULKANRESIDENCYMANAGER_HXX__) */
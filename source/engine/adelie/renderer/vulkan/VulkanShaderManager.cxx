@@ -25,6 +25,11 @@ auto VulkanShaderManager::readFile(const std::string& filename) -> std::vector<c
 }
 
 auto VulkanShaderManager::createShaderModule(VkDevice device, const std::vector<char>& code) -> VkShaderModule {
+    return createShaderModule(device, std::as_bytes(std::span(code)));
+}
+
+auto VulkanShaderManager::createShaderModule(VkDevice device, std::span<const std::byte> code) -> VkShaderModule {
+    // SPIR-V is consumed as 32-bit words, which both pack entries and heap buffers are aligned for
     VkShaderModuleCreateInfo createInfo{};
     createInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
     createInfo.codeSize = code.size();
@@ -6,6 +6,8 @@
     #include <vulkan/vulkan.h>
 
     #include <adelie/adelie.hxx>
+    #include <cstddef>
+    #include <span>
     #include <string>
     #include <vector>
 
@@ -14,6 +16,7 @@ namespace adelie::renderer::vulkan {
         public:
             static auto readFile(const std::string& filename) -> std::vector<char>;
             static auto createShaderModule(VkDevice device, const std::vector<char>& code) -> VkShaderModule;
+            static auto createShaderModule(VkDevice device, std::span<const std::byte> code) -> VkShaderModule;
     }; /* class VulkanShaderManager */
 
 }  // namespace adelie::renderer::vulkan
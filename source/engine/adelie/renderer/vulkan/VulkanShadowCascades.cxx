@@ -0,0 +1,470 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#include <adelie/exception/VulkanRuntimeException.hxx>
+#include <adelie/io/Hash.hxx>
+#include <adelie/io/Logger.hxx>
+#include <adelie/io/VirtualFileSystem.hxx>
+#include <adelie/renderer/vulkan/VulkanBufferManager.hxx>
+#include <adelie/renderer/vulkan/VulkanShaderManager.hxx>
+#include <adelie/renderer/vulkan/VulkanShadowCascades.hxx>
+#include <adelie/renderer/vulkan/VulkanVertex.hxx>
+#include <algorithm>
+#include <cstring>
+
+using adelie::core::renderer::RenderShadowCascade;
+using adelie::core::renderer::SHADOW_CASCADE_COUNT;
+using adelie::core::renderer::SHADOW_MAP_SIZE;
+using adelie::exception::VulkanRuntimeException;
+using adelie::io::VirtualFileSystem;
+using adelie::renderer::vulkan::VulkanBufferManager;
+using adelie::renderer::vulkan::VulkanGpuInstance;
+using adelie::renderer::vulkan::VulkanShaderManager;
+using adelie::renderer::vulkan::VulkanShadowCascades;
+using adelie::renderer::vulkan::VulkanVertex;
+
+namespace {
+    // linear filtering with depth comparison is guaranteed for this format, which gives a 2x2 PCF for free
+    constexpr VkFormat SHADOW_FORMAT = VK_FORMAT_D16_UNORM;
+
+    // FNV-1a over 64 bit words instead of bytes, every frame hashes all casters of every cascade
+    auto hashWords(uint64_t hash, const void* data, const std::size_t size) -> uint64_t {
+        const auto* bytes = static_cast<const std::byte*>(data);
+        for (std::size_t offset = 0; offset + sizeof(uint64_t) <= size; offset += sizeof(uint64_t)) {
+            uint64_t word;
+            std::memcpy(&word, bytes + offset, sizeof(word));
+            hash ^= word;
+            hash *= adelie::io::FNV1A_PRIME;
+        }
+        return hash;
+    }
+
+    static_assert(0 == sizeof(VulkanGpuInstance) % sizeof(uint64_t), "the casters are hashed in whole words");
+}  // namespace
+
+VulkanShadowCascades::VulkanShadowCascades(VkDevice device, VkPhysicalDevice physicalDevice, VulkanDeletionQueue& deletionQueue) : mDeletionQueue(deletionQueue) {
+    mDevice = device;
+    mPhysicalDevice = physicalDevice;
+    mImage = VK_NULL_HANDLE;
+    mMemory = VK_NULL_HANDLE;
+    mArrayView = VK_NULL_HANDLE;
+    mLayerViews.fill(VK_NULL_HANDLE);
+    mFramebuffers.fill(VK_NULL_HANDLE);
+    mSampler = VK_NULL_HANDLE;
+    mRenderPass = VK_NULL_HANDLE;
+    mSetLayout = VK_NULL_HANDLE;
+    mPipelineLayout = VK_NULL_HANDLE;
+    mPipeline = VK_NULL_HANDLE;
+    mHashes.fill(0);
+    mValid.fill(false);
+    mDescriptorPool = VK_NULL_HANDLE;
+
+    createPipeline();
+    createImage();
+}
+
+VulkanShadowCascades::~VulkanShadowCascades() noexcept {
+    // the caller ensures the device is idle and flushes the deletion queue afterwards
+    retire(0);
+    for (uint32_t cascade = 0; cascade < SHADOW_CASCADE_COUNT; cascade++) {
+        mDeletionQueue.retireFramebuffer(mFramebuffers[cascade], 0);
+        mDeletionQueue.retireImageView(mLayerViews[cascade], 0);
+    }
+    mDeletionQueue.retireImageView(mArrayView, 0);
+    mDeletionQueue.retireImage(mImage, mMemory, 0);
+    mDeletionQueue.retireSampler(mSampler, 0);
+    mDeletionQueue.retirePipeline(mPipeline, 0);
+    mDeletionQueue.retirePipelineLayout(mPipelineLayout, 0);
+    mDeletionQueue.retireRenderPass(mRenderPass, 0);
+    vkDestroyDescriptorSetLayout(mDevice, mSetLayout, nullptr);
+}
+
+auto VulkanShadowCascades::createPipeline() -> void {
+    // a cascade is cleared and drawn as a whole, afterwards the fragment shaders of this and the following frames
+    // sample it
+    VkAttachmentDescription depthAttachment{};
+    depthAttachment.format = SHADOW_FORMAT;
+    depthAttachment.samples = VK_SAMPLE_COUNT_1_BIT;
+    depthAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+    depthAttachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+    depthAttachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+    depthAttachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+    depthAttachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    depthAttachment.finalLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL;
+
+    VkAttachmentReference depthAttachmentRef{};
+    depthAttachmentRef.attachment = 0;
+    depthAttachmentRef.layout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+
+    VkSubpassDescription subpass{};
+    subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+    subpass.colorAttachmentCount = 0;
+    subpass.pDepthStencilAttachment = &depthAttachmentRef;
+
+    // the previous frame might still sample the layer, the following draws sample it
+    std::array<VkSubpassDependency, 2> dependencies{};
+    dependencies[0].srcSubpass = VK_SUBPASS_EXTERNAL;
+    dependencies[0].dstSubpass = 0;
+    dependencies[0].srcStageMask = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+    dependencies[0].srcAccessMask = 0;
+    dependencies[0].dstStageMask = VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+    dependencies[0].dstAccessMask = VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+    dependencies[1].srcSubpass = 0;
+    dependencies[1].dstSubpass = VK_SUBPASS_EXTERNAL;
+    dependencies[1].srcStageMask = VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+    dependencies[1].srcAccessMask = VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+    dependencies[1].dstStageMask = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+    dependencies[1].dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+
+    VkRenderPassCreateInfo renderPassInfo{};
+    renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
+    renderPassInfo.attachmentCount = 1;
+    renderPassInfo.pAttachments = &depthAttachment;
+    renderPassInfo.subpassCount = 1;
+    renderPassInfo.pSubpasses = &subpass;
+    renderPassInfo.dependencyCount = static_cast<uint32_t>(dependencies.size());
+    renderPassInfo.pDependencies = dependencies.data();
+
+    if (const auto result = vkCreateRenderPass(mDevice, &renderPassInfo, nullptr, &mRenderPass); result != VK_SUCCESS) {
+        throw VulkanRuntimeException("Failed to create shadow render pass", result);
+    }
+
+    // the casters, indexed by the first instance of the draws
+    VkDescriptorSetLayoutBinding casterBinding{};
+    casterBinding.binding = 0;
+    casterBinding.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    casterBinding.descriptorCount = 1;
+    casterBinding.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+
+    VkDescriptorSetLayoutCreateInfo layoutInfo{};
+    layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+    layoutInfo.bindingCount = 1;
+    layoutInfo.pBindings = &casterBinding;
+
+    if (const auto result = vkCreateDescriptorSetLayout(mDevice, &layoutInfo, nullptr, &mSetLayout); result != VK_SUCCESS) {
+        throw VulkanRuntimeException("Failed to create shadow descriptor set layout", result);
+    }
+
+    // the light matrix of the cascade
+    VkPushConstantRange pushConstantRange{};
+    pushConstantRange.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+    pushConstantRange.offset = 0;
+    pushConstantRange.size = sizeof(glm::mat4);
+
+    VkPipelineLayoutCreateInfo pipelineLayoutInfo{};
+    pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+    pipelineLayoutInfo.setLayoutCount = 1;
+    pipelineLayoutInfo.pSetLayouts = &mSetLayout;
+    pipelineLayoutInfo.pushConstantRangeCount = 1;
+    pipelineLayoutInfo.pPushConstantRanges = &pushConstantRange;
+
+    if (const auto result = vkCreatePipelineLayout(mDevice, &pipelineLayoutInfo, nullptr, &mPipelineLayout); result != VK_SUCCESS) {
+        throw VulkanRuntimeException("Failed to create shadow pipeline layout", result);
+    }
+
+    const auto code = VirtualFileSystem::getInstance()->read("shader/shadow.vert.spv");
+    const auto shaderModule = VulkanShaderManager::createShaderModule(mDevice, code->getData());
+
+    // only the depth is written, so there is no fragment shader
+    VkPipelineShaderStageCreateInfo vertShaderStageInfo{};
+    vertShaderStageInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    vertShaderStageInfo.stage = VK_SHADER_STAGE_VERTEX_BIT;
+    vertShaderStageInfo.module = shaderModule;
+    vertShaderStageInfo.pName = "main";
+
+    const auto bindingDescription = VulkanVertex::getBindingDescription();
+    const auto attributeDescriptions = VulkanVertex::getAttributeDescriptions();
+
+    VkPipelineVertexInputStateCreateInfo vertexInputInfo{};
+    vertexInputInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
+    vertexInputInfo.vertexBindingDescriptionCount = 1;
+    vertexInputInfo.pVertexBindingDescriptions = &bindingDescription;
+    vertexInputInfo.vertexAttributeDescriptionCount = static_cast<uint32_t>(attributeDescriptions.size());
+    vertexInputInfo.pVertexAttributeDescriptions = attributeDescriptions.data();
+
+    VkPipelineInputAssemblyStateCreateInfo inputAssembly{};
+    inputAssembly.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
+    inputAssembly.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    inputAssembly.primitiveRestartEnable = VK_FALSE;
+
+    VkViewport viewport{};
+    viewport.x = 0.0f;
+    viewport.y = 0.0f;
+    viewport.width = static_cast<float>(SHADOW_MAP_SIZE);
+    viewport.height = static_cast<float>(SHADOW_MAP_SIZE);
+    viewport.minDepth = 0.0f;
+    viewport.maxDepth = 1.0f;
+
+    VkRect2D scissor{.offset = {0, 0}, .extent = {.width = SHADOW_MAP_SIZE, .height = SHADOW_MAP_SIZE}};
+
+    VkPipelineViewportStateCreateInfo viewportState{};
+    viewportState.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
+    viewportState.viewportCount = 1;
+    viewportState.pViewports = &viewport;
+    viewportState.scissorCount = 1;
+    viewportState.pScissors = &scissor;
+
+    // both faces cast shadows, so open meshes do not leak light. The bias keeps the lit surfaces from shadowing
+    // themselves
+    VkPipelineRasterizationStateCreateInfo rasterizer{};
+    rasterizer.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
+    rasterizer.depthClampEnable = VK_FALSE;
+    rasterizer.rasterizerDiscardEnable = VK_FALSE;
+    rasterizer.polygonMode = VK_POLYGON_MODE_FILL;
+    rasterizer.cullMode = VK_CULL_MODE_NONE;
+    rasterizer.frontFace = VK_FRONT_FACE_COUNTER_CLOCKWISE;
+    rasterizer.depthBiasEnable = VK_TRUE;
+    rasterizer.depthBiasConstantFactor = 1.25f;
+    rasterizer.depthBiasClamp = 0.0f;
+    rasterizer.depthBiasSlopeFactor = 1.75f;
+    rasterizer.lineWidth = 1.0f;
+
+    VkPipelineMultisampleStateCreateInfo multisampling{};
+    multisampling.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
+    multisampling.sampleShadingEnable = VK_FALSE;
+    multisampling.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
+    multisampling.minSampleShading = 1.0f;
+
+    VkPipelineDepthStencilStateCreateInfo depthStencil{};
+    depthStencil.sType = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
+    depthStencil.depthTestEnable = VK_TRUE;
+    depthStencil.depthWriteEnable = VK_TRUE;
+    depthStencil.depthCompareOp = VK_COMPARE_OP_LESS;
+    depthStencil.depthBoundsTestEnable = VK_FALSE;
+    depthStencil.stencilTestEnable = VK_FALSE;
+
+    VkPipelineColorBlendStateCreateInfo colorBlending{};
+    colorBlending.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
+    colorBlending.logicOpEnable = VK_FALSE;
+    colorBlending.attachmentCount = 0;
+
+    VkGraphicsPipelineCreateInfo pipelineInfo{};
+    pipelineInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+    pipelineInfo.stageCount = 1;
+    pipelineInfo.pStages = &vertShaderStageInfo;
+    pipelineInfo.pVertexInputState = &vertexInputInfo;
+    pipelineInfo.pInputAssemblyState = &inputAssembly;
+    pipelineInfo.pViewportState = &viewportState;
+    pipelineInfo.pRasterizationState = &rasterizer;
+    pipelineInfo.pMultisampleState = &multisampling;
+    pipelineInfo.pDepthStencilState = &depthStencil;
+    pipelineInfo.pColorBlendState = &colorBlending;
+    pipelineInfo.layout = mPipelineLayout;
+    pipelineInfo.renderPass = mRenderPass;
+    pipelineInfo.subpass = 0;
+
+    const auto result = vkCreateGraphicsPipelines(mDevice, VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &mPipeline);
+    vkDestroyShaderModule(mDevice, shaderModule, nullptr);
+    if (result != VK_SUCCESS) {
+        throw VulkanRuntimeException("Failed to create shadow pipeline", result);
+    }
+}
+
+auto VulkanShadowCascades::createImage() -> void {
+    VkImageCreateInfo imageInfo{};
+    imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+    imageInfo.imageType = VK_IMAGE_TYPE_2D;
+    imageInfo.extent.width = SHADOW_MAP_SIZE;
+    imageInfo.extent.height = SHADOW_MAP_SIZE;
+    imageInfo.extent.depth = 1;
+    imageInfo.mipLevels = 1;
+    imageInfo.arrayLayers = SHADOW_CASCADE_COUNT;
+    imageInfo.format = SHADOW_FORMAT;
+    imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+    imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    imageInfo.usage = VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+    imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+
+    if (const auto result = vkCreateImage(mDevice, &imageInfo, nullptr, &mImage); result != VK_SUCCESS) {
+        throw VulkanRuntimeException("Failed to create shadow map image", result);
+    }
+
+    VkMemoryRequirements memRequirements;
+    vkGetImageMemoryRequirements(mDevice, mImage, &memRequirements);
+
+    VkMemoryAllocateInfo allocInfo{};
+    allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    allocInfo.allocationSize = memRequirements.size;
+    allocInfo.memoryTypeIndex = VulkanBufferManager::findMemoryType(mPhysicalDevice, memRequirements.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+    if (const auto result = vkAllocateMemory(mDevice, &allocInfo, nullptr, &mMemory); result != VK_SUCCESS) {
+        throw VulkanRuntimeException("Failed to allocate shadow map memory", result);
+    }
+    vkBindImageMemory(mDevice, mImage, mMemory, 0);
+
+    VkImageViewCreateInfo viewInfo{};
+    viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+    viewInfo.image = mImage;
+    viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D_ARRAY;
+    viewInfo.format = SHADOW_FORMAT;
+    viewInfo.subresourceRange.aspectMask = VK_IMAGE_ASPECT_DEPTH_BIT;
+    viewInfo.subresourceRange.baseMipLevel = 0;
+    viewInfo.subresourceRange.levelCount = 1;
+    viewInfo.subresourceRange.baseArrayLayer = 0;
+    viewInfo.subresourceRange.layerCount = SHADOW_CASCADE_COUNT;
+
+    if (const auto result = vkCreateImageView(mDevice, &viewInfo, nullptr, &mArrayView); result != VK_SUCCESS) {
+        throw VulkanRuntimeException("Failed to create shadow map image view", result);
+    }
+
+    for (uint32_t cascade = 0; cascade < SHADOW_CASCADE_COUNT; cascade++) {
+        viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+        viewInfo.subresourceRange.baseArrayLayer = cascade;
+        viewInfo.subresourceRange.layerCount = 1;
+        if (const auto result = vkCreateImageView(mDevice, &viewInfo, nullptr, &mLayerViews[cascade]); result != VK_SUCCESS) {
+            throw VulkanRuntimeException("Failed to create shadow cascade image view", result);
+        }
+
+        VkFramebufferCreateInfo framebufferInfo{};
+        framebufferInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+        framebufferInfo.renderPass = mRenderPass;
+        framebufferInfo.attachmentCount = 1;
+        framebufferInfo.pAttachments = &mLayerViews[cascade];
+        framebufferInfo.width = SHADOW_MAP_SIZE;
+        framebufferInfo.height = SHADOW_MAP_SIZE;
+        framebufferInfo.layers = 1;
+
+        if (const auto result = vkCreateFramebuffer(mDevice, &framebufferInfo, nullptr, &mFramebuffers[cascade]); result != VK_SUCCESS) {
+            throw VulkanRuntimeException("Failed to create shadow cascade frame buffer", result);
+        }
+    }
+
+    VkSamplerCreateInfo samplerInfo{};
+    samplerInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+    samplerInfo.magFilter = VK_FILTER_LINEAR;
+    samplerInfo.minFilter = VK_FILTER_LINEAR;
+    samplerInfo.mipmapMode = VK_SAMPLER_MIPMAP_MODE_NEAREST;
+    samplerInfo.addressModeU = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_BORDER;
+    samplerInfo.addressModeV = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_BORDER;
+    samplerInfo.addressModeW = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+    samplerInfo.borderColor = VK_BORDER_COLOR_FLOAT_OPAQUE_WHITE;
+    samplerInfo.compareEnable = VK_TRUE;
+    samplerInfo.compareOp = VK_COMPARE_OP_LESS_OR_EQUAL;
+    samplerInfo.minLod = 0.0f;
+    samplerInfo.maxLod = 0.0f;
+
+    if (const auto result = vkCreateSampler(mDevice, &samplerInfo, nullptr, &mSampler); result != VK_SUCCESS) {
+        throw VulkanRuntimeException("Failed to create shadow map sampler", result);
+    }
+}
+
+auto VulkanShadowCascades::resize(const uint32_t frameCount, const uint64_t lastUsedFrame) -> void {
+    retire(lastUsedFrame);
+
+    mFrames.resize(frameCount);
+    for (auto& frame : mFrames) {
+        VulkanBufferManager::createBuffer(mDevice, mPhysicalDevice, sizeof(VulkanGpuInstance) * SHADOW_MAX_CASTERS, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+                                          VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, frame.casterBuffer, frame.casterMemory);
+        void* data;
+        vkMapMemory(mDevice, frame.casterMemory, 0, VK_WHOLE_SIZE, 0, &data);
+        frame.casters = static_cast<VulkanGpuInstance*>(data);
+        frame.set = VK_NULL_HANDLE;
+    }
+
+    VkDescriptorPoolSize poolSize{};
+    poolSize.type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    poolSize.descriptorCount = frameCount;
+
+    VkDescriptorPoolCreateInfo poolInfo{};
+    poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+    poolInfo.poolSizeCount = 1;
+    poolInfo.pPoolSizes = &poolSize;
+    poolInfo.maxSets = frameCount;
+
+    if (const auto result = vkCreateDescriptorPool(mDevice, &poolInfo, nullptr, &mDescriptorPool); result != VK_SUCCESS) {
+        throw VulkanRuntimeException("Failed to create shadow descriptor pool", result);
+    }
+
+    for (auto& frame : mFrames) {
+        VkDescriptorSetAllocateInfo allocInfo{};
+        allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+        allocInfo.descriptorPool = mDescriptorPool;
+        allocInfo.descriptorSetCount = 1;
+        allocInfo.pSetLayouts = &mSetLayout;
+
+        if (const auto result = vkAllocateDescriptorSets(mDevice, &allocInfo, &frame.set); result != VK_SUCCESS) {
+            throw VulkanRuntimeException("Failed to allocate shadow descriptor set", result);
+        }
+
+        VkDescriptorBufferInfo bufferInfo{.buffer = frame.casterBuffer, .offset = 0, .range = VK_WHOLE_SIZE};
+
+        VkWriteDescriptorSet descriptorWrite{};
+        descriptorWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        descriptorWrite.dstSet = frame.set;
+        descriptorWrite.dstBinding = 0;
+        descriptorWrite.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        descriptorWrite.descriptorCount = 1;
+        descriptorWrite.pBufferInfo = &bufferInfo;
+        vkUpdateDescriptorSets(mDevice, 1, &descriptorWrite, 0, nullptr);
+    }
+}
+
+auto VulkanShadowCascades::retire(const uint64_t lastUsedFrame) -> void {
+    // the mapped caster memory is unmapped implicitly when it is freed
+    for (const auto& frame : mFrames) {
+        mDeletionQueue.retireBuffer(frame.casterBuffer, frame.casterMemory, lastUsedFrame);
+    }
+    mFrames.clear();
+
+    if (VK_NULL_HANDLE != mDescriptorPool) {
+        mDeletionQueue.retireDescriptorPool(mDescriptorPool, lastUsedFrame);
+        mDescriptorPool = VK_NULL_HANDLE;
+    }
+}
+
+auto VulkanShadowCascades::recordCascades(VkCommandBuffer commandBuffer, const uint32_t frame, const std::span<const RenderShadowCascade> cascades, const std::span<const VulkanGpuInstance> casters,
+                                          VkBuffer vertexBuffer, VkBuffer indexBuffer) -> uint32_t {
+    const auto& slot = mFrames[frame];
+    const auto casterLimit = static_cast<uint32_t>(std::min<std::size_t>(casters.size(), SHADOW_MAX_CASTERS));
+    if (casterLimit < casters.size()) {
+        AdelieLogWarning("Dropping {} of {} shadow casters, the shadow cascades only handle {}", casters.size() - casterLimit, casters.size(), SHADOW_MAX_CASTERS);
+    }
+
+    uint32_t redrawn = 0;
+    const auto cascadeCount = std::min<std::size_t>(cascades.size(), SHADOW_CASCADE_COUNT);
+    for (uint32_t index = 0; index < cascadeCount; index++) {
+        const auto& cascade = cascades[index];
+        const auto first = std::min(cascade.firstCaster, casterLimit);
+        const auto range = casters.subspan(first, std::min(cascade.casterCount, casterLimit - first));
+
+        // the layer still holds what the same matrix and the same casters would draw
+        auto hash = hashWords(adelie::io::FNV1A_OFFSET_BASIS, &cascade.viewProjection, sizeof(cascade.viewProjection));
+        hash = hashWords(hash, range.data(), range.size_bytes());
+        if (mValid[index] && hash == mHashes[index]) {
+            continue;
+        }
+        mValid[index] = true;
+        mHashes[index] = hash;
+
+        // the casters keep their indices, so the first instance of a draw is the index of its caster
+        std::memcpy(slot.casters + first, range.data(), range.size_bytes());
+
+        VkClearValue clearValue{};
+        clearValue.depthStencil = {.depth = 1.0f, .stencil = 0};
+
+        VkRenderPassBeginInfo renderPassInfo{};
+        renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+        renderPassInfo.renderPass = mRenderPass;
+        renderPassInfo.framebuffer = mFramebuffers[index];
+        renderPassInfo.renderArea.offset = {0, 0};
+        renderPassInfo.renderArea.extent = {.width = SHADOW_MAP_SIZE, .height = SHADOW_MAP_SIZE};
+        renderPassInfo.clearValueCount = 1;
+        renderPassInfo.pClearValues = &clearValue;
+
+        vkCmdBeginRenderPass(commandBuffer, &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
+        if (0 == redrawn) {
+            const VkDeviceSize offset = 0;
+            vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, mPipeline);
+            vkCmdBindVertexBuffers(commandBuffer, 0, 1, &vertexBuffer, &offset);
+            vkCmdBindIndexBuffer(commandBuffer, indexBuffer, 0, VK_INDEX_TYPE_UINT32);
+            vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, mPipelineLayout, 0, 1, &slot.set, 0, nullptr);
+        }
+        vkCmdPushConstants(commandBuffer, mPipelineLayout, VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(cascade.viewProjection), &cascade.viewProjection);
+        for (uint32_t caster = 0; caster < range.size(); caster++) {
+            vkCmdDrawIndexed(commandBuffer, range[caster].indexCount, 1, range[caster].firstIndex, range[caster].vertexOffset, first + caster);
+        }
+        vkCmdEndRenderPass(commandBuffer);
+        redrawn++;
+    }
+    return redrawn;
+}
@@ -0,0 +1,95 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#if !defined(__ADELIE_RENDERER_VULKAN_VULKANSHADOWCASCADES_HXX__)
+    #define __ADELIE_RENDERER_VULKAN_VULKANSHADOWCASCADES_HXX__
+
+    #include <vulkan/vulkan.h>
+
+    #include <adelie/adelie.hxx>
+    #include <adelie/core/renderer/RenderSnapshot.hxx>
+    #include <adelie/core/renderer/ShadowCascades.hxx>
+    #include <adelie/renderer/vulkan/VulkanDeletionQueue.hxx>
+    #include <adelie/renderer/vulkan/VulkanOcclusionCuller.hxx>
+    #include <array>
+    #include <cstdint>
+    #include <span>
+    #include <vector>
+
+namespace adelie::renderer::vulkan {
+
+    // the number of casters a frame can draw into all cascades together, the casters beyond it are dropped
+    static inline constexpr uint32_t SHADOW_MAX_CASTERS = 16384;
+
+    // draws the shadow cascades of the directional light into the layers of a single depth image array, which the
+    // fragment shaders sample with depth comparison
+    //
+    // the image is kept between the frames. A cascade is only redrawn when its light matrix or its casters changed
+    // since it was drawn the last time, which is detected by a hash of both. With the stable fit of ShadowCascades a
+    // static scene seen by a slow camera redraws hardly any cascade
+    class ADELIE_API VulkanShadowCascades {
+        public:
+            VulkanShadowCascades(VkDevice device, VkPhysicalDevice physicalDevice, VulkanDeletionQueue& deletionQueue);
+
+            ~VulkanShadowCascades() noexcept;
+
+            VulkanShadowCascades(const VulkanShadowCascades&) = delete;
+
+            auto operator=(VulkanShadowCascades const&) -> VulkanShadowCascades& = delete;
+
+            VulkanShadowCascades(VulkanShadowCascades&&) = delete;
+
+            auto operator=(VulkanShadowCascades&&) -> VulkanShadowCascades& = delete;
+
+            // (re)creates the caster buffers of every frame slot, the replaced ones are retired after lastUsedFrame.
+            // The cascades keep their content
+            auto resize(uint32_t frameCount, uint64_t lastUsedFrame) -> void;
+
+            // render thread: redraws the cascades which changed, recorded outside of a render pass. The casters of
+            // all cascades are indexed by the ranges of the cascades. Returns the number of redrawn cascades
+            auto recordCascades(VkCommandBuffer commandBuffer, uint32_t frame, std::span<const core::renderer::RenderShadowCascade> cascades, std::span<const VulkanGpuInstance> casters,
+                                VkBuffer vertexBuffer, VkBuffer indexBuffer) -> uint32_t;
+
+            // all cascades, in the layout DEPTH_STENCIL_READ_ONLY_OPTIMAL once they were recorded
+            [[nodiscard]] auto getImageView() const -> VkImageView { return mArrayView; }
+
+            // compares with LESS_OR_EQUAL and filters linearly, outside of the cascades everything is lit
+            [[nodiscard]] auto getSampler() const -> VkSampler { return mSampler; }
+
+        private:
+            struct Frame {
+                    VkBuffer casterBuffer;
+                    VkDeviceMemory casterMemory;
+                    VulkanGpuInstance* casters;  // persistently mapped
+                    VkDescriptorSet set;
+            };
+
+            auto createImage() -> void;
+            auto createPipeline() -> void;
+            auto retire(uint64_t lastUsedFrame) -> void;
+
+            VkDevice mDevice;
+            VkPhysicalDevice mPhysicalDevice;
+            VulkanDeletionQueue& mDeletionQueue;
+
+            VkImage mImage;
+            VkDeviceMemory mMemory;
+            VkImageView mArrayView;  // all layers, sampled by the fragment shaders
+            std::array<VkImageView, core::renderer::SHADOW_CASCADE_COUNT> mLayerViews;
+            std::array<VkFramebuffer, core::renderer::SHADOW_CASCADE_COUNT> mFramebuffers;
+            VkSampler mSampler;
+
+            VkRenderPass mRenderPass;
+            VkDescriptorSetLayout mSetLayout;
+            VkPipelineLayout mPipelineLayout;
+            VkPipeline mPipeline;
+
+            std::array<uint64_t, core::renderer::SHADOW_CASCADE_COUNT> mHashes;  // of the content of each layer
+            std::array<bool, core::renderer::SHADOW_CASCADE_COUNT> mValid;       // false until a layer was drawn
+            std::vector<Frame> mFrames;
+            VkDescriptorPool mDescriptorPool;
+
+    }; /* class VulkanShadowCascades */
+
+} /* namespace adelie::renderer::vulkan */
+
+#endif /* if !defined(__ADELIE_RENDERER_VULKAN_VULKANSHADOWCASCADES_HXX__) */
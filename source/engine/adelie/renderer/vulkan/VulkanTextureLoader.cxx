@@ -0,0 +1,441 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#include <adelie/core/jobs/JobSystem.hxx>
+#include <adelie/exception/IOException.hxx>
+#include <adelie/exception/VulkanRuntimeException.hxx>
+#include <adelie/io/Logger.hxx>
+#include <adelie/io/VirtualFileSystem.hxx>
+#include <adelie/renderer/vulkan/VulkanBufferManager.hxx>
+#include <adelie/renderer/vulkan/VulkanTextureLoader.hxx>
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <utility>
+
+using adelie::core::jobs::JobSystem;
+using adelie::exception::IOException;
+using adelie::exception::VulkanRuntimeException;
+using adelie::io::VirtualFileSystem;
+using adelie::renderer::vulkan::TextureHandle;
+using adelie::renderer::vulkan::VulkanBufferManager;
+using adelie::renderer::vulkan::VulkanDeletionQueue;
+using adelie::renderer::vulkan::VulkanTextureInfo;
+using adelie::renderer::vulkan::VulkanTextureLoader;
+
+namespace {
+    constexpr auto BYTES_PER_TEXEL = 4;
+
+    auto getMipLevelCount(const uint32_t width, const uint32_t height) -> uint32_t {
+        return static_cast<uint32_t>(std::bit_width(std::max(width, height)));
+    }
+
+    // appends the mip levels below the top level with a 2x2 box filter, the texels are filtered in their stored encoding
+    auto generateMipChain(uint32_t width, uint32_t height, const uint32_t mipLevels, std::vector<uint8_t>& pixels) -> void {
+        std::size_t sourceOffset = 0;
+        for (uint32_t level = 1; level < mipLevels; level++) {
+            const auto mipWidth = std::max(width / 2, 1U);
+            const auto mipHeight = std::max(height / 2, 1U);
+            const auto targetOffset = pixels.size();
+            pixels.resize(targetOffset + static_cast<std::size_t>(mipWidth) * mipHeight * BYTES_PER_TEXEL);
+
+            for (uint32_t y = 0; y < mipHeight; y++) {
+                const auto y0 = std::min(y * 2, height - 1);
+                const auto y1 = std::min(y * 2 + 1, height - 1);
+                for (uint32_t x = 0; x < mipWidth; x++) {
+                    const auto x0 = std::min(x * 2, width - 1);
+                    const auto x1 = std::min(x * 2 + 1, width - 1);
+                    for (uint32_t channel = 0; channel < BYTES_PER_TEXEL; channel++) {
+                        const auto texel = [&](const uint32_t tx, const uint32_t ty) { return static_cast<uint32_t>(pixels[sourceOffset + (static_cast<std::size_t>(ty) * width + tx) * BYTES_PER_TEXEL + channel]); };
+                        const auto sum = texel(x0, y0) + texel(x1, y0) + texel(x0, y1) + texel(x1, y1);
+                        pixels[targetOffset + (static_cast<std::size_t>(y) * mipWidth + x) * BYTES_PER_TEXEL + channel] = static_cast<uint8_t>((sum + 2) / 4);
+                    }
+                }
+            }
+
+            sourceOffset = targetOffset;
+            width = mipWidth;
+            height = mipHeight;
+        }
+    }
+
+    auto recordLayoutTransition(VkCommandBuffer commandBuffer, VkImage image, const uint32_t baseMipLevel, const uint32_t levelCount, const VkImageLayout oldLayout, const VkImageLayout newLayout) -> void {
+        VkImageMemoryBarrier barrier{};
+        barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        barrier.oldLayout = oldLayout;
+        barrier.newLayout = newLayout;
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.image = image;
+        barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        barrier.subresourceRange.baseMipLevel = baseMipLevel;
+        barrier.subresourceRange.levelCount = levelCount;
+        barrier.subresourceRange.baseArrayLayer = 0;
+        barrier.subresourceRange.layerCount = 1;
+
+        VkPipelineStageFlags sourceStage;
+        VkPipelineStageFlags destinationStage;
+
+        if (oldLayout == VK_IMAGE_LAYOUT_UNDEFINED && newLayout == VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL) {
+            barrier.srcAccessMask = 0;
+            barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+
+            sourceStage = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+            destinationStage = VK_PIPELINE_STAGE_TRANSFER_BIT;
+        } else if (oldLayout == VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL && newLayout == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL) {
+            barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+
+            sourceStage = VK_PIPELINE_STAGE_TRANSFER_BIT;
+            destinationStage = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+        } else if (oldLayout == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL && newLayout == VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL) {
+            barrier.srcAccessMask = VK_ACCESS_SHADER_READ_BIT;
+            barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+
+            sourceStage = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+            destinationStage = VK_PIPELINE_STAGE_TRANSFER_BIT;
+        } else {
+            throw VulkanRuntimeException("Unsupported layout transition");
+        }
+
+        vkCmdPipelineBarrier(commandBuffer, sourceStage, destinationStage, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+    }
+}  // namespace
+
+VulkanTextureLoader::VulkanTextureLoader(VkDevice device, VkPhysicalDevice physicalDevice, VulkanDeletionQueue& deletionQueue) : mDeletionQueue(deletionQueue) {
+    mDevice = device;
+    mPhysicalDevice = physicalDevice;
+    mMemoryUsage = 0;
+}
+
+VulkanTextureLoader::~VulkanTextureLoader() noexcept {
+    // the decode jobs reference this object, so they have to be done before we go away
+    JobSystem::getInstance()->wait(mDecodeCounter);
+
+    // the caller ensures the device is idle, the images can be released right away
+    std::scoped_lock lock(mMutex);
+    for (auto& texture : mTextures) {
+        vkDestroyImageView(mDevice, texture.image.imageView, nullptr);
+        vkDestroyImage(mDevice, texture.image.image, nullptr);
+        vkFreeMemory(mDevice, texture.image.memory, nullptr);
+    }
+    mTextures.clear();
+    mPendingUploads.clear();
+}
+
+auto VulkanTextureLoader::load(const std::string& filename, const VkFormat format, const uint32_t placeholderColor) -> TextureHandle {
+    Texture texture{.path = "textures/" + filename,
+                    .format = format,
+                    .image = createImage(1, 1, 1, format),
+                    .width = 1,
+                    .height = 1,
+                    .mipLevels = 1,
+                    .loading = true,
+                    .version = 0};
+
+    PendingUpload placeholder{.handle = 0, .width = 1, .height = 1, .mipLevels = 1, .placeholder = true, .pixels = std::vector<uint8_t>(BYTES_PER_TEXEL)};
+    std::memcpy(placeholder.pixels.data(), &placeholderColor, BYTES_PER_TEXEL);
+
+    TextureHandle handle;
+    std::string path = texture.path;
+    {
+        std::scoped_lock lock(mMutex);
+        handle = static_cast<TextureHandle>(mTextures.size());
+        mMemoryUsage += texture.image.memorySize;
+        mTextures.push_back(std::move(texture));
+
+        placeholder.handle = handle;
+        mPendingUploads.push_back(std::move(placeholder));
+    }
+
+    JobSystem::getInstance()->run(mDecodeCounter, [this, handle, path = std::move(path)] { decode(handle, path); });
+    return handle;
+}
+
+auto VulkanTextureLoader::create(const std::string& name, const uint32_t width, const uint32_t height, const VkFormat format, std::vector<uint8_t> pixels) -> TextureHandle {
+    Texture texture{.path = name,
+                    .format = format,
+                    .image = createImage(1, 1, 1, format),
+                    .width = 1,
+                    .height = 1,
+                    .mipLevels = 1,
+                    .loading = true,
+                    .version = 0};
+
+    // the handle is sampleable right away, the transparent placeholder is replaced by the pixels in the same frame
+    PendingUpload placeholder{.handle = 0, .width = 1, .height = 1, .mipLevels = 1, .placeholder = true, .pixels = std::vector<uint8_t>(BYTES_PER_TEXEL)};
+    PendingUpload upload{.handle = 0, .width = width, .height = height, .mipLevels = 1, .placeholder = false, .pixels = std::move(pixels)};
+
+    std::scoped_lock lock(mMutex);
+    const auto handle = static_cast<TextureHandle>(mTextures.size());
+    mMemoryUsage += texture.image.memorySize;
+    mTextures.push_back(std::move(texture));
+
+    placeholder.handle = handle;
+    upload.handle = handle;
+    mPendingUploads.push_back(std::move(placeholder));
+    mPendingUploads.push_back(std::move(upload));
+    return handle;
+}
+
+auto VulkanTextureLoader::decode(const TextureHandle handle, const std::string& path) -> void {
+    int width = 0, height = 0, channels = 0;
+
+    // the flag of stb_image is global by default, the thread-local variant does not race with the other decode jobs
+    stbi_set_flip_vertically_on_load_thread(1);
+
+    std::shared_ptr<const io::Blob> encoded;
+    try {
+        encoded = VirtualFileSystem::getInstance()->read(path);
+    } catch (const IOException& exception) {
+        AdelieLogError("Failed to read texture image {}: {}, keeping the current image", path, exception.getMessage());
+
+        std::scoped_lock lock(mMutex);
+        mTextures[handle].loading = false;
+        return;
+    }
+
+    const auto data = encoded->getData();
+    stbi_uc* pixels = stbi_load_from_memory(reinterpret_cast<const stbi_uc*>(data.data()), static_cast<int>(data.size()), &width, &height, &channels, STBI_rgb_alpha);
+    if (nullptr == pixels) {
+        AdelieLogError("Failed to load texture image {}: {}, keeping the current image", path, stbi_failure_reason());
+
+        std::scoped_lock lock(mMutex);
+        mTextures[handle].loading = false;
+        return;
+    }
+
+    const auto size = static_cast<std::size_t>(width) * static_cast<std::size_t>(height) * BYTES_PER_TEXEL;
+    PendingUpload upload{.handle = handle,
+                         .width = static_cast<uint32_t>(width),
+                         .height = static_cast<uint32_t>(height),
+                         .mipLevels = getMipLevelCount(static_cast<uint32_t>(width), static_cast<uint32_t>(height)),
+                         .placeholder = false,
+                         .pixels = std::vector<uint8_t>(pixels, pixels + size)};
+    stbi_image_free(pixels);
+
+    // the full chain is uploaded, so top levels can be dropped without touching the file again
+    generateMipChain(upload.width, upload.height, upload.mipLevels, upload.pixels);
+
+    AdelieLogTrace("Decoded texture {} ({}x{})", path, width, height);
+
+    std::scoped_lock lock(mMutex);
+    mPendingUploads.push_back(std::move(upload));
+}
+
+auto VulkanTextureLoader::recordUploads(VkCommandBuffer commandBuffer, const uint64_t frameNumber) -> void {
+    std::vector<PendingUpload> uploads;
+    {
+        std::scoped_lock lock(mMutex);
+        uploads.swap(mPendingUploads);
+    }
+
+    for (auto& upload : uploads) {
+        recordUpload(commandBuffer, frameNumber, upload);
+    }
+}
+
+auto VulkanTextureLoader::recordUpload(VkCommandBuffer commandBuffer, const uint64_t frameNumber, PendingUpload& upload) -> void {
+    const auto imageSize = static_cast<VkDeviceSize>(upload.pixels.size());
+
+    VkBuffer stagingBuffer;
+    VkDeviceMemory stagingBufferMemory;
+    VulkanBufferManager::createBuffer(mDevice, mPhysicalDevice, imageSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, stagingBuffer, stagingBufferMemory);
+
+    void* data;
+    vkMapMemory(mDevice, stagingBufferMemory, 0, imageSize, 0, &data);
+    std::memcpy(data, upload.pixels.data(), upload.pixels.size());
+    vkUnmapMemory(mDevice, stagingBufferMemory);
+
+    std::scoped_lock lock(mMutex);
+    auto& texture = mTextures[upload.handle];
+
+    // a placeholder is uploaded into the image created by load(), real data gets a new image of the correct size
+    auto image = texture.image;
+    const auto replacesImage = upload.width != 1 || upload.height != 1 || texture.version > 0;
+    if (replacesImage) {
+        image = createImage(upload.width, upload.height, upload.mipLevels, texture.format);
+    }
+
+    recordLayoutTransition(commandBuffer, image.image, 0, upload.mipLevels, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+
+    std::vector<VkBufferImageCopy> regions(upload.mipLevels);
+    VkDeviceSize bufferOffset = 0;
+    for (uint32_t level = 0; level < upload.mipLevels; level++) {
+        const auto mipWidth = std::max(upload.width >> level, 1U);
+        const auto mipHeight = std::max(upload.height >> level, 1U);
+
+        auto& region = regions[level];
+        region.bufferOffset = bufferOffset;
+        region.bufferRowLength = 0;
+        region.bufferImageHeight = 0;
+        region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        region.imageSubresource.mipLevel = level;
+        region.imageSubresource.baseArrayLayer = 0;
+        region.imageSubresource.layerCount = 1;
+        region.imageOffset = {0, 0, 0};
+        region.imageExtent = {mipWidth, mipHeight, 1};
+
+        bufferOffset += static_cast<VkDeviceSize>(mipWidth) * mipHeight * BYTES_PER_TEXEL;
+    }
+    vkCmdCopyBufferToImage(commandBuffer, stagingBuffer, image.image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, static_cast<uint32_t>(regions.size()), regions.data());
+
+    recordLayoutTransition(commandBuffer, image.image, 0, upload.mipLevels, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+
+    // the staging buffer and the replaced image are still referenced by frames up to (and including) this one
+    mDeletionQueue.retireBuffer(stagingBuffer, stagingBufferMemory, frameNumber);
+    if (replacesImage) {
+        retireImage(texture.image, frameNumber);
+        mMemoryUsage += image.memorySize;
+        texture.image = image;
+        AdelieLogDebug("Uploaded texture {} ({}x{}, {} mip levels)", texture.path, upload.width, upload.height, upload.mipLevels);
+    }
+    texture.width = upload.width;
+    texture.height = upload.height;
+    texture.mipLevels = upload.mipLevels;
+    texture.loading = texture.loading && upload.placeholder;
+    texture.version++;
+}
+
+auto VulkanTextureLoader::reload(const TextureHandle handle) -> void {
+    std::string path;
+    {
+        std::scoped_lock lock(mMutex);
+        mTextures[handle].loading = true;
+        path = mTextures[handle].path;
+    }
+
+    JobSystem::getInstance()->run(mDecodeCounter, [this, handle, path = std::move(path)] { decode(handle, path); });
+}
+
+auto VulkanTextureLoader::recordDowngrade(VkCommandBuffer commandBuffer, const uint64_t frameNumber, const TextureHandle handle) -> void {
+    std::scoped_lock lock(mMutex);
+    auto& texture = mTextures[handle];
+
+    const auto width = std::max(texture.width / 2, 1U);
+    const auto height = std::max(texture.height / 2, 1U);
+    const auto mipLevels = texture.mipLevels - 1;
+    const auto image = createImage(width, height, mipLevels, texture.format);
+
+    // the lower mip levels are already on the GPU, they are copied over instead of being loaded again
+    recordLayoutTransition(commandBuffer, texture.image.image, 1, mipLevels, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
+    recordLayoutTransition(commandBuffer, image.image, 0, mipLevels, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+
+    std::vector<VkImageCopy> regions(mipLevels);
+    for (uint32_t level = 0; level < mipLevels; level++) {
+        auto& region = regions[level];
+        region.srcSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        region.srcSubresource.mipLevel = level + 1;
+        region.srcSubresource.baseArrayLayer = 0;
+        region.srcSubresource.layerCount = 1;
+        region.srcOffset = {0, 0, 0};
+        region.dstSubresource = region.srcSubresource;
+        region.dstSubresource.mipLevel = level;
+        region.dstOffset = {0, 0, 0};
+        region.extent = {std::max(width >> level, 1U), std::max(height >> level, 1U), 1};
+    }
+    vkCmdCopyImage(commandBuffer, texture.image.image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, image.image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, static_cast<uint32_t>(regions.size()), regions.data());
+
+    recordLayoutTransition(commandBuffer, image.image, 0, mipLevels, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+
+    retireImage(texture.image, frameNumber);
+    mMemoryUsage += image.memorySize;
+    texture.image = image;
+    texture.width = width;
+    texture.height = height;
+    texture.mipLevels = mipLevels;
+    texture.version++;
+
+    AdelieLogDebug("Downgraded texture {} to {}x{} to stay within the texture budget", texture.path, width, height);
+}
+
+auto VulkanTextureLoader::retireImage(const Image& image, const uint64_t frameNumber) -> void {
+    mDeletionQueue.retireImageView(image.imageView, frameNumber);
+    mDeletionQueue.retireImage(image.image, image.memory, frameNumber);
+    mMemoryUsage -= image.memorySize;
+}
+
+auto VulkanTextureLoader::createImage(const uint32_t width, const uint32_t height, const uint32_t mipLevels, const VkFormat format) const -> Image {
+    Image image{.image = VK_NULL_HANDLE, .memory = VK_NULL_HANDLE, .imageView = VK_NULL_HANDLE, .memorySize = 0};
+
+    VkImageCreateInfo imageInfo{};
+    imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+    imageInfo.imageType = VK_IMAGE_TYPE_2D;
+    imageInfo.extent.width = width;
+    imageInfo.extent.height = height;
+    imageInfo.extent.depth = 1;
+    imageInfo.mipLevels = mipLevels;
+    imageInfo.arrayLayers = 1;
+    imageInfo.format = format;
+    imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+    imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    imageInfo.usage = VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+    imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+    imageInfo.flags = 0;
+
+    if (const auto result = vkCreateImage(mDevice, &imageInfo, nullptr, &image.image); result != VK_SUCCESS) {
+        throw VulkanRuntimeException("Failed to create texture image", result);
+    }
+
+    VkMemoryRequirements memRequirements;
+    vkGetImageMemoryRequirements(mDevice, image.image, &memRequirements);
+    image.memorySize = memRequirements.size;
+
+    VkMemoryAllocateInfo allocInfo{};
+    allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    allocInfo.allocationSize = memRequirements.size;
+    allocInfo.memoryTypeIndex = VulkanBufferManager::findMemoryType(mPhysicalDevice, memRequirements.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+    if (const auto result = vkAllocateMemory(mDevice, &allocInfo, nullptr, &image.memory); result != VK_SUCCESS) {
+        throw VulkanRuntimeException("Failed to allocate texture image memory", result);
+    }
+    vkBindImageMemory(mDevice, image.image, image.memory, 0);
+
+    VkImageViewCreateInfo viewInfo{};
+    viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+    viewInfo.image = image.image;
+    viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+    viewInfo.format = format;
+    viewInfo.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    viewInfo.subresourceRange.baseMipLevel = 0;
+    viewInfo.subresourceRange.levelCount = mipLevels;
+    viewInfo.subresourceRange.baseArrayLayer = 0;
+    viewInfo.subresourceRange.layerCount = 1;
+
+    if (const auto result = vkCreateImageView(mDevice, &viewInfo, nullptr, &image.imageView); result != VK_SUCCESS) {
+        throw VulkanRuntimeException("Failed to create texture image view", result);
+    }
+
+    return image;
+}
+
+auto VulkanTextureLoader::getImageView(const TextureHandle handle) -> VkImageView {
+    std::scoped_lock lock(mMutex);
+    return mTextures[handle].image.imageView;
+}
+
+auto VulkanTextureLoader::getVersion(const TextureHandle handle) -> uint32_t {
+    std::scoped_lock lock(mMutex);
+    return mTextures[handle].version;
+}
+
+auto VulkanTextureLoader::getTextureCount() -> uint32_t {
+    std::scoped_lock lock(mMutex);
+    return static_cast<uint32_t>(mTextures.size());
+}
+
+auto VulkanTextureLoader::getInfo(const TextureHandle handle) -> VulkanTextureInfo {
+    std::scoped_lock lock(mMutex);
+    const auto& texture = mTextures[handle];
+    return {.width = texture.width, .height = texture.height, .mipLevels = texture.mipLevels, .memorySize = texture.image.memorySize, .version = texture.version, .loading = texture.loading};
+}
+
+auto VulkanTextureLoader::getMemoryUsage() -> VkDeviceSize {
+    std::scoped_lock lock(mMutex);
+    return mMemoryUsage;
+}
+
+auto VulkanTextureLoader::isLoading() -> bool {
+    std::scoped_lock lock(mMutex);
+    return !mDecodeCounter.isDone() || !mPendingUploads.empty();
+}
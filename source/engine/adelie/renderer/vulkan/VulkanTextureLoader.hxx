@@ -0,0 +1,132 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#if !defined(__ADELIE_RENDERER_VULKAN_VULKANTEXTURELOADER_HXX__)
+    #define __ADELIE_RENDERER_VULKAN_VULKANTEXTURELOADER_HXX__
+
+    #include <vulkan/vulkan.h>
+
+    #include <adelie/adelie.hxx>
+    #include <adelie/core/jobs/JobCounter.hxx>
+    #include <adelie/renderer/vulkan/VulkanDeletionQueue.hxx>
+    #include <cstdint>
+    #include <mutex>
+    #include <string>
+    #include <vector>
+
+namespace adelie::renderer::vulkan {
+
+    using TextureHandle = uint32_t;
+
+    // the state of the image behind a handle
+    struct VulkanTextureInfo {
+            uint32_t width;      // of the resident top mip level
+            uint32_t height;     // of the resident top mip level
+            uint32_t mipLevels;  // resident mip levels
+            VkDeviceSize memorySize;
+            uint32_t version;
+            bool loading;  // the file is decoded or waiting for its upload
+    }; /* struct VulkanTextureInfo */
+
+    // loads textures without blocking the caller. load() immediately returns a handle whose image is a 1x1 texel of
+    // the placeholder color, the file is decoded by a job on the job system and the real image is uploaded by the
+    // render thread as part of the next recorded frame. Every time the image behind a handle changes its version is
+    // incremented, so descriptor sets know when they have to be rewritten. The files are read through the virtual file
+    // system
+    //
+    // which textures stay resident at which size is decided by the VulkanResidencyManager, the loader only carries out
+    // its downgrades and reloads
+    class ADELIE_API VulkanTextureLoader {
+        public:
+            VulkanTextureLoader(VkDevice device, VkPhysicalDevice physicalDevice, VulkanDeletionQueue& deletionQueue);
+
+            ~VulkanTextureLoader() noexcept;
+
+            VulkanTextureLoader(const VulkanTextureLoader&) = delete;
+
+            auto operator=(VulkanTextureLoader const&) -> VulkanTextureLoader& = delete;
+
+            VulkanTextureLoader(VulkanTextureLoader&&) = delete;
+
+            auto operator=(VulkanTextureLoader&&) -> VulkanTextureLoader& = delete;
+
+            // placeholderColor is packed as 0xAABBGGRR (the byte order of a R8G8B8A8 texel)
+            auto load(const std::string& filename, VkFormat format, uint32_t placeholderColor) -> TextureHandle;
+
+            // a texture generated at runtime from tightly packed RGBA8 pixels, uploaded as part of the next recorded
+            // frame. It has a single mip level, so it is never downgraded
+            auto create(const std::string& name, uint32_t width, uint32_t height, VkFormat format, std::vector<uint8_t> pixels) -> TextureHandle;
+
+            // render thread: record the upload of all textures which finished decoding (and of new placeholders) into a
+            // command buffer which is outside a render pass. The replaced images are retired after frameNumber
+            auto recordUploads(VkCommandBuffer commandBuffer, uint64_t frameNumber) -> void;
+
+            // render thread: record the replacement of the image by one without its top mip level into a command buffer
+            // which is outside a render pass, the lower levels are copied on the GPU. The texture must have more than one
+            // mip level and must not be loading
+            auto recordDowngrade(VkCommandBuffer commandBuffer, uint64_t frameNumber, TextureHandle handle) -> void;
+
+            // render thread: decode the file of a loaded texture again, its full mip chain is uploaded once it is decoded
+            auto reload(TextureHandle handle) -> void;
+
+            [[nodiscard]] auto getTextureCount() -> uint32_t;
+
+            [[nodiscard]] auto getInfo(TextureHandle handle) -> VulkanTextureInfo;
+
+            [[nodiscard]] auto getImageView(TextureHandle handle) -> VkImageView;
+
+            [[nodiscard]] auto getVersion(TextureHandle handle) -> uint32_t;
+
+            // the device memory currently allocated for all texture images
+            [[nodiscard]] auto getMemoryUsage() -> VkDeviceSize;
+
+            // true as long as at least one texture is still decoding or waiting for its upload
+            [[nodiscard]] auto isLoading() -> bool;
+
+        private:
+            struct Image {
+                    VkImage image;
+                    VkDeviceMemory memory;
+                    VkImageView imageView;
+                    VkDeviceSize memorySize;
+            };
+
+            struct Texture {
+                    std::string path;
+                    VkFormat format;
+                    Image image;
+                    uint32_t width;           // of the resident top mip level
+                    uint32_t height;          // of the resident top mip level
+                    uint32_t mipLevels;       // resident mip levels
+                    bool loading;
+                    uint32_t version;
+            };
+
+            struct PendingUpload {
+                    TextureHandle handle;
+                    uint32_t width;
+                    uint32_t height;
+                    uint32_t mipLevels;
+                    bool placeholder;             // shown until the real image is uploaded
+                    std::vector<uint8_t> pixels;  // tightly packed RGBA8, all mip levels one after another
+            };
+
+            auto decode(TextureHandle handle, const std::string& path) -> void;
+            auto createImage(uint32_t width, uint32_t height, uint32_t mipLevels, VkFormat format) const -> Image;
+            auto recordUpload(VkCommandBuffer commandBuffer, uint64_t frameNumber, PendingUpload& upload) -> void;
+            auto retireImage(const Image& image, uint64_t frameNumber) -> void;
+
+            VkDevice mDevice;
+            VkPhysicalDevice mPhysicalDevice;
+            VulkanDeletionQueue& mDeletionQueue;
+            core::jobs::JobCounter mDecodeCounter;
+
+            std::mutex mMutex;
+            std::vector<Texture> mTextures;
+            std::vector<PendingUpload> mPendingUploads;
+            VkDeviceSize mMemoryUsage;
+
+    }; /* class VulkanTextureLoader */
+
+} /* namespace adelie::renderer::vulkan */
+
+#endif /* if !defined(__ADELIE_RENDERER_VULKAN_VULKANTEXTURELOADER_HXX__) */
@@ -0,0 +1,72 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#include <adelie/exception/VulkanRuntimeException.hxx>
+#include <adelie/renderer/vulkan/VulkanTimelineSemaphore.hxx>
+
+using adelie::exception::VulkanRuntimeException;
+using adelie::renderer::vulkan::VulkanTimelineSemaphore;
+
+VulkanTimelineSemaphore::VulkanTimelineSemaphore(VkDevice device, const uint64_t initialValue) {
+    mDevice = device;
+    mSemaphore = VK_NULL_HANDLE;
+
+    VkSemaphoreTypeCreateInfo typeInfo{};
+    typeInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
+    typeInfo.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+    typeInfo.initialValue = initialValue;
+
+    VkSemaphoreCreateInfo semaphoreInfo{};
+    semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+    semaphoreInfo.pNext = &typeInfo;
+
+    if (const auto result = vkCreateSemaphore(mDevice, &semaphoreInfo, nullptr, &mSemaphore); result != VK_SUCCESS) {
+        throw VulkanRuntimeException("Failed to create timeline semaphore", result);
+    }
+}
+
+VulkanTimelineSemaphore::~VulkanTimelineSemaphore() noexcept {
+    if (VK_NULL_HANDLE != mSemaphore) {
+        vkDestroySemaphore(mDevice, mSemaphore, nullptr);
+        mSemaphore = VK_NULL_HANDLE;
+    }
+}
+
+auto VulkanTimelineSemaphore::getHandle() const -> VkSemaphore {
+    return mSemaphore;
+}
+
+auto VulkanTimelineSemaphore::getCompletedValue() const -> uint64_t {
+    uint64_t value = 0;
+    if (const auto result = vkGetSemaphoreCounterValue(mDevice, mSemaphore, &value); result != VK_SUCCESS) {
+        throw VulkanRuntimeException("Failed to query the counter value of a timeline semaphore", result);
+    }
+    return value;
+}
+
+auto VulkanTimelineSemaphore::wait(const uint64_t value, const uint64_t timeoutInNanoseconds) const -> bool {
+    VkSemaphoreWaitInfo waitInfo{};
+    waitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
+    waitInfo.semaphoreCount = 1;
+    waitInfo.pSemaphores = &mSemaphore;
+    waitInfo.pValues = &value;
+
+    const auto result = vkWaitSemaphores(mDevice, &waitInfo, timeoutInNanoseconds);
+    if (result == VK_TIMEOUT) {
+        return false;
+    }
+    if (result != VK_SUCCESS) {
+        throw VulkanRuntimeException("Failed to wait for a timeline semaphore value", result);
+    }
+    return true;
+}
+
+auto VulkanTimelineSemaphore::signal(const uint64_t value) const -> void {
+    VkSemaphoreSignalInfo signalInfo{};
+    signalInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SIGNAL_INFO;
+    signalInfo.semaphore = mSemaphore;
+    signalInfo.value = value;
+
+    if (const auto result = vkSignalSemaphore(mDevice, &signalInfo); result != VK_SUCCESS) {
+        throw VulkanRuntimeException("Failed to signal a timeline semaphore from the host", result);
+    }
+}
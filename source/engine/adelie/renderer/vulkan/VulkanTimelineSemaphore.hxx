@@ -0,0 +1,46 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#if !defined(__ADELIE_RENDERER_VULKAN_VULKANTIMELINESEMAPHORE_HXX__)
+    #define __ADELIE_RENDERER_VULKAN_VULKANTIMELINESEMAPHORE_HXX__
+
+    #include <vulkan/vulkan.h>
+
+    #include <adelie/adelie.hxx>
+    #include <cstdint>
+
+namespace adelie::renderer::vulkan {
+
+    // a timeline semaphore (core since Vulkan 1.2) whose payload is a monotonically increasing counter. The renderer
+    // signals the number of each submitted frame on it, so the host can wait for "GPU finished frame N" precisely and
+    // other queues can chain their work on a specific value without additional fences
+    class ADELIE_API VulkanTimelineSemaphore {
+        public:
+            VulkanTimelineSemaphore(VkDevice device, uint64_t initialValue);
+
+            ~VulkanTimelineSemaphore() noexcept;
+
+            VulkanTimelineSemaphore(const VulkanTimelineSemaphore&) = delete;
+
+            auto operator=(VulkanTimelineSemaphore const&) -> VulkanTimelineSemaphore& = delete;
+
+            VulkanTimelineSemaphore(VulkanTimelineSemaphore&&) = delete;
+
+            auto operator=(VulkanTimelineSemaphore&&) -> VulkanTimelineSemaphore& = delete;
+
+            [[nodiscard]] auto getHandle() const -> VkSemaphore;
+
+            [[nodiscard]] auto getCompletedValue() const -> uint64_t;
+
+            auto wait(uint64_t value, uint64_t timeoutInNanoseconds) const -> bool;
+
+            auto signal(uint64_t value) const -> void;
+
+        private:
+            VkDevice mDevice;
+            VkSemaphore mSemaphore;
+
+    }; /* class VulkanTimelineSemaphore */
+
+} /* namespace adelie::renderer::vulkan */
+
+#endif /* if !defined(__ADELIE_RENDERER_VULKAN_VULKANTIMELINESEMAPHORE_HXX__) */
@@ -0,0 +1,105 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#include <adelie/core/Layer.hxx>
+#include <adelie/core/LayerStack.hxx>
+#include <adelie/core/SimulationLoop.hxx>
+#include <adelie/core/Timestep.hxx>
+#include <cstdint>
+#include <gtest/gtest.h>
+
+using adelie::core::Layer;
+using adelie::core::LayerStack;
+using adelie::core::SimulationLoop;
+using adelie::core::Timestep;
+
+namespace {
+
+    // a step of a quarter second and frame times which are multiples of an eighth are exact in floating point
+    constexpr float STEP = 0.25F;
+
+    class CountingLayer : public Layer {
+        public:
+            CountingLayer() : Layer("CountingLayer") {}
+
+            void onUpdate(const Timestep& deltaTime) override {
+                updates++;
+                lastDeltaTime = deltaTime;
+            }
+
+            uint32_t updates = 0;
+            float lastDeltaTime = 0.0F;
+    };
+
+    class SimulationLoopTest : public testing::Test {
+        protected:
+            auto SetUp() -> void override {
+                mLayer = new CountingLayer();  // NOLINT(cppcoreguidelines-owning-memory)
+                mLayers.pushLayer(mLayer);
+            }
+
+            LayerStack mLayers;
+            CountingLayer* mLayer = nullptr;  // owned by the layer stack
+    };
+
+} /* namespace */
+
+TEST_F(SimulationLoopTest, StepsOnceEveryFixedDeltaTime) {
+    SimulationLoop loop(STEP, 8);
+
+    EXPECT_EQ(0U, loop.update(0.125F, mLayers));
+    EXPECT_FLOAT_EQ(0.5F, loop.getAlpha());
+
+    EXPECT_EQ(1U, loop.update(0.125F, mLayers));
+    EXPECT_FLOAT_EQ(0.0F, loop.getAlpha());
+
+    EXPECT_EQ(2U, loop.update(0.625F, mLayers));
+    EXPECT_FLOAT_EQ(0.5F, loop.getAlpha());
+
+    EXPECT_EQ(3U, loop.getStepCount());
+    EXPECT_EQ(3U, mLayer->updates);
+    EXPECT_FLOAT_EQ(STEP, mLayer->lastDeltaTime);
+    EXPECT_DOUBLE_EQ(0.75, loop.getSimulationTime());
+    EXPECT_DOUBLE_EQ(0.625, loop.getInterpolatedTime());
+}
+
+TEST_F(SimulationLoopTest, KeepsTheAlphaBelowOne) {
+    SimulationLoop loop(1.0F / 60.0F, 8);
+    for (int frame = 0; frame < 1000; frame++) {
+        loop.update(1.0F / 144.0F, mLayers);
+        ASSERT_GE(loop.getAlpha(), 0.0F);
+        ASSERT_LT(loop.getAlpha(), 1.0F);
+    }
+}
+
+TEST_F(SimulationLoopTest, TakesTheSameStepsAtEveryFrameRate) {
+    // ten seconds rendered at 144 and at 24 frames per second
+    SimulationLoop fast(1.0F / 60.0F, 8);
+    for (int frame = 0; frame < 1440; frame++) {
+        fast.update(1.0F / 144.0F, mLayers);
+    }
+    SimulationLoop slow(1.0F / 60.0F, 8);
+    for (int frame = 0; frame < 240; frame++) {
+        slow.update(1.0F / 24.0F, mLayers);
+    }
+
+    // rounding of the frame times may shift the last step into the next frame
+    EXPECT_NEAR(600.0, static_cast<double>(fast.getStepCount()), 1.0);
+    EXPECT_NEAR(600.0, static_cast<double>(slow.getStepCount()), 1.0);
+    EXPECT_DOUBLE_EQ(0.0, fast.getDroppedTime());
+    EXPECT_DOUBLE_EQ(0.0, slow.getDroppedTime());
+}
+
+TEST_F(SimulationLoopTest, DropsTheTimeOfFramesTooLongToCatchUp) {
+    SimulationLoop loop(STEP, 4);
+
+    // a stall of five seconds would need twenty steps, only four of them are simulated
+    EXPECT_EQ(4U, loop.update(5.0F, mLayers));
+    EXPECT_DOUBLE_EQ(4.0, loop.getDroppedTime());
+    EXPECT_FLOAT_EQ(0.0F, loop.getAlpha());
+
+    // a frame needing exactly the maximum number of steps and a fraction of another is not capped
+    EXPECT_EQ(4U, loop.update(1.125F, mLayers));
+    EXPECT_DOUBLE_EQ(4.0, loop.getDroppedTime());
+    EXPECT_FLOAT_EQ(0.5F, loop.getAlpha());
+    EXPECT_EQ(8U, mLayer->updates);
+}
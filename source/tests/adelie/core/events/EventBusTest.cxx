@@ -0,0 +1,209 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#include <adelie/core/Input.hxx>
+#include <adelie/core/events/EventBus.hxx>
+#include <adelie/core/events/KeyPressedEvent.hxx>
+#include <adelie/core/events/MouseMovedEvent.hxx>
+#include <adelie/core/events/WindowCloseEvent.hxx>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using adelie::core::KeyCode;
+using adelie::core::events::Event;
+using adelie::core::events::EventBus;
+using adelie::core::events::EventCategory;
+using adelie::core::events::EventHandler;
+using adelie::core::events::KeyPressedEvent;
+using adelie::core::events::MouseMovedEvent;
+using adelie::core::events::SubscriptionId;
+using adelie::core::events::WindowCloseEvent;
+
+namespace {
+
+    // handlers cannot capture, every handler logs into the recorder it was subscribed with
+    struct Recorder {
+            std::vector<std::string> log;
+            bool handleKeys = false;
+            bool throwOnKeys = false;
+            SubscriptionId unsubscribeOnKeys = 0;
+
+            auto onKeyPressed(KeyPressedEvent& event) -> bool {
+                log.push_back("key " + std::to_string(event.getRepeatCount()));
+                if (throwOnKeys) {
+                    throw std::runtime_error("handler failed");
+                }
+                if (0 != unsubscribeOnKeys) {
+                    EventBus::getInstance()->unsubscribe(unsubscribeOnKeys);
+                }
+                return handleKeys;
+            }
+
+            auto onMouseMoved(MouseMovedEvent& event) -> bool {
+                log.push_back("mouse " + std::to_string(static_cast<int>(event.getX())));
+                return false;
+            }
+
+            // every key press is answered with a mouse movement
+            auto onKeyPressedPublish(KeyPressedEvent& event) -> bool {
+                log.push_back("publish " + std::to_string(event.getRepeatCount()));
+                EventBus::getInstance()->publish<MouseMovedEvent>(static_cast<float>(event.getRepeatCount()), 0.0F);
+                return false;
+            }
+
+            static auto onAny(void* context, Event& event) -> bool {
+                static_cast<Recorder*>(context)->log.push_back(std::string("category ") + event.getEventName());
+                return false;
+            }
+    };
+
+    // the bus is a singleton, every test removes its subscriptions and drops its leftover events again
+    class EventBusTest : public testing::Test {
+        protected:
+            auto TearDown() -> void override {
+                auto* bus = EventBus::getInstance();
+                for (const auto id : mSubscriptions) {
+                    bus->unsubscribe(id);
+                }
+                bus->dispatch();
+                bus->dispatch();
+            }
+
+            template <typename T, auto Method>
+            auto subscribe(Recorder& recorder) -> SubscriptionId {
+                const auto id = EventBus::getInstance()->subscribe<T, Method>(&recorder);
+                mSubscriptions.push_back(id);
+                return id;
+            }
+
+            auto subscribe(const uint32_t categoryMask, Recorder& recorder) -> SubscriptionId {
+                const auto id = EventBus::getInstance()->subscribe(categoryMask, EventHandler{&Recorder::onAny, &recorder});
+                mSubscriptions.push_back(id);
+                return id;
+            }
+
+            std::vector<SubscriptionId> mSubscriptions;
+    };
+
+} /* namespace */
+
+TEST_F(EventBusTest, DispatchesEventsInTheOrderTheyWerePublished) {
+    Recorder recorder;
+    subscribe<KeyPressedEvent, &Recorder::onKeyPressed>(recorder);
+    subscribe<MouseMovedEvent, &Recorder::onMouseMoved>(recorder);
+
+    auto* bus = EventBus::getInstance();
+    bus->publish<KeyPressedEvent>(KeyCode::CharacterA, 1U);
+    bus->publish<MouseMovedEvent>(2.0F, 0.0F);
+    bus->publish<KeyPressedEvent>(KeyCode::CharacterB, 3U);
+    EXPECT_TRUE(recorder.log.empty());
+
+    bus->dispatch();
+    EXPECT_EQ((std::vector<std::string>{"key 1", "mouse 2", "key 3"}), recorder.log);
+
+    // dispatched events are gone
+    bus->dispatch();
+    EXPECT_EQ(3U, recorder.log.size());
+}
+
+TEST_F(EventBusTest, DispatchesEventsSpanningSeveralArenaBlocks) {
+    Recorder recorder;
+    subscribe<KeyPressedEvent, &Recorder::onKeyPressed>(recorder);
+
+    // enough events to fill more than one block, the order must survive the block boundaries
+    constexpr uint32_t count = 10000;
+    auto* bus = EventBus::getInstance();
+    for (int frame = 0; frame < 2; frame++) {
+        recorder.log.clear();
+        for (uint32_t i = 0; i < count; i++) {
+            bus->publish<KeyPressedEvent>(KeyCode::CharacterA, i);
+        }
+        bus->dispatch();
+
+        ASSERT_EQ(count, recorder.log.size());
+        for (uint32_t i = 0; i < count; i++) {
+            ASSERT_EQ("key " + std::to_string(i), recorder.log[i]);
+        }
+    }
+}
+
+TEST_F(EventBusTest, StopsAtTheFirstHandlerWhichHandledTheEvent) {
+    Recorder first;
+    Recorder second;
+    first.handleKeys = true;
+    subscribe<KeyPressedEvent, &Recorder::onKeyPressed>(first);
+    subscribe<KeyPressedEvent, &Recorder::onKeyPressed>(second);
+    subscribe(EventCategory::KeyboardInput, second);
+
+    EventBus::getInstance()->publish<KeyPressedEvent>(KeyCode::CharacterA, 1U);
+    EventBus::getInstance()->dispatch();
+
+    EXPECT_EQ((std::vector<std::string>{"key 1"}), first.log);
+    EXPECT_TRUE(second.log.empty());
+}
+
+TEST_F(EventBusTest, HandsEventsToTheCategoriesTheyBelongTo) {
+    Recorder keyboard;
+    Recorder input;
+    subscribe(EventCategory::KeyboardInput, keyboard);
+    subscribe(EventCategory::KeyboardInput | EventCategory::MouseInput, input);
+
+    auto* bus = EventBus::getInstance();
+    bus->publish<WindowCloseEvent>();
+    bus->publish<MouseMovedEvent>(1.0F, 1.0F);
+    bus->publish<KeyPressedEvent>(KeyCode::CharacterA, 1U);
+    bus->dispatch();
+
+    EXPECT_EQ((std::vector<std::string>{"category KeyPressed"}), keyboard.log);
+    EXPECT_EQ((std::vector<std::string>{"category MouseMoved", "category KeyPressed"}), input.log);
+}
+
+TEST_F(EventBusTest, DispatchesEventsPublishedByHandlersWithTheNextFrame) {
+    Recorder recorder;
+    subscribe<KeyPressedEvent, &Recorder::onKeyPressedPublish>(recorder);
+    subscribe<MouseMovedEvent, &Recorder::onMouseMoved>(recorder);
+
+    auto* bus = EventBus::getInstance();
+    bus->publish<KeyPressedEvent>(KeyCode::CharacterA, 7U);
+    bus->dispatch();
+    EXPECT_EQ((std::vector<std::string>{"publish 7"}), recorder.log);
+
+    bus->dispatch();
+    EXPECT_EQ((std::vector<std::string>{"publish 7", "mouse 7"}), recorder.log);
+}
+
+TEST_F(EventBusTest, SkipsHandlersUnsubscribedDuringTheDispatch) {
+    Recorder first;
+    Recorder second;
+    subscribe<KeyPressedEvent, &Recorder::onKeyPressed>(first);
+    first.unsubscribeOnKeys = subscribe<KeyPressedEvent, &Recorder::onKeyPressed>(second);
+
+    auto* bus = EventBus::getInstance();
+    bus->publish<KeyPressedEvent>(KeyCode::CharacterA, 1U);
+    bus->publish<KeyPressedEvent>(KeyCode::CharacterA, 2U);
+    bus->dispatch();
+
+    EXPECT_EQ((std::vector<std::string>{"key 1", "key 2"}), first.log);
+    EXPECT_TRUE(second.log.empty());
+}
+
+TEST_F(EventBusTest, RecoversFromAThrowingHandler) {
+    Recorder recorder;
+    recorder.throwOnKeys = true;
+    subscribe<KeyPressedEvent, &Recorder::onKeyPressed>(recorder);
+    subscribe<MouseMovedEvent, &Recorder::onMouseMoved>(recorder);
+
+    auto* bus = EventBus::getInstance();
+    bus->publish<KeyPressedEvent>(KeyCode::CharacterA, 1U);
+    bus->publish<MouseMovedEvent>(2.0F, 0.0F);
+    EXPECT_THROW(bus->dispatch(), std::runtime_error);
+
+    // the remaining events of the failed frame are dropped, the next frame is dispatched as usual
+    recorder.throwOnKeys = false;
+    bus->publish<MouseMovedEvent>(3.0F, 0.0F);
+    bus->publish<KeyPressedEvent>(KeyCode::CharacterA, 4U);
+    bus->dispatch();
+    EXPECT_EQ((std::vector<std::string>{"key 1", "mouse 3", "key 4"}), recorder.log);
+}
@@ -0,0 +1,145 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#include <adelie/core/jobs/JobSystem.hxx>
+#include <atomic>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+using adelie::core::jobs::JobCounter;
+using adelie::core::jobs::JobSystem;
+
+namespace {
+
+    constexpr uint32_t TEST_WORKER_COUNT = 4;
+
+    class JobSystemTest : public testing::Test {
+        protected:
+            auto SetUp() -> void override { JobSystem::getInstance()->initialize(TEST_WORKER_COUNT); }
+
+            auto TearDown() -> void override { JobSystem::getInstance()->shutdown(); }
+    };
+
+} /* namespace */
+
+TEST(JobSystemWithoutWorkersTest, RunsJobsInline) {
+    auto* jobSystem = JobSystem::getInstance();
+    ASSERT_EQ(0U, jobSystem->getWorkerCount());
+
+    JobCounter counter;
+    int value = 0;
+    jobSystem->run(counter, [&value] { value = 7; });
+    EXPECT_EQ(7, value);
+    EXPECT_TRUE(counter.isDone());
+    jobSystem->wait(counter);
+}
+
+TEST_F(JobSystemTest, RunsEveryJob) {
+    auto* jobSystem = JobSystem::getInstance();
+    EXPECT_EQ(TEST_WORKER_COUNT, jobSystem->getWorkerCount());
+
+    constexpr uint64_t jobCount = 100000;
+    std::atomic<uint64_t> sum = 0;
+    JobCounter counter;
+    for (uint64_t i = 0; i < jobCount; i++) {
+        jobSystem->run(counter, [&sum, i] { sum += i; });
+    }
+    jobSystem->wait(counter);
+
+    EXPECT_TRUE(counter.isDone());
+    EXPECT_EQ(jobCount * (jobCount - 1) / 2, sum.load());
+}
+
+TEST_F(JobSystemTest, RunsJobsSubmittedByOtherThreads) {
+    auto* jobSystem = JobSystem::getInstance();
+
+    std::atomic<uint32_t> executed = 0;
+    std::thread submitter([&] {
+        JobCounter counter;
+        for (uint32_t i = 0; i < 20000; i++) {
+            jobSystem->run(counter, [&executed] { executed++; });
+        }
+        jobSystem->wait(counter);
+    });
+    submitter.join();
+
+    EXPECT_EQ(20000U, executed.load());
+}
+
+TEST_F(JobSystemTest, WaitsForNestedJobs) {
+    auto* jobSystem = JobSystem::getInstance();
+
+    std::atomic<uint32_t> executed = 0;
+    JobCounter outer;
+    for (uint32_t i = 0; i < 64; i++) {
+        jobSystem->run(outer, [&] {
+            JobCounter inner;
+            for (uint32_t j = 0; j < 64; j++) {
+                jobSystem->run(inner, [&executed] { executed++; });
+            }
+            jobSystem->wait(inner);
+        });
+    }
+    jobSystem->wait(outer);
+
+    EXPECT_EQ(64U * 64U, executed.load());
+}
+
+TEST_F(JobSystemTest, StartsDependentJobsAfterTheirDependency) {
+    auto* jobSystem = JobSystem::getInstance();
+
+    for (uint32_t round = 0; round < 1000; round++) {
+        std::atomic<uint32_t> finished = 0;
+        std::atomic<uint32_t> startedEarly = 0;
+        std::atomic<uint32_t> dependents = 0;
+
+        JobCounter dependency;
+        JobCounter counter;
+        for (uint32_t i = 0; i < 16; i++) {
+            jobSystem->run(dependency, [&finished] { finished++; });
+        }
+        for (uint32_t i = 0; i < 8; i++) {
+            jobSystem->runAfter(&dependency, counter, [&] {
+                if (finished.load() != 16) {
+                    startedEarly++;
+                }
+                dependents++;
+            });
+        }
+        jobSystem->wait(counter);
+
+        ASSERT_EQ(0U, startedEarly.load());
+        ASSERT_EQ(8U, dependents.load());
+    }
+}
+
+TEST_F(JobSystemTest, StartsDependentJobsOfAFinishedDependencyRightAway) {
+    auto* jobSystem = JobSystem::getInstance();
+
+    JobCounter dependency;
+    jobSystem->run(dependency, [] {});
+    jobSystem->wait(dependency);
+
+    bool executed = false;
+    JobCounter counter;
+    jobSystem->runAfter(&dependency, counter, [&executed] { executed = true; });
+    jobSystem->wait(counter);
+
+    EXPECT_TRUE(executed);
+}
+
+TEST_F(JobSystemTest, CoversTheRangeOfAParallelFor) {
+    auto* jobSystem = JobSystem::getInstance();
+
+    std::vector<std::atomic<uint32_t>> visits(10007);
+    jobSystem->parallelFor(static_cast<uint32_t>(visits.size()), 64, [&visits](const uint32_t begin, const uint32_t end) {
+        for (auto i = begin; i < end; i++) {
+            visits[i]++;
+        }
+    });
+
+    for (const auto& visit : visits) {
+        ASSERT_EQ(1U, visit.load());
+    }
+}
@@ -0,0 +1,227 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#include <adelie/core/renderer/MeshSimplifier.hxx>
+#include <cmath>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <numbers>
+#include <set>
+#include <vector>
+
+using adelie::core::renderer::MeshSimplifier;
+using adelie::core::renderer::SimplifiedMesh;
+
+namespace {
+
+    struct Mesh {
+            std::vector<glm::vec3> positions;
+            std::vector<uint32_t> indices;
+    };
+
+    // a closed unit sphere with welded poles, the triangles are wound counter-clockwise seen from outside
+    auto makeSphere(const uint32_t rings, const uint32_t segments) -> Mesh {
+        Mesh mesh;
+        mesh.positions.emplace_back(0.0F, 0.0F, 1.0F);
+        for (uint32_t ring = 1; ring < rings; ring++) {
+            for (uint32_t segment = 0; segment < segments; segment++) {
+                const auto theta = std::numbers::pi_v<float> * static_cast<float>(ring) / static_cast<float>(rings);
+                const auto phi = 2.0F * std::numbers::pi_v<float> * static_cast<float>(segment) / static_cast<float>(segments);
+                mesh.positions.emplace_back(std::sin(theta) * std::cos(phi), std::sin(theta) * std::sin(phi), std::cos(theta));
+            }
+        }
+        mesh.positions.emplace_back(0.0F, 0.0F, -1.0F);
+
+        const auto vertex = [&](const uint32_t ring, const uint32_t segment) -> uint32_t {
+            if (0 == ring) {
+                return 0;
+            }
+            if (rings == ring) {
+                return static_cast<uint32_t>(mesh.positions.size() - 1);
+            }
+            return 1 + ((ring - 1) * segments) + (segment % segments);
+        };
+        for (uint32_t ring = 0; ring < rings; ring++) {
+            for (uint32_t segment = 0; segment < segments; segment++) {
+                const auto a = vertex(ring, segment);
+                const auto b = vertex(ring + 1, segment);
+                const auto c = vertex(ring + 1, segment + 1);
+                const auto d = vertex(ring, segment + 1);
+                if (0 != ring) {
+                    mesh.indices.insert(mesh.indices.end(), {a, b, d});
+                }
+                if (rings - 1 != ring) {
+                    mesh.indices.insert(mesh.indices.end(), {d, b, c});
+                }
+            }
+        }
+        return mesh;
+    }
+
+    // a flat grid of size x size quads in the xy plane. With a seam, the vertices of the middle column exist twice
+    // (e.g. with different texture coordinates), the left quads use the first and the right quads the second copy
+    auto makeGrid(const uint32_t size, const bool withSeam) -> Mesh {
+        Mesh mesh;
+        for (uint32_t y = 0; y <= size; y++) {
+            for (uint32_t x = 0; x <= size; x++) {
+                mesh.positions.emplace_back(static_cast<float>(x), static_cast<float>(y), 0.0F);
+            }
+        }
+        const auto seamColumn = size / 2;
+        const auto seamStart = static_cast<uint32_t>(mesh.positions.size());
+        if (withSeam) {
+            for (uint32_t y = 0; y <= size; y++) {
+                mesh.positions.emplace_back(static_cast<float>(seamColumn), static_cast<float>(y), 0.0F);
+            }
+        }
+
+        const auto vertex = [&](const uint32_t x, const uint32_t y, const bool right) -> uint32_t {
+            if (withSeam && right && x == seamColumn) {
+                return seamStart + y;
+            }
+            return (y * (size + 1)) + x;
+        };
+        for (uint32_t y = 0; y < size; y++) {
+            for (uint32_t x = 0; x < size; x++) {
+                const auto right = x >= seamColumn;
+                const auto a = vertex(x, y, right);
+                const auto b = vertex(x + 1, y, right);
+                const auto c = vertex(x + 1, y + 1, right);
+                const auto d = vertex(x, y + 1, right);
+                mesh.indices.insert(mesh.indices.end(), {a, b, c, a, c, d});
+            }
+        }
+        return mesh;
+    }
+
+    auto getNormal(const Mesh& mesh, const std::vector<uint32_t>& indices, const std::size_t first) -> glm::vec3 {
+        const auto& a = mesh.positions[indices[first]];
+        const auto& b = mesh.positions[indices[first + 1]];
+        const auto& c = mesh.positions[indices[first + 2]];
+        return glm::cross(b - a, c - a);
+    }
+
+    // every triangle indexes the source vertices, is not degenerate and keeps the winding of the surface
+    auto expectValidTriangles(const Mesh& mesh, const SimplifiedMesh& simplified, const bool closedSphere) -> void {
+        ASSERT_EQ(0U, simplified.indices.size() % 3);
+        for (std::size_t i = 0; i < simplified.indices.size(); i += 3) {
+            const auto a = simplified.indices[i];
+            const auto b = simplified.indices[i + 1];
+            const auto c = simplified.indices[i + 2];
+            ASSERT_LT(a, mesh.positions.size());
+            ASSERT_LT(b, mesh.positions.size());
+            ASSERT_LT(c, mesh.positions.size());
+            ASSERT_TRUE(a != b && b != c && c != a) << "triangle " << i / 3 << " is degenerate";
+
+            const auto normal = getNormal(mesh, simplified.indices, i);
+            if (closedSphere) {
+                // three vertices of a meridian form a sliver in a plane through the center, which is edge-on but
+                // not flipped
+                const auto center = (mesh.positions[a] + mesh.positions[b] + mesh.positions[c]) / 3.0F;
+                ASSERT_GT(glm::dot(normal, center), -1e-5F * glm::length(normal)) << "triangle " << i / 3 << " flipped";
+            } else {
+                ASSERT_GT(normal.z, 0.0F) << "triangle " << i / 3 << " flipped";
+            }
+        }
+    }
+
+    auto getArea(const Mesh& mesh, const std::vector<uint32_t>& indices) -> float {
+        float area = 0.0F;
+        for (std::size_t i = 0; i < indices.size(); i += 3) {
+            area += glm::length(getNormal(mesh, indices, i)) * 0.5F;
+        }
+        return area;
+    }
+
+} /* namespace */
+
+TEST(MeshSimplifierTest, ReducesAClosedMeshToTheTriangleBudget) {
+    const auto sphere = makeSphere(32, 64);
+    const auto sourceCount = static_cast<uint32_t>(sphere.indices.size());
+
+    for (const uint32_t divisor : {2U, 4U, 10U}) {
+        const auto target = (sourceCount / divisor) / 3 * 3;
+        const auto simplified = MeshSimplifier::simplify(sphere.positions, sphere.indices, target, 1.0F);
+        EXPECT_LE(simplified.indices.size(), target) << "1/" << divisor << " of the triangles";
+        EXPECT_GT(simplified.indices.size(), target / 2) << "1/" << divisor << " of the triangles";
+        EXPECT_GT(simplified.error, 0.0F);
+        expectValidTriangles(sphere, simplified, true);
+    }
+}
+
+TEST(MeshSimplifierTest, ErrorGrowsWithSmallerBudgets) {
+    const auto sphere = makeSphere(32, 64);
+    const auto sourceCount = static_cast<uint32_t>(sphere.indices.size());
+
+    const auto half = MeshSimplifier::simplify(sphere.positions, sphere.indices, sourceCount / 6 * 3, 1.0F);
+    const auto tenth = MeshSimplifier::simplify(sphere.positions, sphere.indices, sourceCount / 30 * 3, 1.0F);
+    EXPECT_LT(half.error, tenth.error);
+
+    // the vertices stay on the sphere, the centers of the triangles sink in by at most the estimated error and a bit
+    for (std::size_t i = 0; i < tenth.indices.size(); i += 3) {
+        const auto center = (sphere.positions[tenth.indices[i]] + sphere.positions[tenth.indices[i + 1]] + sphere.positions[tenth.indices[i + 2]]) / 3.0F;
+        ASSERT_LT(1.0F - glm::length(center), 4.0F * tenth.error);
+    }
+}
+
+TEST(MeshSimplifierTest, KeepsTheMeshIfItFitsTheBudget) {
+    const auto sphere = makeSphere(8, 16);
+    const auto simplified = MeshSimplifier::simplify(sphere.positions, sphere.indices, static_cast<uint32_t>(sphere.indices.size()), 1.0F);
+    EXPECT_EQ(sphere.indices, simplified.indices);
+    EXPECT_EQ(0.0F, simplified.error);
+}
+
+TEST(MeshSimplifierTest, StopsBeforeExceedingTheMaximumError) {
+    const auto sphere = makeSphere(32, 64);
+    constexpr float maxError = 0.001F;
+
+    const auto simplified = MeshSimplifier::simplify(sphere.positions, sphere.indices, 0, maxError);
+    EXPECT_LE(simplified.error, maxError);
+    EXPECT_LT(simplified.indices.size(), sphere.indices.size());
+    EXPECT_GT(simplified.indices.size(), sphere.indices.size() / 10);
+    expectValidTriangles(sphere, simplified, true);
+}
+
+TEST(MeshSimplifierTest, KeepsTheBorderOfAnOpenMesh) {
+    constexpr uint32_t size = 16;
+    const auto grid = makeGrid(size, false);
+    const auto simplified = MeshSimplifier::simplify(grid.positions, grid.indices, 0, 0.001F);
+
+    EXPECT_LT(simplified.indices.size(), grid.indices.size() / 4);
+    expectValidTriangles(grid, simplified, false);
+    EXPECT_NEAR(getArea(grid, grid.indices), getArea(grid, simplified.indices), 1e-3F);
+
+    const std::set<uint32_t> used(simplified.indices.begin(), simplified.indices.end());
+    for (uint32_t i = 0; i <= size; i++) {
+        EXPECT_TRUE(used.contains(i)) << "bottom border vertex " << i;
+        EXPECT_TRUE(used.contains((size * (size + 1)) + i)) << "top border vertex " << i;
+        EXPECT_TRUE(used.contains(i * (size + 1))) << "left border vertex " << i;
+        EXPECT_TRUE(used.contains((i * (size + 1)) + size)) << "right border vertex " << i;
+    }
+}
+
+TEST(MeshSimplifierTest, KeepsBothSidesOfASeam) {
+    constexpr uint32_t size = 16;
+    const auto grid = makeGrid(size, true);
+    const auto simplified = MeshSimplifier::simplify(grid.positions, grid.indices, 0, 0.001F);
+
+    EXPECT_LT(simplified.indices.size(), grid.indices.size() / 2);
+    expectValidTriangles(grid, simplified, false);
+    EXPECT_NEAR(getArea(grid, grid.indices), getArea(grid, simplified.indices), 1e-3F);
+
+    // the copies on the right side of the seam are only used by triangles right of it and vice versa
+    const auto seamColumn = size / 2;
+    const auto seamStart = static_cast<uint32_t>((size + 1) * (size + 1));
+    const std::set<uint32_t> used(simplified.indices.begin(), simplified.indices.end());
+    for (uint32_t y = 0; y <= size; y++) {
+        EXPECT_TRUE(used.contains((y * (size + 1)) + seamColumn)) << "left seam vertex " << y;
+        EXPECT_TRUE(used.contains(seamStart + y)) << "right seam vertex " << y;
+    }
+    for (std::size_t i = 0; i < simplified.indices.size(); i += 3) {
+        const auto center = (grid.positions[simplified.indices[i]] + grid.positions[simplified.indices[i + 1]] + grid.positions[simplified.indices[i + 2]]) / 3.0F;
+        for (uint32_t corner = 0; corner < 3; corner++) {
+            if (simplified.indices[i + corner] >= seamStart) {
+                ASSERT_GT(center.x, static_cast<float>(seamColumn));
+            }
+        }
+    }
+}
@@ -0,0 +1,236 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#include <adelie/core/scene/BoundingVolumeHierarchy.hxx>
+#include <adelie/core/scene/Bounds.hxx>
+#include <algorithm>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <random>
+#include <set>
+#include <vector>
+
+using adelie::core::scene::Aabb;
+using adelie::core::scene::BoundingVolumeHierarchy;
+using adelie::core::scene::BVH_NULL;
+using adelie::core::scene::BvhProxy;
+using adelie::core::scene::BvhRayHit;
+using adelie::core::scene::Frustum;
+using adelie::core::scene::Ray;
+
+namespace {
+
+    constexpr uint32_t BOX_COUNT = 5000;
+    constexpr uint32_t QUERY_COUNT = 100;
+    constexpr float RAY_LENGTH = 1000.0F;
+
+    // random boxes in a cube of 200 units. Every query is checked against a brute force test of all live proxies,
+    // the proxies are compared with their enlarged bounds, which are the ones the tree reports
+    class BoundingVolumeHierarchyTest : public testing::Test {
+        protected:
+            auto SetUp() -> void override {
+                for (uint32_t i = 0; i < BOX_COUNT; i++) {
+                    mBoxes.push_back(makeBox());
+                    mProxies.push_back(mTree.createProxy(mBoxes.back(), i));
+                }
+            }
+
+            auto makeBox() -> Aabb {
+                std::uniform_real_distribution<float> position(-100.0F, 100.0F);
+                std::uniform_real_distribution<float> extent(0.1F, 2.0F);
+                const glm::vec3 center(position(mRandom), position(mRandom), position(mRandom));
+                const glm::vec3 extents(extent(mRandom), extent(mRandom), extent(mRandom));
+                return {center - extents, center + extents};
+            }
+
+            auto makeRay() -> Ray {
+                std::uniform_real_distribution<float> position(-100.0F, 100.0F);
+                return Ray::create(glm::vec3(position(mRandom), position(mRandom), -200.0F), glm::normalize(glm::vec3(0.01F, 0.02F, 1.0F)), RAY_LENGTH);
+            }
+
+            auto destroy(const uint32_t index) -> void {
+                mTree.destroyProxy(mProxies[index]);
+                mProxies[index] = BVH_NULL;
+            }
+
+            auto expectOverlapQueriesMatch() -> void {
+                for (uint32_t query = 0; query < QUERY_COUNT; query++) {
+                    auto box = makeBox();
+                    box.max = box.max + glm::vec3(10.0F);
+
+                    std::set<uint64_t> found;
+                    mTree.queryOverlap(box, [&](const BvhProxy proxy) {
+                        EXPECT_TRUE(found.insert(mTree.getUserData(proxy)).second) << "reported twice";
+                        return true;
+                    });
+
+                    std::set<uint64_t> expected;
+                    for (uint32_t i = 0; i < mProxies.size(); i++) {
+                        if (BVH_NULL != mProxies[i] && box.overlaps(mTree.getBounds(mProxies[i]))) {
+                            expected.insert(i);
+                        }
+                    }
+                    ASSERT_EQ(expected, found);
+                }
+            }
+
+            // the closest hit against the exact boxes of the objects
+            auto bruteForceRaycast(const Ray& ray) -> uint64_t {
+                auto closest = ray.maxDistance;
+                uint64_t hit = BVH_NULL;
+                for (uint32_t i = 0; i < mProxies.size(); i++) {
+                    const auto distance = ray.intersect(mBoxes[i]);
+                    if (BVH_NULL != mProxies[i] && distance >= 0.0F && distance < closest) {
+                        closest = distance;
+                        hit = i;
+                    }
+                }
+                return hit;
+            }
+
+            auto expectRaycastsMatch() -> void {
+                std::vector<Ray> rays;
+                for (uint32_t query = 0; query < QUERY_COUNT; query++) {
+                    rays.push_back(makeRay());
+                }
+
+                std::vector<BvhRayHit> hits(rays.size());
+                mTree.raycast(rays, hits, [&](const uint32_t ray, const BvhProxy proxy, const float /*boxDistance*/) { return rays[ray].intersect(mBoxes[mTree.getUserData(proxy)]); });
+
+                for (uint32_t i = 0; i < rays.size(); i++) {
+                    const auto& ray = rays[i];
+                    const auto hit = mTree.raycast(ray, [&](const BvhProxy proxy, const float /*boxDistance*/) { return ray.intersect(mBoxes[mTree.getUserData(proxy)]); });
+                    const auto expected = bruteForceRaycast(ray);
+                    ASSERT_EQ(expected, BVH_NULL == hit.proxy ? BVH_NULL : mTree.getUserData(hit.proxy));
+                    ASSERT_EQ(hit.proxy, hits[i].proxy) << "ray " << i << " of the packet";
+                }
+            }
+
+            auto expectFrustumQueriesMatch() -> void {
+                // an axis-aligned box of 60 x 40 x 100 units as a frustum
+                Frustum frustum{};
+                frustum.planes = {glm::vec4(1.0F, 0.0F, 0.0F, 30.0F), glm::vec4(-1.0F, 0.0F, 0.0F, 30.0F), glm::vec4(0.0F, 1.0F, 0.0F, 20.0F),
+                                  glm::vec4(0.0F, -1.0F, 0.0F, 20.0F), glm::vec4(0.0F, 0.0F, 1.0F, 50.0F), glm::vec4(0.0F, 0.0F, -1.0F, 50.0F)};
+                const Aabb box{glm::vec3(-30.0F, -20.0F, -50.0F), glm::vec3(30.0F, 20.0F, 50.0F)};
+
+                std::set<uint64_t> found;
+                mTree.queryFrustum(frustum, [&](const BvhProxy proxy) { found.insert(mTree.getUserData(proxy)); });
+
+                std::set<uint64_t> expected;
+                for (uint32_t i = 0; i < mProxies.size(); i++) {
+                    if (BVH_NULL != mProxies[i] && box.overlaps(mTree.getBounds(mProxies[i]))) {
+                        expected.insert(i);
+                    }
+                }
+                EXPECT_FALSE(expected.empty());
+                EXPECT_EQ(expected, found);
+            }
+
+            auto expectQueriesMatch() -> void {
+                expectOverlapQueriesMatch();
+                expectRaycastsMatch();
+                expectFrustumQueriesMatch();
+            }
+
+            BoundingVolumeHierarchy mTree;
+            std::mt19937 mRandom{1};
+            std::vector<Aabb> mBoxes;
+            std::vector<BvhProxy> mProxies;  // BVH_NULL for destroyed proxies
+    };
+
+} /* namespace */
+
+TEST_F(BoundingVolumeHierarchyTest, MatchesBruteForceAfterInsertion) {
+    EXPECT_EQ(BOX_COUNT, mTree.getProxyCount());
+    expectQueriesMatch();
+}
+
+TEST_F(BoundingVolumeHierarchyTest, MatchesBruteForceAfterRemoval) {
+    for (uint32_t i = 0; i < BOX_COUNT; i += 3) {
+        destroy(i);
+    }
+    EXPECT_EQ(BOX_COUNT - ((BOX_COUNT + 2) / 3), mTree.getProxyCount());
+    expectQueriesMatch();
+
+    // the freed proxies are reused
+    for (uint32_t i = 0; i < BOX_COUNT; i += 3) {
+        mProxies[i] = mTree.createProxy(mBoxes[i], i);
+    }
+    expectQueriesMatch();
+}
+
+TEST_F(BoundingVolumeHierarchyTest, MatchesBruteForceAfterMovesAndRebuilds) {
+    for (uint32_t frame = 0; frame < 20; frame++) {
+        for (uint32_t i = 0; i < BOX_COUNT; i++) {
+            const glm::vec3 velocity(0.5F, 0.3F * static_cast<float>(i % 3), -0.2F);
+            mBoxes[i].min = mBoxes[i].min + velocity;
+            mBoxes[i].max = mBoxes[i].max + velocity;
+            mTree.moveProxy(mProxies[i], mBoxes[i]);
+            ASSERT_TRUE(mTree.getBounds(mProxies[i]).contains(mBoxes[i]));
+        }
+        mTree.optimize();
+    }
+    expectQueriesMatch();
+
+    mTree.rebuild();
+    expectQueriesMatch();
+}
+
+TEST_F(BoundingVolumeHierarchyTest, IgnoresSmallMovesWithinTheEnlargedBounds) {
+    const auto bounds = mTree.getBounds(mProxies[0]);
+    EXPECT_FALSE(mTree.moveProxy(mProxies[0], mBoxes[0]));
+    EXPECT_TRUE(mTree.moveProxy(mProxies[0], Aabb{mBoxes[0].min + glm::vec3(50.0F), mBoxes[0].max + glm::vec3(50.0F)}));
+    EXPECT_FALSE(mTree.getBounds(mProxies[0]).overlaps(bounds));
+}
+
+TEST_F(BoundingVolumeHierarchyTest, StopsAQueryWhenAskedTo) {
+    uint32_t reported = 0;
+    mTree.queryOverlap(Aabb{glm::vec3(-1000.0F), glm::vec3(1000.0F)}, [&reported](const BvhProxy /*proxy*/) {
+        reported++;
+        return reported < 10;
+    });
+    EXPECT_EQ(10U, reported);
+}
+
+TEST(BoundingVolumeHierarchyBalanceTest, StaysShallowForSortedInsertions) {
+    // boxes along a line are the worst case of an unbalanced insertion, without rotations the tree degenerates into
+    // a list which overflows the fixed traversal stacks
+    BoundingVolumeHierarchy tree;
+    constexpr uint32_t count = 20000;
+    for (uint32_t i = 0; i < count; i++) {
+        const auto x = static_cast<float>(i) * 2.0F;
+        tree.createProxy(Aabb{glm::vec3(x, 0.0F, 0.0F), glm::vec3(x + 1.0F, 1.0F, 1.0F)}, i);
+    }
+
+    std::vector<bool> found(count, false);
+    tree.queryOverlap(Aabb{glm::vec3(-1e9F), glm::vec3(1e9F)}, [&](const BvhProxy proxy) {
+        found[tree.getUserData(proxy)] = true;
+        return true;
+    });
+    EXPECT_EQ(count, static_cast<uint32_t>(std::count(found.begin(), found.end(), true)));
+
+    const auto ray = Ray::create(glm::vec3(-10.0F, 0.5F, 0.5F), glm::vec3(1.0F, 0.0F, 0.0F), 1e9F);
+    const auto hit = tree.raycast(ray, [](const BvhProxy /*proxy*/, const float boxDistance) { return boxDistance; });
+    ASSERT_NE(BVH_NULL, hit.proxy);
+    EXPECT_EQ(0U, tree.getUserData(hit.proxy));
+}
+
+TEST(BoundingVolumeHierarchyEmptyTest, ReportsNothing) {
+    BoundingVolumeHierarchy tree;
+    uint32_t reported = 0;
+    tree.queryOverlap(Aabb{glm::vec3(-1e9F), glm::vec3(1e9F)}, [&reported](const BvhProxy /*proxy*/) {
+        reported++;
+        return true;
+    });
+    EXPECT_EQ(0U, reported);
+    EXPECT_EQ(BVH_NULL, tree.raycast(Ray::create(glm::vec3(0.0F), glm::vec3(1.0F, 0.0F, 0.0F), 100.0F), [](const BvhProxy /*proxy*/, const float distance) { return distance; }).proxy);
+
+    // a tree which lost all of its proxies is empty again
+    const auto proxy = tree.createProxy(Aabb{glm::vec3(0.0F), glm::vec3(1.0F)}, 0);
+    tree.destroyProxy(proxy);
+    EXPECT_EQ(0U, tree.getProxyCount());
+    tree.queryOverlap(Aabb{glm::vec3(-1e9F), glm::vec3(1e9F)}, [&reported](const BvhProxy /*proxy*/) {
+        reported++;
+        return true;
+    });
+    EXPECT_EQ(0U, reported);
+}
@@ -0,0 +1,140 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#include <adelie/core/scene/TransformHierarchy.hxx>
+#include <adelie/exception/RuntimeException.hxx>
+#include <cmath>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <numbers>
+#include <vector>
+
+using adelie::core::scene::Transform;
+using adelie::core::scene::TransformHierarchy;
+using adelie::core::scene::TransformNode;
+using adelie::exception::RuntimeException;
+
+namespace {
+
+    constexpr float TOLERANCE = 1e-5F;
+
+    auto makeTransform(const glm::vec3& position) -> Transform {
+        return {.position = position, .rotation = glm::quat(1.0F, 0.0F, 0.0F, 0.0F), .scale = glm::vec3(1.0F, 1.0F, 1.0F)};
+    }
+
+    // the world position of a node is the translation column of its world matrix
+    auto expectWorldPosition(const TransformHierarchy& hierarchy, const TransformNode node, const glm::vec3& expected) -> void {
+        const auto& world = hierarchy.getWorldMatrix(node);
+        EXPECT_NEAR(expected.x, world[3][0], TOLERANCE);
+        EXPECT_NEAR(expected.y, world[3][1], TOLERANCE);
+        EXPECT_NEAR(expected.z, world[3][2], TOLERANCE);
+    }
+
+    // a root node which is moved by one along x, turned by 90 degrees around z and scaled by two
+    class TransformHierarchyTest : public testing::Test {
+        protected:
+            auto SetUp() -> void override {
+                const auto halfAngle = std::numbers::pi_v<float> / 4.0F;
+                mRoot = mHierarchy.createNode({.position = glm::vec3(1.0F, 0.0F, 0.0F), .rotation = glm::quat(std::cos(halfAngle), 0.0F, 0.0F, std::sin(halfAngle)), .scale = glm::vec3(2.0F, 2.0F, 2.0F)});
+                mChild = mHierarchy.createNode(mRoot, makeTransform(glm::vec3(1.0F, 0.0F, 0.0F)));
+                mGrandchild = mHierarchy.createNode(mChild, makeTransform(glm::vec3(0.0F, 1.0F, 0.0F)));
+                mOther = mHierarchy.createNode(makeTransform(glm::vec3(0.0F, 0.0F, 5.0F)));
+                mHierarchy.update();
+            }
+
+            TransformHierarchy mHierarchy;
+            TransformNode mRoot{};
+            TransformNode mChild{};
+            TransformNode mGrandchild{};
+            TransformNode mOther{};
+    };
+
+} /* namespace */
+
+TEST_F(TransformHierarchyTest, ConcatenatesTheTransformsOfTheAncestors) {
+    expectWorldPosition(mHierarchy, mRoot, glm::vec3(1.0F, 0.0F, 0.0F));
+    expectWorldPosition(mHierarchy, mChild, glm::vec3(1.0F, 2.0F, 0.0F));
+    expectWorldPosition(mHierarchy, mGrandchild, glm::vec3(-1.0F, 2.0F, 0.0F));
+    expectWorldPosition(mHierarchy, mOther, glm::vec3(0.0F, 0.0F, 5.0F));
+}
+
+TEST_F(TransformHierarchyTest, UpdatesOnlyTheChangedNodesAndTheirDescendants) {
+    EXPECT_EQ(0U, mHierarchy.update());
+
+    mHierarchy.setLocal(mChild, makeTransform(glm::vec3(0.0F, 0.0F, 0.0F)));
+    EXPECT_EQ(2U, mHierarchy.update());
+    expectWorldPosition(mHierarchy, mChild, glm::vec3(1.0F, 0.0F, 0.0F));
+    expectWorldPosition(mHierarchy, mGrandchild, glm::vec3(-1.0F, 0.0F, 0.0F));
+    EXPECT_EQ(0U, mHierarchy.update());
+}
+
+TEST_F(TransformHierarchyTest, MovesNodesToTheirNewParent) {
+    mHierarchy.setParent(mChild, mOther);
+    mHierarchy.update();
+    expectWorldPosition(mHierarchy, mChild, glm::vec3(1.0F, 0.0F, 5.0F));
+    expectWorldPosition(mHierarchy, mGrandchild, glm::vec3(1.0F, 1.0F, 5.0F));
+
+    // the other node was created after the child, the sort has to move the parent in front of it again
+    mHierarchy.setParent(mOther, mRoot);
+    mHierarchy.update();
+    expectWorldPosition(mHierarchy, mOther, glm::vec3(1.0F, 0.0F, 10.0F));
+    expectWorldPosition(mHierarchy, mGrandchild, glm::vec3(-1.0F, 2.0F, 10.0F));
+
+    mHierarchy.clearParent(mChild);
+    mHierarchy.update();
+    expectWorldPosition(mHierarchy, mChild, glm::vec3(1.0F, 0.0F, 0.0F));
+    expectWorldPosition(mHierarchy, mGrandchild, glm::vec3(1.0F, 1.0F, 0.0F));
+}
+
+TEST_F(TransformHierarchyTest, RejectsCycles) {
+    EXPECT_THROW(mHierarchy.setParent(mRoot, mRoot), RuntimeException);
+    EXPECT_THROW(mHierarchy.setParent(mRoot, mGrandchild), RuntimeException);
+    EXPECT_THROW(mHierarchy.setParent(mChild, mGrandchild), RuntimeException);
+
+    // the hierarchy is unchanged
+    mHierarchy.update();
+    expectWorldPosition(mHierarchy, mGrandchild, glm::vec3(-1.0F, 2.0F, 0.0F));
+}
+
+TEST_F(TransformHierarchyTest, DestroysTheSubtreeOfADestroyedNode) {
+    mHierarchy.destroyNode(mChild);
+    EXPECT_FALSE(mHierarchy.isAlive(mChild));
+    EXPECT_THROW((void)mHierarchy.getWorldMatrix(mChild), RuntimeException);
+
+    mHierarchy.update();
+    EXPECT_FALSE(mHierarchy.isAlive(mGrandchild));
+    EXPECT_THROW((void)mHierarchy.getWorldMatrix(mGrandchild), RuntimeException);
+    EXPECT_THROW(mHierarchy.createNode(mGrandchild, makeTransform(glm::vec3(0.0F, 0.0F, 0.0F))), RuntimeException);
+    EXPECT_THROW(mHierarchy.setParent(mOther, mChild), RuntimeException);
+    EXPECT_EQ(2U, mHierarchy.getNodeCount());
+
+    // the surviving nodes keep their matrices
+    expectWorldPosition(mHierarchy, mRoot, glm::vec3(1.0F, 0.0F, 0.0F));
+    expectWorldPosition(mHierarchy, mOther, glm::vec3(0.0F, 0.0F, 5.0F));
+
+    // the indices of the destroyed nodes are reused with a new generation, the old handles stay dead
+    const auto first = mHierarchy.createNode(mRoot, makeTransform(glm::vec3(1.0F, 0.0F, 0.0F)));
+    const auto second = mHierarchy.createNode(first, makeTransform(glm::vec3(0.0F, 1.0F, 0.0F)));
+    mHierarchy.update();
+    EXPECT_FALSE(mHierarchy.isAlive(mChild));
+    EXPECT_FALSE(mHierarchy.isAlive(mGrandchild));
+    expectWorldPosition(mHierarchy, second, glm::vec3(-1.0F, 2.0F, 0.0F));
+
+    // destroying a dead node again does nothing
+    mHierarchy.destroyNode(mChild);
+    mHierarchy.update();
+    EXPECT_EQ(4U, mHierarchy.getNodeCount());
+}
+
+TEST(TransformHierarchyLargeTest, MatchesTheMatricesOfADeepChain) {
+    // every link moves one along x, the chain is longer than a batch of the local matrix calculation
+    TransformHierarchy hierarchy;
+    std::vector<TransformNode> chain{hierarchy.createNode(makeTransform(glm::vec3(1.0F, 0.0F, 0.0F)))};
+    for (uint32_t i = 1; i < 37; i++) {
+        chain.push_back(hierarchy.createNode(chain.back(), makeTransform(glm::vec3(1.0F, 0.0F, 0.0F))));
+    }
+    EXPECT_EQ(37U, hierarchy.update());
+
+    for (uint32_t i = 0; i < chain.size(); i++) {
+        expectWorldPosition(hierarchy, chain[i], glm::vec3(static_cast<float>(i + 1), 0.0F, 0.0F));
+    }
+}
@@ -0,0 +1,159 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#include <adelie/core/scene/Entity.hxx>
+#include <adelie/core/scene/World.hxx>
+#include <adelie/exception/RuntimeException.hxx>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <vector>
+
+using adelie::core::scene::Entity;
+using adelie::core::scene::World;
+using adelie::exception::RuntimeException;
+
+namespace {
+
+    struct Position {
+            float x;
+            float y;
+            float z;
+    };
+
+    struct Velocity {
+            float x;
+            float y;
+            float z;
+    };
+
+    struct Health {
+            int32_t value;
+    };
+
+} /* namespace */
+
+TEST(WorldTest, KeepsTheComponentsWhenAnEntityChangesItsArchetype) {
+    World world;
+    const auto entity = world.createEntity();
+    world.addComponent(entity, Position{1.0F, 2.0F, 3.0F});
+    world.addComponent(entity, Velocity{4.0F, 5.0F, 6.0F});
+    world.addComponent(entity, Health{100});
+
+    ASSERT_TRUE(world.hasComponent<Velocity>(entity));
+    world.removeComponent<Velocity>(entity);
+    EXPECT_FALSE(world.hasComponent<Velocity>(entity));
+    EXPECT_EQ(nullptr, world.getComponent<Velocity>(entity));
+
+    const auto* position = world.getComponent<Position>(entity);
+    ASSERT_NE(nullptr, position);
+    EXPECT_FLOAT_EQ(1.0F, position->x);
+    EXPECT_FLOAT_EQ(2.0F, position->y);
+    EXPECT_FLOAT_EQ(3.0F, position->z);
+
+    const auto* health = world.getComponent<Health>(entity);
+    ASSERT_NE(nullptr, health);
+    EXPECT_EQ(100, health->value);
+
+    // adding a component the entity already has overwrites it in place
+    world.addComponent(entity, Health{50});
+    EXPECT_EQ(50, world.getComponent<Health>(entity)->value);
+
+    // removing a component the entity does not have changes nothing
+    world.removeComponent<Velocity>(entity);
+    EXPECT_EQ(50, world.getComponent<Health>(entity)->value);
+}
+
+TEST(WorldTest, KeepsTheOtherEntitiesWhenAnArchetypeIsCompacted) {
+    World world;
+    std::vector<Entity> entities;
+    for (int32_t i = 0; i < 10000; i++) {
+        const auto entity = world.createEntity();
+        world.addComponent(entity, Health{i});
+        if (i % 2 == 0) {
+            world.addComponent(entity, Position{static_cast<float>(i), 0.0F, 0.0F});
+        }
+        entities.push_back(entity);
+    }
+
+    // every move and every destroyed entity fills its hole with the last entity of the archetype
+    for (int32_t i = 0; i < 10000; i += 3) {
+        world.removeComponent<Health>(entities[i]);
+    }
+    for (int32_t i = 1; i < 10000; i += 5) {
+        world.destroyEntity(entities[i]);
+    }
+
+    for (int32_t i = 0; i < 10000; i++) {
+        const auto entity = entities[i];
+        if (i % 5 == 1) {
+            ASSERT_FALSE(world.isAlive(entity));
+            continue;
+        }
+
+        const auto* health = world.getComponent<Health>(entity);
+        if (i % 3 == 0) {
+            ASSERT_EQ(nullptr, health) << "entity " << i;
+        } else {
+            ASSERT_NE(nullptr, health) << "entity " << i;
+            ASSERT_EQ(i, health->value);
+        }
+
+        const auto* position = world.getComponent<Position>(entity);
+        if (i % 2 == 0) {
+            ASSERT_NE(nullptr, position) << "entity " << i;
+            ASSERT_FLOAT_EQ(static_cast<float>(i), position->x);
+        } else {
+            ASSERT_EQ(nullptr, position) << "entity " << i;
+        }
+    }
+}
+
+TEST(WorldTest, VisitsEveryEntityWithTheRequestedComponents) {
+    World world;
+    for (int32_t i = 0; i < 1000; i++) {
+        const auto entity = world.createEntity();
+        world.addComponent(entity, Position{static_cast<float>(i), 0.0F, 0.0F});
+        if (i % 4 == 0) {
+            world.addComponent(entity, Velocity{1.0F, 0.0F, 0.0F});
+        }
+    }
+
+    world.each<Position, const Velocity>([](Position& position, const Velocity& velocity) { position.x += velocity.x; });
+
+    uint32_t moving = 0;
+    uint32_t all = 0;
+    float sum = 0.0F;
+    world.each<const Velocity>([&moving](const Velocity& /*velocity*/) { moving++; });
+    world.each<const Position>([&](const Position& position) {
+        all++;
+        sum += position.x;
+    });
+    EXPECT_EQ(250U, moving);
+    EXPECT_EQ(1000U, all);
+    EXPECT_FLOAT_EQ(999.0F * 1000.0F / 2.0F + 250.0F, sum);
+}
+
+TEST(WorldTest, InvalidatesTheHandlesOfDestroyedEntities) {
+    World world;
+    const auto entity = world.createEntity();
+    world.addComponent(entity, Health{1});
+    world.destroyEntity(entity);
+
+    EXPECT_FALSE(world.isAlive(entity));
+    EXPECT_FALSE(world.hasComponent<Health>(entity));
+    EXPECT_EQ(nullptr, world.getComponent<Health>(entity));
+    EXPECT_THROW(world.addComponent(entity, Health{2}), RuntimeException);
+    EXPECT_EQ(0U, world.getEntityCount());
+
+    // the index is reused with the next generation, the old handle stays dead
+    const auto successor = world.createEntity();
+    EXPECT_EQ(entity.index, successor.index);
+    EXPECT_NE(entity.generation, successor.generation);
+    EXPECT_TRUE(world.isAlive(successor));
+    EXPECT_FALSE(world.isAlive(entity));
+    EXPECT_FALSE(world.hasComponent<Health>(successor));
+
+    // destroying a dead entity again does nothing
+    world.destroyEntity(entity);
+    EXPECT_TRUE(world.isAlive(successor));
+    EXPECT_EQ(1U, world.getEntityCount());
+}
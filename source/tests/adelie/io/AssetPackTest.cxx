@@ -0,0 +1,171 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#include <adelie/exception/IOException.hxx>
+#include <adelie/io/AssetPack.hxx>
+#include <adelie/io/Hash.hxx>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using adelie::exception::IOException;
+using adelie::io::AssetCompression;
+using adelie::io::AssetPack;
+using adelie::io::AssetPackEntry;
+using adelie::io::AssetPackHeader;
+using adelie::io::AssetPackWriter;
+using adelie::io::hashBytes;
+using adelie::io::hashPath;
+
+namespace {
+
+    auto toBytes(const std::string& text) -> std::vector<std::byte> {
+        std::vector<std::byte> bytes(text.size());
+        std::memcpy(bytes.data(), text.data(), text.size());
+        return bytes;
+    }
+
+    auto readFile(const std::filesystem::path& path) -> std::vector<char> {
+        std::ifstream stream(path, std::ios::binary);
+        return {std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>()};
+    }
+
+    auto writeFile(const std::filesystem::path& path, const std::vector<char>& content) -> void {
+        std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+        stream.write(content.data(), static_cast<std::streamsize>(content.size()));
+    }
+
+    class AssetPackTest : public testing::Test {
+        protected:
+            auto SetUp() -> void override {
+                mDirectory = std::filesystem::temp_directory_path() / ("adelie_asset_pack_test_" + std::string(testing::UnitTest::GetInstance()->current_test_info()->name()));
+                std::filesystem::create_directories(mDirectory);
+                mFilename = (mDirectory / "test.adpk").string();
+
+                std::string shader(20000, ' ');
+                for (std::size_t i = 0; i < shader.size(); i++) {
+                    shader[i] = "void main() { gl_Position = vec4(0.0); }\n"[i % 41];
+                }
+                mShader = toBytes(shader);
+                mTexture = toBytes("not really a png, stored as it is");
+
+                AssetPackWriter writer;
+                writer.add("shader/cube.vert", mShader, AssetCompression::Lz4);
+                writer.add("textures/albedo.png", mTexture, AssetCompression::None);
+                writer.add("empty.txt", {}, AssetCompression::Lz4);
+                writer.write(mFilename);
+            }
+
+            auto TearDown() -> void override { std::filesystem::remove_all(mDirectory); }
+
+            std::filesystem::path mDirectory;
+            std::string mFilename;
+            std::vector<std::byte> mShader;
+            std::vector<std::byte> mTexture;
+    };
+
+} /* namespace */
+
+TEST_F(AssetPackTest, FindsEveryEntryByItsPath) {
+    const AssetPack pack(mFilename);
+    EXPECT_EQ(3U, pack.getEntries().size());
+
+    const auto* shader = pack.find("shader/cube.vert");
+    ASSERT_NE(nullptr, shader);
+    EXPECT_EQ(hashPath("shader/cube.vert"), shader->pathHash);
+    EXPECT_EQ(AssetCompression::Lz4, shader->compression);
+    EXPECT_LT(shader->storedSize, shader->size);
+
+    // backslashes resolve to the same entry, the lookup is case-sensitive
+    EXPECT_EQ(shader, pack.find("shader\\cube.vert"));
+    EXPECT_EQ(nullptr, pack.find("Shader/cube.vert"));
+    EXPECT_FALSE(pack.contains("shader/missing.vert"));
+    EXPECT_TRUE(pack.contains("empty.txt"));
+}
+
+TEST_F(AssetPackTest, ReadsCompressedAndUncompressedEntries) {
+    const AssetPack pack(mFilename);
+
+    const auto* shader = pack.find("shader/cube.vert");
+    ASSERT_NE(nullptr, shader);
+    EXPECT_EQ(mShader, pack.read(*shader));
+    EXPECT_EQ(hashBytes(mShader), shader->contentHash);
+
+    const auto* texture = pack.find("textures/albedo.png");
+    ASSERT_NE(nullptr, texture);
+    EXPECT_EQ(AssetCompression::None, texture->compression);
+    EXPECT_EQ(texture->offset % adelie::io::ASSET_PACK_ALIGNMENT, 0U);
+    const auto view = pack.view(*texture);
+    EXPECT_EQ(mTexture, std::vector<std::byte>(view.begin(), view.end()));
+
+    const auto* empty = pack.find("empty.txt");
+    ASSERT_NE(nullptr, empty);
+    EXPECT_TRUE(pack.read(*empty).empty());
+
+    const std::vector<const AssetPackEntry*> entries{texture, shader};
+    const auto many = pack.readMany(entries);
+    ASSERT_EQ(2U, many.size());
+    EXPECT_EQ(mTexture, many[0]);
+    EXPECT_EQ(mShader, many[1]);
+}
+
+TEST_F(AssetPackTest, RejectsFilesWhichAreNoAssetPack) {
+    auto content = readFile(mFilename);
+
+    writeFile(mFilename, std::vector<char>(content.begin(), content.begin() + sizeof(AssetPackHeader) - 1));
+    EXPECT_THROW(AssetPack{mFilename}, IOException);
+
+    auto corrupted = content;
+    corrupted[0] = 'X';
+    writeFile(mFilename, corrupted);
+    EXPECT_THROW(AssetPack{mFilename}, IOException);
+}
+
+TEST_F(AssetPackTest, RejectsAnIndexOutOfBounds) {
+    auto content = readFile(mFilename);
+    AssetPackHeader header{};
+    std::memcpy(&header, content.data(), sizeof(header));
+
+    // the index is cut off at the end of the file
+    writeFile(mFilename, std::vector<char>(content.begin(), content.end() - 1));
+    EXPECT_THROW(AssetPack{mFilename}, IOException);
+
+    auto corrupted = content;
+    header.entryCount++;
+    std::memcpy(corrupted.data(), &header, sizeof(header));
+    writeFile(mFilename, corrupted);
+    EXPECT_THROW(AssetPack{mFilename}, IOException);
+}
+
+TEST_F(AssetPackTest, RejectsEntriesOutOfBounds) {
+    const auto content = readFile(mFilename);
+    AssetPackHeader header{};
+    std::memcpy(&header, content.data(), sizeof(header));
+
+    const auto corruptEntry = [&](const auto& modify) {
+        auto corrupted = content;
+        AssetPackEntry entry{};
+        std::memcpy(&entry, corrupted.data() + header.indexOffset, sizeof(entry));
+        modify(entry);
+        std::memcpy(corrupted.data() + header.indexOffset, &entry, sizeof(entry));
+        writeFile(mFilename, corrupted);
+    };
+
+    corruptEntry([&](AssetPackEntry& entry) { entry.offset = content.size() + 1; });
+    EXPECT_THROW(AssetPack{mFilename}, IOException);
+
+    corruptEntry([&](AssetPackEntry& entry) { entry.storedSize = content.size(); });
+    EXPECT_THROW(AssetPack{mFilename}, IOException);
+
+    // an offset close to the end of the address range must not wrap around when the size is added
+    corruptEntry([](AssetPackEntry& entry) {
+        entry.offset = UINT64_MAX - 8;
+        entry.storedSize = 16;
+    });
+    EXPECT_THROW(AssetPack{mFilename}, IOException);
+}
@@ -0,0 +1,108 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#include <adelie/io/Blob.hxx>
+#include <adelie/io/BlobCache.hxx>
+#include <adelie/io/Hash.hxx>
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+using adelie::io::Blob;
+using adelie::io::BlobCache;
+using adelie::io::hashPath;
+
+namespace {
+
+    auto makeBlob(const std::size_t size) -> std::shared_ptr<const Blob> {
+        return std::make_shared<const Blob>(std::vector<std::byte>(size, std::byte{0x2a}));
+    }
+
+    auto insert(BlobCache& cache, const std::string_view path, std::shared_ptr<const Blob> blob) -> void {
+        cache.insert(hashPath(path), path, std::move(blob));
+    }
+
+    auto contains(BlobCache& cache, const std::string_view path) -> bool {
+        return nullptr != cache.find(hashPath(path), path);
+    }
+
+} /* namespace */
+
+TEST(BlobCacheTest, CountsHitsAndMisses) {
+    BlobCache cache(1000);
+    const auto blob = makeBlob(100);
+    insert(cache, "a", blob);
+
+    EXPECT_EQ(blob, cache.find(hashPath("a"), "a"));
+    EXPECT_EQ(nullptr, cache.find(hashPath("b"), "b"));
+    EXPECT_EQ(1U, cache.getHitCount());
+    EXPECT_EQ(1U, cache.getMissCount());
+    EXPECT_EQ(100U, cache.getSize());
+}
+
+TEST(BlobCacheTest, EvictsTheLeastRecentlyUsedBlobsFirst) {
+    BlobCache cache(300);
+    insert(cache, "a", makeBlob(100));
+    insert(cache, "b", makeBlob(100));
+    insert(cache, "c", makeBlob(100));
+
+    // touching "a" makes "b" the least recently used blob
+    EXPECT_TRUE(contains(cache, "a"));
+    insert(cache, "d", makeBlob(100));
+
+    EXPECT_FALSE(contains(cache, "b"));
+    EXPECT_TRUE(contains(cache, "a"));
+    EXPECT_TRUE(contains(cache, "c"));
+    EXPECT_TRUE(contains(cache, "d"));
+    EXPECT_EQ(300U, cache.getSize());
+
+    // a large blob evicts as many blobs as it needs
+    insert(cache, "e", makeBlob(250));
+    EXPECT_EQ(250U, cache.getSize());
+    EXPECT_TRUE(contains(cache, "e"));
+}
+
+TEST(BlobCacheTest, NeverExceedsTheBudget) {
+    BlobCache cache(300);
+    insert(cache, "a", makeBlob(100));
+    insert(cache, "b", makeBlob(100));
+    insert(cache, "c", makeBlob(100));
+
+    // blobs larger than the whole budget are not cached and do not evict anything
+    insert(cache, "huge", makeBlob(301));
+    EXPECT_FALSE(contains(cache, "huge"));
+    EXPECT_EQ(300U, cache.getSize());
+
+    // a smaller budget evicts right away
+    cache.setBudget(150);
+    EXPECT_EQ(100U, cache.getSize());
+    EXPECT_TRUE(contains(cache, "c"));
+    EXPECT_FALSE(contains(cache, "a"));
+    EXPECT_FALSE(contains(cache, "b"));
+}
+
+TEST(BlobCacheTest, ReplacesABlobInsertedTwice) {
+    BlobCache cache(300);
+    insert(cache, "a", makeBlob(100));
+
+    const auto newer = makeBlob(150);
+    insert(cache, "a", newer);
+    EXPECT_EQ(150U, cache.getSize());
+    EXPECT_EQ(newer, cache.find(hashPath("a"), "a"));
+
+    cache.erase(hashPath("a"));
+    EXPECT_EQ(0U, cache.getSize());
+    EXPECT_FALSE(contains(cache, "a"));
+}
+
+TEST(BlobCacheTest, KeepsEvictedBlobsAliveWhileTheyAreReferenced) {
+    BlobCache cache(100);
+    auto blob = makeBlob(100);
+    insert(cache, "a", blob);
+    insert(cache, "b", makeBlob(100));
+
+    EXPECT_FALSE(contains(cache, "a"));
+    EXPECT_EQ(100U, blob->getSize());
+    EXPECT_EQ(std::byte{0x2a}, blob->getData()[99]);
+}
@@ -0,0 +1,100 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#include <adelie/exception/IOException.hxx>
+#include <adelie/io/Lz4.hxx>
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <random>
+#include <string_view>
+#include <vector>
+
+using adelie::exception::IOException;
+using adelie::io::Lz4;
+
+namespace {
+
+    auto makeRandomBytes(const std::size_t size, const uint32_t seed) -> std::vector<std::byte> {
+        std::mt19937 generator(seed);
+        std::vector<std::byte> bytes(size);
+        for (auto& byte : bytes) {
+            byte = static_cast<std::byte>(generator());
+        }
+        return bytes;
+    }
+
+    auto makeText(const std::size_t size) -> std::vector<std::byte> {
+        constexpr std::string_view words = "the quick brown fox jumps over the lazy dog while the penguin waddles along ";
+        std::vector<std::byte> bytes(size);
+        for (std::size_t i = 0; i < size; i++) {
+            bytes[i] = static_cast<std::byte>(words[(i * 7 + i / 13) % words.size()]);
+        }
+        return bytes;
+    }
+
+    auto roundTrip(const std::vector<std::byte>& source) -> std::vector<std::byte> {
+        const auto compressed = Lz4::compress(source);
+        EXPECT_LE(compressed.size(), Lz4::getMaxCompressedSize(source.size()));
+
+        std::vector<std::byte> decompressed(source.size());
+        Lz4::decompress(compressed, decompressed);
+        return decompressed;
+    }
+
+} /* namespace */
+
+TEST(Lz4Test, RoundTripsEmptyInput) {
+    const std::vector<std::byte> source;
+    EXPECT_EQ(source, roundTrip(source));
+}
+
+TEST(Lz4Test, RoundTripsInputShorterThanAMatch) {
+    for (std::size_t size = 1; size < 16; size++) {
+        const auto source = makeRandomBytes(size, static_cast<uint32_t>(size));
+        EXPECT_EQ(source, roundTrip(source)) << "size " << size;
+    }
+}
+
+TEST(Lz4Test, RoundTripsIncompressibleInput) {
+    const auto source = makeRandomBytes(256 * 1024, 1);
+    EXPECT_EQ(source, roundTrip(source));
+}
+
+TEST(Lz4Test, RoundTripsAndShrinksRepetitiveInput) {
+    const auto text = makeText(300 * 1024);
+    EXPECT_EQ(text, roundTrip(text));
+    EXPECT_LT(Lz4::compress(text).size(), text.size() / 4);
+
+    // a run of one byte is encoded as matches which overlap their own output
+    const std::vector<std::byte> zeros(100000, std::byte{0});
+    EXPECT_EQ(zeros, roundTrip(zeros));
+    EXPECT_LT(Lz4::compress(zeros).size(), zeros.size() / 100);
+}
+
+TEST(Lz4Test, RejectsTruncatedInput) {
+    const auto source = makeText(4096);
+    const auto compressed = Lz4::compress(source);
+
+    std::vector<std::byte> decompressed(source.size());
+    const std::vector<std::byte> truncated(compressed.begin(), compressed.begin() + static_cast<std::ptrdiff_t>(compressed.size() / 2));
+    EXPECT_THROW(Lz4::decompress(truncated, decompressed), IOException);
+    EXPECT_THROW(Lz4::decompress({}, decompressed), IOException);
+}
+
+TEST(Lz4Test, RejectsADestinationOfTheWrongSize) {
+    const auto source = makeText(4096);
+    const auto compressed = Lz4::compress(source);
+
+    std::vector<std::byte> tooSmall(source.size() - 1);
+    EXPECT_THROW(Lz4::decompress(compressed, tooSmall), IOException);
+
+    std::vector<std::byte> tooLarge(source.size() + 1);
+    EXPECT_THROW(Lz4::decompress(compressed, tooLarge), IOException);
+}
+
+TEST(Lz4Test, RejectsMatchesBeforeTheStartOfTheOutput) {
+    // a token with one literal and a match, followed by an offset reaching in front of the output
+    const std::vector<std::byte> malformed{std::byte{0x10}, std::byte{'a'}, std::byte{0x10}, std::byte{0x00}, std::byte{0x00}};
+    std::vector<std::byte> decompressed(64);
+    EXPECT_THROW(Lz4::decompress(malformed, decompressed), IOException);
+}
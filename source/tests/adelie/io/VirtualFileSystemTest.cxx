@@ -0,0 +1,122 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#include <adelie/exception/IOException.hxx>
+#include <adelie/io/DirectoryMount.hxx>
+#include <adelie/io/VirtualFileSystem.hxx>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <string_view>
+
+using adelie::exception::IOException;
+using adelie::io::DirectoryMount;
+using adelie::io::VFS_DEFAULT_CACHE_BUDGET;
+using adelie::io::VirtualFileSystem;
+
+namespace {
+
+    auto writeFile(const std::filesystem::path& path, const std::string_view content) -> void {
+        std::filesystem::create_directories(path.parent_path());
+        std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+        stream.write(content.data(), static_cast<std::streamsize>(content.size()));
+    }
+
+    auto toString(const adelie::io::Blob& blob) -> std::string {
+        const auto data = blob.getData();
+        return {reinterpret_cast<const char*>(data.data()), data.size()};  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    }
+
+    class VirtualFileSystemTest : public testing::Test {
+        protected:
+            auto SetUp() -> void override {
+                mDirectory = std::filesystem::temp_directory_path() / ("adelie_vfs_test_" + std::string(testing::UnitTest::GetInstance()->current_test_info()->name()));
+                writeFile(mDirectory / "base" / "shader" / "cube.vert", "base vertex shader");
+                writeFile(mDirectory / "base" / "shader" / "cube.frag", "base fragment shader");
+                writeFile(mDirectory / "patch" / "shader" / "cube.frag", "patched fragment shader");
+                writeFile(mDirectory / "extra" / "readme.txt", "mounted below a mount point");
+            }
+
+            auto TearDown() -> void override {
+                auto* fileSystem = VirtualFileSystem::getInstance();
+                fileSystem->unmount("");
+                fileSystem->unmount("extra");
+                fileSystem->setCacheBudget(VFS_DEFAULT_CACHE_BUDGET);
+                std::filesystem::remove_all(mDirectory);
+            }
+
+            std::filesystem::path mDirectory;
+    };
+
+} /* namespace */
+
+TEST(VirtualFileSystemPathTest, NormalizesSeparatorsAndDots) {
+    EXPECT_EQ("shader/cube.vert", VirtualFileSystem::normalizePath("shader/cube.vert"));
+    EXPECT_EQ("shader/cube.vert", VirtualFileSystem::normalizePath("./shader//cube.vert"));
+    EXPECT_EQ("shader/cube.vert", VirtualFileSystem::normalizePath("/shader/./cube.vert/"));
+    EXPECT_EQ("shader/cube.vert", VirtualFileSystem::normalizePath("shader\\cube.vert"));
+    EXPECT_EQ("a/b", VirtualFileSystem::normalizePath("\\a\\\\b\\"));
+    EXPECT_EQ("", VirtualFileSystem::normalizePath(""));
+    EXPECT_EQ("", VirtualFileSystem::normalizePath("./"));
+
+    // dots inside a segment are part of the name
+    EXPECT_EQ("a/..b/c..", VirtualFileSystem::normalizePath("a/..b/c.."));
+}
+
+TEST(VirtualFileSystemPathTest, RejectsPathsLeavingTheRoot) {
+    EXPECT_THROW((void)VirtualFileSystem::normalizePath(".."), IOException);
+    EXPECT_THROW((void)VirtualFileSystem::normalizePath("../shader/cube.vert"), IOException);
+    EXPECT_THROW((void)VirtualFileSystem::normalizePath("shader/../../cube.vert"), IOException);
+    EXPECT_THROW((void)VirtualFileSystem::normalizePath("shader\\..\\..\\cube.vert"), IOException);
+}
+
+TEST_F(VirtualFileSystemTest, LaterMountsShadowEarlierOnes) {
+    auto* fileSystem = VirtualFileSystem::getInstance();
+    fileSystem->mount("", std::make_shared<DirectoryMount>(mDirectory / "base"));
+    EXPECT_EQ("base fragment shader", toString(*fileSystem->read("shader/cube.frag")));
+
+    fileSystem->mount("", std::make_shared<DirectoryMount>(mDirectory / "patch"));
+    EXPECT_EQ("patched fragment shader", toString(*fileSystem->read("shader/cube.frag")));
+    EXPECT_EQ("base vertex shader", toString(*fileSystem->read("./shader\\cube.vert")));
+
+    EXPECT_TRUE(fileSystem->exists("shader/cube.vert"));
+    EXPECT_FALSE(fileSystem->exists("shader/missing.vert"));
+    EXPECT_THROW((void)fileSystem->read("shader/missing.vert"), IOException);
+
+    // directories are no files
+    EXPECT_THROW((void)fileSystem->read("shader"), IOException);
+}
+
+TEST_F(VirtualFileSystemTest, ResolvesPathsBelowAMountPoint) {
+    auto* fileSystem = VirtualFileSystem::getInstance();
+    fileSystem->mount("extra", std::make_shared<DirectoryMount>(mDirectory / "extra"));
+
+    EXPECT_TRUE(fileSystem->exists("extra/readme.txt"));
+    EXPECT_EQ("mounted below a mount point", toString(*fileSystem->read("/extra//readme.txt")));
+    EXPECT_FALSE(fileSystem->exists("readme.txt"));
+
+    fileSystem->unmount("extra");
+    EXPECT_FALSE(fileSystem->exists("extra/readme.txt"));
+}
+
+TEST_F(VirtualFileSystemTest, CachesReadsUntilTheyAreInvalidated) {
+    auto* fileSystem = VirtualFileSystem::getInstance();
+    fileSystem->mount("", std::make_shared<DirectoryMount>(mDirectory / "base"));
+
+    const auto first = fileSystem->read("shader/cube.vert");
+    const auto second = fileSystem->read("shader\\cube.vert");
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(first->getSize(), fileSystem->getCache().getSize());
+
+    writeFile(mDirectory / "base" / "shader" / "cube.vert", "changed vertex shader");
+    EXPECT_EQ("base vertex shader", toString(*fileSystem->read("shader/cube.vert")));
+
+    fileSystem->invalidate("shader/cube.vert");
+    EXPECT_EQ("changed vertex shader", toString(*fileSystem->read("shader/cube.vert")));
+
+    // a budget too small for the file leaves it uncached
+    fileSystem->setCacheBudget(4);
+    EXPECT_EQ(0U, fileSystem->getCache().getSize());
+    EXPECT_NE(fileSystem->read("shader/cube.vert"), fileSystem->read("shader/cube.vert"));
+}
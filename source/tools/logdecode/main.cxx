@@ -0,0 +1,288 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#include <Adelie.hxx>
+#include <bit>
+#include <charconv>
+#include <cstdio>
+#include <cstring>
+#include <format>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+using adelie::exception::RuntimeException;
+using adelie::io::BINARY_LOG_MAGIC;
+using adelie::io::BINARY_LOG_VERSION;
+using adelie::io::BinaryLogArgumentType;
+using adelie::io::BinaryLogFileHeader;
+using adelie::io::BinaryLogFormatHeader;
+using adelie::io::BinaryLogRecordHeader;
+using adelie::io::BinaryLogRecordType;
+using adelie::io::Logger;
+using adelie::io::LoggingLevel;
+using adelie::io::MemoryMappedFile;
+
+namespace {
+    struct Format {
+            LoggingLevel level;
+            std::string fileName;
+            uint32_t line;
+            std::string format;
+    };
+
+    using Argument = std::variant<bool, char, int64_t, uint64_t, float, double, const void*, std::string>;
+
+    // reads values from a record without running past its end
+    class Reader {
+        public:
+            Reader(const std::byte* data, const std::size_t size) {
+                mData = data;
+                mSize = size;
+                mPosition = 0;
+            }
+
+            template <typename T>
+            auto read() -> std::optional<T> {
+                if (mPosition + sizeof(T) > mSize) {
+                    return std::nullopt;
+                }
+                T value;
+                std::memcpy(&value, mData + mPosition, sizeof(T));
+                mPosition += sizeof(T);
+                return value;
+            }
+
+            auto readString(const std::size_t length) -> std::optional<std::string> {
+                if (mPosition + length > mSize) {
+                    return std::nullopt;
+                }
+                std::string value(reinterpret_cast<const char*>(mData + mPosition), length);  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+                mPosition += length;
+                return value;
+            }
+
+        private:
+            const std::byte* mData;
+            std::size_t mSize;
+            std::size_t mPosition;
+    };
+
+    auto readArgument(Reader& reader) -> std::optional<Argument> {
+        const auto type = reader.read<BinaryLogArgumentType>();
+        if (!type) {
+            return std::nullopt;
+        }
+
+        if (BinaryLogArgumentType::String == *type) {
+            const auto length = reader.read<uint32_t>();
+            if (!length) {
+                return std::nullopt;
+            }
+            return reader.readString(*length);
+        }
+
+        const auto value = reader.read<uint64_t>();
+        if (!value) {
+            return std::nullopt;
+        }
+        switch (*type) {
+            case BinaryLogArgumentType::Bool:
+                return Argument(0 != *value);
+            case BinaryLogArgumentType::Char:
+                return Argument(static_cast<char>(*value));
+            case BinaryLogArgumentType::Signed:
+                return Argument(static_cast<int64_t>(*value));
+            case BinaryLogArgumentType::Unsigned:
+                return Argument(*value);
+            case BinaryLogArgumentType::Float:
+                return Argument(static_cast<float>(std::bit_cast<double>(*value)));
+            case BinaryLogArgumentType::Double:
+                return Argument(std::bit_cast<double>(*value));
+            case BinaryLogArgumentType::Pointer:
+                return Argument(reinterpret_cast<const void*>(static_cast<std::uintptr_t>(*value)));  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast, performance-no-int-to-ptr)
+            default:
+                return std::nullopt;
+        }
+    }
+
+    auto formatArgument(const Argument& argument, const std::string_view specification) -> std::string {
+        const auto fieldFormat = "{" + std::string(specification) + "}";
+        try {
+            return std::visit([&fieldFormat](const auto& value) { return std::vformat(fieldFormat, std::make_format_args(value)); }, argument);
+        } catch (...) {
+            // e.g. a specification of a type which was stored as its text
+            return std::visit([](const auto& value) { return std::vformat("{}", std::make_format_args(value)); }, argument);
+        }
+    }
+
+    // replaces the fields of the format string like std::format does. Every field is formatted on its own, so nested
+    // fields (a width or precision taken from an argument) and named fields are not supported, they are kept verbatim
+    auto formatMessage(const std::string_view format, const std::vector<Argument>& arguments) -> std::string {
+        std::string message;
+        std::size_t nextArgument = 0;
+
+        for (std::size_t i = 0; i < format.size(); i++) {
+            const auto character = format[i];
+            if ('}' == character) {
+                message.push_back('}');
+                if (i + 1 < format.size() && '}' == format[i + 1]) {
+                    i++;
+                }
+                continue;
+            }
+            if ('{' != character) {
+                message.push_back(character);
+                continue;
+            }
+            if (i + 1 < format.size() && '{' == format[i + 1]) {
+                message.push_back('{');
+                i++;
+                continue;
+            }
+
+            // the closing brace of the field, skipping the ones of nested fields
+            auto end = i + 1;
+            std::size_t nestedFields = 0;
+            for (std::size_t depth = 1; end < format.size(); end++) {
+                if ('{' == format[end]) {
+                    depth++;
+                    nestedFields++;
+                } else if ('}' == format[end] && 0 == --depth) {
+                    break;
+                }
+            }
+            if (end >= format.size()) {
+                message.append(format.substr(i));
+                break;
+            }
+
+            const auto field = format.substr(i + 1, end - i - 1);
+            const auto colon = field.find(':');
+            const auto argumentId = field.substr(0, colon);
+            const auto specification = std::string_view::npos == colon ? std::string_view() : field.substr(colon);
+
+            // an argument id which is not a plain index (e.g. a name) does not parse completely
+            std::size_t index = 0;
+            const auto [parsed, error] = std::from_chars(argumentId.data(), argumentId.data() + argumentId.size(), index);
+            const auto isIndex = argumentId.empty() || (std::errc() == error && argumentId.data() + argumentId.size() == parsed);
+            if (0 != nestedFields || !isIndex) {
+                // the automatic numbering of the following fields still counts the arguments of the nested fields
+                if (argumentId.empty()) {
+                    nextArgument += 1 + nestedFields;
+                }
+                message.append(format.substr(i, end - i + 1));
+                i = end;
+                continue;
+            }
+
+            if (argumentId.empty()) {
+                index = nextArgument++;
+            }
+
+            if (index < arguments.size()) {
+                message.append(formatArgument(arguments[index], specification));
+            } else {
+                message.append("{?}");
+            }
+            i = end;
+        }
+
+        return message;
+    }
+}  // namespace
+
+auto main(int argc, char** argv) -> int {
+    if (argc != 2) {
+        std::cerr << "usage: adelie_logdecode <binary log>" << std::endl;
+        return 1;
+    }
+
+    try {
+        const MemoryMappedFile file(argv[1]);
+        const auto data = file.getData();
+
+        BinaryLogFileHeader fileHeader{};
+        if (data.size() < sizeof(fileHeader)) {
+            std::cerr << "Not a binary log: " << argv[1] << std::endl;
+            return 1;
+        }
+        std::memcpy(&fileHeader, data.data(), sizeof(fileHeader));
+        if (fileHeader.magic != BINARY_LOG_MAGIC || fileHeader.version != BINARY_LOG_VERSION) {
+            std::cerr << "Not a binary log or an unsupported version: " << argv[1] << std::endl;
+            return 1;
+        }
+
+        std::unordered_map<uint32_t, Format> formats;
+        std::string output;
+        uint64_t messages = 0;
+
+        // the records end at the first one which was never completed, or at the end of the file
+        auto position = sizeof(fileHeader);
+        while (position + sizeof(BinaryLogRecordHeader) <= data.size()) {
+            BinaryLogRecordHeader recordHeader{};
+            std::memcpy(&recordHeader, data.data() + position, sizeof(recordHeader));
+            if (recordHeader.size < sizeof(recordHeader) || position + recordHeader.size > data.size()) {
+                break;
+            }
+
+            Reader reader(data.data() + position + sizeof(recordHeader), recordHeader.size - sizeof(recordHeader));
+            position += recordHeader.size;
+
+            if (BinaryLogRecordType::Format == recordHeader.type) {
+                const auto formatHeader = reader.read<BinaryLogFormatHeader>();
+                if (!formatHeader) {
+                    continue;
+                }
+                auto fileName = reader.readString(formatHeader->fileNameLength);
+                auto format = reader.readString(formatHeader->formatLength);
+                formats[recordHeader.formatId] = {static_cast<LoggingLevel>(formatHeader->level), fileName.value_or(""), formatHeader->line, format.value_or("")};
+                continue;
+            }
+
+            std::vector<Argument> arguments;
+            for (uint16_t i = 0; i < recordHeader.argumentCount; i++) {
+                auto argument = readArgument(reader);
+                if (!argument) {
+                    break;
+                }
+                arguments.push_back(std::move(*argument));
+            }
+
+            std::array<char, adelie::io::MAX_LOGGING_TIME_LINE_SIZE> timeAsString{};
+            snprintf(timeAsString.data(), timeAsString.size(), "%10.4f", static_cast<double>(recordHeader.timestamp) / 1e9);
+
+            const auto format = formats.find(recordHeader.formatId);
+            if (formats.end() == format) {
+                output.append(std::format("[{}][?????] <unknown format {}>\n", timeAsString.data(), recordHeader.formatId));
+            } else {
+                output.append(std::format("[{}][{}] {}\n", timeAsString.data(), Logger::getLevelName(format->second.level), formatMessage(format->second.format, arguments)));
+            }
+            messages++;
+
+            if (output.size() > 1024 * 1024) {
+                std::cout.write(output.data(), static_cast<std::streamsize>(output.size()));
+                output.clear();
+            }
+        }
+        std::cout.write(output.data(), static_cast<std::streamsize>(output.size()));
+        std::cout.flush();
+
+        std::cerr << "Decoded " << messages << " message(s)";
+        if (fileHeader.droppedRecords > 0) {
+            std::cerr << ", " << fileHeader.droppedRecords << " message(s) were dropped because the log was full";
+        }
+        std::cerr << std::endl;
+    } catch (const RuntimeException& exception) {
+        std::cerr << "Failed to decode log: " << exception.getMessage() << std::endl;
+        return 1;
+    } catch (const std::exception& exception) {
+        std::cerr << "Failed to decode log: " << exception.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
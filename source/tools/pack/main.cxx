@@ -0,0 +1,75 @@
+// Copyright (c) 2025 by Tim Janke. All rights reserved.
+
+#include <Adelie.hxx>
+#include <adelie/exception/IOException.hxx>
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <span>
+#include <string>
+#include <vector>
+
+using adelie::exception::IOException;
+using adelie::exception::RuntimeException;
+using adelie::io::AssetCompression;
+using adelie::io::AssetPackWriter;
+
+namespace {
+    // file formats which are compressed already would only cost decompression time, they are stored as they are and
+    // can be used directly from the mapping
+    auto shouldCompress(const std::filesystem::path& path) -> bool {
+        const auto extension = path.extension().string();
+        return extension != ".png" && extension != ".jpg" && extension != ".jpeg" && extension != ".ktx2";
+    }
+}  // namespace
+
+auto main(int argc, char** argv) -> int {
+    if (argc != 3) {
+        std::cerr << "usage: adelie_pack <output.adpk> <asset directory>" << std::endl;
+        return 1;
+    }
+
+    const std::filesystem::path output(argv[1]);
+    const std::filesystem::path root(argv[2]);
+
+    try {
+        // a sorted file list keeps the pack reproducible
+        std::vector<std::filesystem::path> files;
+        for (const auto& entry : std::filesystem::recursive_directory_iterator(root)) {
+            if (entry.is_regular_file()) {
+                files.push_back(entry.path());
+            }
+        }
+        std::sort(files.begin(), files.end());
+
+        AssetPackWriter writer;
+        for (const auto& file : files) {
+            std::ifstream stream(file, std::ios::binary);
+            if (!stream.is_open()) {
+                throw IOException("Failed to open asset: " + file.string());
+            }
+            std::vector<char> content(std::filesystem::file_size(file));
+            stream.read(content.data(), static_cast<std::streamsize>(content.size()));
+            if (!stream.good() || static_cast<std::size_t>(stream.gcount()) != content.size()) {
+                throw IOException("Failed to read asset: " + file.string());
+            }
+
+            const auto path = std::filesystem::relative(file, root).generic_string();
+            const auto compression = shouldCompress(file) ? AssetCompression::Lz4 : AssetCompression::None;
+            writer.add(path, std::as_bytes(std::span(content)), compression);
+            std::cout << "  " << path << " (" << content.size() << " bytes)" << std::endl;
+        }
+
+        writer.write(output.string());
+        std::cout << "Packed " << files.size() << " file(s) into " << output.string() << std::endl;
+    } catch (const RuntimeException& exception) {
+        std::cerr << "Failed to create asset pack: " << exception.getMessage() << std::endl;
+        return 1;
+    } catch (const std::exception& exception) {
+        std::cerr << "Failed to create asset pack: " << exception.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}